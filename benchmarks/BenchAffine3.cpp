@@ -0,0 +1,119 @@
+#include <fuse/math/Affine3.h>
+#include <fuse/math/Angle.h>
+#include <fuse/math/Mat4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+// A scene graph like chain: each node is a translation and a rotation relative to its parent.
+// Same transformations as the boxes of the testbed.
+std::vector<Affine3> makeLocalTransforms(std::size_t count) {
+    std::vector<Affine3> transforms(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f  = static_cast<float>(i);
+        transforms[i] = Affine3::CreateTranslation({0.f, 0.f, 1.f}) *
+                        Affine3::CreateRotation(degrees(f), {0.f, 1.f, 0.f});
+    }
+    return transforms;
+}
+
+void BM_Chain_Mat4(benchmark::State& state) {
+    std::vector<Mat4> locals;
+    for (const auto& local : makeLocalTransforms(static_cast<std::size_t>(state.range(0)))) {
+        locals.push_back(local.toMat4());
+    }
+    std::vector<Mat4> worlds(locals.size());
+    for (auto _ : state) {
+        Mat4 world = Mat4::kIdentity;
+        for (std::size_t i = 0; i < locals.size(); i++) {
+            world *= locals[i];
+            worlds[i] = world;
+        }
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Chain_Affine3(benchmark::State& state) {
+    const auto           locals = makeLocalTransforms(static_cast<std::size_t>(state.range(0)));
+    std::vector<Affine3> worlds(locals.size());
+    for (auto _ : state) {
+        Affine3 world = Affine3::kIdentity;
+        for (std::size_t i = 0; i < locals.size(); i++) {
+            world *= locals[i];
+            worlds[i] = world;
+        }
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Composition then conversion for the upload, what the testbed does each frame.
+void BM_Chain_Affine3_ToMat4(benchmark::State& state) {
+    const auto        locals = makeLocalTransforms(static_cast<std::size_t>(state.range(0)));
+    std::vector<Mat4> worlds(locals.size());
+    for (auto _ : state) {
+        Affine3 world = Affine3::kIdentity;
+        for (std::size_t i = 0; i < locals.size(); i++) {
+            world *= locals[i];
+            worlds[i] = world.toMat4();
+        }
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Inverse_Mat4(benchmark::State& state) {
+    auto m = (Affine3::CreateTranslation({1.f, 2.f, 3.f}) *
+              Affine3::CreateRotation(degrees(30.f), {1.f, 1.f, 0.f}))
+               .toMat4();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.inverse());
+    }
+}
+
+void BM_Inverse_Affine3(benchmark::State& state) {
+    auto m = Affine3::CreateTranslation({1.f, 2.f, 3.f}) *
+             Affine3::CreateRotation(degrees(30.f), {1.f, 1.f, 0.f});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.inverse());
+    }
+}
+
+void BM_Inverse_Affine3_Rigid(benchmark::State& state) {
+    auto m = Affine3::CreateTranslation({1.f, 2.f, 3.f}) *
+             Affine3::CreateRotation(degrees(30.f), {1.f, 1.f, 0.f});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.inverseRigid());
+    }
+}
+
+void BM_Inverse_Affine3_Orthogonal(benchmark::State& state) {
+    const auto rotation = Mat3::CreateRotation(degrees(30.f), {1.f, 1.f, 0.f});
+    auto       m        = Affine3::CreateTRS({1.f, 2.f, 3.f}, rotation, {2.f, 3.f, 4.f});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(m.inverseOrthogonal());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Chain_Mat4)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Chain_Affine3)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Chain_Affine3_ToMat4)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Inverse_Mat4);
+BENCHMARK(BM_Inverse_Affine3);
+BENCHMARK(BM_Inverse_Affine3_Rigid);
+BENCHMARK(BM_Inverse_Affine3_Orthogonal);
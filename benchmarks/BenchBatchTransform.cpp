@@ -0,0 +1,110 @@
+#include <fuse/JobSystem.h>
+#include <fuse/math/BatchTransform.h>
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Vec3.h>
+#include <fuse/math/Vec4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+const Mat4 kMatrix =
+  Mat4::CreateTranslation(Vec3(1.f, 2.f, 3.f)) * Mat4::CreateScaling(Vec3(2.f));
+
+std::vector<Vec3> makePoints(std::size_t count) {
+    std::vector<Vec3> points(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        points[i]    = Vec3(f, f * 0.5f, -f);
+    }
+    return points;
+}
+
+// Baseline: one operator*(const Mat4&, const Vec4&) call per point.
+void BM_TransformPoints_PerElement(benchmark::State& state) {
+    const auto        points = makePoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3> results(points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); i++) {
+            const Vec4 r = kMatrix * Vec4(points[i].x, points[i].y, points[i].z, 1.f);
+            results[i]   = Vec3(r.x, r.y, r.z);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TransformPoints(benchmark::State& state) {
+    const auto        points = makePoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3> results(points.size());
+    for (auto _ : state) {
+        transformPoints(kMatrix, points, results);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TransformPoints_Threaded(benchmark::State& state) {
+    const auto         points = makePoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3>  results(points.size());
+    JobSystem          jobs;
+    const BatchOptions options{.jobs = &jobs};
+    for (auto _ : state) {
+        transformPoints(kMatrix, points, results, options);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TransformDirections(benchmark::State& state) {
+    const auto        directions = makePoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3> results(directions.size());
+    for (auto _ : state) {
+        transformDirections(kMatrix, directions, results);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TransformVec4_PerElement(benchmark::State& state) {
+    const std::vector<Vec4> vectors(static_cast<std::size_t>(state.range(0)),
+                                    Vec4(1.f, 2.f, 3.f, 1.f));
+    std::vector<Vec4>       results(vectors.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); i++) {
+            results[i] = kMatrix * vectors[i];
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TransformVec4(benchmark::State& state) {
+    const std::vector<Vec4> vectors(static_cast<std::size_t>(state.range(0)),
+                                    Vec4(1.f, 2.f, 3.f, 1.f));
+    std::vector<Vec4>       results(vectors.size());
+    for (auto _ : state) {
+        transformVec4(kMatrix, vectors, results);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_TransformPoints_PerElement)->Arg(7)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_TransformPoints)->Arg(7)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_TransformPoints_Threaded)->Arg(1 << 16)->Arg(1 << 20)->UseRealTime();
+BENCHMARK(BM_TransformDirections)->Arg(7)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_TransformVec4_PerElement)->Arg(7)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_TransformVec4)->Arg(7)->Arg(1024)->Arg(1 << 16);
@@ -0,0 +1,122 @@
+#include <fuse/EventBus.h>
+
+#include <SDL3/SDL.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+// A frame with a flood of mouse motions and a few key presses, delivered to `range(0)` layers
+// of which one handles the mouse and one the keyboard: the former virtual call per layer and
+// per event against the event bus.
+
+constexpr int kMotions = 256;
+constexpr int kKeys    = 4;
+
+std::vector<SDL_Event> frameEvents() {
+    std::vector<SDL_Event> events;
+    for (int i = 0; i < kMotions; i++) {
+        SDL_Event e{};
+        e.motion.type = SDL_EVENT_MOUSE_MOTION;
+        e.motion.xrel = 1.0f;
+        events.push_back(e);
+        if (i % (kMotions / kKeys) == 0) {
+            SDL_Event key{};
+            key.type = SDL_EVENT_KEY_DOWN;
+            events.push_back(key);
+        }
+    }
+    return events;
+}
+
+class VirtualLayer {
+public:
+    virtual ~VirtualLayer()                      = default;
+    virtual bool onEvent(const SDL_Event& event) = 0;
+};
+
+class IgnoringLayer final : public VirtualLayer {
+public:
+    bool onEvent(const SDL_Event& event) override {
+        return event.type == SDL_EVENT_QUIT;
+    }
+};
+
+class CameraLayer final : public VirtualLayer {
+public:
+    bool onEvent(const SDL_Event& event) override {
+        if (event.type == SDL_EVENT_MOUSE_MOTION) {
+            yaw += event.motion.xrel;
+        } else if (event.type == SDL_EVENT_KEY_DOWN) {
+            keys++;
+        }
+        return false;
+    }
+
+    bool onMotion(const SDL_Event& event) {
+        yaw += event.motion.xrel;
+        return false;
+    }
+
+    bool onKey(const SDL_Event&) {
+        keys++;
+        return false;
+    }
+
+    float yaw{0.0f};
+    int   keys{0};
+};
+
+void BM_EventBus_VirtualFanOut(benchmark::State& state) {
+    const auto                                 events = frameEvents();
+    std::vector<std::unique_ptr<VirtualLayer>> layers;
+    auto*                                      camera = new CameraLayer();
+    layers.emplace_back(camera);
+    for (std::int64_t i = 1; i < state.range(0); i++) {
+        layers.push_back(std::make_unique<IgnoringLayer>());
+    }
+    for (auto _ : state) {
+        for (const SDL_Event& event : events) {
+            for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
+                if ((*it)->onEvent(event)) {
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(camera->yaw);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(events.size()));
+}
+
+void BM_EventBus_Dispatch(benchmark::State& state) {
+    const auto  events = frameEvents();
+    EventBus    bus;
+    CameraLayer camera;
+    auto        motion = bus.subscribe<&CameraLayer::onMotion>(SDL_EVENT_MOUSE_MOTION, &camera);
+    auto        key    = bus.subscribe<&CameraLayer::onKey>(SDL_EVENT_KEY_DOWN, &camera);
+    // The other layers subscribe to types absent from the frame.
+    std::vector<CameraLayer>       others(static_cast<std::size_t>(state.range(0)));
+    std::vector<EventSubscription> subscriptions;
+    for (CameraLayer& other : others) {
+        subscriptions.push_back(bus.subscribe<&CameraLayer::onKey>(SDL_EVENT_KEY_UP, &other));
+    }
+    bus.setCoalescing(state.range(1) != 0);
+    for (auto _ : state) {
+        for (const SDL_Event& event : events) {
+            bus.enqueue(event);
+        }
+        bus.dispatch();
+        benchmark::DoNotOptimize(camera.yaw);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(events.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_EventBus_VirtualFanOut)->Arg(4)->Arg(32);
+BENCHMARK(BM_EventBus_Dispatch)->ArgsProduct({{4, 32}, {0, 1}});
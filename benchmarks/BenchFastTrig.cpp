@@ -0,0 +1,78 @@
+#include <fuse/math/Angle.h>
+#include <fuse/math/FastTrig.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+// The angles of the vertices of a sphere, what GeometryGenerator computes.
+std::vector<Angle> makeAngles(std::size_t count) {
+    std::vector<Angle> angles(count);
+    for (std::size_t i = 0; i < count; i++) {
+        angles[i] = degrees(static_cast<float>(i) * 0.37f - 720.f);
+    }
+    return angles;
+}
+
+void BM_SinCos_Libm(benchmark::State& state) {
+    const auto         angles = makeAngles(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> sin(angles.size());
+    std::vector<float> cos(angles.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < angles.size(); i++) {
+            sin[i] = std::sin(angles[i]);
+            cos[i] = std::cos(angles[i]);
+        }
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <TrigPrecision kPrecision>
+void BM_SinCos_Fast(benchmark::State& state) {
+    const auto         angles = makeAngles(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> sin(angles.size());
+    std::vector<float> cos(angles.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < angles.size(); i++) {
+            const auto r = sincos<kPrecision>(angles[i]);
+            sin[i]       = r.sin;
+            cos[i]       = r.cos;
+        }
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <TrigPrecision kPrecision>
+void BM_SinCos_Batch(benchmark::State& state) {
+    const auto         angles = makeAngles(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> sin(angles.size());
+    std::vector<float> cos(angles.size());
+    for (auto _ : state) {
+        sincos(angles, sin, cos, kPrecision);
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_SinCos_Libm)->Arg(4096);
+BENCHMARK(BM_SinCos_Fast<TrigPrecision::Low>)->Arg(4096);
+BENCHMARK(BM_SinCos_Fast<TrigPrecision::Medium>)->Arg(4096);
+BENCHMARK(BM_SinCos_Fast<TrigPrecision::High>)->Arg(4096);
+BENCHMARK(BM_SinCos_Batch<TrigPrecision::Low>)->Arg(4096);
+BENCHMARK(BM_SinCos_Batch<TrigPrecision::Medium>)->Arg(4096);
+BENCHMARK(BM_SinCos_Batch<TrigPrecision::High>)->Arg(4096);
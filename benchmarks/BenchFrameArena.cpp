@@ -0,0 +1,70 @@
+#include <fuse/FrameArena.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <vector>
+
+using namespace fuse;
+
+// Short-lived allocations of a frame: the arena of the thread against the default heap, whose
+// allocator is shared by the threads.
+
+namespace {
+
+constexpr int kAllocationsPerFrame = 256;
+
+} // namespace
+
+static void BM_FrameArena_Allocate(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        resetFrameArenas();
+        FrameArena& arena = frameArena();
+        for (int i = 0; i < kAllocationsPerFrame; i++) {
+            void* p = arena.allocate(size);
+            benchmark::DoNotOptimize(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocationsPerFrame);
+}
+BENCHMARK(BM_FrameArena_Allocate)->Arg(32)->Arg(512)->ThreadRange(1, 8);
+
+static void BM_FrameArena_Heap(benchmark::State& state) {
+    const auto         size = static_cast<std::size_t>(state.range(0));
+    std::vector<void*> allocations(kAllocationsPerFrame);
+    for (auto _ : state) {
+        for (void*& p : allocations) {
+            p = ::operator new(size);
+            benchmark::DoNotOptimize(p);
+        }
+        for (void* p : allocations) {
+            ::operator delete(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kAllocationsPerFrame);
+}
+BENCHMARK(BM_FrameArena_Heap)->Arg(32)->Arg(512)->ThreadRange(1, 8);
+
+static void BM_FrameArena_PmrVector(benchmark::State& state) {
+    for (auto _ : state) {
+        resetFrameArenas();
+        std::pmr::vector<int> values(frameMemoryResource());
+        for (int i = 0; i < 1000; i++) {
+            values.push_back(i);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_FrameArena_PmrVector)->ThreadRange(1, 8);
+
+static void BM_FrameArena_StdVector(benchmark::State& state) {
+    for (auto _ : state) {
+        std::vector<int> values;
+        for (int i = 0; i < 1000; i++) {
+            values.push_back(i);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_FrameArena_StdVector)->ThreadRange(1, 8);
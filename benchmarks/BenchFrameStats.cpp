@@ -0,0 +1,31 @@
+#include <fuse/FrameStats.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace fuse;
+
+// addFrame() runs once per frame in the main loop, summary() each frame the testbed shows the
+// percentiles: a sort of the window.
+
+static void BM_FrameStats_AddFrame(benchmark::State& state) {
+    FrameStats      stats;
+    FramePhaseTimes phases{};
+    double          ms = 0.0;
+    for (auto _ : state) {
+        ms = ms < 40.0 ? ms + 0.37 : 1.0;
+        stats.addFrame(ms / 1000.0, phases);
+    }
+    benchmark::DoNotOptimize(stats.frameCount());
+}
+BENCHMARK(BM_FrameStats_AddFrame);
+
+static void BM_FrameStats_Summary(benchmark::State& state) {
+    FrameStats stats(static_cast<std::size_t>(state.range(0)));
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        stats.addFrame(static_cast<double>((i * 7919) % 40 + 1) / 1000.0);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(stats.summary());
+    }
+}
+BENCHMARK(BM_FrameStats_Summary)->Arg(256)->Arg(1024)->Arg(4096);
@@ -0,0 +1,106 @@
+#include <fuse/math/AABB.h>
+#include <fuse/math/Angle.h>
+#include <fuse/math/BoundingSphere.h>
+#include <fuse/math/Frustum.h>
+#include <fuse/math/Mat4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+// A camera in the middle of a scene, about a quarter of the objects are visible.
+Frustum makeFrustum() {
+    const Mat4 projection = Mat4::CreateProjectionPerspectiveFOVY(degrees(60), 16.f / 9.f, 0.1f, 500.f);
+    const Mat4 view       = Mat4::CreateViewLookAt({0.f, 10.f, 0.f}, {100.f, 0.f, 100.f});
+    return Frustum::FromMatrix(projection * view);
+}
+
+std::vector<BoundingSphere> makeSpheres(std::size_t count) {
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> position(-500.f, 500.f);
+    std::uniform_real_distribution<float> radius(0.5f, 5.f);
+    std::vector<BoundingSphere>           spheres(count);
+    for (auto& sphere : spheres) {
+        sphere = {{position(rng), position(rng) * 0.1f, position(rng)}, radius(rng)};
+    }
+    return spheres;
+}
+
+std::vector<AABB> makeBoxes(std::size_t count) {
+    std::vector<AABB> boxes;
+    boxes.reserve(count);
+    for (const auto& sphere : makeSpheres(count)) {
+        boxes.push_back(
+          AABB::FromCenterExtents(sphere.center, {sphere.radius, sphere.radius, sphere.radius}));
+    }
+    return boxes;
+}
+
+template <typename Bound>
+void cullLoop(const Frustum& frustum, const std::vector<Bound>& bounds,
+              std::vector<std::uint32_t>& visibility) {
+    std::fill(visibility.begin(), visibility.end(), 0u);
+    for (std::size_t i = 0; i < bounds.size(); i++) {
+        visibility[i / 32] |= static_cast<std::uint32_t>(frustum.intersects(bounds[i])) << (i % 32);
+    }
+}
+
+void BM_CullSpheres_Loop(benchmark::State& state) {
+    const auto                 frustum = makeFrustum();
+    const auto                 spheres = makeSpheres(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> visibility(visibilityMaskSize(spheres.size()));
+    for (auto _ : state) {
+        cullLoop(frustum, spheres, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CullSpheres_Batch(benchmark::State& state) {
+    const auto                 frustum = makeFrustum();
+    const auto                 spheres = makeSpheres(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> visibility(visibilityMaskSize(spheres.size()));
+    for (auto _ : state) {
+        cull(frustum, spheres, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CullBoxes_Loop(benchmark::State& state) {
+    const auto                 frustum = makeFrustum();
+    const auto                 boxes   = makeBoxes(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> visibility(visibilityMaskSize(boxes.size()));
+    for (auto _ : state) {
+        cullLoop(frustum, boxes, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CullBoxes_Batch(benchmark::State& state) {
+    const auto                 frustum = makeFrustum();
+    const auto                 boxes   = makeBoxes(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::uint32_t> visibility(visibilityMaskSize(boxes.size()));
+    for (auto _ : state) {
+        cull(frustum, boxes, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_CullSpheres_Loop)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(BM_CullSpheres_Batch)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(BM_CullBoxes_Loop)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+BENCHMARK(BM_CullBoxes_Batch)->RangeMultiplier(10)->Range(10'000, 1'000'000);
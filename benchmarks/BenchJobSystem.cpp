@@ -0,0 +1,82 @@
+#include <fuse/JobSystem.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Register the benchmark with 1 to N threads, the calling thread and the workers.
+void ThreadCounts(benchmark::internal::Benchmark* benchmark) {
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned count = 1; count <= threads; count *= 2) {
+        benchmark->Arg(count);
+    }
+    if ((threads & (threads - 1)) != 0) {
+        benchmark->Arg(threads);
+    }
+    benchmark->UseRealTime();
+}
+
+/// @brief Some math on each element, enough to be bound by the computation.
+void compute(std::vector<float>& values, std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; i++) {
+        float x = values[i];
+        for (int k = 0; k < 16; k++) {
+            x = std::sqrt(x * x + 1.f) * 0.5f;
+        }
+        values[i] = x;
+    }
+}
+
+void BM_ParallelFor_Compute(benchmark::State& state) {
+    JobSystem          jobs(static_cast<unsigned>(state.range(0) - 1));
+    std::vector<float> values(1 << 20, 1.f);
+    for (auto _ : state) {
+        jobs.parallelFor(0, values.size(), [&](std::size_t first, std::size_t last) {
+            compute(values, first, last);
+        });
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+
+void BM_ParallelFor_Memory(benchmark::State& state) {
+    // Bound by the memory bandwidth, scales less than the computation.
+    JobSystem          jobs(static_cast<unsigned>(state.range(0) - 1));
+    std::vector<float> values(1 << 22, 1.f);
+    for (auto _ : state) {
+        jobs.parallelFor(0, values.size(), [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; i++) {
+                values[i] = values[i] * 0.5f + 1.f;
+            }
+        });
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+
+void BM_Schedule_Empty(benchmark::State& state) {
+    // Cost of scheduling, stealing and running a job doing nothing.
+    JobSystem  jobs(static_cast<unsigned>(state.range(0) - 1));
+    JobCounter counter;
+    for (auto _ : state) {
+        for (int i = 0; i < 1000; i++) {
+            jobs.schedule([] {}, &counter);
+        }
+        jobs.wait(counter);
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+
+} // namespace
+
+BENCHMARK(BM_ParallelFor_Compute)->Apply(ThreadCounts);
+BENCHMARK(BM_ParallelFor_Memory)->Apply(ThreadCounts);
+BENCHMARK(BM_Schedule_Empty)->Apply(ThreadCounts);
@@ -0,0 +1,133 @@
+#include <fuse/Layer.h>
+#include <fuse/LayerStack.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace fuse;
+
+namespace {
+
+// A layer with a little state, the benchmark measures the virtual dispatch of the stack.
+class CounterLayer final : public Layer {
+public:
+    void onFixedUpdate(Time step) override { mSimulated += step.asSeconds(); }
+    void onUpdate(Time deltaTime) override { mElapsed += deltaTime.asSeconds(); }
+    void onRender(float /*alpha*/) override { mFrames++; }
+    void onImGui() override { benchmark::DoNotOptimize(mFrames); }
+
+private:
+    double   mSimulated{};
+    double   mElapsed{};
+    unsigned mFrames{};
+};
+
+void fillStack(LayerStack& stack, std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+        if (i % 4 == 3) {
+            stack.pushOverlay(new CounterLayer());
+        } else {
+            stack.pushLayer(new CounterLayer());
+        }
+    }
+}
+
+// One frame of the application loop: fixed update, update, render and ImGui on each layer.
+void BM_LayerStack_Frame(benchmark::State& state) {
+    LayerStack stack;
+    fillStack(stack, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (Layer* layer : stack) {
+            layer->onFixedUpdate(Time(1.0 / 60.0));
+        }
+        for (Layer* layer : stack) {
+            layer->onUpdate(Time(1.0 / 60.0));
+        }
+        for (Layer* layer : stack) {
+            layer->onRender(0.f);
+        }
+        for (Layer* layer : stack) {
+            layer->onImGui();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// An editor overlay: only draws its window.
+class PanelLayer final : public Layer {
+public:
+    void onImGui() override { benchmark::DoNotOptimize(++mDraws); }
+
+private:
+    unsigned mDraws{};
+};
+
+// The editor: 2 full layers under 30 overlays overriding only onImGui(), 6 of them hidden.
+void fillEditor(LayerStack& stack) {
+    stack.pushLayer(new CounterLayer());
+    stack.pushLayer(new CounterLayer());
+    for (int i = 0; i < 30; i++) {
+        auto* panel = new PanelLayer();
+        stack.pushOverlay(panel);
+        if (i % 5 == 4) {
+            stack.setEnabled(panel, false);
+        }
+    }
+}
+
+// The editor frame with a call of every callback of every layer, hidden or not, as the loop
+// of the application used to do.
+void BM_LayerStack_EditorAllLayers(benchmark::State& state) {
+    LayerStack stack;
+    fillEditor(stack);
+    for (auto _ : state) {
+        for (Layer* layer : stack) {
+            layer->onFixedUpdate(Time(1.0 / 60.0));
+        }
+        for (Layer* layer : stack) {
+            layer->onUpdate(Time(1.0 / 60.0));
+        }
+        for (Layer* layer : stack) {
+            layer->onRender(0.f);
+        }
+        for (Layer* layer : stack) {
+            layer->onImGui();
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// The editor frame through the dispatch lists of the stack.
+void BM_LayerStack_EditorDispatch(benchmark::State& state) {
+    LayerStack stack;
+    fillEditor(stack);
+    for (auto _ : state) {
+        stack.forEach(LayerPhase::FixedUpdate,
+                      [](Layer* layer) { layer->onFixedUpdate(Time(1.0 / 60.0)); });
+        stack.forEach(LayerPhase::Update, [](Layer* layer) { layer->onUpdate(Time(1.0 / 60.0)); });
+        stack.forEach(LayerPhase::Render, [](Layer* layer) { layer->onRender(0.f); });
+        stack.forEach(LayerPhase::ImGui, [](Layer* layer) { layer->onImGui(); });
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_LayerStack_PushPop(benchmark::State& state) {
+    LayerStack stack;
+    fillStack(stack, static_cast<std::size_t>(state.range(0)));
+    // Not owned by the stack, it is popped before the stack is destroyed.
+    CounterLayer layer;
+    for (auto _ : state) {
+        stack.pushLayer(&layer);
+        stack.popLayer(&layer);
+        stack.pushOverlay(&layer);
+        stack.popOverlay(&layer);
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+
+} // namespace
+
+BENCHMARK(BM_LayerStack_Frame)->Arg(4)->Arg(64);
+BENCHMARK(BM_LayerStack_EditorAllLayers);
+BENCHMARK(BM_LayerStack_EditorDispatch);
+BENCHMARK(BM_LayerStack_PushPop)->Arg(4)->Arg(64);
@@ -0,0 +1,161 @@
+#include <fuse/BinaryLog.h>
+#include <fuse/LogSink.h>
+#include <fuse/Logger.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+
+#if defined(_WIN32)
+#    include <io.h>
+#    define FUSE_BENCH_DUP  _dup
+#    define FUSE_BENCH_DUP2 _dup2
+#    define FUSE_BENCH_NULL "NUL"
+#else
+#    include <unistd.h>
+#    define FUSE_BENCH_DUP  dup
+#    define FUSE_BENCH_DUP2 dup2
+#    define FUSE_BENCH_NULL "/dev/null"
+#endif
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Redirect stdout to the null device while alive.
+/// The logger prints on stdout, it would mix with the benchmark report.
+/// The measure still include the formatting and the write to the stream.
+class SilenceStdout {
+public:
+    SilenceStdout() {
+        std::fflush(stdout);
+        mSaved = FUSE_BENCH_DUP(fileno(stdout));
+        mNull  = std::fopen(FUSE_BENCH_NULL, "w");
+        if (mNull) {
+            FUSE_BENCH_DUP2(fileno(mNull), fileno(stdout));
+        }
+    }
+
+    ~SilenceStdout() {
+        std::fflush(stdout);
+        if (mNull) {
+            FUSE_BENCH_DUP2(mSaved, fileno(stdout));
+            std::fclose(mNull);
+        }
+    }
+
+    SilenceStdout(const SilenceStdout&)            = delete;
+    SilenceStdout& operator=(const SilenceStdout&) = delete;
+
+private:
+    int   mSaved{-1};
+    FILE* mNull{};
+};
+
+/// @brief Discard the messages, the asynchronous benchmarks measure the cost for the caller.
+class NullSink final : public LogSink {
+public:
+    void write(const LogRecord& record) override { benchmark::DoNotOptimize(record.message); }
+};
+
+void initializeAsync(const benchmark::State& /*state*/) {
+    log_initialize({.capacity = 8192, .overflow = LogOverflow::Drop, .console = false});
+    log_add_sink(std::make_unique<NullSink>());
+}
+
+void shutdownAsync(const benchmark::State& /*state*/) { log_shutdown(); }
+
+std::filesystem::path binaryLogPath() {
+    return std::filesystem::temp_directory_path() / "FuseBenchLogger.blog";
+}
+
+void initializeBinary(const benchmark::State& /*state*/) {
+    binary_log_initialize({.path = binaryLogPath()});
+}
+
+void shutdownBinary(const benchmark::State& /*state*/) {
+    binary_log_shutdown();
+    std::filesystem::remove(binaryLogPath());
+}
+
+// Synchronous logging, before log_initialize(): formatted and printed by the caller.
+void BM_Logger_Message(benchmark::State& state) {
+    const SilenceStdout silence;
+    for (auto _ : state) {
+        log_message(LogLevel::Info, "Frame rendered");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Logger_Formatted(benchmark::State& state) {
+    const SilenceStdout silence;
+    int                 frame = 0;
+    for (auto _ : state) {
+        log_message(LogLevel::Info, "Frame {} rendered in {:.3f} ms ({})", frame++, 16.667, "vsync");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Asynchronous logging: the caller formats and copies the message in the queue.
+void BM_Logger_AsyncFormatted(benchmark::State& state) {
+    int frame = 0;
+    for (auto _ : state) {
+        log_message(LogLevel::Info, "Frame {} rendered in {:.3f} ms ({})", frame++, 16.667, "vsync");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Many threads logging at once, the throughput of the queue with contended producers.
+// The messages which do not fit are dropped and counted, as in a burst in the application.
+void BM_Logger_AsyncThroughput(benchmark::State& state) {
+    int frame = 0;
+    for (auto _ : state) {
+        log_message(LogLevel::Info, "Thread {} frame {}", state.thread_index(), frame++);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        state.counters["dropped"] = static_cast<double>(log_stats().dropped);
+    }
+}
+
+// Binary logging: the id of the format, a timestamp and the raw arguments, nothing is formatted.
+void BM_Logger_Binary(benchmark::State& state) {
+    int frame = 0;
+    for (auto _ : state) {
+        FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Frame {} rendered in {:.3f} ms ({})",
+                        frame++, 16.667, "vsync");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A message of a category disabled at runtime: a load and a branch, nothing is formatted.
+void BM_Logger_Filtered(benchmark::State& state) {
+    log_set_level(LogCategory::Render, LogLevel::Warn);
+    int frame = 0;
+    for (auto _ : state) {
+        log_message(LogCategory::Render, LogLevel::Debug, "Frame {} rendered in {:.3f} ms ({})",
+                    frame++, 16.667, "vsync");
+        benchmark::ClobberMemory();
+    }
+    log_set_level(LogCategory::Render, kCompiledLogLevel);
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_Logger_Message);
+BENCHMARK(BM_Logger_Formatted);
+BENCHMARK(BM_Logger_Filtered);
+BENCHMARK(BM_Logger_AsyncFormatted)->Setup(initializeAsync)->Teardown(shutdownAsync);
+BENCHMARK(BM_Logger_Binary)
+  ->Setup(initializeBinary)
+  ->Teardown(shutdownBinary)
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+BENCHMARK(BM_Logger_AsyncThroughput)
+  ->Setup(initializeAsync)
+  ->Teardown(shutdownAsync)
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
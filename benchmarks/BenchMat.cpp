@@ -0,0 +1,126 @@
+#include <fuse/math/Angle.h>
+#include <fuse/math/Mat2.h>
+#include <fuse/math/Mat3.h>
+#include <fuse/math/Mat4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace fuse;
+
+// The Mat4 multiply, inverse and transform are in BenchMat4.cpp.
+namespace {
+
+template <typename M>
+std::vector<M> makeRandomMatrices(std::size_t count) {
+    constexpr unsigned                    kSize = sizeof(M) / sizeof(float);
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+    std::vector<M>                        matrices(count);
+    for (auto& m : matrices) {
+        for (unsigned i = 0; i < kSize; i++) {
+            m.data()[i] = dist(rng);
+        }
+    }
+    return matrices;
+}
+
+// Apply a unary operation on N matrices.
+template <typename M, typename Fn>
+void unaryOp(benchmark::State& state, Fn&& op) {
+    const auto matrices = makeRandomMatrices<M>(static_cast<std::size_t>(state.range(0)));
+    std::vector<decltype(op(matrices[0]))> results(matrices.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); i++) {
+            results[i] = op(matrices[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Apply a binary operation on N pairs of matrices.
+template <typename M, typename Fn>
+void binaryOp(benchmark::State& state, Fn&& op) {
+    const auto a = makeRandomMatrices<M>(static_cast<std::size_t>(state.range(0)));
+    const auto b = makeRandomMatrices<M>(a.size());
+    std::vector<decltype(op(a[0], b[0]))> results(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); i++) {
+            results[i] = op(a[i], b[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Mat2_Multiply(benchmark::State& state) {
+    binaryOp<Mat2>(state, [](const Mat2& a, const Mat2& b) { return a * b; });
+}
+
+void BM_Mat2_MultiplyVec2(benchmark::State& state) {
+    unaryOp<Mat2>(state, [](const Mat2& m) { return m * Vec2(1.f, 2.f); });
+}
+
+void BM_Mat2_Inverse(benchmark::State& state) {
+    unaryOp<Mat2>(state, [](const Mat2& m) { return m.inverse(); });
+}
+
+void BM_Mat3_Multiply(benchmark::State& state) {
+    binaryOp<Mat3>(state, [](const Mat3& a, const Mat3& b) { return a * b; });
+}
+
+void BM_Mat3_MultiplyVec3(benchmark::State& state) {
+    unaryOp<Mat3>(state, [](const Mat3& m) { return m * Vec3(1.f, 2.f, 3.f); });
+}
+
+void BM_Mat3_Inverse(benchmark::State& state) {
+    unaryOp<Mat3>(state, [](const Mat3& m) { return m.inverse(); });
+}
+
+void BM_Mat3_Determinant(benchmark::State& state) {
+    unaryOp<Mat3>(state, [](const Mat3& m) { return m.determinant(); });
+}
+
+void BM_Mat3_Transpose(benchmark::State& state) {
+    unaryOp<Mat3>(state, [](const Mat3& m) { return m.transpose(); });
+}
+
+void BM_Mat4_Determinant(benchmark::State& state) {
+    unaryOp<Mat4>(state, [](const Mat4& m) { return m.determinant(); });
+}
+
+void BM_Mat4_Transpose(benchmark::State& state) {
+    unaryOp<Mat4>(state, [](const Mat4& m) { return m.transpose(); });
+}
+
+void BM_Mat4_CreateRotation(benchmark::State& state) {
+    unaryOp<Mat4>(state, [](const Mat4& m) {
+        return Mat4::CreateRotation(radians(m(0, 0)), Vec3(0.f, 1.f, 0.f));
+    });
+}
+
+void BM_Mat4_CreateViewLookAt(benchmark::State& state) {
+    unaryOp<Mat4>(state, [](const Mat4& m) {
+        return Mat4::CreateViewLookAt(Vec3(m(0, 0), m(1, 0), m(2, 0)), Vec3::kZero, Vec3::kUnitY);
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_Mat2_Multiply)->Arg(1024);
+BENCHMARK(BM_Mat2_MultiplyVec2)->Arg(1024);
+BENCHMARK(BM_Mat2_Inverse)->Arg(1024);
+BENCHMARK(BM_Mat3_Multiply)->Arg(1024);
+BENCHMARK(BM_Mat3_MultiplyVec3)->Arg(1024);
+BENCHMARK(BM_Mat3_Inverse)->Arg(1024);
+BENCHMARK(BM_Mat3_Determinant)->Arg(1024);
+BENCHMARK(BM_Mat3_Transpose)->Arg(1024);
+BENCHMARK(BM_Mat4_Determinant)->Arg(1024);
+BENCHMARK(BM_Mat4_Transpose)->Arg(1024);
+BENCHMARK(BM_Mat4_CreateRotation)->Arg(1024);
+BENCHMARK(BM_Mat4_CreateViewLookAt)->Arg(1024);
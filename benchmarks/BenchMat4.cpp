@@ -0,0 +1,217 @@
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Vec4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+#if defined(_MSC_VER)
+#    define FUSE_BENCH_NOINLINE __declspec(noinline)
+#else
+#    define FUSE_BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+/// @brief The scalar implementation of Mat4 before the SIMD kernels.
+/// Used as a baseline to measure the speedup.
+/// Like the library, the functions are not inlined in the benchmark loop.
+namespace reference {
+
+FUSE_BENCH_NOINLINE Mat4 multiply(const Mat4& m, const Mat4& other) {
+    Mat4 r;
+    for (unsigned row = 0; row < 4; row++) {
+        for (unsigned col = 0; col < 4; col++) {
+            r(row, col) = m(row, 0) * other(0, col) + m(row, 1) * other(1, col) +
+                          m(row, 2) * other(2, col) + m(row, 3) * other(3, col);
+        }
+    }
+    return r;
+}
+
+FUSE_BENCH_NOINLINE Vec4 multiply(const Mat4& m, const Vec4& v) {
+    const auto x = m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z + m(0, 3) * v.w;
+    const auto y = m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z + m(1, 3) * v.w;
+    const auto z = m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z + m(2, 3) * v.w;
+    const auto w = m(3, 0) * v.x + m(3, 1) * v.y + m(3, 2) * v.z + m(3, 3) * v.w;
+    return {x, y, z, w};
+}
+
+FUSE_BENCH_NOINLINE Mat4 inverse(const Mat4& r) {
+    const float m00 = r(0, 0), m01 = r(0, 1), m02 = r(0, 2), m03 = r(0, 3);
+    const float m10 = r(1, 0), m11 = r(1, 1), m12 = r(1, 2), m13 = r(1, 3);
+    const float m20 = r(2, 0), m21 = r(2, 1), m22 = r(2, 2), m23 = r(2, 3);
+    const float m30 = r(3, 0), m31 = r(3, 1), m32 = r(3, 2), m33 = r(3, 3);
+
+    float v0 = m20 * m31 - m21 * m30;
+    float v1 = m20 * m32 - m22 * m30;
+    float v2 = m20 * m33 - m23 * m30;
+    float v3 = m21 * m32 - m22 * m31;
+    float v4 = m21 * m33 - m23 * m31;
+    float v5 = m22 * m33 - m23 * m32;
+
+    const float t00 = +(v5 * m11 - v4 * m12 + v3 * m13);
+    const float t10 = -(v5 * m10 - v2 * m12 + v1 * m13);
+    const float t20 = +(v4 * m10 - v2 * m11 + v0 * m13);
+    const float t30 = -(v3 * m10 - v1 * m11 + v0 * m12);
+
+    const float invDet = 1 / (t00 * m00 + t10 * m01 + t20 * m02 + t30 * m03);
+
+    const float d00 = t00 * invDet;
+    const float d10 = t10 * invDet;
+    const float d20 = t20 * invDet;
+    const float d30 = t30 * invDet;
+
+    const float d01 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const float d11 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const float d21 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const float d31 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    v0 = m10 * m31 - m11 * m30;
+    v1 = m10 * m32 - m12 * m30;
+    v2 = m10 * m33 - m13 * m30;
+    v3 = m11 * m32 - m12 * m31;
+    v4 = m11 * m33 - m13 * m31;
+    v5 = m12 * m33 - m13 * m32;
+
+    const float d02 = +(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const float d12 = -(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const float d22 = +(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const float d32 = -(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    v0 = m21 * m10 - m20 * m11;
+    v1 = m22 * m10 - m20 * m12;
+    v2 = m23 * m10 - m20 * m13;
+    v3 = m22 * m11 - m21 * m12;
+    v4 = m23 * m11 - m21 * m13;
+    v5 = m23 * m12 - m22 * m13;
+
+    const float d03 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const float d13 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const float d23 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const float d33 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    return {
+      // clang-format off
+        d00, d01, d02, d03,
+        d10, d11, d12, d13,
+        d20, d21, d22, d23,
+        d30, d31, d32, d33
+      // clang-format on
+    };
+}
+
+} // namespace reference
+
+template <typename T = float>
+std::vector<TMat4<T>> makeRandomMatrices(std::size_t count) {
+    std::mt19937                      rng(42);
+    std::uniform_real_distribution<T> dist(T(-10), T(10));
+    std::vector<TMat4<T>>             matrices(count);
+    for (auto& m : matrices) {
+        for (unsigned i = 0; i < 16; i++) {
+            m.data()[i] = dist(rng);
+        }
+    }
+    return matrices;
+}
+
+// Compose N model matrices with their parent, like a scene graph update.
+template <typename T = float, typename Fn>
+void composeMatrices(benchmark::State& state, Fn&& multiply) {
+    const auto            count   = static_cast<std::size_t>(state.range(0));
+    const auto            parents = makeRandomMatrices<T>(count);
+    const auto            locals  = makeRandomMatrices<T>(count);
+    std::vector<TMat4<T>> worlds(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; i++) {
+            worlds[i] = multiply(parents[i], locals[i]);
+        }
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T = float, typename Fn>
+void invertMatrices(benchmark::State& state, Fn&& inverse) {
+    const auto            count    = static_cast<std::size_t>(state.range(0));
+    const auto            matrices = makeRandomMatrices<T>(count);
+    std::vector<TMat4<T>> inverses(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; i++) {
+            inverses[i] = inverse(matrices[i]);
+        }
+        benchmark::DoNotOptimize(inverses.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T = float, typename Fn>
+void transformVectors(benchmark::State& state, Fn&& multiply) {
+    const auto            count  = static_cast<std::size_t>(state.range(0));
+    const TMat4<T>        matrix = makeRandomMatrices<T>(1).front();
+    std::vector<TVec4<T>> vectors(count, TVec4<T>(1, 2, 3, 1));
+    std::vector<TVec4<T>> results(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; i++) {
+            results[i] = multiply(matrix, vectors[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Mat4_Multiply_Reference(benchmark::State& state) {
+    composeMatrices(state, [](const Mat4& a, const Mat4& b) { return reference::multiply(a, b); });
+}
+
+void BM_Mat4_Multiply(benchmark::State& state) {
+    composeMatrices(state, [](const Mat4& a, const Mat4& b) { return a * b; });
+}
+
+void BM_Mat4_Inverse_Reference(benchmark::State& state) {
+    invertMatrices(state, [](const Mat4& m) { return reference::inverse(m); });
+}
+
+void BM_Mat4_Inverse(benchmark::State& state) {
+    invertMatrices(state, [](const Mat4& m) { return m.inverse(); });
+}
+
+void BM_Mat4_MultiplyVec4_Reference(benchmark::State& state) {
+    transformVectors(state, [](const Mat4& m, const Vec4& v) { return reference::multiply(m, v); });
+}
+
+void BM_Mat4_MultiplyVec4(benchmark::State& state) {
+    transformVectors(state, [](const Mat4& m, const Vec4& v) { return m * v; });
+}
+
+// Same workloads in double precision, to compare the cost of Mat4d with Mat4.
+void BM_Mat4d_Multiply(benchmark::State& state) {
+    composeMatrices<double>(state, [](const Mat4d& a, const Mat4d& b) { return a * b; });
+}
+
+void BM_Mat4d_Inverse(benchmark::State& state) {
+    invertMatrices<double>(state, [](const Mat4d& m) { return m.inverse(); });
+}
+
+void BM_Mat4d_MultiplyVec4(benchmark::State& state) {
+    transformVectors<double>(state, [](const Mat4d& m, const Vec4d& v) { return m * v; });
+}
+
+} // namespace
+
+BENCHMARK(BM_Mat4_Multiply_Reference)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4_Multiply)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4_Inverse_Reference)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4_Inverse)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4_MultiplyVec4_Reference)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4_MultiplyVec4)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4d_Multiply)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4d_Inverse)->Arg(1)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_Mat4d_MultiplyVec4)->Arg(1)->Arg(1024)->Arg(16384);
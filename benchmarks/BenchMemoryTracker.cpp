@@ -0,0 +1,34 @@
+#include <fuse/MemoryTracker.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+// Cost of the tracking: a vector filled and released with and without a TrackedAllocator. The
+// threads use the same tag to measure the contention on its counters.
+
+static void BM_MemoryTracker_Track(benchmark::State& state) {
+    for (auto _ : state) {
+        trackAllocation(MemTag::General, 64);
+        trackDeallocation(MemTag::General, 64);
+    }
+}
+BENCHMARK(BM_MemoryTracker_Track)->ThreadRange(1, 8);
+
+static void BM_MemoryTracker_TrackedVector(benchmark::State& state) {
+    for (auto _ : state) {
+        TrackedVector<int, MemTag::General> values(16);
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_MemoryTracker_TrackedVector)->ThreadRange(1, 8);
+
+static void BM_MemoryTracker_StdVector(benchmark::State& state) {
+    for (auto _ : state) {
+        std::vector<int> values(16);
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(BM_MemoryTracker_StdVector)->ThreadRange(1, 8);
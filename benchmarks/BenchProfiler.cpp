@@ -0,0 +1,59 @@
+#include <fuse/Profiler.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace fuse;
+
+// Cost of a FUSE_PROFILE_SCOPE(): 2 reads of the time stamp counter and a slot written in the
+// buffer of the thread.
+
+static void BM_Profiler_Scope(benchmark::State& state) {
+    setProfilerEnabled(true);
+    for (auto _ : state) {
+        FUSE_PROFILE_SCOPE("Bench");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Profiler_Scope);
+
+static void BM_Profiler_NestedScopes(benchmark::State& state) {
+    setProfilerEnabled(true);
+    for (auto _ : state) {
+        FUSE_PROFILE_SCOPE("Outer");
+        {
+            FUSE_PROFILE_SCOPE("Inner");
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(BM_Profiler_NestedScopes);
+
+static void BM_Profiler_ScopeDisabled(benchmark::State& state) {
+    setProfilerEnabled(false);
+    for (auto _ : state) {
+        FUSE_PROFILE_SCOPE("Bench");
+        benchmark::ClobberMemory();
+    }
+    setProfilerEnabled(true);
+}
+BENCHMARK(BM_Profiler_ScopeDisabled);
+
+static void BM_Profiler_ScopeThreads(benchmark::State& state) {
+    setProfilerEnabled(true);
+    for (auto _ : state) {
+        FUSE_PROFILE_SCOPE("Bench");
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Profiler_ScopeThreads)->ThreadRange(1, 8);
+
+static void BM_Profiler_Collect(benchmark::State& state) {
+    setProfilerEnabled(true);
+    for (std::size_t i = 0; i < detail::ProfileThreadBuffer::kCapacity; i++) {
+        FUSE_PROFILE_SCOPE("Bench");
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(collectProfileEvents(0, profilerTicks()));
+    }
+}
+BENCHMARK(BM_Profiler_Collect)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,83 @@
+#include <fuse/math/Angle.h>
+#include <fuse/math/Mat3.h>
+#include <fuse/math/Quaternion.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+// The batched slerp/nlerp and matrix conversion are in BenchQuaternionBatch.cpp.
+namespace {
+
+std::vector<Quaternion> makeRotations(std::size_t count) {
+    std::vector<Quaternion> rotations(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        rotations[i] = Quaternion(Vec3(f, 1.f, -f).normalize(), degrees(f));
+    }
+    return rotations;
+}
+
+// Apply a unary operation on N quaternions.
+template <typename Fn>
+void unaryOp(benchmark::State& state, Fn&& op) {
+    const auto rotations = makeRotations(static_cast<std::size_t>(state.range(0)));
+    std::vector<decltype(op(rotations[0]))> results(rotations.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < rotations.size(); i++) {
+            results[i] = op(rotations[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Quaternion_Multiply(benchmark::State& state) {
+    const auto              a = makeRotations(static_cast<std::size_t>(state.range(0)));
+    const auto              b = makeRotations(a.size());
+    std::vector<Quaternion> results(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); i++) {
+            results[i] = a[i] * b[b.size() - i - 1];
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Quaternion_RotateVec3(benchmark::State& state) {
+    unaryOp(state, [](const Quaternion& q) { return q * Vec3(1.f, 2.f, 3.f); });
+}
+
+void BM_Quaternion_AsMatrix(benchmark::State& state) {
+    unaryOp(state, [](const Quaternion& q) { return q.asMatrix(); });
+}
+
+void BM_Quaternion_SetMatrix(benchmark::State& state) {
+    unaryOp(state, [](const Quaternion& q) {
+        Quaternion r;
+        r.setMatrix(q.asMatrix());
+        return r;
+    });
+}
+
+void BM_Quaternion_Normalize(benchmark::State& state) {
+    unaryOp(state, [](const Quaternion& q) { return q.normalize(); });
+}
+
+void BM_Quaternion_Inverse(benchmark::State& state) {
+    unaryOp(state, [](const Quaternion& q) { return q.inverse(); });
+}
+
+} // namespace
+
+BENCHMARK(BM_Quaternion_Multiply)->Arg(1024);
+BENCHMARK(BM_Quaternion_RotateVec3)->Arg(1024);
+BENCHMARK(BM_Quaternion_AsMatrix)->Arg(1024);
+BENCHMARK(BM_Quaternion_SetMatrix)->Arg(1024);
+BENCHMARK(BM_Quaternion_Normalize)->Arg(1024);
+BENCHMARK(BM_Quaternion_Inverse)->Arg(1024);
@@ -0,0 +1,123 @@
+#include <fuse/math/Angle.h>
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Quaternion.h>
+#include <fuse/math/QuaternionBatch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+// The rotation tracks of a skeleton sampled between 2 keyframes.
+struct Keyframes {
+    std::vector<Quaternion> from;
+    std::vector<Quaternion> to;
+    std::vector<float>      t;
+};
+
+Keyframes makeKeyframes(std::size_t count) {
+    Keyframes keyframes;
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        keyframes.from.push_back(Quaternion({0.f, 1.f, 0.f}, degrees(f)));
+        keyframes.to.push_back(Quaternion({1.f, 0.f, 0.f}, degrees(2.f * f)));
+        keyframes.t.push_back(static_cast<float>(i % 100) / 100.f);
+    }
+    return keyframes;
+}
+
+void BM_Slerp_Loop(benchmark::State& state) {
+    const auto keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Quaternion> result(keyframes.t.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = slerpShortestPath(keyframes.from[i], keyframes.to[i], keyframes.t[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Slerp_Batch(benchmark::State& state) {
+    const auto keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Quaternion> result(keyframes.t.size());
+    for (auto _ : state) {
+        slerpShortestPath(keyframes.from, keyframes.to, keyframes.t, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Nlerp_Loop(benchmark::State& state) {
+    const auto keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Quaternion> result(keyframes.t.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = nlerp(keyframes.from[i], keyframes.to[i], keyframes.t[i]);
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Nlerp_Batch(benchmark::State& state) {
+    const auto keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Quaternion> result(keyframes.t.size());
+    for (auto _ : state) {
+        nlerp(keyframes.from, keyframes.to, keyframes.t, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ToMat3_Loop(benchmark::State& state) {
+    const auto        keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Mat3> result(keyframes.t.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = keyframes.from[i].asMatrix();
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ToMat3_Batch(benchmark::State& state) {
+    const auto        keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Mat3> result(keyframes.t.size());
+    for (auto _ : state) {
+        toMatrices(keyframes.from, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ToMat4_Batch(benchmark::State& state) {
+    const auto        keyframes = makeKeyframes(static_cast<std::size_t>(state.range(0)));
+    std::vector<Mat4> result(keyframes.t.size());
+    for (auto _ : state) {
+        toMatrices(keyframes.from, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Slerp_Loop)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Slerp_Batch)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Nlerp_Loop)->Arg(64)->Arg(4096);
+BENCHMARK(BM_Nlerp_Batch)->Arg(64)->Arg(4096);
+BENCHMARK(BM_ToMat3_Loop)->Arg(64)->Arg(4096);
+BENCHMARK(BM_ToMat3_Batch)->Arg(64)->Arg(4096);
+BENCHMARK(BM_ToMat4_Batch)->Arg(64)->Arg(4096);
@@ -0,0 +1,131 @@
+#include <fuse/math/Vec2.h>
+#include <fuse/math/Vec3.h>
+#include <fuse/math/Vec4.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+template <typename V>
+std::vector<V> makeVectors(std::size_t count) {
+    std::vector<V> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        if constexpr (std::is_same_v<V, Vec2>) {
+            vectors[i] = Vec2(f + 1.f, f * 0.5f);
+        } else if constexpr (std::is_same_v<V, Vec3>) {
+            vectors[i] = Vec3(f + 1.f, f * 0.5f, -f);
+        } else {
+            vectors[i] = Vec4(f + 1.f, f * 0.5f, -f, 1.f);
+        }
+    }
+    return vectors;
+}
+
+// Apply a unary operation on N vectors.
+template <typename V, typename Fn>
+void unaryOp(benchmark::State& state, Fn&& op) {
+    const auto vectors = makeVectors<V>(static_cast<std::size_t>(state.range(0)));
+    std::vector<decltype(op(vectors[0]))> results(vectors.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); i++) {
+            results[i] = op(vectors[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Apply a binary operation on N pairs of vectors.
+template <typename V, typename Fn>
+void binaryOp(benchmark::State& state, Fn&& op) {
+    const auto a = makeVectors<V>(static_cast<std::size_t>(state.range(0)));
+    const auto b = makeVectors<V>(a.size());
+    std::vector<decltype(op(a[0], b[0]))> results(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); i++) {
+            results[i] = op(a[i], b[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Vec2_Add(benchmark::State& state) {
+    binaryOp<Vec2>(state, [](const Vec2& a, const Vec2& b) { return a + b; });
+}
+
+void BM_Vec2_Dot(benchmark::State& state) {
+    binaryOp<Vec2>(state, [](const Vec2& a, const Vec2& b) { return a.dot(b); });
+}
+
+void BM_Vec2_Length(benchmark::State& state) {
+    unaryOp<Vec2>(state, [](const Vec2& v) { return v.length(); });
+}
+
+void BM_Vec2_Normalize(benchmark::State& state) {
+    unaryOp<Vec2>(state, [](const Vec2& v) { return v.normalize(); });
+}
+
+void BM_Vec3_Add(benchmark::State& state) {
+    binaryOp<Vec3>(state, [](const Vec3& a, const Vec3& b) { return a + b; });
+}
+
+void BM_Vec3_Dot(benchmark::State& state) {
+    binaryOp<Vec3>(state, [](const Vec3& a, const Vec3& b) { return a.dot(b); });
+}
+
+void BM_Vec3_Cross(benchmark::State& state) {
+    binaryOp<Vec3>(state, [](const Vec3& a, const Vec3& b) { return a.cross(b); });
+}
+
+void BM_Vec3_Length(benchmark::State& state) {
+    unaryOp<Vec3>(state, [](const Vec3& v) { return v.length(); });
+}
+
+void BM_Vec3_Normalize(benchmark::State& state) {
+    unaryOp<Vec3>(state, [](const Vec3& v) { return v.normalize(); });
+}
+
+void BM_Vec3_AngleBetween(benchmark::State& state) {
+    binaryOp<Vec3>(state, [](const Vec3& a, const Vec3& b) { return a.angleBetween(b); });
+}
+
+void BM_Vec4_Add(benchmark::State& state) {
+    binaryOp<Vec4>(state, [](const Vec4& a, const Vec4& b) { return a + b; });
+}
+
+void BM_Vec4_Dot(benchmark::State& state) {
+    binaryOp<Vec4>(state, [](const Vec4& a, const Vec4& b) { return a.dot(b); });
+}
+
+void BM_Vec4_Length(benchmark::State& state) {
+    unaryOp<Vec4>(state, [](const Vec4& v) { return v.length(); });
+}
+
+void BM_Vec4_Normalize(benchmark::State& state) {
+    unaryOp<Vec4>(state, [](const Vec4& v) { return v.normalize(); });
+}
+
+} // namespace
+
+BENCHMARK(BM_Vec2_Add)->Arg(1024);
+BENCHMARK(BM_Vec2_Dot)->Arg(1024);
+BENCHMARK(BM_Vec2_Length)->Arg(1024);
+BENCHMARK(BM_Vec2_Normalize)->Arg(1024);
+BENCHMARK(BM_Vec3_Add)->Arg(1024);
+BENCHMARK(BM_Vec3_Dot)->Arg(1024);
+BENCHMARK(BM_Vec3_Cross)->Arg(1024);
+BENCHMARK(BM_Vec3_Length)->Arg(1024);
+BENCHMARK(BM_Vec3_Normalize)->Arg(1024);
+BENCHMARK(BM_Vec3_AngleBetween)->Arg(1024);
+BENCHMARK(BM_Vec4_Add)->Arg(1024);
+BENCHMARK(BM_Vec4_Dot)->Arg(1024);
+BENCHMARK(BM_Vec4_Length)->Arg(1024);
+BENCHMARK(BM_Vec4_Normalize)->Arg(1024);
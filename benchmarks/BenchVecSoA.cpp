@@ -0,0 +1,117 @@
+#include <fuse/math/Vec3.h>
+#include <fuse/math/VecSoA.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+std::vector<Vec3> makeVectors(std::size_t count) {
+    std::vector<Vec3> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        vectors[i]   = Vec3(f + 1.f, f * 0.5f, -f);
+    }
+    return vectors;
+}
+
+void BM_Vec3_Normalize_AoS(benchmark::State& state) {
+    const auto        vectors = makeVectors(static_cast<std::size_t>(state.range(0)));
+    std::vector<Vec3> results(vectors.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); i++) {
+            results[i] = vectors[i].normalize();
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Vec3_Normalize_SoA(benchmark::State& state) {
+    const Vec3SoA vectors(makeVectors(static_cast<std::size_t>(state.range(0))));
+    Vec3SoA       results(vectors.size());
+    for (auto _ : state) {
+        normalize(vectors, results);
+        benchmark::DoNotOptimize(results.x().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Vec3_Dot_AoS(benchmark::State& state) {
+    const auto         a = makeVectors(static_cast<std::size_t>(state.range(0)));
+    const auto         b = makeVectors(a.size());
+    std::vector<float> results(a.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < a.size(); i++) {
+            results[i] = a[i].dot(b[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Vec3_Dot_SoA(benchmark::State& state) {
+    const Vec3SoA      a(makeVectors(static_cast<std::size_t>(state.range(0))));
+    const Vec3SoA      b(makeVectors(a.size()));
+    std::vector<float> results(a.size());
+    for (auto _ : state) {
+        dot(a, b, results);
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Particle integration: position += velocity * dt
+void BM_Vec3_MulAdd_AoS(benchmark::State& state) {
+    const auto velocities = makeVectors(static_cast<std::size_t>(state.range(0)));
+    auto       positions  = makeVectors(velocities.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            positions[i] += velocities[i] * 0.016f;
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Vec3_MulAdd_SoA(benchmark::State& state) {
+    const Vec3SoA velocities(makeVectors(static_cast<std::size_t>(state.range(0))));
+    Vec3SoA       positions(makeVectors(velocities.size()));
+    for (auto _ : state) {
+        mulAdd(velocities, 0.016f, positions, positions);
+        benchmark::DoNotOptimize(positions.x().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The cost to convert to and from the AoS layout.
+void BM_Vec3_GatherScatter(benchmark::State& state) {
+    auto    vectors = makeVectors(static_cast<std::size_t>(state.range(0)));
+    Vec3SoA soa;
+    for (auto _ : state) {
+        soa.gather(vectors);
+        soa.scatter(vectors);
+        benchmark::DoNotOptimize(vectors.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Vec3_Normalize_AoS)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_Normalize_SoA)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_Dot_AoS)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_Dot_SoA)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_MulAdd_AoS)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_MulAdd_SoA)->Arg(1024)->Arg(1 << 16);
+BENCHMARK(BM_Vec3_GatherScatter)->Arg(1024)->Arg(1 << 16);
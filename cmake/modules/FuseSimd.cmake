@@ -0,0 +1,120 @@
+#
+# This file contains the SIMD configuration of the fuse math kernels.
+#
+include_guard()
+
+####################################################################
+# Instruction set used by the math kernels.
+#
+#   AUTO     : DISPATCH on x86-64, SCALAR on every other architecture.
+#   SCALAR   : Portable C++ implementation.
+#   SSE      : SSE2 kernels (baseline of x86-64, no extra compiler flag).
+#   AVX2     : AVX2 + FMA kernels (the binary require a Haswell or newer CPU).
+#   AVX512   : AVX-512F kernels (the binary require a Skylake-X or newer CPU).
+#   DISPATCH : Compile the SSE, AVX2 and AVX-512 kernels and select the best one supported
+#              by the CPU at runtime. The environment variable FUSE_FORCE_ISA (scalar, sse,
+#              avx2 or avx512) can select a lower one.
+#
+set(FUSE_SIMD "AUTO" CACHE STRING "Instruction set used by the math kernels (AUTO, SCALAR, SSE, AVX2, AVX512, DISPATCH)")
+set_property(CACHE FUSE_SIMD PROPERTY STRINGS AUTO SCALAR SSE AVX2 AVX512 DISPATCH)
+
+####################################################################
+# Resolve FUSE_SIMD into the instruction set to use.
+#
+# Example:
+#   fuse_get_simd(simd)
+#   message(STATUS ${simd}) # DISPATCH
+#
+function(fuse_get_simd result)
+    set(simd ${FUSE_SIMD})
+    if(simd STREQUAL "AUTO")
+        if(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|x64)$")
+            set(simd "DISPATCH")
+        else()
+            set(simd "SCALAR")
+        endif()
+    endif()
+
+    if(NOT simd MATCHES "^(SCALAR|SSE|AVX2|AVX512|DISPATCH)$")
+        message(FATAL_ERROR "Invalid FUSE_SIMD value '${FUSE_SIMD}'.")
+    endif()
+
+    set(${result} ${simd} PARENT_SCOPE)
+endfunction()
+
+####################################################################
+# Return the compiler options enabling an instruction set.
+#
+# Example:
+#   fuse_get_simd_options(AVX2 options)
+#   message(STATUS ${options}) # -mavx2;-mfma
+#
+function(fuse_get_simd_options isa result)
+    if(CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        set(avx2   /arch:AVX2)
+        set(avx512 /arch:AVX512)
+    else()
+        set(avx2   -mavx2 -mfma)
+        set(avx512 -mavx512f -mavx512bw -mavx512dq -mavx512vl -mavx2 -mfma)
+    endif()
+
+    if(isa STREQUAL "AVX2")
+        set(${result} ${avx2} PARENT_SCOPE)
+    elseif(isa STREQUAL "AVX512")
+        set(${result} ${avx512} PARENT_SCOPE)
+    else()
+        set(${result} "" PARENT_SCOPE)
+    endif()
+endfunction()
+
+####################################################################
+# Add the compile definitions and options required by the selected
+# instruction set to a target.
+#
+# With DISPATCH, the sources of the target are compiled with the options of the instruction
+# set in their name (*AVX2.cpp, *AVX512.cpp), call this function after adding the sources.
+#
+# Definitions:
+#   FUSE_SIMD_SSE      : SSE kernels are available.
+#   FUSE_SIMD_AVX2     : AVX2 kernels are available (implies FUSE_SIMD_SSE).
+#   FUSE_SIMD_AVX512   : AVX-512 kernels are available (implies FUSE_SIMD_AVX2).
+#   FUSE_SIMD_DISPATCH : The kernels are selected at runtime.
+#
+function(fuse_target_set_simd target)
+    if(NOT TARGET ${target})
+        message(FATAL_ERROR "Target ${target} does not exist.")
+    endif()
+
+    fuse_get_simd(simd)
+    message(STATUS "${target} SIMD : ${simd}")
+
+    if(simd STREQUAL "SSE")
+        target_compile_definitions(${target} PRIVATE FUSE_SIMD_SSE=1)
+    elseif(simd STREQUAL "AVX2")
+        fuse_get_simd_options(AVX2 options)
+        target_compile_definitions(${target} PRIVATE FUSE_SIMD_SSE=1 FUSE_SIMD_AVX2=1)
+        target_compile_options(${target} PRIVATE ${options})
+    elseif(simd STREQUAL "AVX512")
+        fuse_get_simd_options(AVX512 options)
+        target_compile_definitions(${target} PRIVATE FUSE_SIMD_SSE=1 FUSE_SIMD_AVX2=1 FUSE_SIMD_AVX512=1)
+        target_compile_options(${target} PRIVATE ${options})
+    elseif(simd STREQUAL "DISPATCH")
+        target_compile_definitions(${target}
+            PRIVATE
+                FUSE_SIMD_SSE=1
+                FUSE_SIMD_AVX2=1
+                FUSE_SIMD_AVX512=1
+                FUSE_SIMD_DISPATCH=1
+        )
+        get_target_property(sources ${target} SOURCES)
+        foreach(isa AVX2 AVX512)
+            fuse_get_simd_options(${isa} options)
+            set(isaSources ${sources})
+            list(FILTER isaSources INCLUDE REGEX "${isa}\\.cpp$")
+            set_source_files_properties(${isaSources}
+                TARGET_DIRECTORY ${target}
+                PROPERTIES COMPILE_OPTIONS "${options}"
+            )
+        endforeach()
+    endif()
+endfunction(fuse_target_set_simd)
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+Compare 2 FuseBench JSON reports and flag the regressions.
+
+The reports are written by the RunFuseBench target (or FuseBench --benchmark_out=<file>
+--benchmark_out_format=json). When a report has repetitions, the median is used.
+
+Usage:
+    python scripts/CompareBenchmarks.py baseline.json contender.json --threshold 5
+
+The exit code is 1 when at least one benchmark is slower than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+# Conversion from the benchmark time unit to nanoseconds.
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    """Return {benchmark name: (ns/op, items/s or None)} from a google benchmark JSON report.
+
+    The time of a benchmark is per iteration, divided by the items of an iteration when it
+    reports items_per_second. The items/s are only displayed.
+    """
+    with open(path, encoding="utf-8") as file:
+        report = json.load(file)
+
+    runs = {}
+    medians = {}
+    for bench in report.get("benchmarks", []):
+        if bench.get("error_occurred"):
+            continue
+        name = bench.get("run_name", bench["name"])
+        unit = TIME_UNITS[bench.get("time_unit", "ns")]
+        time = bench[metric] * unit
+        items = bench.get("items_per_second")
+        if items:
+            # items_per_second is computed from the CPU time, or from the real time with
+            # UseRealTime(): recover the items of an iteration to give the time of a single
+            # operation in the selected metric.
+            rate_metric = "real_time" if name.endswith("/real_time") else "cpu_time"
+            items_per_iteration = items * bench[rate_metric] * unit * 1e-9
+            if items_per_iteration > 0:
+                time /= items_per_iteration
+        sample = (time, items)
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[name] = sample
+        else:
+            runs.setdefault(name, []).append(sample)
+
+    results = {}
+    for name, samples in runs.items():
+        samples.sort(key=lambda s: s[0])
+        results[name] = samples[len(samples) // 2]
+    results.update(medians)
+
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare 2 FuseBench JSON reports.")
+    parser.add_argument("baseline", help="JSON report of the reference run")
+    parser.add_argument("contender", help="JSON report of the run to check")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="slowdown in percent above which a benchmark is a regression (default: 5)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time",
+                        help="time measure to compare (default: cpu_time)")
+    parser.add_argument("--filter", default="", help="only compare the benchmarks containing this text")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    names = [name for name in baseline if name in contender and args.filter in name]
+    if not names:
+        print("No benchmark in common.")
+        return 1
+
+    width = max(len(name) for name in set(baseline) | set(contender))
+    print(f"{'Benchmark':<{width}}  {'Base ns/op':>12}  {'New ns/op':>12}  {'Change':>8}  {'New items/s':>12}")
+    regressions = []
+    for name in names:
+        base_time, _ = baseline[name]
+        new_time, new_items = contender[name]
+        change = (new_time - base_time) / base_time * 100.0 if base_time else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        items = f"{new_items:12.4g}" if new_items else f"{'-':>12}"
+        print(f"{name:<{width}}  {base_time:12.3f}  {new_time:12.3f}  {change:+7.1f}%  {items}{flag}")
+
+    for name in sorted(set(baseline) ^ set(contender)):
+        if args.filter in name:
+            print(f"{name:<{width}}  only in {'baseline' if name in baseline else 'contender'}")
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) above {args.threshold}%.")
+        return 1
+    print(f"\nNo regression above {args.threshold}%.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
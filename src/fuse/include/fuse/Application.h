@@ -1,18 +1,68 @@
 #pragma once
+#include "FixedTimestep.h"
+#include "Layer.h"
 #include "Time.h"
 
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
 union SDL_Event;
 
 namespace fuse {
-class Layer;
+class EventBus;
+class FrameLimiter;
+class FrameStats;
+class GpuProfiler;
+class JobSystem;
+class LayerStack;
+
+/// @brief The options of an Application.
+struct ApplicationConfig {
+    /// @brief Title of the window.
+    const char* title = "Fuse";
+
+    /// @brief Size of the window, or of the offscreen framebuffer in headless mode.
+    unsigned width  = 1920;
+    unsigned height = 1080;
+
+    /// @brief Run without a visible window, e.g. for the benchmarks and render tests in CI.
+    ///
+    /// SDL uses its offscreen video driver: the OpenGL context comes from EGL, with Mesa
+    /// llvmpipe on a machine without GPU (LIBGL_ALWAYS_SOFTWARE=1). The frames are rendered
+    /// into an offscreen framebuffer, see Application::getFramebuffer(), and the ImGui
+    /// settings are not saved.
+    bool headless = false;
+
+    /// @brief Number of frames run by each call to Application::run(), 0 to run until the
+    ///        window is closed.
+    std::uint64_t frameCount = 0;
+
+    /// @brief File to record the keyboard and mouse events into, with the duration of each
+    ///        frame, see InputRecorder. Empty to not record.
+    std::filesystem::path recordInput;
+
+    /// @brief Recording of InputRecorder to replay, empty to use the live input.
+    ///
+    /// The recorded events replace the live keyboard and mouse events and each frame lasts its
+    /// recorded duration for the updates: the camera follows the same path on every run. The
+    /// main loop ends with the recording.
+    std::filesystem::path replayInput;
+
+    /// @brief File the summary of the frame times is written to when the application is
+    ///        destroyed, see FrameStats::exportCsv(). Empty to not write it.
+    std::filesystem::path frameStatsCsv;
+};
 
 /// @brief Base class for fuse application.
 class Application {
 public:
-    /// @brief
-    Application();
+    /// @brief Create the window, the OpenGL context, the ImGui context and the job system.
+    explicit Application(const ApplicationConfig& config = {});
 
-    /// @brief
+    /// @brief Destroy the contexts and the window, then stop the job system and the logger.
     virtual ~Application();
 
     Application(const Application&)             = delete;
@@ -23,13 +73,83 @@ public:
     /// @brief Return the single instance of the application.
     static Application* Get() { return sInstance; }
 
-    /// @brief Start the application and the main loop.
-    void run();
+    /// @brief Run the main loop.
+    ///
+    /// The loop ends when the window is closed, after ApplicationConfig::frameCount frames, or
+    /// when @p stop returns true. run() can be called again to continue.
+    /// @param stop Called after each frame, may be empty.
+    void run(const std::function<bool()>& stop = {});
 
     void* getWindow();
     void* getGLContext();
 
-    void pushLayer(Layer* layer);
+    /// @brief Return true if the application runs without a visible window.
+    [[nodiscard]] bool isHeadless() const;
+
+    /// @brief Return the number of frames run since the creation of the application.
+    [[nodiscard]] std::uint64_t getFrameIndex() const;
+
+    /// @brief Return the OpenGL framebuffer the frames are rendered into.
+    ///
+    /// In headless mode, an offscreen framebuffer (RGBA8 color, 24 bits depth and 8 bits
+    /// stencil) of ApplicationConfig::width x height, bound before onRender(). Otherwise 0,
+    /// the window.
+    [[nodiscard]] unsigned getFramebuffer() const;
+
+    /// @brief Read the color of the framebuffer rendered into, e.g. for render tests.
+    /// @return RGBA8 pixels, width x height, from the bottom row to the top row.
+    [[nodiscard]] std::vector<std::uint8_t> readPixels() const;
+
+    /// @brief Add a layer, the application deletes it before destroying the OpenGL context.
+    /// @param hooks The callbacks the layer overrides, all when the type is unknown.
+    void pushLayer(Layer* layer, LayerHooks hooks = kAllLayerHooks);
+
+    /// @brief Add a layer, only its overridden callbacks are called each frame when @p T is
+    ///        final (see knownLayerHooks()): declare the layer classes final.
+    template <std::derived_from<Layer> T>
+    void pushLayer(T* layer) {
+        pushLayer(static_cast<Layer*>(layer), knownLayerHooks<T>());
+    }
+
+    /// @brief Return the layers of the main loop, e.g. to add an overlay or disable a layer.
+    LayerStack& getLayerStack();
+
+    /// @brief Return the frame rate limiter of the main loop.
+    ///
+    /// Unlimited by default. Every event marks the limiter active, call
+    /// FrameLimiter::markActive() while an animation runs to keep the adaptive mode active.
+    FrameLimiter& getFrameLimiter();
+
+    /// @brief Return the event bus of the main loop.
+    ///
+    /// onEvent() queues the SDL events on the bus, the main loop dispatches them once per frame
+    /// before the updates. The layers subscribe to the types they handle.
+    EventBus& getEventBus();
+
+    /// @brief Return the frame time statistics of the main loop.
+    ///
+    /// Each frame adds the measured time since the previous frame, also when replaying an
+    /// input recording, and the duration of each phase of the loop.
+    FrameStats& getFrameStats();
+
+    /// @brief Return the GPU profiler of the main loop.
+    ///
+    /// The main loop measures the GPU time of the frame, of onRender() and of ImGui, and of
+    /// each layer in onRender(). Use FUSE_GPU_PROFILE_SCOPE() for finer scopes.
+    GpuProfiler& getGpuProfiler();
+
+    /// @brief Return the job system of the application.
+    ///
+    /// The job system is started and stopped with the application, it uses all the cores.
+    JobSystem& getJobSystem();
+
+    /// @brief Set the rate of onFixedUpdate().
+    ///
+    /// The default is 60 steps per second and at most FixedTimestep::kDefaultMaxSteps steps
+    /// per frame.
+    /// @param step The duration of a fixed step.
+    /// @param maxStepsPerFrame Limit of steps per frame, the simulation slows down beyond.
+    void setFixedTimestep(Time step, unsigned maxStepsPerFrame = FixedTimestep::kDefaultMaxSteps);
 
 protected:
 
@@ -37,13 +157,18 @@ protected:
     /// @param deltaTime The delta time since the last update.
     virtual void onUpdate(Time deltaTime);
 
+    /// @brief Call at a fixed rate to advance the simulation, see setFixedTimestep().
+    /// @param step The duration of a fixed step.
+    virtual void onFixedUpdate(Time step);
+
     /// @brief Call once every frame for rendering.
-    virtual void onRender();
+    /// @param alpha Interpolation factor between the last 2 fixed steps.
+    virtual void onRender(float alpha);
 
     /// @brief Call once every frame for ImGui.
     virtual void onImGui();
 
-    /// @brief Call when a event happen.
+    /// @brief Call when a event happen, the default queues it on the event bus.
     virtual void onEvent(const SDL_Event&);
 
 private:
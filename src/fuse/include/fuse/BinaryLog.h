@@ -0,0 +1,220 @@
+#pragma once
+#include "Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fuse {
+
+/// @brief Configuration of the binary log.
+struct BinaryLogConfig {
+    /// @brief The file written, overwritten if it exists.
+    std::filesystem::path path = "fuse.blog";
+    /// @brief Size of the buffer of each thread, a full buffer is given to the writer thread.
+    ///        At least 8 KiB, a message larger than a buffer is given to log_message().
+    std::size_t bufferSize = 64 * 1024;
+    /// @brief A buffer older than this is given to the writer thread on the next message, or
+    ///        taken by the writer thread if its thread logs nothing more.
+    double flushInterval = 0.1;
+};
+
+/// @brief Start the binary log.
+///
+/// The FUSE_LOG_BINARY() messages are then written to @p config.path without being formatted:
+/// each call site registers its format string once and a message only stores the id of the
+/// format, a timestamp and the raw bytes of its arguments in a buffer of the calling thread.
+/// fuse-logdecode (or decodeBinaryLog()) formats the messages offline.
+///
+/// When the binary log is not started, FUSE_LOG_BINARY() messages are given to log_message().
+/// @return false if the file can not be opened.
+bool binary_log_initialize(const BinaryLogConfig& config = {});
+
+/// @brief Write the messages of every thread and close the file.
+/// @warning No other thread may log binary messages during the shutdown.
+void binary_log_shutdown();
+
+/// @brief Give the buffer of the calling thread to the writer thread and wait until every
+///        buffer given so far is written.
+void binary_log_flush();
+
+/// @brief A message read from a binary log.
+struct BinaryLogMessage {
+    LogCategory   category; ///< The category of the call site.
+    LogLevel      level;    ///< The level of the call site.
+    double        time;     ///< Seconds since binary_log_initialize().
+    std::uint32_t thread;   ///< Index of the logging thread, in order of their first message.
+    std::string   message;  ///< The formatted message.
+    std::string   file;     ///< Source file of the call site.
+    std::uint32_t line;     ///< Line of the call site.
+};
+
+/// @brief Read and format the messages of a binary log.
+///
+/// The messages of a thread are in order, the messages of different threads are grouped by
+/// buffer: sort them by time to interleave them.
+/// @return The messages, or a description of the error.
+std::expected<std::vector<BinaryLogMessage>, std::string> decodeBinaryLog(
+  const std::filesystem::path& path);
+
+namespace detail {
+
+/// @brief Type of an argument of a binary message, stored in the format of the call site.
+enum class BinaryArg : char {
+    Bool    = 'b',
+    Char    = 'c',
+    Int8    = 'a',
+    Int16   = 'h',
+    Int32   = 'i',
+    Int64   = 'l',
+    UInt8   = 'A',
+    UInt16  = 'H',
+    UInt32  = 'I',
+    UInt64  = 'L',
+    Float   = 'f',
+    Double  = 'd',
+    Pointer = 'p', ///< Stored as a 64 bits integer.
+    String  = 's', ///< Stored as a 32 bits length followed by the characters.
+};
+
+/// @brief Longest string argument stored, longer strings are truncated.
+inline constexpr std::size_t kBinaryLogMaxString = 4096;
+
+template <typename T>
+consteval BinaryArg binaryArgOf() {
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        return BinaryArg::Bool;
+    } else if constexpr (std::is_same_v<U, char>) {
+        return BinaryArg::Char;
+    } else if constexpr (std::is_integral_v<U>) {
+        constexpr bool isSigned = std::is_signed_v<U>;
+        if constexpr (sizeof(U) == 1) {
+            return isSigned ? BinaryArg::Int8 : BinaryArg::UInt8;
+        } else if constexpr (sizeof(U) == 2) {
+            return isSigned ? BinaryArg::Int16 : BinaryArg::UInt16;
+        } else if constexpr (sizeof(U) == 4) {
+            return isSigned ? BinaryArg::Int32 : BinaryArg::UInt32;
+        } else {
+            static_assert(sizeof(U) == 8, "Unsupported integer size.");
+            return isSigned ? BinaryArg::Int64 : BinaryArg::UInt64;
+        }
+    } else if constexpr (std::is_same_v<U, float>) {
+        return BinaryArg::Float;
+    } else if constexpr (std::is_same_v<U, double>) {
+        return BinaryArg::Double;
+    } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+        return BinaryArg::String;
+    } else if constexpr (std::is_pointer_v<std::decay_t<U>>) {
+        return BinaryArg::Pointer;
+    } else {
+        static_assert(sizeof(U) == 0,
+                      "FUSE_LOG_BINARY() only takes arithmetic, pointer and string arguments, "
+                      "format the other types with FUSE_LOG().");
+    }
+}
+
+/// @brief Return the type tags of the arguments of a call site, e.g. "isd".
+template <typename... Args>
+std::string binaryArgTags() {
+    return {static_cast<char>(binaryArgOf<Args>())...};
+}
+
+/// @brief The format of a FUSE_LOG_BINARY() call site, registered in each session using it.
+struct BinaryFormatSite {
+    LogCategory      category;
+    LogLevel         level;
+    std::string_view format;
+    std::string      tags;
+    std::string_view file;
+    std::uint32_t    line;
+    /// @brief The session (high 32 bits) and the id of the format in its file (low 32 bits).
+    std::atomic<std::uint64_t> key{0};
+};
+
+/// @brief Reserve @p size bytes for the arguments of a message in the buffer of the calling
+///        thread, after the id of the format of @p site and the timestamp of the message.
+///
+/// The buffer is locked until binaryLogCommit(), the writer thread does not take it with a
+/// partial message.
+/// @return nullptr if the binary log is not started, nothing to commit then.
+std::byte* binaryLogReserve(BinaryFormatSite& site, std::size_t size);
+
+/// @brief Unlock the buffer of the calling thread after a successful binaryLogReserve().
+void binaryLogCommit() noexcept;
+
+template <typename T>
+std::size_t binaryArgSize(const T& arg) {
+    if constexpr (binaryArgOf<T>() == BinaryArg::String) {
+        return sizeof(std::uint32_t) +
+               std::min(std::string_view(arg).size(), kBinaryLogMaxString);
+    } else if constexpr (binaryArgOf<T>() == BinaryArg::Pointer) {
+        return sizeof(std::uint64_t);
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+std::byte* writeBinaryArg(std::byte* out, const T& arg) {
+    if constexpr (binaryArgOf<T>() == BinaryArg::String) {
+        const std::string_view str = std::string_view(arg).substr(0, kBinaryLogMaxString);
+        const auto             size = static_cast<std::uint32_t>(str.size());
+        std::memcpy(out, &size, sizeof(size));
+        std::memcpy(out + sizeof(size), str.data(), str.size());
+        return out + sizeof(size) + str.size();
+    } else if constexpr (binaryArgOf<T>() == BinaryArg::Pointer) {
+        const auto value = static_cast<std::uint64_t>(
+          reinterpret_cast<std::uintptr_t>(static_cast<const void*>(arg)));
+        std::memcpy(out, &value, sizeof(value));
+        return out + sizeof(value);
+    } else {
+        std::memcpy(out, &arg, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+/// @brief Write a message in the buffer of the calling thread.
+/// @return false if the binary log is not started.
+template <typename... Args>
+bool writeBinaryMessage(BinaryFormatSite& site, const Args&... args) {
+    std::byte* out = binaryLogReserve(site, (std::size_t{0} + ... + binaryArgSize(args)));
+    if (out == nullptr) {
+        return false;
+    }
+    ((out = writeBinaryArg(out, args)), ...);
+    binaryLogCommit();
+    return true;
+}
+
+} // namespace detail
+
+} // namespace fuse
+
+/// @brief Log a message in the binary log, see binary_log_initialize().
+///
+/// Filtered as FUSE_LOG(). The format string is checked at compile time and registered once
+/// per call site and session, the arguments must be arithmetic, pointer or string types.
+#define FUSE_LOG_BINARY(category, level, fmt, ...)                                              \
+    do {                                                                                        \
+        if constexpr (fuse::isLogLevelCompiled(level)) {                                        \
+            if (fuse::log_enabled(level, category)) {                                           \
+                [&](const auto&... fuseArgs) {                                                  \
+                    static fuse::detail::BinaryFormatSite fuseSite{                             \
+                      category, level, fmt,                                                     \
+                      fuse::detail::binaryArgTags<decltype(fuseArgs)...>(), __FILE__, __LINE__}; \
+                    if (!fuse::detail::writeBinaryMessage(fuseSite, fuseArgs...)) {             \
+                        fuse::log_message(category, level, fmt, fuseArgs...);                   \
+                    }                                                                           \
+                }(__VA_ARGS__);                                                                 \
+            }                                                                                   \
+        }                                                                                       \
+    } while (false)
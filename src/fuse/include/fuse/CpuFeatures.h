@@ -0,0 +1,26 @@
+#pragma once
+
+namespace fuse {
+
+/// @brief Instruction set extensions supported by the CPU.
+///
+/// An extension using the AVX registers is only reported if the operating system saves
+/// them on context switches, so a supported extension can always be used.
+struct CpuFeatures {
+    bool sse2     = false;
+    bool sse42    = false;
+    bool avx2     = false;
+    bool fma      = false;
+    bool avx512f  = false;
+    bool avx512bw = false;
+    bool avx512dq = false;
+    bool avx512vl = false;
+};
+
+/// @brief Get the instruction set extensions supported by the CPU.
+///
+/// The CPU is queried (cpuid) on the first call only. All the extensions are false on
+/// architectures other than x86.
+[[nodiscard]] const CpuFeatures& cpuFeatures() noexcept;
+
+} // namespace fuse
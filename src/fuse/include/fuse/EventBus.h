@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+union SDL_Event;
+
+namespace fuse {
+
+template <typename T>
+class MpscRingBuffer;
+
+class EventBus;
+
+/// @brief A subscription to an EventBus, the callback is removed when it is destroyed.
+class EventSubscription {
+public:
+    EventSubscription() = default;
+    ~EventSubscription() { reset(); }
+
+    EventSubscription(const EventSubscription&)            = delete;
+    EventSubscription& operator=(const EventSubscription&) = delete;
+
+    EventSubscription(EventSubscription&& other) noexcept;
+    EventSubscription& operator=(EventSubscription&& other) noexcept;
+
+    /// @brief Remove the callback from the bus now.
+    void reset();
+
+    [[nodiscard]] bool isActive() const noexcept { return mBus != nullptr; }
+
+private:
+    friend class EventBus;
+
+    EventSubscription(EventBus* bus, std::uint32_t type, std::uint32_t id) noexcept
+        : mBus(bus)
+        , mType(type)
+        , mId(id) {}
+
+    EventBus*     mBus{nullptr};
+    std::uint32_t mType{0};
+    std::uint32_t mId{0};
+};
+
+/// @brief Deliver the events of a frame to the callbacks subscribed to their type.
+///
+/// The main loop queues the SDL events with enqueue() and delivers them once per frame with
+/// dispatch(). Each event type has its own table of subscribers: an event only reaches the
+/// callbacks of its type, instead of a virtual call per layer and per event that then tests
+/// the type. The callbacks of a type are called by decreasing priority, the latest subscription
+/// first for equal priorities (the top of the layer stack first), until one returns true.
+///
+/// enqueue() merges an event with the previous queued one when only the last state matters:
+/// the consecutive mouse motions of a mouse with the same buttons held become one motion with
+/// the sum of the relative moves, the consecutive wheel moves one move. A flood of motion
+/// events then costs one dispatch per frame.
+///
+/// Engine events, of a type from registerEventType(), are posted from any thread with post()
+/// and delivered by the next dispatch(), in the main thread. The queue is lock-free and
+/// bounded, post() fails when it is full.
+///
+/// subscribe() and the destruction of a subscription are allowed in a callback: a removed
+/// callback is not called anymore, an added one from the next dispatch(). The subscriptions
+/// are destroyed before the bus.
+class EventBus {
+public:
+    /// @brief Callback of a subscription, returns true when the event is handled: the next
+    ///        subscribers do not receive it.
+    using Callback = bool (*)(void* context, const SDL_Event& event);
+
+    /// @brief Capacity of the queue of post() by default.
+    static constexpr std::size_t kDefaultPostCapacity = 1024;
+
+    /// @param postCapacity Capacity of the queue of post(), rounded up to a power of 2.
+    explicit EventBus(std::size_t postCapacity = kDefaultPostCapacity);
+    ~EventBus();
+
+    EventBus(const EventBus&)            = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    /// @brief Return a new event type for the engine events, SDL_RegisterEvents() is used so
+    ///        that it does not collide with the user events of SDL.
+    /// @return The type, 0 when SDL has no type left.
+    [[nodiscard]] static std::uint32_t registerEventType();
+
+    /// @brief Call @p callback with @p context for the events of type @p type.
+    /// @param priority The callbacks of a higher priority are called first.
+    [[nodiscard]] EventSubscription subscribe(std::uint32_t type, Callback callback,
+                                              void* context, int priority = 0);
+
+    /// @brief Call `object->*Method(event)` for the events of type @p type.
+    ///
+    /// The method returns bool, true when the event is handled, or void for false.
+    template <auto Method, typename T>
+    [[nodiscard]] EventSubscription subscribe(std::uint32_t type, T* object, int priority = 0) {
+        return subscribe(
+          type,
+          [](void* context, const SDL_Event& event) -> bool {
+              if constexpr (std::is_void_v<std::invoke_result_t<decltype(Method), T*,
+                                                                const SDL_Event&>>) {
+                  std::invoke(Method, static_cast<T*>(context), event);
+                  return false;
+              } else {
+                  return std::invoke(Method, static_cast<T*>(context), event);
+              }
+          },
+          object,
+          priority);
+    }
+
+    /// @brief Return the number of callbacks subscribed to a type.
+    [[nodiscard]] std::size_t subscriberCount(std::uint32_t type) const noexcept;
+
+    /// @brief Merge the consecutive mouse motions and wheel moves, enabled by default.
+    void setCoalescing(bool enabled) noexcept { mCoalescing = enabled; }
+    [[nodiscard]] bool isCoalescing() const noexcept { return mCoalescing; }
+
+    /// @brief Queue an event for the next dispatch(), main thread only.
+    void enqueue(const SDL_Event& event);
+
+    /// @brief Queue an event for the next dispatch(), any thread.
+    /// @return false if the queue is full, the event is dropped.
+    bool post(const SDL_Event& event);
+
+    /// @brief Queue an engine event for the next dispatch(), any thread.
+    /// @param type A type from registerEventType().
+    /// @param code, data1, data2 The fields of SDL_UserEvent.
+    /// @return false if the queue is full, the event is dropped.
+    bool post(std::uint32_t type, std::int32_t code = 0, void* data1 = nullptr,
+              void* data2 = nullptr);
+
+    /// @brief Return the number of events queued, the posted ones not included.
+    [[nodiscard]] std::size_t queuedCount() const noexcept;
+
+    /// @brief Return the number of events merged into the previous one since the creation.
+    [[nodiscard]] std::uint64_t coalescedCount() const noexcept { return mCoalesced; }
+
+    /// @brief Deliver the queued and posted events, in order, then clear the queue. Main
+    ///        thread only.
+    void dispatch();
+
+private:
+    friend class EventSubscription;
+
+    struct Subscriber {
+        Callback      callback;
+        void*         context;
+        int           priority;
+        std::uint32_t id;
+    };
+
+    /// @brief The subscribers of a type, by order of call.
+    struct Table {
+        std::uint32_t           type;
+        std::vector<Subscriber> subscribers;
+    };
+
+    void                 unsubscribe(std::uint32_t type, std::uint32_t id);
+    void                 insert(std::uint32_t type, const Subscriber& subscriber);
+    [[nodiscard]] Table* find(std::uint32_t type) noexcept;
+    void                 compact();
+
+    std::vector<Table>                         mTables; ///< Sorted by type.
+    std::vector<SDL_Event>                     mQueue;
+    std::vector<SDL_Event>                     mDelivered; ///< The events of dispatch().
+    std::unique_ptr<MpscRingBuffer<SDL_Event>> mPosted;
+
+    // The subscriptions changed by a callback, applied after the dispatch.
+    std::vector<std::pair<std::uint32_t, Subscriber>> mPendingInserts;
+    bool                                              mDispatching{false};
+    bool                                              mRemoved{false};
+
+    std::uint32_t mNextId{1};
+    std::uint64_t mCoalesced{0};
+    bool          mCoalescing{true};
+};
+
+} // namespace fuse
@@ -0,0 +1,72 @@
+#pragma once
+#include "Time.h"
+
+namespace fuse {
+
+/// @brief Split the variable frame time in fixed simulation steps.
+///
+/// The frame time is added to an accumulator, each whole step in the accumulator is one
+/// simulation step to run. The time left, less than a step, is carried to the next frame and
+/// gives the interpolation factor between the last 2 simulation states (alpha()).
+///
+/// When a frame is too long, running all its steps would take even longer and the next frame
+/// would have more steps to catch up (the spiral of death). The number of steps per frame is
+/// capped and the time beyond it is dropped: the simulation slows down instead.
+///
+/// @code
+/// FixedTimestep fixed(1.0 / 60.0);
+/// while (running) {
+///     for (unsigned steps = fixed.advance(timer.deltaTime()); steps > 0; steps--) {
+///         simulate(fixed.step());
+///     }
+///     render(fixed.alpha()); // lerp(previousState, currentState, alpha)
+/// }
+/// @endcode
+class FixedTimestep {
+public:
+    /// @brief Default maximum number of steps per frame.
+    static constexpr unsigned kDefaultMaxSteps = 5;
+
+    /// @brief Constructor.
+    /// @param step The duration of a simulation step.
+    /// @param maxSteps The maximum number of steps per frame.
+    /// @pre @p step > 0 and @p maxSteps > 0.
+    explicit FixedTimestep(Time step = 1.0 / 60.0, unsigned maxSteps = kDefaultMaxSteps) noexcept;
+
+    /// @brief Add the time of a frame.
+    /// @param frameTime The time elapsed since the previous frame.
+    /// @return The number of simulation steps to run, at most maxSteps().
+    [[nodiscard]] unsigned advance(Time frameTime) noexcept;
+
+    /// @brief Return the interpolation factor in [0, 1) between the state of the previous step
+    ///        (0) and the state of the last step (1).
+    [[nodiscard]] float alpha() const noexcept;
+
+    /// @brief Return the duration of a simulation step.
+    [[nodiscard]] Time step() const noexcept { return mStep; }
+
+    /// @brief Return the maximum number of steps per frame.
+    [[nodiscard]] unsigned maxSteps() const noexcept { return mMaxSteps; }
+
+    /// @brief Return the time dropped because of the step limit since the construction.
+    [[nodiscard]] Time droppedTime() const noexcept { return mDroppedTime; }
+
+    /// @brief Change the duration of a step, the accumulated time is kept.
+    /// @pre @p step > 0.
+    void setStep(Time step) noexcept;
+
+    /// @brief Change the maximum number of steps per frame.
+    /// @pre @p maxSteps > 0.
+    void setMaxSteps(unsigned maxSteps) noexcept;
+
+    /// @brief Clear the accumulated time, e.g. after loading a level.
+    void reset() noexcept { mAccumulator = 0.0; }
+
+private:
+    double   mStep;
+    double   mAccumulator{};
+    double   mDroppedTime{};
+    unsigned mMaxSteps;
+};
+
+} // namespace fuse
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/// @def FUSE_FRAME_ARENA_DEBUG
+/// @brief 1 to detect the uses of the frame memory after a reset, by default in debug builds.
+///
+/// The memory released by FrameArena::reset() is filled with 0xCD (and poisoned under
+/// AddressSanitizer), and FrameArenaResource checks that a block is deallocated in the frame
+/// it was allocated in.
+#ifndef FUSE_FRAME_ARENA_DEBUG
+#    ifdef NDEBUG
+#        define FUSE_FRAME_ARENA_DEBUG 0
+#    else
+#        define FUSE_FRAME_ARENA_DEBUG 1
+#    endif
+#endif
+
+namespace fuse {
+
+/// @brief A bump allocator for the memory used during a single frame.
+///
+/// An allocation moves a pointer in the current block, a full block is followed by a larger
+/// one. Nothing is freed individually, reset() releases everything at once: after a reset
+/// which needed several blocks, the blocks are merged into one so that the next frames
+/// allocate in a single block.
+///
+/// Not thread safe, see frameArena() for the arena of each thread.
+class FrameArena {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 256 * 1024;
+
+    /// @param blockSize Size of the first block, allocated on the first allocation.
+    explicit FrameArena(std::size_t blockSize = kDefaultBlockSize) noexcept
+        : mBlockSize(blockSize) {}
+
+    ~FrameArena();
+
+    FrameArena(const FrameArena&)            = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// @brief Allocate @p size bytes aligned on @p alignment, valid until the next reset().
+    /// @pre @p alignment is a power of 2.
+    [[nodiscard]] void* allocate(std::size_t size,
+                                 std::size_t alignment = alignof(std::max_align_t)) {
+        const std::uintptr_t begin = (mCurrent + alignment - 1) & ~(alignment - 1);
+        if (begin + size > mEnd || begin < mCurrent) [[unlikely]] {
+            return allocateSlow(size, alignment);
+        }
+        mCurrent = begin + size;
+#if FUSE_FRAME_ARENA_DEBUG
+        unpoison(begin, size);
+#endif
+        return reinterpret_cast<void*>(begin);
+    }
+
+    /// @brief Allocate an uninitialized array of @p count T.
+    template <typename T>
+    [[nodiscard]] T* allocate(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "The arena does not call the destructors.");
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// @brief Release every allocation.
+    void reset() noexcept;
+
+    /// @brief Return the number of bytes allocated since the last reset, padding included.
+    [[nodiscard]] std::size_t used() const noexcept {
+        return mUsedInFullBlocks + (mCurrent - mBegin);
+    }
+
+    /// @brief Return the size of the blocks.
+    [[nodiscard]] std::size_t capacity() const noexcept { return mCapacity; }
+
+    /// @brief Return the largest used() seen at a reset or now.
+    [[nodiscard]] std::size_t highWaterMark() const noexcept {
+        return used() > mHighWaterMark ? used() : mHighWaterMark;
+    }
+
+    /// @brief Return the number of resets, the frame of the allocations.
+    [[nodiscard]] std::uint64_t generation() const noexcept { return mGeneration; }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t                  size;
+    };
+
+    void* allocateSlow(std::size_t size, std::size_t alignment);
+    void  useBlock(Block& block) noexcept;
+    /// @brief Allow the accesses to an allocation under AddressSanitizer, in debug mode.
+    static void unpoison(std::uintptr_t begin, std::size_t size) noexcept;
+    /// @brief Return the address of an empty block aligned on std::max_align_t, used before the
+    ///        first block: an allocation of 0 bytes returns it instead of nullptr.
+    static std::uintptr_t emptyBlock() noexcept;
+
+    std::vector<Block> mBlocks;
+    std::size_t        mBlockSize;
+    std::size_t        mCapacity{0};
+    std::size_t        mUsedInFullBlocks{0};
+    std::size_t        mHighWaterMark{0};
+    std::uint64_t      mGeneration{0};
+    std::uintptr_t     mBegin{emptyBlock()};
+    std::uintptr_t     mCurrent{mBegin};
+    std::uintptr_t     mEnd{mBegin};
+};
+
+/// @brief Adapt a FrameArena to std::pmr, e.g. `std::pmr::vector<int> v(&resource)`.
+///
+/// A deallocation does nothing, the containers must be destroyed before the reset of the
+/// arena.
+class FrameArenaResource final : public std::pmr::memory_resource {
+public:
+    explicit FrameArenaResource(FrameArena& arena) noexcept
+        : mArena(arena) {}
+
+    [[nodiscard]] FrameArena& arena() const noexcept { return mArena; }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void  do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    FrameArena& mArena;
+};
+
+/// @brief Return the frame arena of the calling thread.
+///
+/// Each thread (the main thread and the workers of the job system) has its own arena, reset
+/// on its first use after resetFrameArenas(). The memory is valid until the end of the frame.
+[[nodiscard]] FrameArena& frameArena() noexcept;
+
+/// @brief Return a memory resource on the frame arena of the calling thread.
+[[nodiscard]] std::pmr::memory_resource* frameMemoryResource() noexcept;
+
+/// @brief Start a new frame: the arenas of every thread are reset on their next use.
+///
+/// Called by Application::run() at the start of each frame.
+void resetFrameArenas() noexcept;
+
+} // namespace fuse
@@ -0,0 +1,123 @@
+#pragma once
+#include "Time.h"
+
+#include <cstdint>
+
+namespace fuse {
+
+/// @brief Accuracy of the frame pacing since the last FrameLimiter::resetStats().
+struct FramePacingStats {
+    /// @brief Number of frames measured.
+    unsigned frames = 0;
+
+    /// @brief Average time between 2 frames.
+    Time averageFrameTime{0.0};
+
+    /// @brief Average of the absolute difference between the frame time and the target
+    ///        frame time (the jitter). Only the frames with a target are counted.
+    Time averageError{0.0};
+
+    /// @brief Largest absolute difference between the frame time and the target frame time.
+    Time maxError{0.0};
+
+    /// @brief Largest delay between the deadline of a frame and the end of the wait.
+    Time maxLateness{0.0};
+};
+
+/// @brief Limit the frame rate of the main loop.
+///
+/// The main loop calls waitForNextFrame() once per frame, the limiter sleeps until the
+/// deadline of the next frame. The deadlines are spaced by the target frame time from the
+/// previous deadline, not from the end of the wait, so the errors do not accumulate.
+///
+/// The wait is hybrid: the OS sleep is not precise (up to 1-2 ms late), so the limiter sleeps
+/// until a short time before the deadline (the spin threshold) and then spins on the
+/// performance counter.
+///
+/// In adaptive mode the limiter runs at the target rate while there is activity, reported
+/// with markActive(), and drops to the idle rate after the idle delay without activity.
+class FrameLimiter {
+public:
+    /// @brief How the frame rate is limited.
+    enum class Mode {
+        Unlimited, ///< No wait, as fast as possible.
+        Fixed,     ///< Always at the target rate.
+        Adaptive,  ///< At the target rate when active, at the idle rate otherwise.
+    };
+
+    /// @brief Create an unlimited limiter, with a target of 60 FPS and an idle rate of 10 FPS.
+    FrameLimiter() noexcept;
+
+    /// @brief Set how the frame rate is limited.
+    void setMode(Mode mode) noexcept { mMode = mode; }
+
+    /// @brief Return how the frame rate is limited.
+    [[nodiscard]] Mode getMode() const noexcept { return mMode; }
+
+    /// @brief Set the frame rate of the Fixed mode and of the Adaptive mode when active.
+    /// @pre @p fps > 0.
+    void setTargetFps(double fps) noexcept;
+
+    /// @brief Return the frame rate of the Fixed mode and of the Adaptive mode when active.
+    [[nodiscard]] double getTargetFps() const noexcept { return mTargetFps; }
+
+    /// @brief Set the frame rate of the Adaptive mode when idle.
+    /// @pre @p fps > 0.
+    void setIdleFps(double fps) noexcept;
+
+    /// @brief Return the frame rate of the Adaptive mode when idle.
+    [[nodiscard]] double getIdleFps() const noexcept { return mIdleFps; }
+
+    /// @brief Set the time without activity before the Adaptive mode becomes idle.
+    void setIdleDelay(Time delay) noexcept;
+
+    /// @brief Set how long before the deadline the limiter stops sleeping and spins.
+    ///
+    /// A larger threshold is more precise but uses more CPU. The default, 1 ms, suits the
+    /// sleep precision of Windows with high resolution timers and of Linux.
+    void setSpinThreshold(Time threshold) noexcept;
+
+    /// @brief Report activity (an event, an animation): the Adaptive mode leaves idle.
+    void markActive() noexcept;
+
+    /// @brief Return true if the Adaptive mode is idle.
+    [[nodiscard]] bool isIdle() const noexcept;
+
+    /// @brief Return the time left before the deadline of the next frame, 0 when unlimited.
+    [[nodiscard]] Time remaining() const noexcept;
+
+    /// @brief Wait for the deadline of the next frame, call once per frame.
+    void waitForNextFrame() noexcept;
+
+    /// @brief Return the accuracy of the pacing.
+    [[nodiscard]] const FramePacingStats& getStats() const noexcept { return mStats; }
+
+    /// @brief Restart the measure of the pacing accuracy.
+    void resetStats() noexcept;
+
+private:
+    /// @brief Return the target frame time in ticks of the performance counter, 0 when unlimited.
+    [[nodiscard]] std::uint64_t frameTicks() const noexcept;
+    void                        sleepUntil(std::uint64_t deadline) const noexcept;
+    void                        record(std::uint64_t now, std::uint64_t frame,
+                                       std::uint64_t deadline) noexcept;
+
+    Mode   mMode = Mode::Unlimited;
+    double mTargetFps{60.0};
+    double mIdleFps{10.0};
+
+    double        mSecondsPerTick{};
+    std::uint64_t mTicksPerSecond{};
+    std::uint64_t mIdleDelay{};     ///< In ticks.
+    std::uint64_t mSpinThreshold{}; ///< In ticks.
+    std::uint64_t mLastActivity{};  ///< Performance counter of the last markActive().
+    std::uint64_t mFrameStart{};    ///< Deadline of the current frame, 0 before the first one.
+    std::uint64_t mLastFrameEnd{};  ///< Performance counter at the end of the last wait.
+
+    FramePacingStats mStats;
+    double           mFrameTimeSum{};
+    double           mErrorSum{};
+    unsigned         mErrorCount{};
+};
+
+} // namespace fuse
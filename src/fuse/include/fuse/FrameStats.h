@@ -0,0 +1,158 @@
+#pragma once
+#include "Time.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace fuse {
+
+/// @brief The phases of an iteration of the main loop measured by FrameStats.
+enum class FramePhase : std::uint8_t {
+    Events,      ///< Polling and dispatch of the events.
+    FixedUpdate, ///< Application::onFixedUpdate() steps.
+    Update,      ///< Application::onUpdate().
+    Render,      ///< Application::onRender(), CPU side.
+    ImGui,       ///< Building and submission of the ImGui frame.
+    Swap,        ///< Swap of the window, or flush in headless mode.
+    Wait,        ///< Wait of the frame limiter.
+    Count
+};
+
+inline constexpr std::size_t kFramePhaseCount = static_cast<std::size_t>(FramePhase::Count);
+
+[[nodiscard]] std::string_view toString(FramePhase phase) noexcept;
+
+/// @brief Duration of each phase of a frame, in milliseconds.
+using FramePhaseTimes = std::array<float, kFramePhaseCount>;
+
+/// @brief A frame kept by FrameStats.
+struct FrameSample {
+    float           frameTime; ///< Time between the start of this frame and the previous, in ms.
+    FramePhaseTimes phases;    ///< Duration of each phase, in ms, 0 when not measured.
+};
+
+/// @brief Distribution of a duration over the frames of the window, in milliseconds.
+struct FrameTimeSummary {
+    std::size_t frames  = 0;   ///< Number of frames of the window.
+    double      average = 0.0;
+    double      p50     = 0.0;
+    double      p95     = 0.0;
+    double      p99     = 0.0;
+    double      max     = 0.0;
+    std::size_t hitches = 0; ///< Frames of the window over the hitch threshold.
+};
+
+/// @brief Collect the frame times of the main loop: percentiles, hitches and histogram.
+///
+/// An average frame rate hides the stutter: a 100 ms frame every second barely moves it.
+/// FrameStats keeps the last frames in a ring and summarizes the distribution: p50 tells the
+/// usual frame, p99 and max the worst ones, and the hitches count the frames over a
+/// threshold. The histogram counts every frame since the last reset() in logarithmic buckets,
+/// two per octave, from kHistogramMin.
+///
+/// addFrame() is called by a single thread, the main loop. The readers may run on any thread:
+/// the ring is lock-free, a reader copies the frames and drops the ones overwritten during the
+/// copy. reset() is only called by the writer thread.
+class FrameStats {
+public:
+    /// @brief Number of frames kept by default, about 17 s at 60 FPS.
+    static constexpr std::size_t kDefaultCapacity = 1024;
+    /// @brief Number of buckets of the histogram, the last one has no upper bound.
+    static constexpr std::size_t kHistogramBuckets = 24;
+    /// @brief Upper bound of the first bucket of the histogram, in ms.
+    static constexpr double kHistogramMin = 0.25;
+
+    /// @param capacity Number of frames kept, rounded up to a power of 2.
+    explicit FrameStats(std::size_t capacity = kDefaultCapacity);
+
+    FrameStats(const FrameStats&)            = delete;
+    FrameStats& operator=(const FrameStats&) = delete;
+
+    /// @brief Return the number of frames kept.
+    [[nodiscard]] std::size_t capacity() const noexcept { return mCapacity; }
+
+    /// @brief Set the frame time over which a frame is a hitch, 1/30 s by default.
+    void setHitchThreshold(Time threshold) noexcept;
+    [[nodiscard]] Time hitchThreshold() const noexcept;
+
+    /// @brief Add a frame, from the writer thread.
+    /// @param frameTime Time since the previous frame, e.g. Timer::deltaTime().
+    /// @param phases Duration of each phase, in ms.
+    void addFrame(Time frameTime, const FramePhaseTimes& phases = {}) noexcept;
+
+    /// @brief Remove the frames and clear the counters, from the writer thread.
+    void reset() noexcept;
+
+    /// @brief Return the number of frames added since the last reset().
+    [[nodiscard]] std::uint64_t frameCount() const noexcept;
+
+    /// @brief Return the number of hitches since the last reset().
+    [[nodiscard]] std::uint64_t hitchCount() const noexcept;
+
+    /// @brief Return the frames of the window, the oldest first.
+    [[nodiscard]] std::vector<FrameSample> frames() const;
+
+    /// @brief Return the distribution of the frame times of the window.
+    [[nodiscard]] FrameTimeSummary summary() const;
+
+    /// @brief Return the distribution of the duration of a phase over the window.
+    ///
+    /// FrameTimeSummary::hitches counts the hitch frames, whatever the phase.
+    [[nodiscard]] FrameTimeSummary summary(FramePhase phase) const;
+
+    /// @brief Return the number of frames of each bucket since the last reset().
+    [[nodiscard]] std::array<std::uint64_t, kHistogramBuckets> histogram() const noexcept;
+
+    /// @brief Return the lower bound of a bucket of the histogram, in ms.
+    [[nodiscard]] static double bucketLowerBound(std::size_t bucket) noexcept;
+
+    /// @brief Return the bucket of the histogram counting a frame time, in ms.
+    [[nodiscard]] static std::size_t bucketOf(double milliseconds) noexcept;
+
+    /// @brief Write the summary of the frame time and of each phase as CSV:
+    ///        series, frames, avg, p50, p95, p99, max, hitches. A last line gives the total
+    ///        number of frames and hitches since the last reset().
+    /// @return false if the file can not be written.
+    bool exportCsv(const std::filesystem::path& path) const;
+
+    /// @brief Write the histogram as CSV: lower bound in ms, frames.
+    /// @return false if the file can not be written.
+    bool exportHistogramCsv(const std::filesystem::path& path) const;
+
+private:
+    static constexpr std::size_t kFields = 1 + kFramePhaseCount;
+
+    /// @brief A frame of the ring, atomic so that a reader racing the writer reads a value.
+    struct Slot {
+        std::array<std::atomic<float>, kFields> fields;
+    };
+
+    [[nodiscard]] FrameTimeSummary summarize(std::size_t field) const;
+
+    /// @brief The ring has twice the capacity: the slot written during a copy of the window is
+    ///        not in the window.
+    std::size_t             mCapacity;
+    std::size_t             mMask;
+    std::unique_ptr<Slot[]> mSlots;
+
+    /// @brief Frames written since the last reset(), published after the slot is written.
+    std::atomic<std::uint64_t> mWritten{0};
+    std::atomic<std::uint64_t> mHitches{0};
+    std::atomic<float>         mHitchThreshold{1000.0f / 30.0f}; ///< In ms.
+
+    std::array<std::atomic<std::uint64_t>, kHistogramBuckets> mHistogram{};
+};
+
+/// @brief Show the graph of the frame times, the percentiles and the histogram in an ImGui
+///        window. Call between ImGui::NewFrame() and ImGui::Render().
+/// @param stats The statistics shown.
+/// @param open Close button of the window, may be nullptr.
+void showFrameStatsWindow(const FrameStats& stats, bool* open = nullptr);
+
+} // namespace fuse
@@ -0,0 +1,181 @@
+#pragma once
+#include "Profiler.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace fuse {
+
+/// @brief Last, minimum, average and maximum of the last N samples.
+class SlidingStats {
+public:
+    /// @param window Number of samples kept, at least 1.
+    explicit SlidingStats(std::size_t window = 120);
+
+    /// @brief Add a sample, the oldest one is dropped when the window is full.
+    void add(double value);
+
+    /// @brief Remove every sample.
+    void reset() noexcept;
+
+    [[nodiscard]] std::size_t count() const noexcept { return mCount; }
+    [[nodiscard]] double      last() const noexcept { return mLast; }
+    [[nodiscard]] double      min() const noexcept { return mMin; }
+    [[nodiscard]] double      max() const noexcept { return mMax; }
+    [[nodiscard]] double      average() const noexcept {
+        return mCount == 0 ? 0.0 : mSum / static_cast<double>(mCount);
+    }
+
+private:
+    std::vector<double> mSamples;
+    std::size_t         mNext{0};
+    std::size_t         mCount{0};
+    double              mSum{0.0};
+    double              mLast{0.0};
+    double              mMin{0.0};
+    double              mMax{0.0};
+};
+
+/// @brief The GPU time of a scope over the last frames, in milliseconds.
+struct GpuScopeStats {
+    const char*   name;  ///< Name of the scope.
+    std::uint32_t depth; ///< Number of enclosing scopes, the frame is 0.
+    SlidingStats  time;  ///< Duration of the scope in each frame, in ms.
+};
+
+/// @brief A scope of the last frame read back from the GPU.
+struct GpuScopeResult {
+    const char*   name;  ///< Name of the scope.
+    std::uint64_t begin; ///< Nanoseconds since the start of the frame on the GPU.
+    std::uint64_t end;   ///< Nanoseconds since the start of the frame on the GPU.
+    std::uint32_t depth; ///< Number of enclosing scopes, the frame is 0.
+};
+
+/// @brief Measure the GPU time of render scopes with OpenGL timestamp queries.
+///
+/// The commands are run by the GPU after the calls return, so the CPU time of onRender()
+/// does not tell the GPU cost. Each scope writes a GL_TIMESTAMP query at its start and at
+/// its end, unlike GL_TIME_ELAPSED queries the scopes can be nested.
+///
+/// The queries of a frame are read back kFramesInFlight - 1 frames later, only once the GPU
+/// reports them available: reading never stalls the pipeline. When the GPU is further behind,
+/// the frame is not measured.
+///
+/// Requires the OpenGL context current on the calling thread, the timestamp queries are core
+/// since OpenGL 3.3 (Mesa llvmpipe supports them). Without timestamp support, every call
+/// does nothing.
+class GpuProfiler {
+public:
+    /// @brief Number of frames measured at the same time.
+    static constexpr std::size_t kFramesInFlight = 4;
+    /// @brief Maximum number of scopes of a frame, frame included, the next ones are ignored.
+    static constexpr std::size_t kMaxScopes = 256;
+
+    /// @param window Number of frames of the statistics.
+    explicit GpuProfiler(std::size_t window = 120);
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler&)            = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    /// @brief Return false if the context has no timestamp queries.
+    [[nodiscard]] bool isSupported() const noexcept { return mSupported; }
+
+    /// @brief Enable or disable the measure of the next frames, enabled by default.
+    void setEnabled(bool enabled) noexcept { mEnabled = enabled; }
+    [[nodiscard]] bool isEnabled() const noexcept { return mEnabled; }
+
+    /// @brief Read the results of the previous frames available and start a frame.
+    void beginFrame();
+
+    /// @brief End the frame, call before the swap.
+    void endFrame();
+
+    /// @brief Start a scope, see FUSE_GPU_PROFILE_SCOPE().
+    /// @param name Name of the scope, must have static storage.
+    /// @return The scope to give to endScope().
+    std::uint32_t beginScope(const char* name);
+
+    /// @brief End a scope started by beginScope().
+    void endScope(std::uint32_t scope);
+
+    /// @brief Return the statistics of the scopes, in order of their first appearance.
+    [[nodiscard]] const std::vector<GpuScopeStats>& stats() const noexcept { return mStats; }
+
+    /// @brief Return the scopes of the last frame read back, in order of start.
+    [[nodiscard]] const std::vector<GpuScopeResult>& lastFrame() const noexcept {
+        return mLastFrame;
+    }
+
+    /// @brief Return the number of frames not measured because the GPU was too far behind.
+    [[nodiscard]] std::uint64_t droppedFrames() const noexcept { return mDroppedFrames; }
+
+    /// @brief Write the statistics as CSV: scope, depth, samples, last, min, average, max.
+    /// @return false if the file can not be written.
+    bool exportCsv(const std::filesystem::path& path) const;
+
+private:
+    static constexpr std::uint32_t kInvalidScope = ~std::uint32_t{0};
+
+    struct Scope {
+        const char*   name;
+        std::uint32_t beginQuery;
+        std::uint32_t endQuery;
+        std::uint32_t depth;
+    };
+
+    struct Frame {
+        std::array<std::uint32_t, kMaxScopes * 2> queries{};
+        std::vector<Scope>                        scopes;
+        std::uint32_t                             queryCount{0};
+        bool                                      pending{false};
+    };
+
+    void resolve(Frame& frame);
+    GpuScopeStats& statsOf(const char* name, std::uint32_t depth);
+
+    std::array<Frame, kFramesInFlight> mFrames;
+    std::vector<GpuScopeStats>         mStats;
+    std::vector<GpuScopeResult>        mLastFrame;
+    std::size_t                        mWindow;
+    std::uint64_t                      mFrameIndex{0};
+    std::uint64_t                      mDroppedFrames{0};
+    Frame*                             mCurrent{nullptr};
+    std::uint32_t                      mFrameScope{kInvalidScope};
+    std::uint32_t                      mDepth{0};
+    bool                               mSupported{false};
+    bool                               mEnabled{true};
+};
+
+/// @brief Measure the GPU time of a scope, see GpuProfiler::beginScope().
+class GpuProfileScope {
+public:
+    GpuProfileScope(GpuProfiler& profiler, const char* name)
+        : mProfiler(profiler)
+        , mScope(profiler.beginScope(name)) {}
+
+    ~GpuProfileScope() { mProfiler.endScope(mScope); }
+
+    GpuProfileScope(const GpuProfileScope&)            = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    GpuProfiler&  mProfiler;
+    std::uint32_t mScope;
+};
+
+} // namespace fuse
+
+#if FUSE_PROFILER_ENABLE
+/// @brief Measure the GPU time of the rest of the enclosing scope, @p name must have static
+///        storage.
+#    define FUSE_GPU_PROFILE_SCOPE(profiler, name)                                     \
+        const fuse::GpuProfileScope FUSE_PROFILE_CONCAT(fuseGpuProfileScope, __LINE__)( \
+          profiler, name)
+#else
+#    define FUSE_GPU_PROFILE_SCOPE(profiler, name)
+#endif
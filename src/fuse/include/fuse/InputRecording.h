@@ -0,0 +1,109 @@
+#pragma once
+#include "Time.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+union SDL_Event;
+
+namespace fuse {
+
+/// @brief Return true for the events recorded by InputRecorder: the keyboard and mouse events.
+///
+/// The other events describe the live window (resize, focus...) or hold pointers (text input,
+/// drop) and are not recorded.
+[[nodiscard]] bool isRecordedEvent(const SDL_Event& event) noexcept;
+
+/// @brief Write the input events and the duration of each frame to a file, for InputReplay.
+///
+/// The file starts with "FUSEINPT" and a 32 bits version, then each frame is written as its
+/// number (32 bits), its number of events (32 bits) and its duration in seconds (64 bits
+/// float), followed by its events: the SDL event type (32 bits), the size of the event
+/// structure of this type (32 bits) and the structure. Integers are in the byte order of the
+/// machine.
+class InputRecorder {
+public:
+    InputRecorder() = default;
+    ~InputRecorder() { close(); }
+
+    InputRecorder(const InputRecorder&)            = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    /// @brief Start a recording, the file is overwritten if it exists.
+    /// @return false if the file can not be opened.
+    bool open(const std::filesystem::path& path);
+
+    /// @brief Close the file, the events of the frame in progress are dropped.
+    void close();
+
+    [[nodiscard]] bool isOpen() const noexcept { return mFile != nullptr; }
+
+    /// @brief Keep an event of the frame in progress, see isRecordedEvent().
+    /// @return false if the event is not recorded.
+    bool record(const SDL_Event& event);
+
+    /// @brief Write the frame in progress with its duration and start the next one.
+    void endFrame(Time delta);
+
+    /// @brief Return the number of frames written.
+    [[nodiscard]] std::uint32_t frameCount() const noexcept { return mFrame; }
+
+private:
+    std::FILE*             mFile{nullptr};
+    std::vector<std::byte> mEvents;
+    std::uint32_t          mEventCount{0};
+    std::uint32_t          mFrame{0};
+};
+
+/// @brief Feed the frames of a recording of InputRecorder back, with their recorded durations.
+///
+/// The simulation and the camera then follow the same path on every run, whatever the frame
+/// rate of the machine: the frame times of different builds can be compared.
+class InputReplay {
+public:
+    /// @brief Read a recording.
+    /// @return The replay, or a description of the error.
+    static std::expected<InputReplay, std::string> load(const std::filesystem::path& path);
+
+    /// @brief Return the number of frames of the recording.
+    [[nodiscard]] std::uint32_t frameCount() const noexcept {
+        return static_cast<std::uint32_t>(mFrames.size());
+    }
+
+    /// @brief Return true once every frame is started.
+    [[nodiscard]] bool finished() const noexcept { return mNextFrame == mFrames.size(); }
+
+    /// @brief Start the next frame.
+    /// @pre !finished()
+    /// @return The recorded duration of the frame.
+    Time nextFrame();
+
+    /// @brief Return the next event of the current frame.
+    /// @param event Receives the event, its window is set to @p windowId: the window of the
+    ///              recording may have another id.
+    /// @param windowId SDL id of the window receiving the events.
+    /// @return false when the events of the frame are all returned.
+    bool pollEvent(SDL_Event& event, std::uint32_t windowId);
+
+private:
+    struct Frame {
+        double        delta;      ///< Recorded duration, in seconds.
+        std::size_t   offset;     ///< Position of the first event in mData.
+        std::uint32_t eventCount; ///< Number of events.
+    };
+
+    InputReplay() = default;
+
+    std::string        mData;
+    std::vector<Frame> mFrames;
+    std::size_t        mNextFrame{0};
+    std::size_t        mPosition{0};
+    std::uint32_t      mEventsLeft{0};
+};
+
+} // namespace fuse
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fuse {
+
+class JobCounter;
+
+/// @brief Run jobs on a pool of worker threads.
+///
+/// Each worker owns a deque of jobs: it pushes and pops the jobs it schedules at the back and,
+/// when its deque is empty, steals the oldest jobs of the other workers. The thread which
+/// created the system is a worker without a thread of its own, its jobs are run by the other
+/// workers or by itself while it waits. Jobs scheduled from other threads go to a shared queue.
+///
+/// Waiting never blocks: wait() runs the pending jobs until the counter is done, so a job can
+/// schedule other jobs and wait for them.
+///
+/// @code
+/// fuse::JobSystem  jobs;
+/// fuse::JobCounter loaded;
+/// jobs.schedule([&] { loadMesh(); }, &loaded);
+/// jobs.schedule([&] { loadTexture(); }, &loaded);
+/// jobs.wait(loaded);
+///
+/// jobs.parallelFor(0, particles.size(), [&](std::size_t first, std::size_t last) {
+///     for (std::size_t i = first; i < last; i++) {
+///         particles[i].update(deltaTime);
+///     }
+/// });
+/// @endcode
+///
+/// @warning A job must not throw, an exception escaping a job terminates the program.
+class JobSystem {
+public:
+    /// @brief The function run by a job.
+    using Function = std::move_only_function<void()>;
+
+    /// @brief Start the worker threads.
+    /// @param workerCount Number of worker threads, not counting the calling thread.
+    ///                    With 0 the jobs are run by the threads calling wait().
+    explicit JobSystem(unsigned workerCount = DefaultWorkerCount());
+
+    /// @brief Run the jobs left and stop the worker threads.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem(JobSystem&&)                 = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem& operator=(JobSystem&&)      = delete;
+
+    /// @brief Return the number of worker threads to use all the cores, one less than the
+    ///        number of hardware threads since the calling thread also runs jobs.
+    [[nodiscard]] static unsigned DefaultWorkerCount() noexcept;
+
+    /// @brief Return the number of worker threads.
+    [[nodiscard]] unsigned workerCount() const noexcept {
+        return static_cast<unsigned>(mWorkers.size() - 1);
+    }
+
+    /// @brief Schedule a job.
+    /// @param function The function to run.
+    /// @param counter Counter incremented now and decremented when the job is done, or null.
+    void schedule(Function function, JobCounter* counter = nullptr);
+
+    /// @brief Schedule a job to start once the jobs of @p dependency are done.
+    /// @param function The function to run.
+    /// @param dependency The job starts when this counter is done.
+    /// @param counter Counter incremented now and decremented when the job is done, or null.
+    void schedule(Function function, JobCounter& dependency, JobCounter* counter = nullptr);
+
+    /// @brief Run the pending jobs until the jobs of @p counter are done.
+    void wait(const JobCounter& counter);
+
+    /// @brief Call @p function on sub-ranges of [@p begin, @p end) in parallel.
+    ///
+    /// The range is split in chunks of @p grainSize indices, @p function is called once per
+    /// chunk with the first and past the last index of the chunk. Return when all the chunks
+    /// are done, the calling thread runs chunks meanwhile.
+    ///
+    /// @param begin The first index.
+    /// @param end Past the last index.
+    /// @param function The function to call, `void(std::size_t first, std::size_t last)`.
+    /// @param grainSize The size of the chunks, 0 to split the range in a few chunks per thread.
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, F&& function, std::size_t grainSize = 0);
+
+private:
+    friend class JobCounter;
+    struct Job;
+    struct Worker;
+
+    /// @brief Index of the worker of the calling thread, or kNoWorker.
+    [[nodiscard]] std::size_t currentWorker() const noexcept;
+
+    void push(Job* job);
+    [[nodiscard]] Job* findJob(std::size_t worker);
+    void               execute(Job* job);
+    void               finish(JobCounter& counter);
+    void               workerMain(std::size_t worker);
+
+    static constexpr std::size_t kNoWorker = static_cast<std::size_t>(-1);
+
+    std::vector<std::unique_ptr<Worker>> mWorkers; ///< Worker 0 is the owner thread.
+    std::thread::id                      mOwnerThread;
+
+    std::mutex        mSharedMutex;
+    std::vector<Job*> mSharedJobs; ///< Jobs scheduled from the threads which are not workers.
+
+    std::atomic<unsigned> mWakeEpoch{0}; ///< Incremented to wake the sleeping workers.
+    std::atomic<bool>     mRunning{true};
+};
+
+/// @brief Count the unfinished jobs of a group.
+///
+/// The counter is incremented when a job is scheduled with it and decremented when the job is
+/// done. JobSystem::wait() runs jobs until a counter is done, and a job can be scheduled to
+/// start once a counter is done.
+///
+/// @warning The counter must outlive its jobs, wait for it before destroying it.
+class JobCounter {
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter(JobCounter&&)                 = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter& operator=(JobCounter&&)      = delete;
+
+    /// @brief Return true when all the jobs of the counter are done.
+    [[nodiscard]] bool isDone() const noexcept {
+        // mFinishing is checked after mCount, the thread which decremented the last job may
+        // still use the counter.
+        return mCount.load() == 0 && mFinishing.load() == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<unsigned>        mCount{0};
+    std::atomic<unsigned>        mFinishing{0}; ///< Threads in JobSystem::finish().
+    std::mutex                   mMutex;
+    std::vector<JobSystem::Job*> mContinuations; ///< Jobs waiting for the counter.
+};
+
+template <typename F>
+void JobSystem::parallelFor(std::size_t begin, std::size_t end, F&& function,
+                            std::size_t grainSize) {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t count = end - begin;
+    if (grainSize == 0) {
+        // A few chunks per thread, so the threads finishing first steal from the others.
+        const std::size_t chunks = 4 * (std::size_t{workerCount()} + 1);
+        grainSize                = std::max<std::size_t>(1, (count + chunks - 1) / chunks);
+    }
+    const std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+    JobCounter counter;
+    for (std::size_t chunk = 1; chunk < chunkCount; chunk++) {
+        const std::size_t first = begin + chunk * grainSize;
+        const std::size_t last  = first + std::min(grainSize, end - first);
+        schedule([&function, first, last] { function(first, last); }, &counter);
+    }
+    function(begin, begin + std::min(grainSize, count));
+    wait(counter);
+}
+
+} // namespace fuse
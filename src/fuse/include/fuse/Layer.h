@@ -1,21 +1,26 @@
 #pragma once
 #include "Time.h"
 
-union SDL_Event;
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace fuse {
 
-class Event;
-
 /// @brief Base class for application layer.
 /// Layers are used to separate different states of the application.
 /// They can be used for game states, editor layers, etc.
 /// They are managed by the LayerStack class.
-/// Each layer can handle events, update there state, render and use ImGui.
+/// Each layer can update there state, render and use ImGui. The events are handled by
+/// subscriptions to the EventBus of the application, see Application::getEventBus().
 class Layer {
 public:
-    /// @brief Default constructor. Does nothing.
-    Layer() = default;
+    /// @brief Construct a layer.
+    /// @param name Name of the layer in the profiler, must have static storage (e.g. a string
+    ///             literal).
+    explicit Layer(const char* name = "Layer")
+        : mName(name) {}
 
     Layer(const Layer&)            = delete;
     Layer(Layer&&)                 = delete;
@@ -24,25 +29,86 @@ public:
 
     virtual ~Layer() = default;
 
-    /// @brief Handle an event.
-    /// @param event The event to handle.
-    /// @return True if the event was handled, false otherwise.
-    /// @note Default implementation return false.
-    virtual bool onEvent(const SDL_Event&) { return false; }
+    /// @brief Return the name of the layer.
+    [[nodiscard]] const char* getName() const { return mName; }
 
     /// @brief Call each frame to let the layer update its state.
     /// @param deltaTime Time since last frame in millisecond.
     /// @note Default implementation does nothing.
     virtual void onUpdate(Time /*deltaTime*/) {}
 
+    /// @brief Call at a fixed rate to let the layer advance its simulation.
+    ///
+    /// Called 0 or more times per frame, before onUpdate(), so that the simulation runs at the
+    /// rate set by Application::setFixedTimestep() whatever the frame rate.
+    /// @param step The fixed duration of a step.
+    /// @note Default implementation does nothing.
+    virtual void onFixedUpdate(Time /*step*/) {}
+
     /// @brief Call each frame to let the layer render its content.
+    /// @param alpha Interpolation factor in [0, 1) between the state of the previous fixed step
+    ///              (0) and the state of the last one (1), see FixedTimestep::alpha().
     /// @note Default implementation does nothing.
     /// @note This is different from onImGui which is used to render ImGui content
-    virtual void onRender() {}
+    virtual void onRender(float /*alpha*/) {}
 
     /// @brief Call each frame to let the layer render its ImGui content.
     /// @note Default implementation does nothing.
     virtual void onImGui() {}
+
+private:
+    const char* mName;
 };
 
+/// @brief The callbacks of a layer called each frame by the application.
+enum class LayerPhase : std::uint8_t { FixedUpdate, Update, Render, ImGui, Count };
+
+inline constexpr std::size_t kLayerPhaseCount = static_cast<std::size_t>(LayerPhase::Count);
+
+/// @brief A bit per LayerPhase, set when the layer needs the callback of the phase.
+using LayerHooks = std::uint8_t;
+
+/// @brief Every callback, for a layer of unknown type.
+inline constexpr LayerHooks kAllLayerHooks = (1u << kLayerPhaseCount) - 1;
+
+/// @brief Return the bit of a phase in LayerHooks.
+[[nodiscard]] constexpr LayerHooks layerHook(LayerPhase phase) noexcept {
+    return static_cast<LayerHooks>(1u << static_cast<unsigned>(phase));
+}
+
+/// @brief Return the callbacks overridden by @p T, or by one of its bases below Layer.
+///
+/// `&T::onUpdate` names the declaration found from T: its type is a pointer to a member of
+/// Layer only when no class between T and Layer overrides it.
+template <std::derived_from<Layer> T>
+[[nodiscard]] constexpr LayerHooks layerHooksOf() noexcept {
+    LayerHooks hooks = 0;
+    if (!std::is_same_v<decltype(&T::onFixedUpdate), void (Layer::*)(Time)>) {
+        hooks |= layerHook(LayerPhase::FixedUpdate);
+    }
+    if (!std::is_same_v<decltype(&T::onUpdate), void (Layer::*)(Time)>) {
+        hooks |= layerHook(LayerPhase::Update);
+    }
+    if (!std::is_same_v<decltype(&T::onRender), void (Layer::*)(float)>) {
+        hooks |= layerHook(LayerPhase::Render);
+    }
+    if (!std::is_same_v<decltype(&T::onImGui), void (Layer::*)()>) {
+        hooks |= layerHook(LayerPhase::ImGui);
+    }
+    return hooks;
+}
+
+/// @brief Return the callbacks of a layer known by its static type @p T.
+///
+/// layerHooksOf<T>() when T is final. Otherwise the layer may be of a class derived from T
+/// overriding other callbacks, and every callback is returned.
+template <std::derived_from<Layer> T>
+[[nodiscard]] constexpr LayerHooks knownLayerHooks() noexcept {
+    if constexpr (std::is_final_v<T>) {
+        return layerHooksOf<T>();
+    } else {
+        return kAllLayerHooks;
+    }
+}
+
 } // namespace fuse
@@ -1,11 +1,28 @@
 #pragma once
 #include "Layer.h"
 
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
 #include <vector>
 
 namespace fuse {
 
-/// @brief
+/// @brief The layers of the application, the layers below the overlays.
+///
+/// The stack keeps a dispatch list per LayerPhase with the enabled layers that override the
+/// callback of the phase, detected when a layer is pushed with its type (see knownLayerHooks()).
+/// forEach() walks the list of a phase: a layer using the empty default of a callback costs
+/// nothing in that phase, nor a disabled layer in any phase. The lists are rebuilt on the next
+/// forEach() after a change.
+///
+/// The layers can be pushed, popped, enabled and disabled from a callback called by
+/// forEach(): a pushed layer joins the stack once the outermost forEach() returns, a popped or
+/// disabled layer is not called anymore, an enabled layer is called from the next forEach().
+///
+/// The stack deletes the layers it still has when it is cleared or destroyed, a popped layer
+/// belongs to the caller.
 class LayerStack {
 public:
     LayerStack() = default;
@@ -16,43 +33,117 @@ public:
     LayerStack& operator=(const LayerStack&) = delete;
     LayerStack& operator=(LayerStack&&)      = delete;
 
+    /// @brief Delete the layers, not allowed in forEach().
     void clear();
 
-    /// @brief
-    /// @return
+    /// @brief Return the number of layers and overlays, the pushes deferred by forEach() not
+    ///        included.
     [[nodiscard]] size_t size() const { return mLayers.size(); }
 
-    /// @brief
-    /// @param layer
-    void pushLayer(Layer* layer);
+    /// @brief Add a layer above the other layers and below the overlays.
+    /// @param hooks The callbacks the layer overrides, all when the type is unknown.
+    void pushLayer(Layer* layer, LayerHooks hooks = kAllLayerHooks);
 
-    /// @brief
-    /// @param overlay
-    void pushOverlay(Layer* overlay);
+    /// @brief Add a layer, only its overridden callbacks are called when @p T is final.
+    template <std::derived_from<Layer> T>
+    void pushLayer(T* layer) {
+        pushLayer(static_cast<Layer*>(layer), knownLayerHooks<T>());
+    }
 
-    /// @brief
-    /// @param layer
+    /// @brief Add an overlay above the layers and the other overlays.
+    /// @param hooks The callbacks the overlay overrides, all when the type is unknown.
+    void pushOverlay(Layer* overlay, LayerHooks hooks = kAllLayerHooks);
+
+    /// @brief Add an overlay, only its overridden callbacks are called when @p T is final.
+    template <std::derived_from<Layer> T>
+    void pushOverlay(T* overlay) {
+        pushOverlay(static_cast<Layer*>(overlay), knownLayerHooks<T>());
+    }
+
+    /// @brief Remove a layer, the caller owns it after.
     void popLayer(Layer* layer);
 
-    /// @brief
-    /// @param overlay
+    /// @brief Remove an overlay, the caller owns it after.
     void popOverlay(Layer* overlay);
 
-    /// @brief
-    /// @return
+    /// @brief Enable or disable the callbacks of a layer, enabled when pushed.
+    ///
+    /// The layer keeps its place in the stack.
+    void setEnabled(Layer* layer, bool enabled);
+
+    /// @brief Return true if the layer is in the stack and enabled.
+    [[nodiscard]] bool isEnabled(const Layer* layer) const;
+
+    /// @brief Call @p function with each enabled layer overriding the callback of @p phase,
+    ///        from the bottom of the stack to the top.
+    template <typename F>
+    void forEach(LayerPhase phase, F&& function) {
+        const Iteration iteration(*this);
+        // By index: a callback can pop or disable a layer, it is replaced by nullptr.
+        const std::vector<Layer*>& layers = mDispatch[static_cast<std::size_t>(phase)];
+        for (std::size_t i = 0; i < layers.size(); i++) {
+            if (Layer* layer = layers[i]) {
+                function(layer);
+            }
+        }
+    }
+
+    /// @brief Return the layers called by forEach() for a phase.
+    [[nodiscard]] std::span<Layer* const> dispatchList(LayerPhase phase);
+
+    /// @brief Return the layers, enabled or not, from the bottom of the stack to the top.
+    /// @note Invalidated by a push or a pop outside forEach().
     std::vector<Layer*>::iterator begin() { return mLayers.begin(); }
 
     std::vector<Layer*>::reverse_iterator rbegin() { return mLayers.rbegin(); }
 
-    /// @brief
-    /// @return
     std::vector<Layer*>::iterator end() { return mLayers.end(); }
 
     std::vector<Layer*>::reverse_iterator rend() { return mLayers.rend(); }
 
 private:
+    /// @brief Count the nested forEach(), the changes wait for the outermost one to return.
+    class Iteration {
+    public:
+        explicit Iteration(LayerStack& stack);
+        ~Iteration();
+
+        Iteration(const Iteration&)            = delete;
+        Iteration& operator=(const Iteration&) = delete;
+
+    private:
+        LayerStack& mStack;
+    };
+
+    /// @brief A push or a pop requested during forEach().
+    struct PendingChange {
+        enum class Kind : std::uint8_t { PushLayer, PushOverlay, PopLayer, PopOverlay };
+        Kind       kind;
+        Layer*     layer;
+        LayerHooks hooks;
+        bool       enabled;
+    };
+
+    /// @brief The state of a layer, at the same index as the layer in mLayers.
+    struct Slot {
+        LayerHooks hooks;
+        bool       enabled;
+    };
+
+    void insert(std::size_t index, Layer* layer, LayerHooks hooks);
+    void erase(Layer* layer, bool overlay);
+    void removeFromDispatch(const Layer* layer);
+    void applyPendingChanges();
+    void rebuild();
+
     std::vector<Layer*> mLayers;
+    std::vector<Slot>   mSlots;
     unsigned int        mLayerInsertIndex{};
+
+    std::array<std::vector<Layer*>, kLayerPhaseCount> mDispatch;
+    std::vector<PendingChange>                        mPending;
+    unsigned int                                      mIterationDepth{0};
+    bool                                              mDirty{false};
 };
 
 } // namespace fuse
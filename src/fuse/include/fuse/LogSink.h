@@ -0,0 +1,84 @@
+#pragma once
+#include "Logger.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace fuse {
+
+/// @brief A message given to the sinks.
+struct LogRecord {
+    LogCategory      category; ///< The subsystem which logged the message.
+    LogLevel         level;    ///< The level of the message.
+    double           time;     ///< Seconds since log_initialize() when the message was logged.
+    std::string_view message;  ///< The message, valid during LogSink::write() only.
+};
+
+/// @brief Destination of the log messages.
+///
+/// The sinks are called by the thread of the logger (or by the logging thread before
+/// log_initialize()), one at a time: a sink does not need to be thread safe.
+/// The messages of a batch are given to write() then flush() is called once.
+class LogSink {
+public:
+    LogSink() = default;
+
+    LogSink(const LogSink&)            = delete;
+    LogSink(LogSink&&)                 = delete;
+    LogSink& operator=(const LogSink&) = delete;
+    LogSink& operator=(LogSink&&)      = delete;
+
+    virtual ~LogSink() = default;
+
+    /// @brief Write a message, may be buffered until flush().
+    virtual void write(const LogRecord& record) = 0;
+
+    /// @brief Write the buffered messages.
+    virtual void flush() {}
+};
+
+/// @brief Write the messages on the standard output, `[Level][Category] message`.
+///
+/// The category is omitted for the General category, as for the other sinks.
+class ConsoleSink final : public LogSink {
+public:
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+private:
+    std::string mBuffer;
+};
+
+/// @brief Write the messages in a file, `[time] [Level][Category] message`, and rotate the files.
+///
+/// When the file would exceed the maximum size, it is renamed `<path>.1`, the previous
+/// `<path>.1` becomes `<path>.2` and so on, the oldest beyond the maximum count is deleted.
+class RotatingFileSink final : public LogSink {
+public:
+    /// @brief Open the file, the previous content is kept.
+    /// @param path The path of the current log file.
+    /// @param maxSize Maximum size of a file in bytes.
+    /// @param maxFiles Number of old files kept.
+    RotatingFileSink(std::filesystem::path path, std::uintmax_t maxSize = 8 * 1024 * 1024,
+                     unsigned maxFiles = 3);
+    ~RotatingFileSink() override;
+
+    void write(const LogRecord& record) override;
+    void flush() override;
+
+private:
+    void open();
+    void rotate();
+
+    std::filesystem::path mPath;
+    std::uintmax_t        mMaxSize;
+    unsigned              mMaxFiles;
+    std::uintmax_t        mSize{}; ///< Size of the file, including the buffer.
+    std::FILE*            mFile{};
+    std::string           mBuffer;
+};
+
+} // namespace fuse
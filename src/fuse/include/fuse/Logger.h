@@ -1,9 +1,22 @@
 #pragma once
 
-#include <string_view>
-
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+
+/// @def FUSE_LOG_LEVEL
+/// @brief Most verbose level compiled in, 0 (Fatal) to 5 (Verbose), set by the FUSE_LOG_LEVEL
+///        CMake option. The log macros of the more verbose levels expand to nothing.
+#ifndef FUSE_LOG_LEVEL
+#    define FUSE_LOG_LEVEL 5
+#endif
 
 namespace fuse {
 
@@ -23,33 +36,169 @@ enum class LogLevel {
     Verbose = 5
 };
 
+/// @brief Return the name of a log level.
+[[nodiscard]] std::string_view toString(LogLevel level) noexcept;
+
+/// @brief Subsystem logging a message, each category has its own runtime level.
+enum class LogCategory : std::uint8_t {
+    General, ///< Messages of the FUSE_INFO() like macros: application, window, platform.
+    Render,  ///< OpenGL debug output.
+    Math,    ///< Math kernels and their dispatch.
+};
+
+/// @brief Number of log categories.
+inline constexpr std::size_t kLogCategoryCount = 3;
+
+/// @brief Return the name of a log category.
+[[nodiscard]] std::string_view toString(LogCategory category) noexcept;
+
+/// @brief Most verbose level compiled in, see FUSE_LOG_LEVEL.
+inline constexpr LogLevel kCompiledLogLevel = static_cast<LogLevel>(FUSE_LOG_LEVEL);
+
+/// @brief Return true if the messages of @p level are compiled in. Fatal always is.
+[[nodiscard]] constexpr bool isLogLevelCompiled(LogLevel level) noexcept {
+    return level == LogLevel::Fatal || level <= kCompiledLogLevel;
+}
+
+namespace detail {
+
+/// @brief Runtime level of each category, see log_set_level().
+extern std::array<std::atomic<LogLevel>, kLogCategoryCount> logLevels;
+
+/// @brief Buffer of the formatted messages of the calling thread, reused between messages.
+std::string& logFormatBuffer() noexcept;
+
+} // namespace detail
+
+/// @brief Set the most verbose level written for a category, at runtime.
+///
+/// The level is checked before the message is formatted: a message filtered out costs a load
+/// and a branch. Fatal messages are never filtered.
+void log_set_level(LogCategory category, LogLevel level) noexcept;
+
+/// @brief Set the most verbose level written for every category.
+void log_set_level(LogLevel level) noexcept;
+
+/// @brief Return the most verbose level written for a category.
+[[nodiscard]] LogLevel log_get_level(LogCategory category) noexcept;
+
+/// @brief Return true if a message of @p level and @p category would be written.
+[[nodiscard]] inline bool log_enabled(LogLevel level, LogCategory category) noexcept {
+    return isLogLevelCompiled(level) &&
+           (level == LogLevel::Fatal ||
+            level <= detail::logLevels[static_cast<std::size_t>(category)].load(
+                       std::memory_order_relaxed));
+}
+
+class LogSink;
+
+/// @brief What log_message() does when the queue of the logger is full.
+enum class LogOverflow {
+    /// @brief Drop the message, the number of dropped messages is logged later.
+    Drop,
+    /// @brief Wait for the logger thread to make room.
+    Block,
+};
+
+/// @brief Configuration of the logging system.
+struct LogConfig {
+    /// @brief Maximum number of messages waiting to be written, rounded up to a power of 2.
+    std::size_t capacity = 8192;
+    /// @brief What to do when the queue is full. Fatal messages always wait.
+    LogOverflow overflow = LogOverflow::Drop;
+    /// @brief Add a ConsoleSink.
+    bool console = true;
+};
+
+/// @brief Counters of the logging system since log_initialize().
+struct LogStats {
+    std::uint64_t written = 0; ///< Messages given to the sinks.
+    std::uint64_t dropped = 0; ///< Messages dropped because the queue was full.
+};
+
 /// @brief Initialize logging system
-void log_initialize();
+///
+/// Start the logger thread: log_message() then only copies the message in a queue and the
+/// thread writes the messages to the sinks by batches. Before log_initialize() and after
+/// log_shutdown() the messages are written immediately by the calling thread.
+void log_initialize(const LogConfig& config = {});
 
 /// @brief Shutdown logging system
+///
+/// Write the messages left, stop the logger thread and remove the sinks.
+/// @warning No other thread may log during the shutdown.
 void log_shutdown();
 
+/// @brief Add a destination for the messages.
+void log_add_sink(std::unique_ptr<LogSink> sink);
+
+/// @brief Wait until the messages logged so far by all the threads are written and flushed.
+void log_flush();
+
+/// @brief Return the counters of the logging system.
+[[nodiscard]] LogStats log_stats() noexcept;
+
 /// @brief Log a message.
+///
+/// A Fatal message is written and flushed, then the program is aborted.
+/// @param category The subsystem logging the message.
 /// @param level The log level.
 /// @param msg The message to log.
-void log_message(LogLevel level, std::string_view msg);
+void log_message(LogCategory category, LogLevel level, std::string_view msg);
 
-/// @brief Log a compile time formatted message.
+/// @brief Log a message of the General category.
 /// @param level The log level.
 /// @param msg The message to log.
-/// @param args The arguments toinsert in the formatted message.
+inline void log_message(LogLevel level, std::string_view msg) {
+    log_message(LogCategory::General, level, msg);
+}
+
+/// @brief Log a compile time formatted message.
+///
+/// The arguments are formatted only if the level is enabled for the category.
+/// @param category The subsystem logging the message.
+/// @param level The log level.
+/// @param fmt The format string.
+/// @param args The arguments to insert in the formatted message.
+template <typename... Args>
+void log_message(LogCategory category, LogLevel level, const std::format_string<Args...>& fmt,
+                 Args&&... args) {
+    if (!log_enabled(level, category)) {
+        return;
+    }
+    std::string& msg = detail::logFormatBuffer();
+    msg.clear();
+    std::vformat_to(std::back_inserter(msg), fmt.get(), std::make_format_args(args...));
+    log_message(category, level, std::string_view(msg));
+}
+
+/// @brief Log a compile time formatted message of the General category.
+/// @param level The log level.
+/// @param fmt The format string.
+/// @param args The arguments to insert in the formatted message.
 template <typename... Args>
 void log_message(LogLevel level, const std::format_string<Args...>& fmt, Args&&... args) {
-    const std::string msg = std::vformat(fmt.get(), std::make_format_args(args...));
-    log_message(level, msg);
+    log_message(LogCategory::General, level, fmt, std::forward<Args>(args)...);
 }
 
 } // namespace fuse
 
-// TODO: Enable/Disable from the build system
-#define FUSE_FATAL(msg, ...) fuse::log_message(fuse::LogLevel::Fatal, msg, __VA_ARGS__)
-#define FUSE_ERROR(msg, ...) fuse::log_message(fuse::LogLevel::Error, msg, __VA_ARGS__)
-#define FUSE_WARN(msg, ...) fuse::log_message(fuse::LogLevel::Warn, msg, __VA_ARGS__)
-#define FUSE_INFO(msg, ...) fuse::log_message(fuse::LogLevel::Info, msg, __VA_ARGS__)
-#define FUSE_DEBUG(msg, ...) fuse::log_message(fuse::LogLevel::Debug, msg, __VA_ARGS__)
-#define FUSE_VERBOSE(msg, ...) fuse::log_message(fuse::LogLevel::Verbose, msg, __VA_ARGS__)
+/// @brief Log a formatted message of a category.
+///
+/// Removed at compile time when @p level is more verbose than FUSE_LOG_LEVEL, the arguments
+/// are then not evaluated. Otherwise the runtime level of the category is checked before the
+/// arguments are formatted.
+#define FUSE_LOG(category, level, ...)                               \
+    do {                                                             \
+        if constexpr (fuse::isLogLevelCompiled(level)) {             \
+            fuse::log_message(category, level, __VA_ARGS__);         \
+        }                                                            \
+    } while (false)
+
+#define FUSE_FATAL(...) FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Fatal, __VA_ARGS__)
+#define FUSE_ERROR(...) FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Error, __VA_ARGS__)
+#define FUSE_WARN(...) FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Warn, __VA_ARGS__)
+#define FUSE_INFO(...) FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Info, __VA_ARGS__)
+#define FUSE_DEBUG(...) FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Debug, __VA_ARGS__)
+#define FUSE_VERBOSE(...) \
+    FUSE_LOG(fuse::LogCategory::General, fuse::LogLevel::Verbose, __VA_ARGS__)
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fuse {
+
+/// @brief The subsystem owning a tracked allocation.
+enum class MemTag : std::uint8_t {
+    General,
+    Geometry,
+    Texture,
+    Log,
+    Profiler,
+    Count
+};
+
+inline constexpr std::size_t kMemTagCount = static_cast<std::size_t>(MemTag::Count);
+
+/// @brief Return the name of a tag, e.g. "Geometry".
+[[nodiscard]] std::string_view toString(MemTag tag) noexcept;
+
+/// @brief The counters of a tag.
+struct MemTagStats {
+    MemTag        tag;                  ///< The tag of the counters.
+    std::size_t   liveBytes;            ///< Bytes allocated and not released yet.
+    std::size_t   peakBytes;            ///< Largest liveBytes seen.
+    std::uint64_t allocations;          ///< Number of allocations since the start.
+    std::uint64_t lastFrameAllocations; ///< Number of allocations of the last frame.
+};
+
+/// @brief Count an allocation of @p bytes for @p tag, any thread.
+///
+/// The counters of each tag are relaxed atomics on their own cache line, the tracking costs
+/// a few uncontended atomic additions.
+void trackAllocation(MemTag tag, std::size_t bytes) noexcept;
+
+/// @brief Count the release of an allocation of @p bytes for @p tag, any thread.
+void trackDeallocation(MemTag tag, std::size_t bytes) noexcept;
+
+/// @brief End the current frame of the allocations-per-frame counters.
+///
+/// Called by Application::run() at the start of each frame.
+void markMemoryFrame() noexcept;
+
+/// @brief Return the counters of a tag.
+[[nodiscard]] MemTagStats memoryStats(MemTag tag) noexcept;
+
+/// @brief Return the counters of every tag, in the order of MemTag.
+[[nodiscard]] std::array<MemTagStats, kMemTagCount> memoryStats() noexcept;
+
+/// @brief Return the counters of every tag as a text table, one line per tag, for the logs or
+///        a headless run.
+[[nodiscard]] std::string memoryReport();
+
+/// @brief Show the memory window: the counters of every tag. Call between ImGui::NewFrame()
+///        and ImGui::Render().
+/// @param open Close button of the window, may be nullptr.
+void showMemoryWindow(bool* open = nullptr);
+
+/// @brief A std allocator counting its allocations in a tag, e.g. TrackedVector.
+template <typename T, MemTag Tag>
+class TrackedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = TrackedAllocator<U, Tag>;
+    };
+
+    TrackedAllocator() noexcept = default;
+
+    template <typename U>
+    TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        T* p = std::allocator<T>{}.allocate(count);
+        trackAllocation(Tag, count * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t count) noexcept {
+        trackDeallocation(Tag, count * sizeof(T));
+        std::allocator<T>{}.deallocate(p, count);
+    }
+
+    friend bool operator==(const TrackedAllocator&, const TrackedAllocator&) noexcept {
+        return true;
+    }
+};
+
+/// @brief A std::vector whose memory is counted in @p Tag.
+template <typename T, MemTag Tag>
+using TrackedVector = std::vector<T, TrackedAllocator<T, Tag>>;
+
+/// @brief Count memory not allocated by a TrackedAllocator (e.g. on the GPU) for the lifetime
+///        of the object.
+class TrackedMemory {
+public:
+    TrackedMemory() noexcept = default;
+
+    TrackedMemory(MemTag tag, std::size_t bytes) noexcept
+        : mTag(tag)
+        , mBytes(bytes) {
+        trackAllocation(mTag, mBytes);
+    }
+
+    ~TrackedMemory() { release(); }
+
+    TrackedMemory(const TrackedMemory&)            = delete;
+    TrackedMemory& operator=(const TrackedMemory&) = delete;
+
+    TrackedMemory(TrackedMemory&& o) noexcept
+        : mTag(o.mTag)
+        , mBytes(std::exchange(o.mBytes, 0)) {}
+
+    TrackedMemory& operator=(TrackedMemory&& o) noexcept {
+        if (this != &o) {
+            release();
+            mTag   = o.mTag;
+            mBytes = std::exchange(o.mBytes, 0);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] MemTag      tag() const noexcept { return mTag; }
+    [[nodiscard]] std::size_t bytes() const noexcept { return mBytes; }
+
+private:
+    void release() noexcept {
+        if (mBytes != 0) {
+            trackDeallocation(mTag, std::exchange(mBytes, 0));
+        }
+    }
+
+    MemTag      mTag{MemTag::General};
+    std::size_t mBytes{0};
+};
+
+} // namespace fuse
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define FUSE_PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define FUSE_PROFILER_RDTSC 1
+#else
+#    include <chrono>
+#    define FUSE_PROFILER_RDTSC 0
+#endif
+
+/// @def FUSE_PROFILER_ENABLE
+/// @brief 1 if the FUSE_PROFILE_*() macros are compiled in, set by the FUSE_PROFILER CMake
+///        option. With 0 they expand to nothing.
+#ifndef FUSE_PROFILER_ENABLE
+#    define FUSE_PROFILER_ENABLE 1
+#endif
+
+namespace fuse {
+
+class GpuProfiler;
+
+/// @brief Return the current time of the profiler, in ticks (the TSC on x86).
+[[nodiscard]] inline std::uint64_t profilerTicks() noexcept {
+#if FUSE_PROFILER_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// @brief Return the duration of a tick in seconds.
+///
+/// On x86 the TSC frequency is measured against the steady clock, the first call waits about
+/// 10 ms for the measure.
+[[nodiscard]] double profilerSecondsPerTick() noexcept;
+
+/// @brief A scope measured by the profiler.
+struct ProfileEvent {
+    const char*   name;   ///< Name of the scope, a string with static storage.
+    std::uint64_t begin;  ///< Ticks at the start of the scope.
+    std::uint64_t end;    ///< Ticks at the end of the scope.
+    std::uint32_t thread; ///< Index of the thread, see profileThreadName().
+    std::uint32_t depth;  ///< Number of enclosing scopes in the thread.
+};
+
+/// @brief A frame of the main loop, from a markProfileFrame() to the next.
+struct ProfileFrame {
+    std::uint64_t index; ///< Number of the frame since the start.
+    std::uint64_t begin; ///< Ticks at the start of the frame.
+    std::uint64_t end;   ///< Ticks at the end of the frame.
+};
+
+/// @brief Enable or disable the recording of the scopes at runtime, enabled by default.
+void setProfilerEnabled(bool enabled) noexcept;
+
+/// @brief Return true if the scopes are recorded.
+[[nodiscard]] bool isProfilerEnabled() noexcept;
+
+/// @brief End the current frame and start the next one, call once per frame on the main thread.
+void markProfileFrame() noexcept;
+
+/// @brief Return the last frames recorded (at most 256), from the oldest to the newest.
+[[nodiscard]] std::vector<ProfileFrame> profileFrames();
+
+/// @brief Return the scopes of every thread overlapping [@p begin, @p end] (in ticks) which are
+///        still in the buffers, sorted by thread then by start.
+///
+/// Each thread keeps its last 32768 scopes, the older ones are overwritten.
+[[nodiscard]] std::vector<ProfileEvent> collectProfileEvents(std::uint64_t begin,
+                                                             std::uint64_t end);
+
+/// @brief Name the calling thread in the traces, @p name must have static storage.
+void setProfileThreadName(const char* name) noexcept;
+
+/// @brief Return the name of a thread, "Thread <index>" if not named.
+[[nodiscard]] std::string profileThreadName(std::uint32_t thread);
+
+/// @brief Write the scopes of the frames [@p first, @p last] in the Chrome trace event format.
+///
+/// The file can be opened with chrome://tracing, https://ui.perfetto.dev or Speedscope.
+/// @return false if the file can not be written.
+bool exportChromeTrace(const std::filesystem::path& path, const ProfileFrame& first,
+                       const ProfileFrame& last);
+
+/// @brief Show the profiler window: a flame graph of a frame per thread, and the export of the
+///        last frames to a Chrome trace. Call between ImGui::NewFrame() and ImGui::Render().
+/// @param open Close button of the window, may be nullptr.
+/// @param gpu Profiler of the GPU times shown with the CPU times, may be nullptr.
+void showProfilerWindow(bool* open = nullptr, const GpuProfiler* gpu = nullptr);
+
+namespace detail {
+
+/// @brief The scopes of a thread, written by the thread only.
+class ProfileThreadBuffer {
+public:
+    static constexpr std::size_t kCapacity = 32768;
+
+    explicit ProfileThreadBuffer(std::uint32_t thread) noexcept
+        : mThread(thread) {}
+
+    [[nodiscard]] std::uint32_t thread() const noexcept { return mThread; }
+
+    /// @brief Return the name given by setProfileThreadName(), nullptr if not named.
+    [[nodiscard]] const char* name() const noexcept {
+        return mName.load(std::memory_order_relaxed);
+    }
+    void setName(const char* name) noexcept { mName.store(name, std::memory_order_relaxed); }
+
+    /// @brief Enter a scope, return its depth.
+    std::uint32_t enter() noexcept { return mDepth++; }
+
+    /// @brief Leave a scope and record it.
+    void leave(const char* name, std::uint64_t begin, std::uint64_t end,
+               std::uint32_t depth) noexcept {
+        mDepth--;
+        const std::uint64_t index = mWritten.load(std::memory_order_relaxed);
+        // Claim the slot before writing it, a reader checks the claims after its read.
+        mClaimed.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Slot& slot = mSlots[index % kCapacity];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.begin.store(begin, std::memory_order_relaxed);
+        slot.end.store(end, std::memory_order_relaxed);
+        slot.depth.store(depth, std::memory_order_relaxed);
+        mWritten.store(index + 1, std::memory_order_release);
+    }
+
+    /// @brief Append the scopes overlapping [begin, end] to @p events, any thread.
+    void collect(std::uint64_t begin, std::uint64_t end, std::vector<ProfileEvent>& events) const;
+
+private:
+    // Atomic so that another thread can read the buffer while it is written, a slot
+    // overwritten during the read is detected with mClaimed and discarded.
+    struct Slot {
+        std::atomic<const char*>   name{nullptr};
+        std::atomic<std::uint64_t> begin{0};
+        std::atomic<std::uint64_t> end{0};
+        std::atomic<std::uint32_t> depth{0};
+    };
+
+    Slot                       mSlots[kCapacity];
+    std::atomic<std::uint64_t> mWritten{0}; ///< Number of slots written.
+    std::atomic<std::uint64_t> mClaimed{0}; ///< Number of slots written or being written.
+    std::atomic<const char*>   mName{nullptr};
+    std::uint32_t              mDepth{0};
+    std::uint32_t              mThread;
+};
+
+extern std::atomic<bool> profilerEnabled;
+
+/// @brief Return the buffer of the calling thread, created on the first call.
+ProfileThreadBuffer& profileThreadBuffer() noexcept;
+
+} // namespace detail
+
+/// @brief Record the time spent in a scope, see FUSE_PROFILE_SCOPE().
+class ProfileScope {
+public:
+    /// @param name Name of the scope, must have static storage (e.g. a string literal).
+    explicit ProfileScope(const char* name) noexcept
+        : mName(name) {
+        if (detail::profilerEnabled.load(std::memory_order_relaxed)) {
+            mBuffer = &detail::profileThreadBuffer();
+            mDepth  = mBuffer->enter();
+            mBegin  = profilerTicks();
+        }
+    }
+
+    ~ProfileScope() {
+        if (mBuffer != nullptr) {
+            mBuffer->leave(mName, mBegin, profilerTicks(), mDepth);
+        }
+    }
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char*                  mName;
+    detail::ProfileThreadBuffer* mBuffer{};
+    std::uint64_t                mBegin{};
+    std::uint32_t                mDepth{};
+};
+
+} // namespace fuse
+
+#define FUSE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FUSE_PROFILE_CONCAT(a, b)      FUSE_PROFILE_CONCAT_IMPL(a, b)
+
+#if FUSE_PROFILER_ENABLE
+/// @brief Measure the rest of the enclosing scope, @p name must have static storage.
+#    define FUSE_PROFILE_SCOPE(name) \
+        const fuse::ProfileScope FUSE_PROFILE_CONCAT(fuseProfileScope, __LINE__)(name)
+/// @brief Measure the rest of the enclosing function.
+#    define FUSE_PROFILE_FUNCTION() FUSE_PROFILE_SCOPE(__func__)
+/// @brief End the current frame and start the next one, see markProfileFrame().
+#    define FUSE_PROFILE_FRAME() fuse::markProfileFrame()
+/// @brief Name the calling thread in the traces.
+#    define FUSE_PROFILE_THREAD(name) fuse::setProfileThreadName(name)
+#else
+#    define FUSE_PROFILE_SCOPE(name)
+#    define FUSE_PROFILE_FUNCTION()
+#    define FUSE_PROFILE_FRAME()
+#    define FUSE_PROFILE_THREAD(name)
+#endif
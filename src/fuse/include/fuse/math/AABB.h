@@ -0,0 +1,63 @@
+#pragma once
+#include "Vec3.h"
+
+#include <algorithm>
+
+namespace fuse {
+
+/// @brief Axis-aligned bounding box.
+///
+/// The box is defined by its minimum and maximum corners, a box with min > max on any axis
+/// is empty.
+///
+/// @ingroup Math
+struct AABB {
+    /// @brief Default constructor (Does not initialize members).
+    AABB() = default;
+
+    /// @brief Construct a box from its corners.
+    /// @pre @p min <= @p max on every axis.
+    constexpr AABB(const Vec3& min, const Vec3& max) noexcept
+        : min(min)
+        , max(max) {}
+
+    /// @brief Create a box from its center and its half size on each axis.
+    [[nodiscard]] static constexpr AABB FromCenterExtents(const Vec3& center,
+                                                          const Vec3& extents) noexcept {
+        return {center - extents, center + extents};
+    }
+
+    /// @brief Strict comparaison component by component.
+    [[nodiscard]] constexpr bool operator==(const AABB&) const noexcept = default;
+
+    /// @brief Return the center of the box.
+    [[nodiscard]] constexpr Vec3 center() const noexcept { return (min + max) * 0.5f; }
+
+    /// @brief Return the half size of the box on each axis.
+    [[nodiscard]] constexpr Vec3 extents() const noexcept { return (max - min) * 0.5f; }
+
+    /// @brief Return true if the point is inside the box or on its boundary.
+    [[nodiscard]] constexpr bool contains(const Vec3& point) const noexcept {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y &&
+               point.z >= min.z && point.z <= max.z;
+    }
+
+    /// @brief Return true if the boxes overlap or touch.
+    [[nodiscard]] constexpr bool intersects(const AABB& other) const noexcept {
+        return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+               max.y >= other.min.y && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    /// @brief Return the smallest box containing this box and @p other.
+    [[nodiscard]] constexpr AABB merge(const AABB& other) const noexcept {
+        return {
+          {std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)},
+          {std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)},
+        };
+    }
+
+    Vec3 min; ///< The corner with the smallest coordinates.
+    Vec3 max; ///< The corner with the largest coordinates.
+};
+
+} // namespace fuse
@@ -0,0 +1,198 @@
+#pragma once
+#include "Mat3.h"
+#include "Mat4.h"
+#include "Vec3.h"
+
+namespace fuse {
+class Angle;
+
+/// @brief 3D affine transformation, a 3x4 matrix (row-major memory layout).
+///
+/// This is a Mat4 where the last row is implicitly (0, 0, 0, 1):
+///
+///     | m00 m01 m02 m03 |
+///     | m10 m11 m12 m13 |   The 3x3 block is the linear part (rotation, scaling, shearing)
+///     | m20 m21 m22 m23 |   and the last column the translation.
+///     |  0   0   0   1  |
+///
+/// Use it instead of Mat4 to compose the model transformations, a product cost
+/// 36 multiply-adds instead of 64 and the inverse exploits the structure.
+/// Convert to Mat4 with toMat4() for the view/projection or to upload it.
+///
+/// @ingroup Math
+class Affine3 {
+public:
+    static const Affine3 kIdentity; ///< The identity transformation.
+
+    /// @brief Default constructor, <b>does not</b> initialise the matrix members.
+    Affine3() = default;
+
+    /// @brief Constructor which allow specifying which member.
+    ///
+    /// Each paramater represent an element at position (i,j) where <br>
+    ///  - @b i is the row
+    ///  - @b j is the column
+    ///
+    constexpr Affine3(float m00, float m01, float m02, float m03, float m10, float m11, float m12,
+                      float m13, float m20, float m21, float m22, float m23) noexcept {
+        // clang-format off
+        mData[0][0] = m00; mData[0][1] = m01; mData[0][2] = m02; mData[0][3] = m03;
+        mData[1][0] = m10; mData[1][1] = m11; mData[1][2] = m12; mData[1][3] = m13;
+        mData[2][0] = m20; mData[2][1] = m21; mData[2][2] = m22; mData[2][3] = m23;
+        // clang-format on
+    }
+
+    /// @brief Construct a transformation from its linear part and a translation.
+    constexpr Affine3(const Mat3& linear, const Vec3& translation) noexcept {
+        for (unsigned row = 0; row < 3; row++) {
+            for (unsigned col = 0; col < 3; col++) {
+                mData[row][col] = linear(row, col);
+            }
+        }
+        mData[0][3] = translation.x;
+        mData[1][3] = translation.y;
+        mData[2][3] = translation.z;
+    }
+
+    /// @brief Construct a transformation from the first 3 rows of a Mat4.
+    /// @pre The last row of @p m is (0, 0, 0, 1), it is ignored.
+    constexpr explicit Affine3(const Mat4& m) noexcept {
+        for (unsigned row = 0; row < 3; row++) {
+            for (unsigned col = 0; col < 4; col++) {
+                mData[row][col] = m(row, col);
+            }
+        }
+    }
+
+    /// @brief Strict comparaison component by component.
+    [[nodiscard]] constexpr bool operator==(const Affine3&) const noexcept = default;
+
+    /// @{
+    /// @brief Direct access to elements @p row / @p col.
+    /// @param[in] row The row index in range [0, 2].
+    /// @param[in] col The col index in range [0, 3].
+    [[nodiscard]] constexpr float& operator()(unsigned row, unsigned col) noexcept {
+        return mData[row][col];
+    }
+
+    /// @copydoc operator()(unsigned, unsigned)
+    [[nodiscard]] constexpr float operator()(unsigned row, unsigned col) const noexcept {
+        return mData[row][col];
+    }
+
+    /// @brief Direct access to the underlying data (12 floats, row-major).
+    [[nodiscard]] float* data() noexcept { return reinterpret_cast<float*>(mData); }
+
+    /// @copydoc data()
+    [[nodiscard]] const float* data() const noexcept {
+        return reinterpret_cast<const float*>(mData);
+    }
+    /// @}
+
+    /// @brief Return the linear part (The upper left 3x3 block).
+    [[nodiscard]] constexpr Mat3 linear() const noexcept {
+        return {
+          // clang-format off
+            mData[0][0], mData[0][1], mData[0][2],
+            mData[1][0], mData[1][1], mData[1][2],
+            mData[2][0], mData[2][1], mData[2][2]
+          // clang-format on
+        };
+    }
+
+    /// @brief Return the translation (The last column).
+    [[nodiscard]] constexpr Vec3 translation() const noexcept {
+        return {mData[0][3], mData[1][3], mData[2][3]};
+    }
+
+    /// @brief Convert to a 4x4 matrix, the conversion is exact.
+    [[nodiscard]] constexpr Mat4 toMat4() const noexcept {
+        return {
+          // clang-format off
+            mData[0][0], mData[0][1], mData[0][2], mData[0][3],
+            mData[1][0], mData[1][1], mData[1][2], mData[1][3],
+            mData[2][0], mData[2][1], mData[2][2], mData[2][3],
+            0.f,         0.f,         0.f,         1.f
+          // clang-format on
+        };
+    }
+
+    /// @brief Transform a point, the translation is applied.
+    [[nodiscard]] constexpr Vec3 transformPoint(const Vec3& p) const noexcept {
+        return {
+          mData[0][0] * p.x + mData[0][1] * p.y + mData[0][2] * p.z + mData[0][3],
+          mData[1][0] * p.x + mData[1][1] * p.y + mData[1][2] * p.z + mData[1][3],
+          mData[2][0] * p.x + mData[2][1] * p.y + mData[2][2] * p.z + mData[2][3],
+        };
+    }
+
+    /// @brief Transform a direction, the translation is ignored.
+    [[nodiscard]] constexpr Vec3 transformDirection(const Vec3& d) const noexcept {
+        return {
+          mData[0][0] * d.x + mData[0][1] * d.y + mData[0][2] * d.z,
+          mData[1][0] * d.x + mData[1][1] * d.y + mData[1][2] * d.z,
+          mData[2][0] * d.x + mData[2][1] * d.y + mData[2][2] * d.z,
+        };
+    }
+
+    /// @brief Compute the determinant of this transformation (The determinant of the linear part).
+    [[nodiscard]] constexpr float determinant() const noexcept {
+        const float a = mData[0][0] * (mData[1][1] * mData[2][2] - mData[1][2] * mData[2][1]);
+        const float b = mData[0][1] * (mData[1][0] * mData[2][2] - mData[1][2] * mData[2][0]);
+        const float c = mData[0][2] * (mData[1][0] * mData[2][1] - mData[1][1] * mData[2][0]);
+        return a - b + c;
+    }
+
+    /// @brief Compute the inverse of any invertible affine transformation.
+    ///
+    /// Only the linear part is inverted (with its adjugate), the translation becomes
+    /// @f$ -L^{-1} t @f$.
+    /// @pre The determinant is not zero.
+    [[nodiscard]] Affine3 inverse() const noexcept;
+
+    /// @brief Compute the inverse of a rigid transformation (rotation and translation only).
+    ///
+    /// The inverse of a rotation is its transpose, no division is needed.
+    /// @pre The linear part is orthonormal.
+    [[nodiscard]] Affine3 inverseRigid() const noexcept;
+
+    /// @brief Compute the inverse of a rotation combined with a scaling and a translation.
+    ///
+    /// The scaling may be non-uniform, it must be applied before the rotation (T * R * S).
+    /// Each row of the inverse linear part is a column divided by its squared length.
+    /// @pre The columns of the linear part are orthogonal and non-zero.
+    [[nodiscard]] Affine3 inverseOrthogonal() const noexcept;
+
+    /// @{
+    /// @brief Compose 2 transformations, (a * b) applies @b b first.
+    [[nodiscard]] Affine3 operator*(const Affine3&) const noexcept;
+    /// @brief Compose this transformation with another one.
+    Affine3& operator*=(const Affine3&) noexcept;
+    /// @}
+
+    /// @name Transform
+    ///@{
+
+    /// @brief Create a translation.
+    [[nodiscard]] static Affine3 CreateTranslation(const Vec3& translation) noexcept;
+
+    /// @brief Create a scaling.
+    [[nodiscard]] static Affine3 CreateScaling(const Vec3& scale) noexcept;
+
+    /// @brief Create a rotation from a angle and an axis.
+    [[nodiscard]] static Affine3 CreateRotation(Angle angle, const Vec3& axis) noexcept;
+
+    /// @brief Create a transformation which scales, then rotates and finally translates.
+    [[nodiscard]] static Affine3 CreateTRS(const Vec3& translation, const Mat3& rotation,
+                                           const Vec3& scale) noexcept;
+
+    ///@}
+
+private:
+    float mData[3][4];
+};
+
+inline constexpr Affine3 Affine3::kIdentity(1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F,
+                                            1.F, 0.F);
+
+} // namespace fuse
@@ -0,0 +1,67 @@
+#pragma once
+#include "Mat4.h"
+#include "Vec3.h"
+#include "Vec4.h"
+
+#include <cstddef>
+#include <span>
+
+namespace fuse {
+
+class JobSystem;
+
+/// @brief Control how a batch operation is split across the workers of a JobSystem.
+/// @ingroup Math
+struct BatchOptions {
+    /// @brief The job system running the chunks, nullptr process the whole batch on the
+    ///        calling thread.
+    JobSystem* jobs = nullptr;
+
+    /// @brief The minimum number of elements processed by a job.
+    ///
+    /// A batch is only split when each job has at least this amount of work,
+    /// small batches always run on the calling thread.
+    std::size_t minElementsPerJob = 16384;
+};
+
+/// @brief Transform an array of points by a matrix.
+///
+/// Each point is transformed as (x, y, z, 1). The w component of the result is dropped,
+/// there is no perspective divide, use transformVec4() for projective transformations.
+///
+/// @param m The transformation matrix.
+/// @param in The points to transform.
+/// @param out Receive the transformed points, may be the same span as @p in.
+/// @param options How the batch is split across the workers of a JobSystem.
+/// @pre @p out is at least as large as @p in.
+/// @pre @p in and @p out are the same span or do not overlap.
+/// @ingroup Math
+void transformPoints(const Mat4& m, std::span<const Vec3> in, std::span<Vec3> out,
+                     const BatchOptions& options = {});
+
+/// @brief Transform an array of directions by a matrix.
+///
+/// Each direction is transformed as (x, y, z, 0), the translation is ignored.
+/// The results are not normalized.
+///
+/// @note To transform normals, use the inverse transpose of the matrix.
+///
+/// @copydetails transformPoints()
+void transformDirections(const Mat4& m, std::span<const Vec3> in, std::span<Vec3> out,
+                         const BatchOptions& options = {});
+
+/// @brief Transform an array of 4D vectors by a matrix.
+///
+/// This is the batch equivalent of `m * v`.
+///
+/// @param m The transformation matrix.
+/// @param in The vectors to transform.
+/// @param out Receive the transformed vectors, may be the same span as @p in.
+/// @param options How the batch is split across the workers of a JobSystem.
+/// @pre @p out is at least as large as @p in.
+/// @pre @p in and @p out are the same span or do not overlap.
+/// @ingroup Math
+void transformVec4(const Mat4& m, std::span<const Vec4> in, std::span<Vec4> out,
+                   const BatchOptions& options = {});
+
+} // namespace fuse
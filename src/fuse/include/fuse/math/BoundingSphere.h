@@ -0,0 +1,36 @@
+#pragma once
+#include "Vec3.h"
+
+namespace fuse {
+
+/// @brief Bounding sphere, defined by its center and its radius.
+/// @ingroup Math
+struct BoundingSphere {
+    /// @brief Default constructor (Does not initialize members).
+    BoundingSphere() = default;
+
+    /// @brief Construct a sphere from its center and its radius.
+    /// @pre @p radius >= 0.
+    constexpr BoundingSphere(const Vec3& center, float radius) noexcept
+        : center(center)
+        , radius(radius) {}
+
+    /// @brief Strict comparaison component by component.
+    [[nodiscard]] constexpr bool operator==(const BoundingSphere&) const noexcept = default;
+
+    /// @brief Return true if the point is inside the sphere or on its boundary.
+    [[nodiscard]] constexpr bool contains(const Vec3& point) const noexcept {
+        return center.distanceSquared(point) <= radius * radius;
+    }
+
+    /// @brief Return true if the spheres overlap or touch.
+    [[nodiscard]] constexpr bool intersects(const BoundingSphere& other) const noexcept {
+        const float r = radius + other.radius;
+        return center.distanceSquared(other.center) <= r * r;
+    }
+
+    Vec3  center; ///< The center of the sphere.
+    float radius; ///< The radius of the sphere.
+};
+
+} // namespace fuse
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string_view>
+
+namespace fuse {
+
+/// @brief Instruction sets of the math kernels, from the slowest to the fastest.
+/// @ingroup Math
+enum class Isa {
+    Scalar, ///< Portable C++.
+    SSE,    ///< SSE2, 4 floats per instruction.
+    AVX2,   ///< AVX2 and FMA, 8 floats per instruction.
+    AVX512, ///< AVX-512F, 16 floats per instruction.
+};
+
+/// @brief Return the name of an instruction set.
+/// @ingroup Math
+[[nodiscard]] std::string_view toString(Isa isa) noexcept;
+
+/// @brief Return the best instruction set compiled in the library (FUSE_SIMD).
+/// @ingroup Math
+[[nodiscard]] Isa compiledIsa() noexcept;
+
+/// @brief Return the instruction set used by the math kernels.
+///
+/// When the library is built with FUSE_SIMD=DISPATCH, the kernels of every instruction set
+/// are compiled and the best one supported by the CPU (see cpuFeatures()) is selected on the
+/// first call, Application does it on construction. Otherwise this is compiledIsa().
+///
+/// The environment variable FUSE_FORCE_ISA (scalar, sse, avx2 or avx512) selects a lower
+/// instruction set, to test each kernel on a single machine. An instruction set not
+/// supported by the CPU is ignored with a warning.
+/// @note The first call may log, later calls only read the selected instruction set.
+/// @ingroup Math
+[[nodiscard]] Isa activeIsa();
+
+} // namespace fuse
@@ -0,0 +1,145 @@
+#pragma once
+#include "Angle.h"
+
+#include <cstddef>
+#include <numbers>
+#include <span>
+
+namespace fuse {
+
+/// @brief Precision of the fast trigonometric functions.
+///
+/// Each level is a minimax polynomial on [-45, 45] degrees, a higher precision costs 1 more
+/// multiply-add per function. The errors are absolute and include the rounding of the float
+/// arithmetic.
+/// @ingroup Math
+enum class TrigPrecision {
+    Low,    ///< Maximum error 2e-4, enough for procedural geometry and particles.
+    Medium, ///< Maximum error 1e-6.
+    High,   ///< Maximum error 1e-7, as accurate as std::sin(angle.asRadians()).
+};
+
+/// @brief The sine and the cosine of the same angle.
+/// @see sincos()
+/// @ingroup Math
+struct SinCos {
+    float sin;
+    float cos;
+};
+
+namespace detail {
+
+/// @brief Coefficients of the polynomials of a precision level, in x^2.
+///
+/// sin(x) = x * (kSin[0] + x^2 * (kSin[1] + ...)) and cos(x) = kCos[0] + x^2 * (kCos[1] + ...)
+/// for x in [-pi/4, pi/4].
+template <TrigPrecision kPrecision>
+struct TrigPolynomial;
+
+template <>
+struct TrigPolynomial<TrigPrecision::Low> {
+    static constexpr float kSin[] = {9.990314229e-01f, -1.603440167e-01f};
+    static constexpr float kCos[] = {9.999900350e-01f, -4.997081404e-01f, 4.039853597e-02f};
+};
+
+template <>
+struct TrigPolynomial<TrigPrecision::Medium> {
+    static constexpr float kSin[] = {9.999949976e-01f, -1.666016199e-01f, 8.121557925e-03f};
+    static constexpr float kCos[] = {9.999999724e-01f, -4.999985670e-01f, 4.165502688e-02f,
+                                     -1.358590851e-03f};
+};
+
+/// From the Cephes library (sinf.c, cosf.c).
+template <>
+struct TrigPolynomial<TrigPrecision::High> {
+    static constexpr float kSin[] = {1.f, -1.6666654611e-01f, 8.3321608736e-03f,
+                                     -1.9515295891e-04f};
+    static constexpr float kCos[] = {1.f, -0.5f, 4.166664568298827e-02f,
+                                     -1.388731625493765e-03f, 2.443315711809948e-05f};
+};
+
+/// @brief Evaluate a polynomial in x^2 with the Horner scheme.
+template <std::size_t N>
+constexpr float horner(const float (&coefficients)[N], float x2) noexcept {
+    float r = coefficients[N - 1];
+    for (std::size_t i = N - 1; i-- > 0;) {
+        r = coefficients[i] + x2 * r;
+    }
+    return r;
+}
+
+} // namespace detail
+
+/// @brief Compute the sine and the cosine of an angle with a polynomial.
+///
+/// The angle is reduced to [-45, 45] degrees around the nearest multiple of 90 degrees. The
+/// reduction is done in degrees and is exact, so the usual angles (0, 30, 90, 180 ...) are as
+/// accurate as small angles. This is 2 to 3 times faster than std::sin() + std::cos() and can be
+/// evaluated at compile time.
+///
+/// @tparam kPrecision The precision of the result, see TrigPrecision.
+/// @param angle The angle.
+/// @pre @p angle is in range [-1e7, 1e7] degrees.
+/// @relates Angle
+template <TrigPrecision kPrecision = TrigPrecision::Medium>
+[[nodiscard]] constexpr SinCos sincos(Angle angle) noexcept {
+    using Polynomial = detail::TrigPolynomial<kPrecision>;
+
+    // Round to the nearest quadrant, halfway cases away from zero.
+    const float degree   = angle.asDegrees();
+    const float n        = degree * (1.f / 90.f);
+    const int   quadrant = static_cast<int>(n < 0.f ? n - 0.5f : n + 0.5f);
+
+    const float x  = (degree - static_cast<float>(quadrant) * 90.f) *
+                    (std::numbers::pi_v<float> / 180.f);
+    const float x2 = x * x;
+    const float s  = x * detail::horner(Polynomial::kSin, x2);
+    const float c  = detail::horner(Polynomial::kCos, x2);
+
+    // sin(x + q * 90) is (s, c, -s, -c) and cos(x + q * 90) is (c, -s, -c, s) for q = 0..3
+    const bool  swap = (quadrant & 1) != 0;
+    const float sin  = swap ? c : s;
+    const float cos  = swap ? s : c;
+    return {(quadrant & 2) != 0 ? -sin : sin, ((quadrant + 1) & 2) != 0 ? -cos : cos};
+}
+
+/// @brief Compute the sine of an angle with a polynomial.
+/// @copydetails sincos(Angle)
+template <TrigPrecision kPrecision = TrigPrecision::Medium>
+[[nodiscard]] constexpr float fastSin(Angle angle) noexcept {
+    return sincos<kPrecision>(angle).sin;
+}
+
+/// @brief Compute the cosine of an angle with a polynomial.
+/// @copydetails sincos(Angle)
+template <TrigPrecision kPrecision = TrigPrecision::Medium>
+[[nodiscard]] constexpr float fastCos(Angle angle) noexcept {
+    return sincos<kPrecision>(angle).cos;
+}
+
+/// @brief Compute the sine and the cosine of an array of angles.
+///
+/// This is the batch equivalent of sincos(Angle), the results are within 1 ulp of it.
+///
+/// @param angles The angles.
+/// @param sin Receive the sines, may be empty to only compute the cosines.
+/// @param cos Receive the cosines, may be empty to only compute the sines.
+/// @param precision The precision of the results.
+/// @pre The non-empty outputs are at least as large as @p angles and do not overlap.
+/// @ingroup Math
+void sincos(std::span<const Angle> angles, std::span<float> sin, std::span<float> cos,
+            TrigPrecision precision = TrigPrecision::Medium) noexcept;
+
+/// @brief Compute the sine of an array of angles.
+/// @see sincos(std::span<const Angle>, std::span<float>, std::span<float>, TrigPrecision)
+/// @ingroup Math
+void fastSin(std::span<const Angle> angles, std::span<float> out,
+             TrigPrecision precision = TrigPrecision::Medium) noexcept;
+
+/// @brief Compute the cosine of an array of angles.
+/// @see sincos(std::span<const Angle>, std::span<float>, std::span<float>, TrigPrecision)
+/// @ingroup Math
+void fastCos(std::span<const Angle> angles, std::span<float> out,
+             TrigPrecision precision = TrigPrecision::Medium) noexcept;
+
+} // namespace fuse
@@ -0,0 +1,109 @@
+#pragma once
+#include "AABB.h"
+#include "BoundingSphere.h"
+#include "Mat4.h"
+#include "Plane.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace fuse {
+
+/// @brief View frustum, the volume enclosed by 6 planes.
+///
+/// The normals of the planes point inside the frustum and have unit length.
+/// The frustum is usually extracted from the view-projection matrix of a camera
+/// and used to skip the objects out of view (frustum culling).
+///
+/// @ingroup Math
+class Frustum {
+public:
+    /// @brief Index of the planes.
+    enum Side : unsigned { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+    /// @brief Default constructor, <b>does not</b> initialise the planes.
+    Frustum() = default;
+
+    /// @brief Construct a frustum from its planes.
+    /// @pre The normals point inside the frustum and have unit length.
+    constexpr explicit Frustum(const std::array<Plane, Count>& planes) noexcept
+        : mPlanes(planes) {}
+
+    /// @brief Extract the frustum of a view-projection matrix.
+    ///
+    /// The planes are in the space transformed by the matrix: world space for a
+    /// view-projection matrix, object space for a model-view-projection matrix.
+    /// The matrix follow the OpenGL convention (Mat4::CreateProjectionPerspectiveFOVY()),
+    /// the clip volume is -w <= x, y, z <= w.
+    ///
+    /// @note Method from "Fast Extraction of Viewing Frustum Planes from the
+    ///       World-View-Projection Matrix" (Gribb and Hartmann).
+    [[nodiscard]] static Frustum FromMatrix(const Mat4& viewProjection) noexcept;
+
+    /// @brief Return a plane of the frustum.
+    [[nodiscard]] constexpr const Plane& plane(Side side) const noexcept { return mPlanes[side]; }
+
+    /// @brief Return the 6 planes of the frustum, in the order of Side.
+    [[nodiscard]] constexpr const std::array<Plane, Count>& planes() const noexcept {
+        return mPlanes;
+    }
+
+    /// @brief Return true if the point is inside the frustum or on its boundary.
+    [[nodiscard]] bool contains(const Vec3& point) const noexcept;
+
+    /// @brief Return true if the sphere is inside or intersects the frustum.
+    ///
+    /// The test is conservative: a sphere near a corner of the frustum, outside of it but
+    /// not entirely behind one plane, is reported as intersecting.
+    [[nodiscard]] bool intersects(const BoundingSphere& sphere) const noexcept;
+
+    /// @brief Return true if the box is inside or intersects the frustum.
+    /// @copydetails intersects(const BoundingSphere&) const
+    [[nodiscard]] bool intersects(const AABB& box) const noexcept;
+
+private:
+    std::array<Plane, Count> mPlanes;
+};
+
+/// @brief Return the number of 32 bits words of the visibility mask of @p count objects.
+/// @ingroup Math
+[[nodiscard]] constexpr std::size_t visibilityMaskSize(std::size_t count) noexcept {
+    return (count + 31) / 32;
+}
+
+/// @brief Test an array of spheres against a frustum.
+///
+/// This is the batch equivalent of `frustum.intersects(spheres[i])`. The result of the sphere
+/// @b i is the bit `i % 32` of `visibility[i / 32]`, the bit is set when the sphere is visible.
+/// The unused bits of the last word are cleared.
+///
+/// @param frustum The frustum, usually the one of the camera.
+/// @param spheres The bounding spheres of the objects.
+/// @param visibility Receive the visibility mask.
+/// @pre @p visibility has at least visibilityMaskSize(spheres.size()) words.
+/// @ingroup Math
+void cull(const Frustum& frustum, std::span<const BoundingSphere> spheres,
+          std::span<std::uint32_t> visibility) noexcept;
+
+/// @brief Test an array of boxes against a frustum.
+///
+/// This is the batch equivalent of `frustum.intersects(boxes[i])`, the mask has the same
+/// layout as the one of the spheres.
+///
+/// @param frustum The frustum, usually the one of the camera.
+/// @param boxes The bounding boxes of the objects.
+/// @param visibility Receive the visibility mask.
+/// @pre @p visibility has at least visibilityMaskSize(boxes.size()) words.
+/// @ingroup Math
+void cull(const Frustum& frustum, std::span<const AABB> boxes,
+          std::span<std::uint32_t> visibility) noexcept;
+
+/// @brief Return true if the object @p index is visible in a mask computed by cull().
+/// @ingroup Math
+[[nodiscard]] constexpr bool isVisible(std::span<const std::uint32_t> visibility,
+                                       std::size_t                    index) noexcept {
+    return (visibility[index / 32] >> (index % 32)) & 1u;
+}
+
+} // namespace fuse
@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file
+/// @brief Forward declarations of the math types.
+///
+/// The vectors, matrices and quaternions are templates over their scalar type. The usual names
+/// (Vec3, Mat4 ...) are the float instantiations, the names ending with @b d are the double
+/// instantiations. Both are explicitly instantiated by the library and have SIMD kernels.
+
+namespace fuse {
+
+template <typename T>
+struct TVec2;
+
+template <typename T>
+struct TVec3;
+
+template <typename T>
+struct TVec4;
+
+template <typename T>
+class TMat2;
+
+template <typename T>
+class TMat3;
+
+template <typename T>
+class TMat4;
+
+template <typename T>
+struct TQuaternion;
+
+/// @addtogroup Math
+/// @{
+using Vec2       = TVec2<float>;       ///< 2D vector of floats.
+using Vec3       = TVec3<float>;       ///< 3D vector of floats.
+using Vec4       = TVec4<float>;       ///< 4D vector of floats.
+using Mat2       = TMat2<float>;       ///< 2x2 matrix of floats.
+using Mat3       = TMat3<float>;       ///< 3x3 matrix of floats.
+using Mat4       = TMat4<float>;       ///< 4x4 matrix of floats.
+using Quaternion = TQuaternion<float>; ///< Quaternion of floats.
+
+using Vec2d       = TVec2<double>;       ///< 2D vector of doubles.
+using Vec3d       = TVec3<double>;       ///< 3D vector of doubles.
+using Vec4d       = TVec4<double>;       ///< 4D vector of doubles.
+using Mat2d       = TMat2<double>;       ///< 2x2 matrix of doubles.
+using Mat3d       = TMat3<double>;       ///< 3x3 matrix of doubles.
+using Mat4d       = TMat4<double>;       ///< 4x4 matrix of doubles.
+using Quaterniond = TQuaternion<double>; ///< Quaternion of doubles.
+/// @}
+
+} // namespace fuse
@@ -4,21 +4,25 @@
 namespace fuse {
 
 /// @brief 2D matrix (column-major memory layout).
+/// @tparam T The scalar type, float (Mat2) or double (Mat2d).
 /// @ingroup Math
-class Mat2 {
+template <typename T>
+class TMat2 {
+    static_assert(std::is_floating_point_v<T>, "TMat2 requires a floating point type.");
+
 public:
-    static const Mat2 kZero;
-    static const Mat2 kIdentity;
+    static const TMat2 kZero;
+    static const TMat2 kIdentity;
 
     /// @brief Default constructor, <b>does not</b> initialise the matrix members.
-    Mat2() = default;
+    TMat2() = default;
 
     /// @brief Constructor which allow specifying which member.
     ///
     /// Each paramater represent an element at position (i,j) where <br>
     ///  - @b i is the row
     ///  - @b j is the column
-    constexpr Mat2(float m00, float m01, float m10, float m11) noexcept {
+    constexpr TMat2(T m00, T m01, T m10, T m11) noexcept {
         // clang-format off
         mData[0][0] = m00; mData[0][1] = m10;
         mData[1][0] = m01; mData[1][1] = m11;
@@ -28,7 +32,7 @@ public:
     /// @brief Construct a 2x2 matrix from 2 column vectors.
     /// @param[in] col0 The first column of the matrix.
     /// @param[in] col1 The second column of the matrix.
-    constexpr Mat2(const Vec2& col0, const Vec2& col1) noexcept {
+    constexpr TMat2(const TVec2<T>& col0, const TVec2<T>& col1) noexcept {
         // clang-format off
         mData[0][0] = col0.x; mData[0][1] = col0.y;
         mData[1][0] = col1.x; mData[1][1] = col1.y;
@@ -36,43 +40,43 @@ public:
     }
 
     /// @brief Strict comparaison component by component.
-    [[nodiscard]] constexpr bool operator==(const Mat2&) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const TMat2&) const noexcept = default;
 
     /// @{
     /// @brief Direct access to elements @p row / @p col.
     /// @param[in] row The row index
     /// @param[in] col The col index
-    [[nodiscard]] constexpr float& operator()(unsigned row, unsigned col) noexcept {
+    [[nodiscard]] constexpr T& operator()(unsigned row, unsigned col) noexcept {
         return mData[col][row];
     }
 
     /// @copydoc operator()(int, int)
-    [[nodiscard]] constexpr float operator()(unsigned row, unsigned col) const noexcept {
+    [[nodiscard]] constexpr T operator()(unsigned row, unsigned col) const noexcept {
         return mData[col][row];
     }
 
     /// @brief Direct access to the underlying data.
-    [[nodiscard]] float* data() noexcept { return reinterpret_cast<float*>(mData); }
+    [[nodiscard]] T* data() noexcept { return reinterpret_cast<T*>(mData); }
 
     /// @copydoc data()
-    [[nodiscard]] const float* data() const noexcept {
-        return reinterpret_cast<const float*>(mData);
+    [[nodiscard]] const T* data() const noexcept {
+        return reinterpret_cast<const T*>(mData);
     }
 
     /// @}
 
     /// @brief Compute the determinant of this matrix.
-    [[nodiscard]] float determinant() const noexcept {
+    [[nodiscard]] T determinant() const noexcept {
         return mData[0][0] * mData[1][1] - mData[1][0] * mData[0][1];
     }
 
     /// @brief Compute the inverse of this matrix.
     /// @todo Handle zero determinant case.
-    [[nodiscard]] Mat2 inverse() const noexcept {
-        const float det    = determinant();
-        const float invDet = 1.0f / det;
-        const Mat2& r      = *this;
-        return Mat2(
+    [[nodiscard]] TMat2 inverse() const noexcept {
+        const T      det    = determinant();
+        const T      invDet = T(1) / det;
+        const TMat2& r      = *this;
+        return TMat2(
           // clang-format off
          r(1, 1) * invDet, -r(0, 1) * invDet,
         -r(1, 0) * invDet,  r(0, 0) * invDet
@@ -81,9 +85,9 @@ public:
     }
 
     /// @brief Compute the transpose of this matrix.
-    [[nodiscard]] Mat2 transpose() const noexcept {
-        const Mat2& r = *this;
-        return Mat2(
+    [[nodiscard]] TMat2 transpose() const noexcept {
+        const TMat2& r = *this;
+        return TMat2(
           // clang-format off
             r(0,0), r(1,0),
             r(0,1), r(1,1)
@@ -93,43 +97,52 @@ public:
 
     /// @{
     /// @brief Addition this matrix with another matrix.
-    Mat2& operator+=(const Mat2&) noexcept;
+    TMat2& operator+=(const TMat2&) noexcept;
     /// @brief Substract this matrix with another matrix.
-    Mat2& operator-=(const Mat2&) noexcept;
+    TMat2& operator-=(const TMat2&) noexcept;
     /// @brief Multiply this matrix with another matrix.
-    Mat2& operator*=(const Mat2&) noexcept;
+    TMat2& operator*=(const TMat2&) noexcept;
     /// @}
 
     /// @{
     /// @brief Addition 2 matrix.
-    [[nodiscard]] Mat2 operator+(const Mat2&) const noexcept;
+    [[nodiscard]] TMat2 operator+(const TMat2&) const noexcept;
     /// @brief Substract 2 matrix.
-    [[nodiscard]] Mat2 operator-(const Mat2&) const noexcept;
+    [[nodiscard]] TMat2 operator-(const TMat2&) const noexcept;
     /// @brief Multiply 2 matrix.
-    [[nodiscard]] Mat2 operator*(const Mat2&) const noexcept;
+    [[nodiscard]] TMat2 operator*(const TMat2&) const noexcept;
     /// @}
 
 private:
-    float mData[2][2];
+    T mData[2][2];
 };
 
-inline constexpr Mat2 Mat2::kZero(0, 0, 0, 0);
-inline constexpr Mat2 Mat2::kIdentity(1, 0, 0, 1);
+template <typename T>
+inline constexpr TMat2<T> TMat2<T>::kZero(0, 0, 0, 0);
+template <typename T>
+inline constexpr TMat2<T> TMat2<T>::kIdentity(1, 0, 0, 1);
+
+extern template class TMat2<float>;
+extern template class TMat2<double>;
 
 /// @ingroup  Math
-/// @related  Mat2
+/// @related  TMat2
 /// @{
 /// @brief Multiply a matrix by a value.
-[[nodiscard]] Mat2 operator*(const Mat2&, float) noexcept;
+template <typename T>
+[[nodiscard]] TMat2<T> operator*(const TMat2<T>&, std::type_identity_t<T>) noexcept;
 
-/// @copydoc operator*(const Mat2&, float)
-[[nodiscard]] Mat2 operator*(float value, const Mat2& mat) noexcept;
+/// @copydoc operator*(const TMat2<T>&, std::type_identity_t<T>)
+template <typename T>
+[[nodiscard]] TMat2<T> operator*(std::type_identity_t<T> value, const TMat2<T>& mat) noexcept;
 
 /// @brief Multiply a matrix by a value.
-Mat2& operator*=(Mat2&, float) noexcept;
+template <typename T>
+TMat2<T>& operator*=(TMat2<T>&, std::type_identity_t<T>) noexcept;
 
 /// @brief Multiply the column vector @b v by the matrix @b m
-[[nodiscard]] Vec2 operator*(const Mat2& m, const Vec2& v) noexcept;
+template <typename T>
+[[nodiscard]] TVec2<T> operator*(const TMat2<T>& m, const TVec2<T>& v) noexcept;
 /// @}
 
 } // namespace fuse
@@ -6,14 +6,18 @@ namespace fuse {
 class Angle;
 
 /// @brief 4x4 homogeneous matrix (column-major memory layout).
+/// @tparam T The scalar type, float (Mat4) or double (Mat4d).
 /// @ingroup Math
-class Mat4 {
+template <typename T>
+class TMat4 {
+    static_assert(std::is_floating_point_v<T>, "TMat4 requires a floating point type.");
+
 public:
-    static const Mat4 kZero;     ///< The zero matrix.
-    static const Mat4 kIdentity; ///< The identity matrix.
+    static const TMat4 kZero;     ///< The zero matrix.
+    static const TMat4 kIdentity; ///< The identity matrix.
 
     /// @brief Default constructor, <b>does not</b> initialise the matrix members.
-    Mat4() = default;
+    TMat4() = default;
 
     /// @brief Constructor which allow specifying which member.
     ///
@@ -21,9 +25,8 @@ public:
     ///  - @b i is the row
     ///  - @b j is the column
     ///
-    constexpr Mat4(float m00, float m01, float m02, float m03, float m10, float m11, float m12,
-                   float m13, float m20, float m21, float m22, float m23, float m30, float m31,
-                   float m32, float m33) noexcept {
+    constexpr TMat4(T m00, T m01, T m02, T m03, T m10, T m11, T m12, T m13, T m20, T m21, T m22,
+                    T m23, T m30, T m31, T m32, T m33) noexcept {
         // clang-format off
             mData[0][0] = m00; mData[0][1] = m10; mData[0][2] = m20; mData[0][3] = m30;
             mData[1][0] = m01; mData[1][1] = m11; mData[1][2] = m21; mData[1][3] = m31;
@@ -38,8 +41,8 @@ public:
     /// @param col1 The second column of the matrix.
     /// @param col2 The third column of the matrix.
     /// @param col3 The fourth column of the matrix.
-    constexpr Mat4(const Vec4& col0, const Vec4& col1, const Vec4& col2,
-                   const Vec4& col3) noexcept {
+    constexpr TMat4(const TVec4<T>& col0, const TVec4<T>& col1, const TVec4<T>& col2,
+                    const TVec4<T>& col3) noexcept {
         // clang-format off
         mData[0][0] = col0.x; mData[0][1] = col0.y; mData[0][2] = col0.z; mData[0][3] = col0.w;
         mData[1][0] = col1.x; mData[1][1] = col1.y; mData[1][2] = col1.z; mData[1][3] = col1.w;
@@ -49,41 +52,41 @@ public:
     }
 
     /// @brief Strict comparaison component by component.
-    [[nodiscard]] constexpr bool operator==(const Mat4&) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const TMat4&) const noexcept = default;
 
     /// @{
     /// @brief Direct access to elements @p row / @p col.
     /// @param[in] row The row index
     /// @param[in] col The col index
-    [[nodiscard]] constexpr float& operator()(unsigned row, unsigned col) noexcept {
+    [[nodiscard]] constexpr T& operator()(unsigned row, unsigned col) noexcept {
         return mData[col][row];
     }
 
     /// @copydoc operator()(int, int)
-    [[nodiscard]] constexpr float operator()(unsigned row, unsigned col) const noexcept {
+    [[nodiscard]] constexpr T operator()(unsigned row, unsigned col) const noexcept {
         return mData[col][row];
     }
 
     /// @brief Direct access to the underlying data.
-    [[nodiscard]] float* data() noexcept { return reinterpret_cast<float*>(mData); }
+    [[nodiscard]] T* data() noexcept { return reinterpret_cast<T*>(mData); }
 
     /// @copydoc data()
-    [[nodiscard]] const float* data() const noexcept {
-        return reinterpret_cast<const float*>(mData);
+    [[nodiscard]] const T* data() const noexcept {
+        return reinterpret_cast<const T*>(mData);
     }
 
     /// @}
 
     /// @brief Compute the determinant of this matrix.
-    [[nodiscard]] float determinant() const noexcept {
-        const float subFactor00 = mData[2][2] * mData[3][3] - mData[3][2] * mData[2][3];
-        const float subFactor01 = mData[2][1] * mData[3][3] - mData[3][1] * mData[2][3];
-        const float subFactor02 = mData[2][1] * mData[3][2] - mData[3][1] * mData[2][2];
-        const float subFactor03 = mData[2][0] * mData[3][3] - mData[3][0] * mData[2][3];
-        const float subFactor04 = mData[2][0] * mData[3][2] - mData[3][0] * mData[2][2];
-        const float subFactor05 = mData[2][0] * mData[3][1] - mData[3][0] * mData[2][1];
-
-        const Vec4 detCof(
+    [[nodiscard]] T determinant() const noexcept {
+        const T subFactor00 = mData[2][2] * mData[3][3] - mData[3][2] * mData[2][3];
+        const T subFactor01 = mData[2][1] * mData[3][3] - mData[3][1] * mData[2][3];
+        const T subFactor02 = mData[2][1] * mData[3][2] - mData[3][1] * mData[2][2];
+        const T subFactor03 = mData[2][0] * mData[3][3] - mData[3][0] * mData[2][3];
+        const T subFactor04 = mData[2][0] * mData[3][2] - mData[3][0] * mData[2][2];
+        const T subFactor05 = mData[2][0] * mData[3][1] - mData[3][0] * mData[2][1];
+
+        const TVec4<T> detCof(
           +(mData[1][1] * subFactor00 - mData[1][2] * subFactor01 + mData[1][3] * subFactor02),
           -(mData[1][0] * subFactor00 - mData[1][2] * subFactor03 + mData[1][3] * subFactor04),
           +(mData[1][0] * subFactor01 - mData[1][1] * subFactor03 + mData[1][3] * subFactor05),
@@ -95,75 +98,12 @@ public:
 
     /// @brief Compute the inverse of this matrix.
     /// @todo Handle zero determinant case.
-    [[nodiscard]] Mat4 inverse() const noexcept {
-        const Mat4& r   = *this;
-        const float m00 = r(0, 0), m01 = r(0, 1), m02 = r(0, 2), m03 = r(0, 3);
-        const float m10 = r(1, 0), m11 = r(1, 1), m12 = r(1, 2), m13 = r(1, 3);
-        const float m20 = r(2, 0), m21 = r(2, 1), m22 = r(2, 2), m23 = r(2, 3);
-        const float m30 = r(3, 0), m31 = r(3, 1), m32 = r(3, 2), m33 = r(3, 3);
-
-        float v0 = m20 * m31 - m21 * m30;
-        float v1 = m20 * m32 - m22 * m30;
-        float v2 = m20 * m33 - m23 * m30;
-        float v3 = m21 * m32 - m22 * m31;
-        float v4 = m21 * m33 - m23 * m31;
-        float v5 = m22 * m33 - m23 * m32;
-
-        const float t00 = +(v5 * m11 - v4 * m12 + v3 * m13);
-        const float t10 = -(v5 * m10 - v2 * m12 + v1 * m13);
-        const float t20 = +(v4 * m10 - v2 * m11 + v0 * m13);
-        const float t30 = -(v3 * m10 - v1 * m11 + v0 * m12);
-
-        const float invDet = 1 / (t00 * m00 + t10 * m01 + t20 * m02 + t30 * m03);
-
-        float d00 = t00 * invDet;
-        float d10 = t10 * invDet;
-        float d20 = t20 * invDet;
-        float d30 = t30 * invDet;
-
-        float d01 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
-        float d11 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
-        float d21 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
-        float d31 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
-
-        v0 = m10 * m31 - m11 * m30;
-        v1 = m10 * m32 - m12 * m30;
-        v2 = m10 * m33 - m13 * m30;
-        v3 = m11 * m32 - m12 * m31;
-        v4 = m11 * m33 - m13 * m31;
-        v5 = m12 * m33 - m13 * m32;
-
-        float d02 = +(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
-        float d12 = -(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
-        float d22 = +(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
-        float d32 = -(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
-
-        v0 = m21 * m10 - m20 * m11;
-        v1 = m22 * m10 - m20 * m12;
-        v2 = m23 * m10 - m20 * m13;
-        v3 = m22 * m11 - m21 * m12;
-        v4 = m23 * m11 - m21 * m13;
-        v5 = m23 * m12 - m22 * m13;
-
-        float d03 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
-        float d13 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
-        float d23 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
-        float d33 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
-
-        return Mat4(
-          // clang-format off
-            d00, d01, d02, d03,
-            d10, d11, d12, d13,
-            d20, d21, d22, d23,
-            d30, d31, d32, d33
-          // clang-format on
-        );
-    }
+    [[nodiscard]] TMat4 inverse() const noexcept;
 
     /// @brief Compute the transpose of this matrix.
-    [[nodiscard]] Mat4 transpose() const noexcept {
-        const Mat4& r = *this;
-        return Mat4(
+    [[nodiscard]] TMat4 transpose() const noexcept {
+        const TMat4& r = *this;
+        return TMat4(
           // clang-format off
             r(0,0), r(1,0), r(2,0), r(3,0),
             r(0,1), r(1,1), r(2,1), r(3,1),
@@ -175,65 +115,65 @@ public:
 
     /// @{
     /// @brief Addition this matrix with another matrix.
-    Mat4& operator+=(const Mat4&) noexcept;
+    TMat4& operator+=(const TMat4&) noexcept;
     /// @brief Substract this matrix with another matrix.
-    Mat4& operator-=(const Mat4&) noexcept;
+    TMat4& operator-=(const TMat4&) noexcept;
     /// @brief Multiply this matrix with another matrix.
-    Mat4& operator*=(const Mat4&) noexcept;
+    TMat4& operator*=(const TMat4&) noexcept;
     /// @}
 
     /// @{
     /// @brief Addition 2 matrix..
-    [[nodiscard]] Mat4 operator+(const Mat4&) const noexcept;
+    [[nodiscard]] TMat4 operator+(const TMat4&) const noexcept;
     /// @brief Substract 2 matrix.
-    [[nodiscard]] Mat4 operator-(const Mat4&) const noexcept;
+    [[nodiscard]] TMat4 operator-(const TMat4&) const noexcept;
     /// @brief Multiply 2 matrix.
-    [[nodiscard]] Mat4 operator*(const Mat4&) const noexcept;
+    [[nodiscard]] TMat4 operator*(const TMat4&) const noexcept;
     /// @}
 
     /// @name Transform
     ///@{
 
     /// @brief Create a translation matrix.
-    [[nodiscard]] static Mat4 CreateTranslation(const Vec3& translation) noexcept;
+    [[nodiscard]] static TMat4 CreateTranslation(const TVec3<T>& translation) noexcept;
 
     /// @brief Create a scaling matrix.
-    [[nodiscard]] static Mat4 CreateScaling(const Vec3& scale) noexcept;
+    [[nodiscard]] static TMat4 CreateScaling(const TVec3<T>& scale) noexcept;
 
     /// @brief Create a scaling matrix.
     /// @param[in] scale The scaling factor.
     /// @param[in] direction The direction of the scaling axis (Must be normalized)
-    [[nodiscard]] static Mat4 CreateScaling(float scale, const Vec3& direction) noexcept;
+    [[nodiscard]] static TMat4 CreateScaling(T scale, const TVec3<T>& direction) noexcept;
 
     /// @brief Create a rotation matrix around x-axis.
     /// 1      0           0      0
     /// 0 cos(angle) -sin(angle)  0
     /// 0 sin(angle)  cos(angle)  0
     /// 0      0          1       1
-    [[nodiscard]] static Mat4 CreateRotationX(const Angle& angle) noexcept;
+    [[nodiscard]] static TMat4 CreateRotationX(const Angle& angle) noexcept;
 
     /// @brief Create a rotation matrix around y-axis.
     /// cos(a)   0   sin(a)  0
     ///      0   1     0     0
     /// -sin(a)  0   cos(a)  0
     ///    0     0     1     1
-    [[nodiscard]] static Mat4 CreateRotationY(const Angle& angle) noexcept;
+    [[nodiscard]] static TMat4 CreateRotationY(const Angle& angle) noexcept;
 
     /// @brief Create a rotation matrix around z-axis.
     /// cos(angle) -sin(angle)  0  0
     /// sin(angle)  cos(angle)  0  0
     ///     0            0      1  0
     ///     0            0      0  1
-    [[nodiscard]] static Mat4 CreateRotationZ(const Angle& angle) noexcept;
+    [[nodiscard]] static TMat4 CreateRotationZ(const Angle& angle) noexcept;
 
     /// @brief Create a rotation matrix from a angle and an axis.
-    [[nodiscard]] static Mat4 CreateRotation(Angle angle, const Vec3& axis) noexcept;
+    [[nodiscard]] static TMat4 CreateRotation(Angle angle, const TVec3<T>& axis) noexcept;
 
     /// @brief Create a 4x4 reflection matrix.
     /// The reflection matrix reflect points across a plane.
     /// The plane is defined by its normal vector.
     /// @param normal The normal of the reflection plane (Must be normalized).
-    [[nodiscard]] static Mat4 CreateReflection(const Vec3& normal) noexcept;
+    [[nodiscard]] static TMat4 CreateReflection(const TVec3<T>& normal) noexcept;
 
     ///@}
 
@@ -253,8 +193,9 @@ public:
     /// @param [in] position Position of the camera.
     /// @param [in] target   Position of the reference point to look at.
     /// @param [in] upVector Up direction of the camera.
-    [[nodiscard]] static Mat4 CreateViewLookAt(const Vec3& position, const Vec3& target,
-                                               const Vec3& upVector = Vec3::kUnitY) noexcept;
+    [[nodiscard]] static TMat4 CreateViewLookAt(
+      const TVec3<T>& position, const TVec3<T>& target,
+      const TVec3<T>& upVector = TVec3<T>::kUnitY) noexcept;
 
     /// @brief Builds a view matrix for a right-handed coordinate.
     ///
@@ -269,8 +210,9 @@ public:
     /// @param [in] position  Position of the camera.
     /// @param [in] direction Direction of the camera.
     /// @param [in] upVector  Up direction of the camera.
-    [[nodiscard]] static Mat4 CreateViewLookTo(const Vec3& position, const Vec3& direction,
-                                               const Vec3& upVector = Vec3::kUnitY) noexcept;
+    [[nodiscard]] static TMat4 CreateViewLookTo(
+      const TVec3<T>& position, const TVec3<T>& direction,
+      const TVec3<T>& upVector = TVec3<T>::kUnitY) noexcept;
     ///@}
 
 
@@ -282,8 +224,8 @@ public:
     /// This function is the equivalent of
     /// <b>ProjOrthoOffCenter(-width/2, width/2, -height/2, height/2, near, far)</b>
     /// @see ProjOrthoOffCenter()
-    [[nodiscard]] static Mat4 ProjOrtho(float width, float height, float near = -1.0F,
-                                        float far = 1.0F) noexcept;
+    [[nodiscard]] static TMat4 ProjOrtho(T width, T height, T near = T(-1),
+                                         T far = T(1)) noexcept;
 
     /// @brief Create a orthographic projection matrix.
     ///
@@ -301,8 +243,8 @@ public:
     /// @param far    The distances to the farther depth clipping plane.
     ///               This distance is negative if the plane is to be behind the viewer.
     /// @return The projection matrix.
-    [[nodiscard]] static Mat4 ProjOrthoOffCenter(float left, float right, float bottom, float top,
-                                                 float near /* =-1*/, float far /*= 1*/) noexcept;
+    [[nodiscard]] static TMat4 ProjOrthoOffCenter(T left, T right, T bottom, T top,
+                                                  T near /* =-1*/, T far /*= 1*/) noexcept;
 
     /// @brief Create a customized, right-handed perspective projection matrix.
     ///
@@ -319,10 +261,10 @@ public:
     ///     However, if you flip these values so @b zFar is
     ///     less than @b zNear, the result is an inverted z buffer which can provide increased
     ///     floating-point precision.
-    [[nodiscard]] static Mat4 CreateProjectionPerspectiveOffCenter(float left, float right,
-                                                                   float bottom, float top,
-                                                                   float zNear /* =-1*/,
-                                                                   float zFar /*= 1*/) noexcept;
+    [[nodiscard]] static TMat4 CreateProjectionPerspectiveOffCenter(T left, T right,
+                                                                    T bottom, T top,
+                                                                    T zNear /* =-1*/,
+                                                                    T zFar /*= 1*/) noexcept;
 
     /// @brief Create a right-handed perspective projection matrix based on a horizontal field of view.
     ///
@@ -336,8 +278,8 @@ public:
     ///     However, if you flip these values so @b zFar is
     ///     less than @b zNear, the result is an inverted z buffer which can provide increased
     ///     floating-point precision.
-    [[nodiscard]] static Mat4 CreateProjectionPerspectiveFOVX(const Angle& fovx, float aspectRatio,
-                                                              float zNear, float zFar);
+    [[nodiscard]] static TMat4 CreateProjectionPerspectiveFOVX(const Angle& fovx, T aspectRatio,
+                                                               T zNear, T zFar);
 
     /// @brief Create a right-handed perspective projection matrix based on a vertical field of view.
     ///
@@ -351,37 +293,45 @@ public:
     ///     However, if you flip these values so @b zFar is
     ///     less than @b zNear, the result is an inverted z buffer which can provide increased
     ///     floating-point precision.
-    [[nodiscard]] static Mat4 CreateProjectionPerspectiveFOVY(const Angle& fovY, float aspectRatio,
-                                                              float zNear, float zFar);
+    [[nodiscard]] static TMat4 CreateProjectionPerspectiveFOVY(const Angle& fovY, T aspectRatio,
+                                                               T zNear, T zFar);
 
     ///@}
 
 private:
-    float mData[4][4];
+    T mData[4][4];
 };
 
-inline constexpr Mat4 Mat4::kZero(0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F,
-                                  0.F, 0.F, 0.F);
-inline constexpr Mat4 Mat4::kIdentity(1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F,
-                                      0.F, 0.F, 0.F, 1.F);
+template <typename T>
+inline constexpr TMat4<T> TMat4<T>::kZero(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+template <typename T>
+inline constexpr TMat4<T> TMat4<T>::kIdentity(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1);
+
+extern template class TMat4<float>;
+extern template class TMat4<double>;
 
 /// @ingroup  Math
-/// @related  Mat4
+/// @related  TMat4
 /// @{
 /// @brief Multiply a matrix by a value.
-[[nodiscard]] Mat4 operator*(const Mat4&, float) noexcept;
+template <typename T>
+[[nodiscard]] TMat4<T> operator*(const TMat4<T>&, std::type_identity_t<T>) noexcept;
 
-/// @copydoc operator*(const Mat4&, float)
-[[nodiscard]] Mat4 operator*(float value, const Mat4& mat) noexcept;
+/// @copydoc operator*(const TMat4<T>&, std::type_identity_t<T>)
+template <typename T>
+[[nodiscard]] TMat4<T> operator*(std::type_identity_t<T> value, const TMat4<T>& mat) noexcept;
 
 /// @brief Multiply a matrix by a value.
-Mat4& operator*=(Mat4&, float) noexcept;
+template <typename T>
+TMat4<T>& operator*=(TMat4<T>&, std::type_identity_t<T>) noexcept;
 
 /// @brief Multiply the column vector @b v by the matrix @b m
-[[nodiscard]] Vec4 operator*(const Mat4& m, const Vec4& v) noexcept;
+template <typename T>
+[[nodiscard]] TVec4<T> operator*(const TMat4<T>& m, const TVec4<T>& v) noexcept;
 
 /// @brief Multiply the row vector @b v by the matrix @b m
-[[nodiscard]] Vec4 operator*(const Vec4& v, const Mat4& m) noexcept;
+template <typename T>
+[[nodiscard]] TVec4<T> operator*(const TVec4<T>& v, const TMat4<T>& m) noexcept;
 /// @}
 
 } // namespace fuse
@@ -0,0 +1,51 @@
+#pragma once
+#include "Vec3.h"
+
+namespace fuse {
+
+/// @brief Plane in 3D space, the points @b p where @f$ normal \cdot p + d = 0 @f$.
+///
+/// The normal points toward the positive half-space. When the normal has unit length,
+/// distance() is the signed Euclidean distance to the plane.
+///
+/// @ingroup Math
+struct Plane {
+    /// @brief Default constructor (Does not initialize members).
+    Plane() = default;
+
+    /// @brief Construct a plane from its equation.
+    /// @param normal The normal of the plane, need not be normalized.
+    /// @param d The signed distance of the origin to the plane, scaled by the length of @p normal.
+    constexpr Plane(const Vec3& normal, float d) noexcept
+        : normal(normal)
+        , d(d) {}
+
+    /// @brief Construct a plane from its normal and a point on the plane.
+    constexpr Plane(const Vec3& normal, const Vec3& point) noexcept
+        : normal(normal)
+        , d(-normal.dot(point)) {}
+
+    /// @brief Strict comparaison component by component.
+    [[nodiscard]] constexpr bool operator==(const Plane&) const noexcept = default;
+
+    /// @brief Return the signed distance of a point to the plane.
+    ///
+    /// The distance is positive on the side the normal points to.
+    /// @note The distance is scaled by the length of the normal, normalize() the plane first
+    ///       to get the Euclidean distance.
+    [[nodiscard]] constexpr float distance(const Vec3& point) const noexcept {
+        return normal.dot(point) + d;
+    }
+
+    /// @brief Return the same plane with a unit normal.
+    /// @warning The normal must have a length > 0.
+    [[nodiscard]] Plane normalize() const noexcept {
+        const float invLength = 1.f / normal.length();
+        return {normal * invLength, d * invLength};
+    }
+
+    Vec3  normal; ///< The normal of the plane.
+    float d;      ///< The constant of the plane equation.
+};
+
+} // namespace fuse
@@ -9,17 +9,21 @@ namespace fuse {
 class Angle;
 
 /// @brief A quaternion represents rotation in 3D space.
-struct Quaternion {
+/// @tparam T The scalar type, float (Quaternion) or double (Quaterniond).
+template <typename T>
+struct TQuaternion {
+    static_assert(std::is_floating_point_v<T>, "TQuaternion requires a floating point type.");
+
 public:
-    static const Quaternion kIdentity; ///< The identity quaternion.
+    static const TQuaternion kIdentity; ///< The identity quaternion.
 
     /// @brief Default constructor that leaves the components uninitialized.
-    Quaternion() = default;
+    TQuaternion() = default;
 
     /// @brief Constructor that sets components explicitly.
     /// @param x,y,z The components of the vector part.
     /// @param w The scalar part.
-    constexpr Quaternion(float x, float y, float z, float w)
+    constexpr TQuaternion(T x, T y, T z, T w)
         : x(x)
         , y(y)
         , z(z)
@@ -28,7 +32,7 @@ public:
     /// @brief Constructor that sets components explicitly.
     /// @param v The components of the vector part.
     /// @param w The scalar part.
-    constexpr Quaternion(const Vec3& v, float w)
+    constexpr TQuaternion(const TVec3<T>& v, T w)
         : x(v.x)
         , y(v.y)
         , z(v.z)
@@ -37,61 +41,61 @@ public:
     /// @brief Construct a quaternion from an axis ans a angle.
     /// @param axis The axis of rotation.
     /// @param angle The angle of rotation.
-    Quaternion(const Vec3& axis, const Angle& angle) noexcept;
+    TQuaternion(const TVec3<T>& axis, const Angle& angle) noexcept;
 
     /// @brief Strict comparaison component by component.
-    [[nodiscard]] constexpr bool operator==(const Quaternion&) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const TQuaternion&) const noexcept = default;
 
     /// @brief Return the conjugate (reverse) of this quaternion.
     /// The conjugate of a quaternion is contained by negating the vector part (x,y,z) while keeping the scaler part (w) unchanged.
-    [[nodiscard]] constexpr Quaternion conjugate() const noexcept { return {-x, -y, -z, w}; }
+    [[nodiscard]] constexpr TQuaternion conjugate() const noexcept { return {-x, -y, -z, w}; }
 
     /// @brief Returns the dot product.
-    [[nodiscard]] constexpr float dot(const Quaternion& other) const noexcept {
+    [[nodiscard]] constexpr T dot(const TQuaternion& other) const noexcept {
         return x * other.x + y * other.y + z * other.z + w * other.w;
     }
 
     /// @brief Return the inverse of this quaternion.
     /// The inverse quaternion reverse the original rotation.
     /// @todo check division by 0 ?
-    [[nodiscard]] constexpr Quaternion inverse() const noexcept;
+    [[nodiscard]] constexpr TQuaternion inverse() const noexcept;
 
     /// @brief Normalize the quaternion.
     /// @bug When vector is 0 length.
-    [[nodiscard]] Quaternion normalize() const noexcept {
-        const float len    = length();
-        const float invLen = 1.f / len;
+    [[nodiscard]] TQuaternion normalize() const noexcept {
+        const T len    = length();
+        const T invLen = T(1) / len;
         return {x * invLen, y * invLen, z * invLen, w * invLen};
     }
 
     /// @brief Compute the length (magnitude) of this vector.
     /// @return Returns the length of this vector.
-    [[nodiscard]] float length() const noexcept { return std::sqrt(x * x + y * y + z * z + w * w); }
+    [[nodiscard]] T length() const noexcept { return std::sqrt(x * x + y * y + z * z + w * w); }
 
     /// @brief Compute the square length (magnitude) of this vector.
     /// @return Returns the square length of this vector.
-    [[nodiscard]] constexpr float lengthSquared() const noexcept {
+    [[nodiscard]] constexpr T lengthSquared() const noexcept {
         return (x * x + y * y + z * z + w * w);
     }
 
     /// @brief Return the x-axis of the orientation represented by this quaternion.
     /// This is equivalent to multiply the vector [1,0,0] by this quaternion.
-    [[nodiscard]] Vec3 axisX() const noexcept;
+    [[nodiscard]] TVec3<T> axisX() const noexcept;
 
     /// @brief Return the y-axis of the orientation represented by this quaternion.
     /// This is equivalent to multiply the vector [0,1,0] by this quaternion.
-    [[nodiscard]] Vec3 axisY() const noexcept;
+    [[nodiscard]] TVec3<T> axisY() const noexcept;
 
     /// @brief Return the z-axis of the orientation represented by this quaternion.
     /// This is equivalent to multiply the vector [0,0,1] by this quaternion.
-    [[nodiscard]] Vec3 axisZ() const noexcept;
+    [[nodiscard]] TVec3<T> axisZ() const noexcept;
 
     /// @brief Return the axis of the orientation represented by this quaternion.
     /// @see axisX() axisY() axisZ()
-    [[nodiscard]] std::array<Vec3, 3> axis() const noexcept;
+    [[nodiscard]] std::array<TVec3<T>, 3> axis() const noexcept;
 
     /// @brief Converts the to a 3x3 matrix.
-    [[nodiscard]] Mat3 asMatrix() const noexcept;
+    [[nodiscard]] TMat3<T> asMatrix() const noexcept;
 
     /// @brief Convert a matrix to a quaternion.
     /// Sets the components of this quaternion to values that represents the same rotation as the
@@ -100,57 +104,74 @@ public:
     /// @note This function expects the @b matrix to be orthogonal and have a determinant of +1.
     /// If these conditions are not met, then the results are unlikely to be meaningful.
     /// @param matrix The matrix to convert.
-    void setMatrix(const Mat3& matrix) noexcept;
+    void setMatrix(const TMat3<T>& matrix) noexcept;
 
     /// @brief Define this quaternion has a rotation around an axis.
     /// @param axis The axis about which to rotate.
     /// @param angle The angle of rotation
     /// @pre This vector @b axis must have unit magnitude.
-    Quaternion& fromAxisAngle(const Vec3& axis, Angle angle) noexcept;
+    TQuaternion& fromAxisAngle(const TVec3<T>& axis, Angle angle) noexcept;
 
     /// @brief Convert the quaternion to an axis and angle.
     /// @param axis The axis of rotation.
     /// @param angle The angle of rotation.
-    void toAxisAngle(Vec3& axis, Angle& angle) const noexcept;
+    void toAxisAngle(TVec3<T>& axis, Angle& angle) const noexcept;
 
-    [[nodiscard]] static Quaternion MakeRotationX(Angle angle) noexcept;
-    [[nodiscard]] static Quaternion MakeRotationY(Angle angle) noexcept;
-    [[nodiscard]] static Quaternion MakeRotationZ(Angle angle) noexcept;
+    [[nodiscard]] static TQuaternion MakeRotationX(Angle angle) noexcept;
+    [[nodiscard]] static TQuaternion MakeRotationY(Angle angle) noexcept;
+    [[nodiscard]] static TQuaternion MakeRotationZ(Angle angle) noexcept;
 
-    float x;
-    float y;
-    float z;
-    float w;
+    T x;
+    T y;
+    T z;
+    T w;
 };
 
-inline constexpr Quaternion Quaternion::kIdentity(0, 0, 0, 1);
+template <typename T>
+inline constexpr TQuaternion<T> TQuaternion<T>::kIdentity(0, 0, 0, 1);
+
+extern template struct TQuaternion<float>;
+extern template struct TQuaternion<double>;
 
 /// @brief Addition 2 quaternions.
-[[nodiscard]] constexpr Quaternion operator+(const Quaternion& q1, const Quaternion& q2) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator+(const TQuaternion<T>& q1,
+                                                 const TQuaternion<T>& q2) noexcept {
     return {q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w};
 }
 
 /// @brief Substract 2 quaternions.
-[[nodiscard]] constexpr Quaternion operator-(const Quaternion& q1, const Quaternion& q2) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator-(const TQuaternion<T>& q1,
+                                                 const TQuaternion<T>& q2) noexcept {
     return {q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w};
 }
 
 /// @brief Multiply a scalar with a quaternion.
-[[nodiscard]] constexpr Quaternion operator*(float scalar, const Quaternion& q) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator*(std::type_identity_t<T> scalar,
+                                                 const TQuaternion<T>&   q) noexcept {
     return {q.x * scalar, q.y * scalar, q.z * scalar, q.w * scalar};
 }
 
 /// @brief Multiply a quaternion by a scalar.
-[[nodiscard]] constexpr Quaternion operator*(const Quaternion& q, float scalar) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator*(const TQuaternion<T>&   q,
+                                                 std::type_identity_t<T> scalar) noexcept {
     return {q.x * scalar, q.y * scalar, q.z * scalar, q.w * scalar};
 }
 
 /// @brief Multiply a quaternion by a scalar.
-constexpr Quaternion& operator*=(Quaternion& q, float scalar) noexcept { return q = q * scalar; }
+template <typename T>
+constexpr TQuaternion<T>& operator*=(TQuaternion<T>& q, std::type_identity_t<T> scalar) noexcept {
+    return q = q * scalar;
+}
 
 /// @brief Multiply 2 quaternions.
 /// @note Quaternion multiplication is not commutative (Except if the vector part are parallel).
-[[nodiscard]] constexpr Quaternion operator*(const Quaternion& q1, const Quaternion& q2) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator*(const TQuaternion<T>& q1,
+                                                 const TQuaternion<T>& q2) noexcept {
     return {q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
             q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
             q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
@@ -159,72 +180,120 @@ constexpr Quaternion& operator*=(Quaternion& q, float scalar) noexcept { return
 
 /// @brief Multiply 2 quaternions.
 /// @note Quaternion multiplication is not commutative.
-constexpr Quaternion& operator*=(Quaternion& q1, const Quaternion& q2) noexcept {
+template <typename T>
+constexpr TQuaternion<T>& operator*=(TQuaternion<T>& q1, const TQuaternion<T>& q2) noexcept {
     return q1 = q1 * q2;
 }
 
 /// @brief Multiply (rotate) a vector with a quaternion.
-[[nodiscard]] constexpr Vec3 operator*(const Quaternion& q, const Vec3& v) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator*(const TQuaternion<T>& q, const TVec3<T>& v) noexcept {
 #define IMPL 2
 #if IMPL == 0
     // nVidia SDK implementation
-    Vec3 qvec(q.x, q.y, q.z);
-    Vec3 uv  = qvec.cross(v);
-    Vec3 uuv = qvec.cross(uv);
-    uv *= (2.0f * q.w);
-    uuv *= 2.0f;
+    TVec3<T> qvec(q.x, q.y, q.z);
+    TVec3<T> uv  = qvec.cross(v);
+    TVec3<T> uuv = qvec.cross(uv);
+    uv *= (2 * q.w);
+    uuv *= 2;
     return v + uv + uuv;
 #elif IMPL == 1
     // https://gamedev.stackexchange.com/questions/28395/rotating-vector3-by-a-quaternion
-    const Vec3  u(q.x, q.y, q.z);
-    const float s = q.w;
-    return 2.0f * u.dot(v) * u + (s * s - u.dot(u)) * v + 2.0f * s * u.cross(v);
+    const TVec3<T> u(q.x, q.y, q.z);
+    const T        s = q.w;
+    return 2 * u.dot(v) * u + (s * s - u.dot(u)) * v + 2 * s * u.cross(v);
 #else
     // From Foundations of Game Engine Development Volume Mathematics
-    Vec3        b(q.x, q.y, q.z);
-    const float b2 = b.x * b.x + b.y * b.y + b.z * b.z;
-    return 2.0F * v.dot(b) * b + (q.w * q.w - b2) * v + 2.0F * q.w * b.cross(v);
+    TVec3<T> b(q.x, q.y, q.z);
+    const T  b2 = b.x * b.x + b.y * b.y + b.z * b.z;
+    return 2 * v.dot(b) * b + (q.w * q.w - b2) * v + 2 * q.w * b.cross(v);
 #endif
 #undef IMPL
 }
 
 /// @brief Divide a quaternion by a scalar.
-[[nodiscard]] constexpr Quaternion operator/(const Quaternion& q, float scalar) noexcept {
-    const auto inv = 1.f / scalar;
+template <typename T>
+[[nodiscard]] constexpr TQuaternion<T> operator/(const TQuaternion<T>&   q,
+                                                 std::type_identity_t<T> scalar) noexcept {
+    const T inv = T(1) / scalar;
     return {q.x * inv, q.y * inv, q.z * inv, q.w * inv};
 }
 
 /// @brief Divide a quaternion by a scalar.
-constexpr Quaternion& operator/=(Quaternion& q, float scalar) noexcept { return q = q / scalar; }
+template <typename T>
+constexpr TQuaternion<T>& operator/=(TQuaternion<T>& q, std::type_identity_t<T> scalar) noexcept {
+    return q = q / scalar;
+}
 
-constexpr Quaternion Quaternion::inverse() const noexcept {
-    const float inv = 1.0f / lengthSquared();
+template <typename T>
+constexpr TQuaternion<T> TQuaternion<T>::inverse() const noexcept {
+    const T inv = T(1) / lengthSquared();
     return conjugate() * inv;
 }
 
+/// @brief Normalized linear interpolation between 2 rotations.
+///
+/// Cheaper than slerp() but the angular velocity is not constant.
+/// Like slerpShortestPath(), @p b is negated when the quaternions are in opposite hemispheres
+/// so the interpolation always follows the shortest arc.
+///
+/// @param a The rotation at @p t = 0.
+/// @param b The rotation at @p t = 1.
+/// @param t The interpolation factor in range [0, 1].
+/// @pre @p a and @p b are unit quaternions.
+/// @relates TQuaternion
+template <typename T>
+[[nodiscard]] TQuaternion<T> nlerp(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                                   std::type_identity_t<T> t) noexcept;
+
+/// @brief Spherical linear interpolation between 2 rotations.
+///
+/// Interpolate with a constant angular velocity on the arc between @p a and @p b.
+/// The arc is taken as is, it may be the longest path between the 2 rotations.
+///
+/// @param a The rotation at @p t = 0.
+/// @param b The rotation at @p t = 1.
+/// @param t The interpolation factor in range [0, 1].
+/// @pre @p a and @p b are unit quaternions and @p a != -b.
+/// @relates TQuaternion
+/// @see slerpShortestPath()
+template <typename T>
+[[nodiscard]] TQuaternion<T> slerp(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                                   std::type_identity_t<T> t) noexcept;
+
+/// @brief Spherical linear interpolation between 2 rotations on the shortest path.
+///
+/// Same as slerp() but @p b is negated when the quaternions are in opposite hemispheres.
+/// This is the usual interpolation between 2 keyframes.
+///
+/// @copydetails nlerp()
+template <typename T>
+[[nodiscard]] TQuaternion<T> slerpShortestPath(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                                               std::type_identity_t<T> t) noexcept;
+
 } // namespace fuse
 
-/// @relates Quaternion
+/// @relates fuse::TQuaternion
 /// @brief Custom std::formatter
 ///
 /// This formater format the Quaternion as [x,y,z,w].
 ///
 /// @note All standard options are supported and they are apply component by component.
-template <>
-struct std::formatter<fuse::Quaternion> : std::formatter<float> {
+template <typename T>
+struct std::formatter<fuse::TQuaternion<T>> : std::formatter<T> {
 
-    constexpr auto parse(auto& ctx) { return std::formatter<float>::parse(ctx); }
+    constexpr auto parse(auto& ctx) { return std::formatter<T>::parse(ctx); }
 
-    auto format(const fuse::Quaternion& q, auto& ctx) const {
+    auto format(const fuse::TQuaternion<T>& q, auto& ctx) const {
         auto&& out = ctx.out();
         std::format_to(out, "[");
-        std::formatter<float>::format(q.x, ctx);
+        std::formatter<T>::format(q.x, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(q.y, ctx);
+        std::formatter<T>::format(q.y, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(q.z, ctx);
+        std::formatter<T>::format(q.z, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(q.w, ctx);
+        std::formatter<T>::format(q.w, ctx);
         return format_to(out, "]");
     }
 };
@@ -0,0 +1,64 @@
+#pragma once
+#include "Mat3.h"
+#include "Mat4.h"
+#include "Quaternion.h"
+
+#include <span>
+
+namespace fuse {
+
+/// @brief Normalized linear interpolation of arrays of rotations.
+///
+/// This is the batch equivalent of `out[i] = nlerp(a[i], b[i], t[i])`.
+/// The results are within 1e-6 of the single value function.
+///
+/// @param a The rotations at t = 0.
+/// @param b The rotations at t = 1.
+/// @param t The interpolation factors in range [0, 1].
+/// @param out Receive the interpolated rotations, may be the same span as @p a or @p b.
+/// @pre @p a, @p b and @p t have the same size, @p out is at least as large.
+/// @pre The outputs are the same span as an input or do not overlap it.
+/// @ingroup Math
+void nlerp(std::span<const Quaternion> a, std::span<const Quaternion> b,
+           std::span<const float> t, std::span<Quaternion> out) noexcept;
+
+/// @brief Spherical linear interpolation of arrays of rotations.
+///
+/// This is the batch equivalent of `out[i] = slerp(a[i], b[i], t[i])`.
+/// The trigonometric functions are replaced by a polynomial, the results are within 1e-6
+/// of the single value function.
+///
+/// @copydetails nlerp(std::span<const Quaternion>, std::span<const Quaternion>,
+///              std::span<const float>, std::span<Quaternion>)
+void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b,
+           std::span<const float> t, std::span<Quaternion> out) noexcept;
+
+/// @brief Spherical linear interpolation of arrays of rotations on the shortest path.
+///
+/// This is the batch equivalent of `out[i] = slerpShortestPath(a[i], b[i], t[i])`,
+/// typically used to sample the rotation tracks of an animation.
+///
+/// @copydetails slerp(std::span<const Quaternion>, std::span<const Quaternion>,
+///              std::span<const float>, std::span<Quaternion>)
+void slerpShortestPath(std::span<const Quaternion> a, std::span<const Quaternion> b,
+                       std::span<const float> t, std::span<Quaternion> out) noexcept;
+
+/// @brief Convert an array of unit quaternions to rotation matrices.
+///
+/// This is the batch equivalent of `out[i] = q[i].asMatrix()`.
+///
+/// @param q The rotations to convert.
+/// @param out Receive the matrices.
+/// @pre @p out is at least as large as @p q.
+/// @ingroup Math
+void toMatrices(std::span<const Quaternion> q, std::span<Mat3> out) noexcept;
+
+/// @brief Convert an array of unit quaternions to 4x4 rotation matrices.
+///
+/// The translation is zero, compose with the translation of the joint to build the
+/// skinning matrices.
+///
+/// @copydetails toMatrices(std::span<const Quaternion>, std::span<Mat3>)
+void toMatrices(std::span<const Quaternion> q, std::span<Mat4> out) noexcept;
+
+} // namespace fuse
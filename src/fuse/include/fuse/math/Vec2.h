@@ -1,8 +1,10 @@
 #pragma once
 #include "Angle.h"
+#include "Fwd.h"
 
 #include <cmath>
 #include <format>
+#include <type_traits>
 
 /// @addtogroup Math
 /// @brief This is the group's brief description.
@@ -12,33 +14,37 @@
 
 namespace fuse {
 
-/// @brief 3D Vector.
+/// @brief 2D Vector.
+/// @tparam T The scalar type, float (Vec2) or double (Vec2d).
 /// @ingroup Math
-struct Vec2 {
+template <typename T>
+struct TVec2 {
+    static_assert(std::is_floating_point_v<T>, "TVec2 requires a floating point type.");
+
     /// clang-fornat off
-    static const Vec2 kZero;     ///< The zero vector (0, 0, 0)
-    static const Vec2 kUnitX;    ///< The X unit vector (1, 0, 0), usually facing right
-    static const Vec2 kUnitXNeg; ///< The X unit vector (1, 0, 0), usually facing left
-    static const Vec2 kUnitY;    ///< The Y unit vector (0, 1, 0), usually facing up
-    static const Vec2 kUnitYNeg; ///< The Y unit vector (0, 1, 0), usually facing down
+    static const TVec2 kZero;     ///< The zero vector (0, 0, 0)
+    static const TVec2 kUnitX;    ///< The X unit vector (1, 0, 0), usually facing right
+    static const TVec2 kUnitXNeg; ///< The X unit vector (1, 0, 0), usually facing left
+    static const TVec2 kUnitY;    ///< The Y unit vector (0, 1, 0), usually facing up
+    static const TVec2 kUnitYNeg; ///< The Y unit vector (0, 1, 0), usually facing down
     /// clang-fornat on
 
     /// @brief Default constructor (Does not initialize members).
-    constexpr Vec2() noexcept = default;
+    constexpr TVec2() noexcept = default;
 
     /// @brief Construct a vector component by component.
     /// @param x,y Component of the vector.
-    constexpr Vec2(float x, float y)
+    constexpr TVec2(T x, T y)
         : x{x}
         , y{y} {}
 
     /// @brief Initializes all components with the same value.
-    constexpr explicit Vec2(float value) noexcept
+    constexpr explicit TVec2(T value) noexcept
         : x(value)
         , y(value) {}
 
     /// @brief Strict comparaison component by component.
-    [[nodiscard]] constexpr bool operator==(const Vec2&) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const TVec2&) const noexcept = default;
 
     /// @brief Retrieves the angle required to rotate this vector into another vector.
     ///
@@ -52,9 +58,9 @@ struct Vec2 {
     ///
     /// @param v The other vector used to compute the angle.
     /// @return The angle needed to rotate this vector into \p v.
-    [[nodiscard]] Angle angleBetween(const Vec2& v) const noexcept {
+    [[nodiscard]] Angle angleBetween(const TVec2& v) const noexcept {
         // use Kahan's Mangled Angles formula to avoid precision error at close angle.
-        return radians(std::atan2(std::abs(cross(v)), dot(v)));
+        return radians(static_cast<float>(std::atan2(std::abs(cross(v)), dot(v))));
         //return fuse::radians(std::acos(normalize().dot(v.normalize())));
     }
 
@@ -67,18 +73,18 @@ struct Vec2 {
     ///   - Negative sign, v1 need to move clock clock wise to join v2
     ///   - The absolute value of the 2D cross product is the sine of the angle in between the two vectors,
     ///     so taking the arc sine of it would give you the angle in radians.
-    [[nodiscard]] constexpr float cross(const Vec2& v) const noexcept { return x * v.y - y * v.x; }
+    [[nodiscard]] constexpr T cross(const TVec2& v) const noexcept { return x * v.y - y * v.x; }
 
     /// @brief Returns the distance to another vector.
     /// @return The distance to another vector.
-    [[nodiscard]] float distance(const Vec2& rhs) const noexcept;
+    [[nodiscard]] T distance(const TVec2& rhs) const noexcept;
 
     /// @brief Returns the square of the distance to another vector.
     /// @return The square distance to another vector.
-    [[nodiscard]] constexpr float distanceSquared(const Vec2& rhs) const noexcept;
+    [[nodiscard]] constexpr T distanceSquared(const TVec2& rhs) const noexcept;
 
-    /// @copydoc Vec3::dot()
-    [[nodiscard]] constexpr float dot(const Vec2& other) const noexcept {
+    /// @copydoc TVec3::dot()
+    [[nodiscard]] constexpr T dot(const TVec2& other) const noexcept {
         return x * other.x + y * other.y;
     }
 
@@ -86,17 +92,17 @@ struct Vec2 {
     /// @note If the exact length is not required, by example for comparing
     ///       the distance of 2 vectors, we can use lengthSquared() which is faster.
     /// @return Returns the length of this vector.
-    [[nodiscard]] float length() const noexcept { return std::sqrt(dot(*this)); }
+    [[nodiscard]] T length() const noexcept { return std::sqrt(dot(*this)); }
 
     /// @brief Compute the square length (magnitude) of this vector.
     /// @return Returns the square length of this vector.
-    [[nodiscard]] constexpr float lengthSquared() const noexcept { return dot(*this); }
+    [[nodiscard]] constexpr T lengthSquared() const noexcept { return dot(*this); }
 
     /// @brief Normalize the vector.
     /// @bug When vector is 0 length.
-    [[nodiscard]] Vec2 normalize() const noexcept {
-        const float len    = length();
-        const float invLen = 1.f / len;
+    [[nodiscard]] TVec2 normalize() const noexcept {
+        const T len    = length();
+        const T invLen = T(1) / len;
         return {x * invLen, y * invLen};
     }
 
@@ -105,126 +111,158 @@ struct Vec2 {
     /// @bug     Check for @b other zero length.
     /// @param  other Vector being projected onto. Need not be normalized.
     /// @return  The projection of this vector into vector @b other.
-    [[nodiscard]] constexpr Vec2 projectTo(const Vec2& other) const noexcept;
+    [[nodiscard]] constexpr TVec2 projectTo(const TVec2& other) const noexcept;
 
     /// @brief Compute the perpendicular projection of this vector onto another vector.
     /// @warning If the @b other vector is a zero vector, the projection is undefined.
     /// @bug     Check for @b other zero length.
     /// @param  other Vector being projected onto. Need not be normalized.
-    [[nodiscard]] constexpr Vec2 perpendicularTo(const Vec2& other) const noexcept;
+    [[nodiscard]] constexpr TVec2 perpendicularTo(const TVec2& other) const noexcept;
 
     /// @brief   Calculates a reflection vector to the plane with the given normal .
     /// @pre     normal must be normalized.
     /// @remarks Assumes 'this' is pointing AWAY THROUGH the plane, invert if it is not.
-    [[nodiscard]] Vec2 reflect(const Vec2& normal) const noexcept;
+    [[nodiscard]] TVec2 reflect(const TVec2& normal) const noexcept;
 
-    float x; ///< The x component of the vector.
-    float y; ///< The y component of the vector.
+    T x; ///< The x component of the vector.
+    T y; ///< The y component of the vector.
 };
 
-inline constexpr Vec2 Vec2::kZero(0.F, 0.F);
-inline constexpr Vec2 Vec2::kUnitX(1.F, 0.F);
-inline constexpr Vec2 Vec2::kUnitXNeg(-1.F, 0.F);
-inline constexpr Vec2 Vec2::kUnitY(0.F, 1.F);
-inline constexpr Vec2 Vec2::kUnitYNeg(0.F, -1.F);
-
-/// @related Vec2
+template <typename T>
+inline constexpr TVec2<T> TVec2<T>::kZero(T(0), T(0));
+template <typename T>
+inline constexpr TVec2<T> TVec2<T>::kUnitX(T(1), T(0));
+template <typename T>
+inline constexpr TVec2<T> TVec2<T>::kUnitXNeg(T(-1), T(0));
+template <typename T>
+inline constexpr TVec2<T> TVec2<T>::kUnitY(T(0), T(1));
+template <typename T>
+inline constexpr TVec2<T> TVec2<T>::kUnitYNeg(T(0), T(-1));
+
+/// @related TVec2
 /// @ingroup Math
 /// @brief Negates the vector, flipping the sign of each component.
-[[nodiscard]] constexpr Vec2 operator-(const Vec2& v) noexcept { return {-v.x, -v.y}; }
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator-(const TVec2<T>& v) noexcept {
+    return {-v.x, -v.y};
+}
 
-/// @name Scalar / Vec2 Operations
-/// @related Vec2
+/// @name Scalar / TVec2 Operations
+/// @related TVec2
 /// @ingroup Math
 /// @{
 
 /// @brief Multiply a vector by a scalar.
-[[nodiscard]] constexpr Vec2 operator*(const Vec2& v, float s) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator*(const TVec2<T>& v, std::type_identity_t<T> s) noexcept {
     return {v.x * s, v.y * s};
 }
 
-/// @copydoc operator*(const Vec2&, float)
-[[nodiscard]] constexpr Vec2 operator*(float s, const Vec2& v) noexcept {
+/// @copydoc operator*(const TVec2<T>&, std::type_identity_t<T>)
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator*(std::type_identity_t<T> s, const TVec2<T>& v) noexcept {
     return {v.x * s, v.y * s};
 }
 
-/// @copydoc operator*(const Vec2&, float)
-constexpr Vec2& operator*=(Vec2& v, float s) noexcept { return v = v * s; }
+/// @copydoc operator*(const TVec2<T>&, std::type_identity_t<T>)
+template <typename T>
+constexpr TVec2<T>& operator*=(TVec2<T>& v, std::type_identity_t<T> s) noexcept {
+    return v = v * s;
+}
 
 /// @brief
-[[nodiscard]] constexpr Vec2 operator/(const Vec2& v, float s) noexcept {
-    const auto inv = 1.f / s;
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator/(const TVec2<T>& v, std::type_identity_t<T> s) noexcept {
+    const T inv = T(1) / s;
     return {v.x * inv, v.y * inv};
 }
 
-/// @copydoc operator/(const Vec2&, float)
-constexpr Vec2& operator/=(Vec2& v, float s) noexcept { return v = v / s; }
+/// @copydoc operator/(const TVec2<T>&, std::type_identity_t<T>)
+template <typename T>
+constexpr TVec2<T>& operator/=(TVec2<T>& v, std::type_identity_t<T> s) noexcept {
+    return v = v / s;
+}
 
 /// @}
 
-/// @name Vec2 / Vec2 Operations
-/// @related Vec2
+/// @name TVec2 / TVec2 Operations
+/// @related TVec2
 /// @{
 
 /// @brief
-[[nodiscard]] constexpr Vec2 operator+(const Vec2& a, const Vec2& b) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator+(const TVec2<T>& a, const TVec2<T>& b) noexcept {
     return {a.x + b.x, a.y + b.y};
 }
 
 /// @brief
-constexpr Vec2& operator+=(Vec2& a, const Vec2& b) { return a = a + b; }
+template <typename T>
+constexpr TVec2<T>& operator+=(TVec2<T>& a, const TVec2<T>& b) {
+    return a = a + b;
+}
 
 /// @brief
-[[nodiscard]] constexpr Vec2 operator-(const Vec2& a, const Vec2& b) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec2<T> operator-(const TVec2<T>& a, const TVec2<T>& b) noexcept {
     return {a.x - b.x, a.y - b.y};
 }
 
 /// @brief
-constexpr Vec2& operator-=(Vec2& a, const Vec2& b) { return a = a - b; }
+template <typename T>
+constexpr TVec2<T>& operator-=(TVec2<T>& a, const TVec2<T>& b) {
+    return a = a - b;
+}
 
 /// @}
 
-inline float Vec2::distance(const Vec2& rhs) const noexcept { return (*this - rhs).length(); }
+template <typename T>
+inline T TVec2<T>::distance(const TVec2& rhs) const noexcept {
+    return (*this - rhs).length();
+}
 
-constexpr float Vec2::distanceSquared(const Vec2& rhs) const noexcept {
+template <typename T>
+constexpr T TVec2<T>::distanceSquared(const TVec2& rhs) const noexcept {
     return (*this - rhs).lengthSquared();
 }
 
-constexpr Vec2 Vec2::projectTo(const Vec2& other) const noexcept {
+template <typename T>
+constexpr TVec2<T> TVec2<T>::projectTo(const TVec2& other) const noexcept {
     //             (a dot b)
     // proj(a,b)  ---------- * b
     //             (b dot b)
     return dot(other) / other.dot(other) * other;
 }
 
-constexpr Vec2 Vec2::perpendicularTo(const Vec2& other) const noexcept {
+template <typename T>
+constexpr TVec2<T> TVec2<T>::perpendicularTo(const TVec2& other) const noexcept {
     return *this - projectTo(other);
 }
 
-inline Vec2 Vec2::reflect(const Vec2& normal) const noexcept {
+template <typename T>
+inline TVec2<T> TVec2<T>::reflect(const TVec2& normal) const noexcept {
     //return 2 * dot(normal) * normal - *this;
     return *this - (2 * dot(normal) * normal); // this point to the plane
 }
 
 } // namespace fuse
 
-/// \relates Vec2
+/// \relates fuse::TVec2
 /// \brief Custom std::formatter
 ///
 /// This formater format the vector as [x,y].
 ///
 /// @note All standard options are supported and they are apply component by component.
-template <>
-struct std::formatter<fuse::Vec2> : std::formatter<float> {
+template <typename T>
+struct std::formatter<fuse::TVec2<T>> : std::formatter<T> {
 
-    constexpr auto parse(auto& ctx) { return std::formatter<float>::parse(ctx); }
+    constexpr auto parse(auto& ctx) { return std::formatter<T>::parse(ctx); }
 
-    auto format(const fuse::Vec2& v, auto& ctx) const {
+    auto format(const fuse::TVec2<T>& v, auto& ctx) const {
         auto&& out = ctx.out();
         std::format_to(out, "[");
-        std::formatter<float>::format(v.x, ctx);
+        std::formatter<T>::format(v.x, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(v.y, ctx);
+        std::formatter<T>::format(v.y, ctx);
         return format_to(out, "]");
     }
 };
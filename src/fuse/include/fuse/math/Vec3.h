@@ -1,42 +1,48 @@
 #pragma once
 #include "Angle.h"
+#include "Fwd.h"
 
 #include <cmath>
 #include <format>
+#include <type_traits>
 
 namespace fuse {
 
 /// @brief 3D Vector.
+/// @tparam T The scalar type, float (Vec3) or double (Vec3d).
 /// @ingroup Math
-struct Vec3 {
+template <typename T>
+struct TVec3 {
+    static_assert(std::is_floating_point_v<T>, "TVec3 requires a floating point type.");
+
     /// clang-fornat off
-    static const Vec3 kZero;     ///< The zero vector (0, 0, 0)
-    static const Vec3 kUnitX;    ///< The X unit vector (1, 0, 0), usually facing right
-    static const Vec3 kUnitXNeg; ///< The X unit vector (1, 0, 0), usually facing left
-    static const Vec3 kUnitY;    ///< The Y unit vector (0, 1, 0), usually facing up
-    static const Vec3 kUnitYNeg; ///< The Y unit vector (0, 1, 0), usually facing down
-    static const Vec3 kUnitZ;    ///< The Z unit vector (0, 0, 1), usually facing away the screen
-    static const Vec3 kUnitZNeg; ///< The Z unit vector (0, 0, 1), usually facing into the screen
+    static const TVec3 kZero;     ///< The zero vector (0, 0, 0)
+    static const TVec3 kUnitX;    ///< The X unit vector (1, 0, 0), usually facing right
+    static const TVec3 kUnitXNeg; ///< The X unit vector (1, 0, 0), usually facing left
+    static const TVec3 kUnitY;    ///< The Y unit vector (0, 1, 0), usually facing up
+    static const TVec3 kUnitYNeg; ///< The Y unit vector (0, 1, 0), usually facing down
+    static const TVec3 kUnitZ;    ///< The Z unit vector (0, 0, 1), usually facing away the screen
+    static const TVec3 kUnitZNeg; ///< The Z unit vector (0, 0, 1), usually facing into the screen
     /// clang-fornat on
 
     /// @brief Default constructor (Does not initialize members).
-    constexpr Vec3() noexcept = default;
+    constexpr TVec3() noexcept = default;
 
     /// @brief Construct a vector component by component.
     /// @param x,y,z Component of the vector.
-    constexpr Vec3(float x, float y, float z)
+    constexpr TVec3(T x, T y, T z)
         : x{x}
         , y{y}
         , z{z} {}
 
     /// @brief Initializes all components with the same value.
-    constexpr explicit Vec3(float value) noexcept
+    constexpr explicit TVec3(T value) noexcept
         : x(value)
         , y(value)
         , z(value) {}
 
     /// @brief Strict comparaison component by component.
-    [[nodiscard]] constexpr bool operator==(const Vec3&) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const TVec3&) const noexcept = default;
 
     /// @brief Retrieves the angle required to rotate this vector into another vector.
     ///
@@ -50,11 +56,11 @@ struct Vec3 {
     ///
     /// @param v The other vector used to compute the angle.
     /// @return The angle needed to rotate this vector into \p v.
-    [[nodiscard]] Angle angleBetween(const Vec3& v) const noexcept {
+    [[nodiscard]] Angle angleBetween(const TVec3& v) const noexcept {
         // use Kahan's Mangled Angles formula to avoid precision error at close angle.
-        const float d = dot(v);
-        const float c = cross(v).length();
-        return radians(std::atan2(c, d));
+        const T d = dot(v);
+        const T c = cross(v).length();
+        return radians(static_cast<float>(std::atan2(c, d)));
         //return fuse::radians(std::acos(normalize().dot(v.normalize())));
     }
 
@@ -80,17 +86,17 @@ struct Vec3 {
     ///  - If the vectors are anti-parallel (pointing in opposite directions), the cross product is also zero.
     ///  - If both vectors are normalized, the cross product result will be a normalized perpendicular vector.
     /// @warning Cross product between 2 vectors are not commutative. ( \f$ \vec{a} \times \vec{b} = -\vec{b} \times \vec{a} \f$ )
-    [[nodiscard]] constexpr Vec3 cross(const Vec3& other) const noexcept {
+    [[nodiscard]] constexpr TVec3 cross(const TVec3& other) const noexcept {
         return {y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x};
     }
 
     /// @brief Returns the distance to another vector.
     /// @return The distance to another vector.
-    [[nodiscard]] float distance(const Vec3& rhs) const;
+    [[nodiscard]] T distance(const TVec3& rhs) const;
 
     /// @brief Returns the square of the distance to another vector.
     /// @return The square distance to another vector.
-    [[nodiscard]] constexpr float distanceSquared(const Vec3& rhs) const noexcept;
+    [[nodiscard]] constexpr T distanceSquared(const TVec3& rhs) const noexcept;
 
     /// @brief Compute the dot product (scalar product) of this vector with another vector.
     ///
@@ -115,7 +121,7 @@ struct Vec3 {
     ///  - If the vectors are parallel, the dot product is equal to the product of their lengths.
     ///  - If the vectors are anti-parallel (pointing in opposite directions), the dot product is
     ///    negative and equal to the negative product of their lengths.
-    [[nodiscard]] constexpr float dot(const Vec3& other) const noexcept {
+    [[nodiscard]] constexpr T dot(const TVec3& other) const noexcept {
         return x * other.x + y * other.y + z * other.z;
     }
 
@@ -123,17 +129,17 @@ struct Vec3 {
     /// @note If the exact length is not required, by example for comparing
     ///       the distance of 2 vectors, we can use lengthSquared() which is faster.
     /// @return Returns the length of this vector.
-    [[nodiscard]] float length() const noexcept { return std::sqrt(dot(*this)); }
+    [[nodiscard]] T length() const noexcept { return std::sqrt(dot(*this)); }
 
     /// @brief Compute the square length (magnitude) of this vector.
     /// @return Returns the square length of this vector.
-    [[nodiscard]] constexpr float lengthSquared() const noexcept { return dot(*this); }
+    [[nodiscard]] constexpr T lengthSquared() const noexcept { return dot(*this); }
 
     /// @brief Normalize the vector.
     /// @bug When vector is 0 length.
-    [[nodiscard]] Vec3 normalize() const noexcept {
-        const float len    = length();
-        const float invLen = 1.f / len;
+    [[nodiscard]] TVec3 normalize() const noexcept {
+        const T len    = length();
+        const T invLen = T(1) / len;
         return {x * invLen, y * invLen, z * invLen};
     }
 
@@ -167,7 +173,7 @@ struct Vec3 {
     /// @bug     Check for @b other zero length.
     /// @param  other Vector being projected onto. Need not be normalized.
     /// @return  The projection of this vector into vector @b other.
-    [[nodiscard]] constexpr Vec3 projectTo(const Vec3& other) const noexcept;
+    [[nodiscard]] constexpr TVec3 projectTo(const TVec3& other) const noexcept;
 
     /// @brief Compute the perpendicular projection of this vector onto another vector.
     ///
@@ -191,125 +197,159 @@ struct Vec3 {
     /// @warning If the @b other vector is a zero vector, the projection is undefined.
     /// @bug     Check for @b other zero length.
     /// @param  other Vector being projected onto. Need not be normalized.
-    [[nodiscard]] constexpr Vec3 perpendicularTo(const Vec3& other) const noexcept;
+    [[nodiscard]] constexpr TVec3 perpendicularTo(const TVec3& other) const noexcept;
 
     /// @brief   Calculates a reflection vector to the plane with the given normal .
     /// @pre     normal must be normalized.
     /// @remarks Assumes 'this' is pointing AWAY THROUGH the plane, invert if it is not.
-    [[nodiscard]] Vec3 reflect(const Vec3& normal) const noexcept;
+    [[nodiscard]] TVec3 reflect(const TVec3& normal) const noexcept;
 
-    float x; ///< The x component of the vector.
-    float y; ///< The y component of the vector.
-    float z; ///< The z component of the vector.
+    T x; ///< The x component of the vector.
+    T y; ///< The y component of the vector.
+    T z; ///< The z component of the vector.
 };
 
-inline constexpr Vec3 Vec3::kZero(0.F, 0.F, 0.F);
-inline constexpr Vec3 Vec3::kUnitX(1.F, 0.F, 0.F);
-inline constexpr Vec3 Vec3::kUnitXNeg(-1.F, 0.F, 0.F);
-inline constexpr Vec3 Vec3::kUnitY(0.F, 1.F, 0.F);
-inline constexpr Vec3 Vec3::kUnitYNeg(0.F, -1.F, 0.F);
-inline constexpr Vec3 Vec3::kUnitZ(0.F, 0.F, 1.F);
-inline constexpr Vec3 Vec3::kUnitZNeg(0.F, 0.F, -1.F);
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kZero(T(0), T(0), T(0));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitX(T(1), T(0), T(0));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitXNeg(T(-1), T(0), T(0));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitY(T(0), T(1), T(0));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitYNeg(T(0), T(-1), T(0));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitZ(T(0), T(0), T(1));
+template <typename T>
+inline constexpr TVec3<T> TVec3<T>::kUnitZNeg(T(0), T(0), T(-1));
 
 /// @brief Negates the vector, flipping the sign of each component.
-/// @related Vec3
+/// @related TVec3
 /// @ingroup Math
-[[nodiscard]] constexpr Vec3 operator-(const Vec3& v) noexcept { return {-v.x, -v.y, -v.z}; }
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator-(const TVec3<T>& v) noexcept {
+    return {-v.x, -v.y, -v.z};
+}
 
-/// @name Scalar / Vec3 Operations
-/// @related Vec3
+/// @name Scalar / TVec3 Operations
+/// @related TVec3
 /// @ingroup Math
 /// @{
 
 /// @brief Multiply a vector by a scalar.
-[[nodiscard]] constexpr Vec3 operator*(const Vec3& v, float s) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator*(const TVec3<T>& v, std::type_identity_t<T> s) noexcept {
     return {v.x * s, v.y * s, v.z * s};
 }
 
-/// @copydoc operator*(const Vec3&, float)
-[[nodiscard]] constexpr Vec3 operator*(float s, const Vec3& v) noexcept {
+/// @copydoc operator*(const TVec3<T>&, std::type_identity_t<T>)
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator*(std::type_identity_t<T> s, const TVec3<T>& v) noexcept {
     return {v.x * s, v.y * s, v.z * s};
 }
 
-/// @copydoc operator*(const Vec3&, float)
-constexpr Vec3& operator*=(Vec3& v, float s) noexcept { return v = v * s; }
+/// @copydoc operator*(const TVec3<T>&, std::type_identity_t<T>)
+template <typename T>
+constexpr TVec3<T>& operator*=(TVec3<T>& v, std::type_identity_t<T> s) noexcept {
+    return v = v * s;
+}
 
 /// @brief
-[[nodiscard]] constexpr Vec3 operator/(const Vec3& v, float s) noexcept {
-    const auto inv = 1.f / s;
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator/(const TVec3<T>& v, std::type_identity_t<T> s) noexcept {
+    const T inv = T(1) / s;
     return {v.x * inv, v.y * inv, v.z * inv};
 }
 
-/// @copydoc operator/(const Vec3&, float)
-constexpr Vec3& operator/=(Vec3& v, float s) noexcept { return v = v / s; }
+/// @copydoc operator/(const TVec3<T>&, std::type_identity_t<T>)
+template <typename T>
+constexpr TVec3<T>& operator/=(TVec3<T>& v, std::type_identity_t<T> s) noexcept {
+    return v = v / s;
+}
 
 /// @}
 
-/// @name Vec3 / Vec3 Operations
-/// @related Vec3
+/// @name TVec3 / TVec3 Operations
+/// @related TVec3
 /// @{
 
 /// @brief
-[[nodiscard]] constexpr Vec3 operator+(const Vec3& a, const Vec3& b) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator+(const TVec3<T>& a, const TVec3<T>& b) noexcept {
     return {a.x + b.x, a.y + b.y, a.z + b.z};
 }
 
 /// @brief
-constexpr Vec3& operator+=(Vec3& a, const Vec3& b) { return a = a + b; }
+template <typename T>
+constexpr TVec3<T>& operator+=(TVec3<T>& a, const TVec3<T>& b) {
+    return a = a + b;
+}
 
 /// @brief
-[[nodiscard]] constexpr Vec3 operator-(const Vec3& a, const Vec3& b) noexcept {
+template <typename T>
+[[nodiscard]] constexpr TVec3<T> operator-(const TVec3<T>& a, const TVec3<T>& b) noexcept {
     return {a.x - b.x, a.y - b.y, a.z - b.z};
 }
 
 /// @brief
-constexpr Vec3& operator-=(Vec3& a, const Vec3& b) { return a = a - b; }
+template <typename T>
+constexpr TVec3<T>& operator-=(TVec3<T>& a, const TVec3<T>& b) {
+    return a = a - b;
+}
 
 /// @}
 
-inline float Vec3::distance(const Vec3& rhs) const { return (*this - rhs).length(); }
+template <typename T>
+inline T TVec3<T>::distance(const TVec3& rhs) const {
+    return (*this - rhs).length();
+}
 
-constexpr float Vec3::distanceSquared(const Vec3& rhs) const noexcept {
+template <typename T>
+constexpr T TVec3<T>::distanceSquared(const TVec3& rhs) const noexcept {
     return (*this - rhs).lengthSquared();
 }
 
-constexpr Vec3 Vec3::projectTo(const Vec3& other) const noexcept {
+template <typename T>
+constexpr TVec3<T> TVec3<T>::projectTo(const TVec3& other) const noexcept {
     //             (a dot b)
     // proj(a,b)  ---------- * b
     //             (b dot b)
     return dot(other) / other.dot(other) * other;
 }
 
-constexpr Vec3 Vec3::perpendicularTo(const Vec3& other) const noexcept {
+template <typename T>
+constexpr TVec3<T> TVec3<T>::perpendicularTo(const TVec3& other) const noexcept {
     return *this - projectTo(other);
 }
 
-inline Vec3 Vec3::reflect(const Vec3& normal) const noexcept {
+template <typename T>
+inline TVec3<T> TVec3<T>::reflect(const TVec3& normal) const noexcept {
     //return 2 * (dot(normal)) * normal - *this;
     return *this - (2 * dot(normal) * normal);
 }
 
 } // namespace fuse
 
-/// \relates Vec3
+/// \relates fuse::TVec3
 /// \brief Custom std::formatter
 ///
 /// This formater format the vector as [x,y,z].
 ///
 /// @note All standard options are supported and they are apply component by component.
-template <>
-struct std::formatter<fuse::Vec3> : std::formatter<float> {
+template <typename T>
+struct std::formatter<fuse::TVec3<T>> : std::formatter<T> {
 
-    constexpr auto parse(auto& ctx) { return std::formatter<float>::parse(ctx); }
+    constexpr auto parse(auto& ctx) { return std::formatter<T>::parse(ctx); }
 
-    auto format(const fuse::Vec3& v, auto& ctx) const {
+    auto format(const fuse::TVec3<T>& v, auto& ctx) const {
         auto&& out = ctx.out();
         std::format_to(out, "[");
-        std::formatter<float>::format(v.x, ctx);
+        std::formatter<T>::format(v.x, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(v.y, ctx);
+        std::formatter<T>::format(v.y, ctx);
         std::format_to(out, ", ");
-        std::formatter<float>::format(v.z, ctx);
+        std::formatter<T>::format(v.z, ctx);
         return format_to(out, "]");
     }
 };
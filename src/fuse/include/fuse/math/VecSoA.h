@@ -0,0 +1,211 @@
+#pragma once
+#include "Vec3.h"
+#include "Vec4.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace fuse {
+
+/// @brief Storage of N float streams, one per vector component (Structure of arrays).
+///
+/// Each stream is aligned on kAlignment bytes and its capacity is a multiple of
+/// kAlignment / sizeof(float), so a full SIMD register can always be loaded.
+/// This is the base class of Vec3SoA and Vec4SoA, use them instead.
+///
+/// @tparam N The number of components.
+/// @ingroup Math
+template <unsigned N>
+class VecSoA {
+public:
+    static constexpr std::size_t kAlignment = 32; ///< Alignment of each stream in bytes.
+
+    /// @brief Construct an empty container.
+    VecSoA() noexcept = default;
+
+    /// @brief Construct a container of @p size zero vectors.
+    explicit VecSoA(std::size_t size);
+
+    VecSoA(const VecSoA& other);
+    VecSoA(VecSoA&& other) noexcept;
+    VecSoA& operator=(const VecSoA& other);
+    VecSoA& operator=(VecSoA&& other) noexcept;
+    ~VecSoA();
+
+    /// @brief Return the number of vectors.
+    [[nodiscard]] std::size_t size() const noexcept { return mSize; }
+
+    /// @brief Return the number of vectors that can be stored without reallocation.
+    [[nodiscard]] std::size_t capacity() const noexcept { return mCapacity; }
+
+    /// @brief Return true when the container holds no vector.
+    [[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+
+    /// @brief Change the number of vectors, the new vectors are set to zero.
+    void resize(std::size_t size);
+
+    /// @brief Increase the capacity to at least @p capacity vectors.
+    void reserve(std::size_t capacity);
+
+    /// @brief Remove all vectors, the capacity is unchanged.
+    void clear() noexcept { mSize = 0; }
+
+    /// @brief Return the stream of the component @p component (0 for x, 1 for y ...).
+    [[nodiscard]] std::span<float> stream(unsigned component) noexcept {
+        return {mData + component * mCapacity, mSize};
+    }
+
+    /// @copydoc stream()
+    [[nodiscard]] std::span<const float> stream(unsigned component) const noexcept {
+        return {mData + component * mCapacity, mSize};
+    }
+
+    /// @brief Return the stream of the x components.
+    [[nodiscard]] std::span<float> x() noexcept { return stream(0); }
+    /// @copydoc x()
+    [[nodiscard]] std::span<const float> x() const noexcept { return stream(0); }
+    /// @brief Return the stream of the y components.
+    [[nodiscard]] std::span<float> y() noexcept { return stream(1); }
+    /// @copydoc y()
+    [[nodiscard]] std::span<const float> y() const noexcept { return stream(1); }
+    /// @brief Return the stream of the z components.
+    [[nodiscard]] std::span<float> z() noexcept { return stream(2); }
+    /// @copydoc z()
+    [[nodiscard]] std::span<const float> z() const noexcept { return stream(2); }
+
+protected:
+    float*      mData     = nullptr; ///< The N streams, one after the other.
+    std::size_t mSize     = 0;       ///< Number of vectors.
+    std::size_t mCapacity = 0;       ///< Number of floats allocated per stream.
+};
+
+extern template class VecSoA<3>;
+extern template class VecSoA<4>;
+
+/// @brief Container of Vec3 stored as 3 streams of floats (x, y, z).
+///
+/// Use it for loops over many vectors (particles, physics...), the operations
+/// below process whole streams with SIMD instead of one Vec3 at a time.
+///
+/// @ingroup Math
+class Vec3SoA : public VecSoA<3> {
+public:
+    using VecSoA::VecSoA;
+
+    /// @brief Construct a container from an array of Vec3, see gather().
+    explicit Vec3SoA(std::span<const Vec3> vectors);
+
+    /// @brief Return the vector at index @p i.
+    [[nodiscard]] Vec3 get(std::size_t i) const noexcept {
+        return {mData[i], mData[mCapacity + i], mData[2 * mCapacity + i]};
+    }
+
+    /// @brief Set the vector at index @p i.
+    void set(std::size_t i, const Vec3& v) noexcept {
+        mData[i]                 = v.x;
+        mData[mCapacity + i]     = v.y;
+        mData[2 * mCapacity + i] = v.z;
+    }
+
+    /// @brief Replace the content of this container by @p vectors.
+    void gather(std::span<const Vec3> vectors);
+
+    /// @brief Copy the vectors to @p vectors.
+    /// @pre @p vectors is at least as large as this container.
+    void scatter(std::span<Vec3> vectors) const noexcept;
+
+    /// @brief Return the vectors as an array of Vec3.
+    [[nodiscard]] std::vector<Vec3> toVector() const;
+};
+
+/// @brief Container of Vec4 stored as 4 streams of floats (x, y, z, w).
+/// @see Vec3SoA
+/// @ingroup Math
+class Vec4SoA : public VecSoA<4> {
+public:
+    using VecSoA::VecSoA;
+
+    /// @brief Construct a container from an array of Vec4, see gather().
+    explicit Vec4SoA(std::span<const Vec4> vectors);
+
+    /// @brief Return the stream of the w components.
+    [[nodiscard]] std::span<float> w() noexcept { return stream(3); }
+    /// @copydoc w()
+    [[nodiscard]] std::span<const float> w() const noexcept { return stream(3); }
+
+    /// @brief Return the vector at index @p i.
+    [[nodiscard]] Vec4 get(std::size_t i) const noexcept {
+        return {mData[i], mData[mCapacity + i], mData[2 * mCapacity + i],
+                mData[3 * mCapacity + i]};
+    }
+
+    /// @brief Set the vector at index @p i.
+    void set(std::size_t i, const Vec4& v) noexcept {
+        mData[i]                 = v.x;
+        mData[mCapacity + i]     = v.y;
+        mData[2 * mCapacity + i] = v.z;
+        mData[3 * mCapacity + i] = v.w;
+    }
+
+    /// @copydoc Vec3SoA::gather()
+    void gather(std::span<const Vec4> vectors);
+
+    /// @copydoc Vec3SoA::scatter()
+    void scatter(std::span<Vec4> vectors) const noexcept;
+
+    /// @copydoc Vec3SoA::toVector()
+    [[nodiscard]] std::vector<Vec4> toVector() const;
+};
+
+//
+// Operations over whole streams.
+//
+// The output container is resized to the size of the inputs and may be one of the inputs.
+// When there are 2 inputs, they must have the same size.
+//
+
+/// @brief out[i] = a[i] + b[i]
+/// @ingroup Math
+void add(const Vec3SoA& a, const Vec3SoA& b, Vec3SoA& out);
+
+/// @brief out[i] = a[i] * s + b[i]
+///
+/// By example, to integrate the particles positions: `mulAdd(velocities, dt, positions, positions)`.
+/// @ingroup Math
+void mulAdd(const Vec3SoA& a, float s, const Vec3SoA& b, Vec3SoA& out);
+
+/// @brief out[i] = a[i].dot(b[i])
+/// @pre @p out is at least as large as @p a.
+/// @ingroup Math
+void dot(const Vec3SoA& a, const Vec3SoA& b, std::span<float> out) noexcept;
+
+/// @brief out[i] = a[i].cross(b[i])
+/// @ingroup Math
+void cross(const Vec3SoA& a, const Vec3SoA& b, Vec3SoA& out);
+
+/// @brief out[i] = a[i].normalize()
+/// @ingroup Math
+void normalize(const Vec3SoA& a, Vec3SoA& out);
+
+/// @brief out[i] = a[i].length()
+/// @pre @p out is at least as large as @p a.
+/// @ingroup Math
+void length(const Vec3SoA& a, std::span<float> out) noexcept;
+
+/// @copydoc add(const Vec3SoA&, const Vec3SoA&, Vec3SoA&)
+void add(const Vec4SoA& a, const Vec4SoA& b, Vec4SoA& out);
+
+/// @copydoc mulAdd(const Vec3SoA&, float, const Vec3SoA&, Vec3SoA&)
+void mulAdd(const Vec4SoA& a, float s, const Vec4SoA& b, Vec4SoA& out);
+
+/// @copydoc dot(const Vec3SoA&, const Vec3SoA&, std::span<float>)
+void dot(const Vec4SoA& a, const Vec4SoA& b, std::span<float> out) noexcept;
+
+/// @copydoc normalize(const Vec3SoA&, Vec3SoA&)
+void normalize(const Vec4SoA& a, Vec4SoA& out);
+
+/// @copydoc length(const Vec3SoA&, std::span<float>)
+void length(const Vec4SoA& a, std::span<float> out) noexcept;
+
+} // namespace fuse
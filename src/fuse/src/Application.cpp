@@ -1,8 +1,18 @@
 #include "fuse/Application.h"
 
+#include "fuse/EventBus.h"
+#include "fuse/FrameArena.h"
+#include "fuse/FrameLimiter.h"
+#include "fuse/FrameStats.h"
+#include "fuse/GpuProfiler.h"
+#include "fuse/InputRecording.h"
+#include "fuse/JobSystem.h"
 #include "fuse/LayerStack.h"
 #include "fuse/Logger.h"
+#include "fuse/MemoryTracker.h"
+#include "fuse/Profiler.h"
 #include "fuse/Timer.h"
+#include "fuse/math/Dispatch.h"
 
 #include <glad/gl.h>
 #include <SDL3/SDL.h>
@@ -11,13 +21,54 @@
 #include <imgui/backends/imgui_impl_opengl3.h>
 #include <imgui/backends/imgui_impl_sdl3.h>
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 
 namespace {
-SDL_Window*      window{};
-SDL_GLContext    glContext{};
-fuse::LayerStack layerStack{};
+SDL_Window*             window{};
+SDL_GLContext           glContext{};
+fuse::LayerStack        layerStack{};
+fuse::ApplicationConfig appConfig{};
+std::uint64_t           frameIndex{0};
+
+// The framebuffer of the headless mode and its attachments.
+GLuint offscreenFramebuffer{};
+GLuint offscreenColor{};
+GLuint offscreenDepthStencil{};
+
+std::unique_ptr<fuse::JobSystem>     jobSystem;
+std::unique_ptr<fuse::EventBus>      eventBus;
+std::unique_ptr<fuse::GpuProfiler>   gpuProfiler;
+std::unique_ptr<fuse::InputRecorder> inputRecorder;
+std::unique_ptr<fuse::InputReplay>   inputReplay;
+fuse::FixedTimestep                  fixedTimestep{};
+fuse::FrameLimiter                   frameLimiter{};
+fuse::FrameStats                     frameStats{};
+
+/// @brief Measure the duration of the phases of a frame for FrameStats.
+class PhaseClock {
+public:
+    PhaseClock()
+        : mMsPerCount(1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()))
+        , mStart(SDL_GetPerformanceCounter()) {}
+
+    /// @brief End a phase, the next one starts.
+    void end(fuse::FramePhase phase) {
+        const Uint64 now                        = SDL_GetPerformanceCounter();
+        mTimes[static_cast<std::size_t>(phase)] =
+          static_cast<float>(static_cast<double>(now - mStart) * mMsPerCount);
+        mStart = now;
+    }
+
+    [[nodiscard]] const fuse::FramePhaseTimes& times() const { return mTimes; }
+
+private:
+    double                mMsPerCount;
+    Uint64                mStart;
+    fuse::FramePhaseTimes mTimes{};
+};
 
 
 static void openglDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
@@ -33,6 +84,22 @@ static void openglDebugCallback(GLenum source, GLenum type, GLuint id, GLenum se
         return;
     }
 
+    // Checked first, a filtered message does not pay for the strings and the formatting.
+    const fuse::LogLevel level = [severity]() {
+        switch (severity) {
+                // clang-format off
+            case GL_DEBUG_SEVERITY_HIGH:         return fuse::LogLevel::Error;
+            case GL_DEBUG_SEVERITY_MEDIUM:       return fuse::LogLevel::Warn;
+            case GL_DEBUG_SEVERITY_LOW:          return fuse::LogLevel::Info;
+            case GL_DEBUG_SEVERITY_NOTIFICATION:
+            default:                             return fuse::LogLevel::Debug;
+                // clang-format on
+        }
+    }();
+    if (!fuse::log_enabled(level, fuse::LogCategory::Render)) {
+        return;
+    }
+
     std::string_view sourceStr = [source]() {
         switch (source) {
                 // clang-format off
@@ -79,7 +146,8 @@ static void openglDebugCallback(GLenum source, GLenum type, GLuint id, GLenum se
         }
     }();
 
-    fuse::log_message(fuse::LogLevel::Info,
+    fuse::log_message(fuse::LogCategory::Render,
+                      level,
                       "[OpenGL][{}][{}][{}]({}) {}",
                       typeStr,
                       sourceStr,
@@ -88,6 +156,40 @@ static void openglDebugCallback(GLenum source, GLenum type, GLuint id, GLenum se
                       message);
 }
 
+/// @brief Create the framebuffer the headless mode renders into.
+void createOffscreenFramebuffer(unsigned width, unsigned height) {
+    glCreateRenderbuffers(1, &offscreenColor);
+    glNamedRenderbufferStorage(offscreenColor, GL_RGBA8, (GLsizei)width, (GLsizei)height);
+    glCreateRenderbuffers(1, &offscreenDepthStencil);
+    glNamedRenderbufferStorage(offscreenDepthStencil,
+                               GL_DEPTH24_STENCIL8,
+                               (GLsizei)width,
+                               (GLsizei)height);
+
+    glCreateFramebuffers(1, &offscreenFramebuffer);
+    glObjectLabel(GL_FRAMEBUFFER, offscreenFramebuffer, -1, "Offscreen");
+    glNamedFramebufferRenderbuffer(offscreenFramebuffer,
+                                   GL_COLOR_ATTACHMENT0,
+                                   GL_RENDERBUFFER,
+                                   offscreenColor);
+    glNamedFramebufferRenderbuffer(offscreenFramebuffer,
+                                   GL_DEPTH_STENCIL_ATTACHMENT,
+                                   GL_RENDERBUFFER,
+                                   offscreenDepthStencil);
+    if (glCheckNamedFramebufferStatus(offscreenFramebuffer, GL_FRAMEBUFFER) !=
+        GL_FRAMEBUFFER_COMPLETE) {
+        FUSE_FATAL("Offscreen framebuffer incomplete.");
+    }
+}
+
+void destroyOffscreenFramebuffer() {
+    glDeleteFramebuffers(1, &offscreenFramebuffer);
+    glDeleteRenderbuffers(1, &offscreenColor);
+    glDeleteRenderbuffers(1, &offscreenDepthStencil);
+    offscreenFramebuffer  = 0;
+    offscreenColor        = 0;
+    offscreenDepthStencil = 0;
+}
 
 } // namespace
 
@@ -96,11 +198,45 @@ namespace fuse {
 
 Application* Application::sInstance{};
 
-Application::Application() {
+Application::Application(const ApplicationConfig& config) {
     assert(sInstance == nullptr && "Multiple instance not allowed.");
-    sInstance = this;
+    sInstance  = this;
+    appConfig  = config;
+    frameIndex = 0;
+    frameStats.reset();
 
     fuse::log_initialize();
+    FUSE_PROFILE_THREAD("Main");
+
+    // Select the math kernels now rather than on the first call in the main loop.
+    FUSE_INFO("Math kernels: {} (compiled: {})", toString(activeIsa()), toString(compiledIsa()));
+
+    jobSystem = std::make_unique<JobSystem>();
+    FUSE_INFO("Job system: {} worker threads", jobSystem->workerCount());
+    eventBus = std::make_unique<EventBus>();
+
+    if (!config.recordInput.empty()) {
+        inputRecorder = std::make_unique<InputRecorder>();
+        if (inputRecorder->open(config.recordInput)) {
+            FUSE_INFO("Recording the input into '{}'", config.recordInput.string());
+        } else {
+            inputRecorder.reset();
+        }
+    }
+    if (!config.replayInput.empty()) {
+        auto replay = InputReplay::load(config.replayInput);
+        if (!replay) {
+            FUSE_FATAL("Unable to replay the input: {}", replay.error());
+        } else if (replay->frameCount() == 0) {
+            FUSE_FATAL("Unable to replay the input: '{}' has no frame.",
+                       config.replayInput.string());
+        } else {
+            FUSE_INFO("Replaying {} frames of '{}'",
+                      replay->frameCount(),
+                      config.replayInput.string());
+            inputReplay = std::make_unique<InputReplay>(std::move(*replay));
+        }
+    }
 
     //
     // Init SDL
@@ -125,6 +261,10 @@ Application::Application() {
         FUSE_DEBUG(" - {}", SDL_GetGPUDriver(i));
     }
 
+    if (config.headless) {
+        // No display needed, the OpenGL context comes from EGL (Mesa llvmpipe without GPU).
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    }
     if (!SDL_Init(SDL_INIT_VIDEO)) {
         FUSE_FATAL("SDL could not initialize! SDL error: {}", SDL_GetError());
     }
@@ -141,9 +281,10 @@ Application::Application() {
     //
     // Create the main windows.
     //
+    // In headless mode the window is never shown, the offscreen framebuffer has no multisampling.
     SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 1);
-    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 8);
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, config.headless ? 0 : 1);
+    SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, config.headless ? 0 : 8);
     SDL_GL_SetAttribute(SDL_GL_ACCELERATED_VISUAL, 1);
     SDL_GL_SetAttribute(SDL_GL_FRAMEBUFFER_SRGB_CAPABLE, 0);
     SDL_GL_SetAttribute(SDL_GL_FLOATBUFFERS, 0);
@@ -152,9 +293,13 @@ Application::Application() {
 
     SDL_WindowFlags windowFlags = 0;
     windowFlags |= SDL_WINDOW_OPENGL;
-    windowFlags |= SDL_WINDOW_RESIZABLE;
-    windowFlags |= SDL_WINDOW_HIGH_PIXEL_DENSITY;
-    window = SDL_CreateWindow("Fuse", 1920, 1080, windowFlags);
+    if (config.headless) {
+        windowFlags |= SDL_WINDOW_HIDDEN;
+    } else {
+        windowFlags |= SDL_WINDOW_RESIZABLE;
+        windowFlags |= SDL_WINDOW_HIGH_PIXEL_DENSITY;
+    }
+    window = SDL_CreateWindow(config.title, (int)config.width, (int)config.height, windowFlags);
     if (window == nullptr) {
         FUSE_FATAL("Window could not be created! SDL error: {}", SDL_GetError());
     }
@@ -252,6 +397,12 @@ Application::Application() {
                               true);
     }
 
+    if (config.headless) {
+        createOffscreenFramebuffer(config.width, config.height);
+    }
+
+    gpuProfiler = std::make_unique<GpuProfiler>();
+
     // Setup Dear ImGui context
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
@@ -259,93 +410,257 @@ Application::Application() {
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // Enable Keyboard Controls
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;  // Enable Gamepad Controls
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;     // IF using Docking Branch
+    if (config.headless) {
+        io.IniFilename = nullptr; // Do not write imgui.ini on the build agents.
+    }
 
     ImGui_ImplSDL3_InitForOpenGL(window, glContext);
     ImGui_ImplOpenGL3_Init();
 }
 
-Application::~Application() = default;
+Application::~Application() {
+    if (!appConfig.frameStatsCsv.empty()) {
+        if (frameStats.exportCsv(appConfig.frameStatsCsv)) {
+            FUSE_INFO("Frame times written to '{}'", appConfig.frameStatsCsv.string());
+        } else {
+            FUSE_ERROR("Unable to write the frame times to '{}'",
+                       appConfig.frameStatsCsv.string());
+        }
+    }
+
+    // The layers release their OpenGL resources while the context exists, and their
+    // subscriptions while the event bus exists.
+    layerStack.clear();
+    eventBus.reset();
+
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui_ImplSDL3_Shutdown();
+    ImGui::DestroyContext();
+
+    gpuProfiler.reset();
+    if (offscreenFramebuffer != 0) {
+        destroyOffscreenFramebuffer();
+    }
+    SDL_GL_DestroyContext(glContext);
+    SDL_DestroyWindow(window);
+    glContext = nullptr;
+    window    = nullptr;
+    SDL_Quit();
+
+    jobSystem.reset();
+    inputRecorder.reset();
+    inputReplay.reset();
+
+    fuse::log_shutdown();
+    sInstance = nullptr;
+}
 
 void* Application::getWindow() { return window; }
 
 void* Application::getGLContext() { return glContext; }
 
-void Application::pushLayer(Layer* layer) { layerStack.pushLayer(layer); }
+bool Application::isHeadless() const { return appConfig.headless; }
+
+std::uint64_t Application::getFrameIndex() const { return frameIndex; }
+
+unsigned Application::getFramebuffer() const { return offscreenFramebuffer; }
+
+std::vector<std::uint8_t> Application::readPixels() const {
+    int width  = (int)appConfig.width;
+    int height = (int)appConfig.height;
+    if (!appConfig.headless) {
+        SDL_GetWindowSizeInPixels(window, &width, &height);
+    }
+    std::vector<std::uint8_t> pixels((std::size_t)width * (std::size_t)height * 4);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, offscreenFramebuffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    return pixels;
+}
+
+void Application::pushLayer(Layer* layer, LayerHooks hooks) {
+    layerStack.pushLayer(layer, hooks);
+}
+
+LayerStack& Application::getLayerStack() { return layerStack; }
+
+void Application::setFixedTimestep(Time step, unsigned maxStepsPerFrame) {
+    fixedTimestep.setStep(step);
+    fixedTimestep.setMaxSteps(maxStepsPerFrame);
+}
+
+FrameLimiter& Application::getFrameLimiter() { return frameLimiter; }
+
+FrameStats& Application::getFrameStats() { return frameStats; }
+
+EventBus& Application::getEventBus() {
+    assert(eventBus != nullptr && "The event bus is destroyed with the layers.");
+    return *eventBus;
+}
+
+GpuProfiler& Application::getGpuProfiler() {
+    assert(gpuProfiler != nullptr && "The GPU profiler is destroyed with the OpenGL context.");
+    return *gpuProfiler;
+}
+
+JobSystem& Application::getJobSystem() {
+    assert(jobSystem != nullptr && "The job system is stopped.");
+    return *jobSystem;
+}
 
-void Application::run() {
+void Application::run(const std::function<bool()>& stop) {
 
     //
     // Main Loop
     //
     fuse::Timer timer;
     timer.reset();
+    const std::uint64_t lastFrame =
+      appConfig.frameCount == 0 ? UINT64_MAX : frameIndex + appConfig.frameCount;
     bool quit = false;
     while (!quit) {
-        SDL_Event e;
-        while (SDL_PollEvent(&e)) {
-            ImGui_ImplSDL3_ProcessEvent(&e);
-            if (e.type == SDL_EVENT_QUIT) {
-                quit = true;
+        FUSE_PROFILE_FRAME();
+        resetFrameArenas();
+        markMemoryFrame();
+        gpuProfiler->beginFrame();
+        PhaseClock phases;
+        // The duration of the frame comes from the recording when replaying.
+        Time replayTime{0.0};
+        {
+            FUSE_PROFILE_SCOPE("Events");
+            const auto dispatch = [this](SDL_Event& e) {
+                ImGui_ImplSDL3_ProcessEvent(&e);
+                frameLimiter.markActive();
+                if (inputRecorder) {
+                    inputRecorder->record(e);
+                }
+                onEvent(e);
+            };
+            SDL_Event e;
+            while (SDL_PollEvent(&e)) {
+                if (e.type == SDL_EVENT_QUIT) {
+                    quit = true;
+                }
+                // The live input would change the recorded path.
+                if (inputReplay && isRecordedEvent(e)) {
+                    continue;
+                }
+                dispatch(e);
+            }
+            if (inputReplay) {
+                replayTime                  = inputReplay->nextFrame();
+                const SDL_WindowID windowId = SDL_GetWindowID(window);
+                while (inputReplay->pollEvent(e, windowId)) {
+                    dispatch(e);
+                }
             }
-            onEvent(e);
+            eventBus->dispatch();
         }
         timer.tick();
+        phases.end(FramePhase::Events);
 
         // FIXME: type conversion
-        onUpdate((double)timer.deltaTime());
-
-        onRender();
+        const Time frameTime = inputReplay ? replayTime : Time((double)timer.deltaTime());
+        if (inputRecorder) {
+            inputRecorder->endFrame(frameTime);
+        }
+        {
+            FUSE_PROFILE_SCOPE("FixedUpdate");
+            for (unsigned steps = fixedTimestep.advance(frameTime); steps > 0; steps--) {
+                onFixedUpdate(fixedTimestep.step());
+            }
+        }
+        phases.end(FramePhase::FixedUpdate);
+        {
+            FUSE_PROFILE_SCOPE("Update");
+            onUpdate(frameTime);
+        }
+        phases.end(FramePhase::Update);
+        if (appConfig.headless) {
+            glBindFramebuffer(GL_FRAMEBUFFER, offscreenFramebuffer);
+            glViewport(0, 0, (GLsizei)appConfig.width, (GLsizei)appConfig.height);
+        }
+        {
+            FUSE_PROFILE_SCOPE("Render");
+            FUSE_GPU_PROFILE_SCOPE(*gpuProfiler, "Render");
+            onRender(fixedTimestep.alpha());
+        }
+        phases.end(FramePhase::Render);
+        {
+            FUSE_PROFILE_SCOPE("ImGui");
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplSDL3_NewFrame();
+            ImGui::NewFrame();
+            onImGui();
+            ImGui::Render();
+            FUSE_GPU_PROFILE_SCOPE(*gpuProfiler, "ImGui");
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
+        phases.end(FramePhase::ImGui);
+        gpuProfiler->endFrame();
+        {
+            FUSE_PROFILE_SCOPE("Swap");
+            if (appConfig.headless) {
+                // Nothing to present, submit the commands as the swap does.
+                glFlush();
+            } else {
+                SDL_GL_SwapWindow(window);
+            }
+        }
+        phases.end(FramePhase::Swap);
+        frameIndex++;
+        if (frameIndex >= lastFrame || (inputReplay && inputReplay->finished()) ||
+            (stop && stop())) {
+            quit = true;
+        }
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplSDL3_NewFrame();
-        ImGui::NewFrame();
-        onImGui();
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        {
+            FUSE_PROFILE_SCOPE("Wait");
+            // When idle, an event ends the wait early and the frame rate goes back up at once.
+            if (frameLimiter.isIdle()) {
+                const auto timeoutMs = (Sint32)frameLimiter.remaining().asMilliSeconds();
+                if (SDL_WaitEventTimeout(nullptr, timeoutMs)) {
+                    frameLimiter.markActive();
+                }
+            }
+            frameLimiter.waitForNextFrame();
+        }
+        phases.end(FramePhase::Wait);
 
-        SDL_GL_SwapWindow(window);
+        // The measured time, also when replaying: the perf runs compare it between builds.
+        frameStats.addFrame((double)timer.deltaTime(), phases.times());
     }
-
-    //
-    // Shutdown
-    //
-    ImGui_ImplOpenGL3_Shutdown();
-    ImGui_ImplSDL3_Shutdown();
-    ImGui::DestroyContext();
-
-    SDL_GL_DestroyContext(glContext);
-    SDL_DestroyWindow(window);
-    SDL_Quit();
-
-    fuse::log_shutdown();
 }
 
 void Application::onUpdate(Time deltaTime) {
-    for (Layer* layer : layerStack) {
+    layerStack.forEach(LayerPhase::Update, [&](Layer* layer) {
+        FUSE_PROFILE_SCOPE(layer->getName());
         layer->onUpdate(deltaTime);
-    }
+    });
 }
 
-void Application::onRender() {
-    for (Layer* layer : layerStack) {
-        layer->onRender();
-    }
+void Application::onFixedUpdate(Time step) {
+    layerStack.forEach(LayerPhase::FixedUpdate, [&](Layer* layer) {
+        FUSE_PROFILE_SCOPE(layer->getName());
+        layer->onFixedUpdate(step);
+    });
+}
+
+void Application::onRender(float alpha) {
+    layerStack.forEach(LayerPhase::Render, [&](Layer* layer) {
+        FUSE_PROFILE_SCOPE(layer->getName());
+        FUSE_GPU_PROFILE_SCOPE(*gpuProfiler, layer->getName());
+        layer->onRender(alpha);
+    });
 }
 
 void Application::onImGui() {
-    for (Layer* layer : layerStack) {
+    layerStack.forEach(LayerPhase::ImGui, [&](Layer* layer) {
+        FUSE_PROFILE_SCOPE(layer->getName());
         layer->onImGui();
-    }
+    });
 }
 
-void Application::onEvent(const SDL_Event& e) {
-    for (auto it = layerStack.rbegin(); it != layerStack.rend(); ++it) {
-        if ((*it)->onEvent(e)) {
-            // The layer has handle the event,
-            // stop dispatching the event to other layers.
-            break;
-        }
-    }
-}
+void Application::onEvent(const SDL_Event& e) { eventBus->enqueue(e); }
 
 } // namespace fuse
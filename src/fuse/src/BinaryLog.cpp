@@ -0,0 +1,703 @@
+#include <fuse/BinaryLog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <variant>
+
+// File layout, native byte order:
+//   header : "FUSEBLOG" u32 version
+//   blocks : u8 type, then
+//     'F' format : u32 id, u8 category, u8 level, u32 line, then the format, the argument tags
+//                  and the file, each as u32 size + characters.
+//     'B' buffer : u32 thread, u32 size, then the messages of a thread:
+//                  u32 format id, u64 nanoseconds since the start, the arguments.
+// A format block is always written before the first buffer using it.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char          kMagic[8]     = {'F', 'U', 'S', 'E', 'B', 'L', 'O', 'G'};
+constexpr std::uint32_t kVersion      = 1;
+constexpr char          kFormatBlock  = 'F';
+constexpr char          kBufferBlock  = 'B';
+constexpr std::size_t   kMessageHeaderSize = sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+struct Format {
+    fuse::LogCategory category;
+    fuse::LogLevel    level;
+    std::string       format;
+    std::string       tags;
+    std::string       file;
+    std::uint32_t     line;
+};
+
+/// @brief The messages of a thread, given to the writer thread when full.
+struct Buffer {
+    std::unique_ptr<std::byte[]> data;
+    std::size_t                  size{};
+    std::uint32_t                thread{};
+};
+
+template <typename T>
+void append(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendString(std::string& out, std::string_view str) {
+    append(out, static_cast<std::uint32_t>(str.size()));
+    out += str;
+}
+
+/// @brief Write the buffers given by the logging threads to the file.
+class BinaryLogWriter {
+public:
+    BinaryLogWriter(std::FILE* file, std::size_t bufferSize, Clock::duration flushInterval)
+        : mFile(file)
+        , mBufferSize(bufferSize)
+        , mFlushInterval(flushInterval) {
+        std::fwrite(kMagic, 1, sizeof(kMagic), mFile);
+        std::fwrite(&kVersion, sizeof(kVersion), 1, mFile);
+        std::fflush(mFile);
+        mThread = std::thread(&BinaryLogWriter::run, this);
+    }
+
+    ~BinaryLogWriter() {
+        {
+            std::scoped_lock lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_one();
+        mThread.join();
+        std::fclose(mFile);
+    }
+
+    BinaryLogWriter(const BinaryLogWriter&)            = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    std::unique_ptr<Buffer> acquire() {
+        {
+            std::scoped_lock lock(mMutex);
+            if (!mFree.empty()) {
+                auto buffer = std::move(mFree.back());
+                mFree.pop_back();
+                return buffer;
+            }
+        }
+        auto buffer  = std::make_unique<Buffer>();
+        buffer->data = std::make_unique_for_overwrite<std::byte[]>(mBufferSize);
+        return buffer;
+    }
+
+    void submit(std::unique_ptr<Buffer> buffer) {
+        {
+            std::scoped_lock lock(mMutex);
+            if (buffer->size == 0) {
+                mFree.push_back(std::move(buffer));
+                return;
+            }
+            mQueue.push_back(std::move(buffer));
+            mSubmitted++;
+        }
+        mCondition.notify_one();
+    }
+
+    void flush() {
+        std::unique_lock lock(mMutex);
+        const std::uint64_t target = mSubmitted;
+        mWrittenCondition.wait(lock, [&] { return mWritten >= target; });
+    }
+
+private:
+    void run();
+
+    /// @brief Write the formats registered since the last call.
+    void writeFormats();
+
+    std::FILE*      mFile;
+    std::size_t     mBufferSize;
+    Clock::duration mFlushInterval;
+    std::size_t     mFormatsWritten{}; ///< Writer thread only.
+
+    std::mutex                           mMutex;
+    std::condition_variable              mCondition;
+    std::condition_variable              mWrittenCondition;
+    std::vector<std::unique_ptr<Buffer>> mQueue;
+    std::vector<std::unique_ptr<Buffer>> mFree;
+    std::uint64_t                        mSubmitted{};
+    std::uint64_t                        mWritten{};
+    bool                                 mStop{};
+    std::thread                          mThread;
+};
+
+/// @brief A lock held for a few instructions, cheaper than a mutex when never contended.
+class SpinLock {
+public:
+    bool try_lock() noexcept { return !mLocked.exchange(true, std::memory_order_acquire); }
+
+    void lock() noexcept {
+        while (!try_lock()) {
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock() noexcept { mLocked.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> mLocked{false};
+};
+
+struct ThreadState;
+
+/// @brief The state shared by the logging threads and the writer thread.
+///
+/// Never destroyed: the ThreadState of a thread still running at exit unregisters after the
+/// static objects are destroyed.
+struct SharedState {
+    std::mutex          formatsMutex;
+    std::vector<Format> formats; ///< The formats of the session, indexed by id.
+
+    // Changed with sessionMutex locked.
+    std::mutex                       sessionMutex;
+    std::unique_ptr<BinaryLogWriter> writer;
+    std::vector<ThreadState*>        threads;
+};
+
+SharedState& shared() {
+    static SharedState* const state = new SharedState();
+    return *state;
+}
+
+// Set by binary_log_initialize() before `active`, read by the logging threads.
+std::atomic<bool>          active{false};
+std::atomic<std::uint32_t> session{0};
+std::atomic<Clock::rep>    startTime{0};
+std::atomic<Clock::rep>    flushInterval{0};
+std::atomic<std::size_t>   bufferCapacity{0};
+std::atomic<std::uint32_t> nextThread{0};
+
+/// @brief The buffer of a logging thread.
+struct ThreadState {
+    ThreadState() {
+        SharedState&     state = shared();
+        std::scoped_lock lock(state.sessionMutex);
+        state.threads.push_back(this);
+    }
+
+    ~ThreadState() {
+        SharedState&     state = shared();
+        std::scoped_lock lock(state.sessionMutex);
+        {
+            std::scoped_lock bufferLock(busy);
+            submit();
+        }
+        std::erase(state.threads, this);
+    }
+
+    ThreadState(const ThreadState&)            = delete;
+    ThreadState& operator=(const ThreadState&) = delete;
+
+    /// @brief Give the buffer to the writer, sessionMutex and busy must be locked.
+    void submit() {
+        SharedState& state = shared();
+        if (buffer && state.writer && bufferSession == session.load(std::memory_order_relaxed)) {
+            state.writer->submit(std::move(buffer));
+        }
+        buffer.reset();
+    }
+
+    /// @brief Give the buffer to the writer and take an empty one, busy must not be locked.
+    /// @return false if the binary log is stopped.
+    bool renew() {
+        SharedState&     state = shared();
+        std::scoped_lock lock(state.sessionMutex);
+        std::scoped_lock bufferLock(busy);
+        submit();
+        if (!state.writer) {
+            return false;
+        }
+        buffer         = state.writer->acquire();
+        buffer->thread = index;
+        bufferSession  = session.load(std::memory_order_relaxed);
+        bufferStart    = Clock::now();
+        return true;
+    }
+
+    /// @brief Locked by the thread while it writes a message, and by the writer thread taking
+    ///        the buffer of an idle thread. Never held while waiting for sessionMutex.
+    SpinLock                busy;
+    std::unique_ptr<Buffer> buffer;
+    std::uint32_t           bufferSession{};
+    Clock::time_point       bufferStart;
+    std::uint32_t           index = nextThread.fetch_add(1, std::memory_order_relaxed);
+};
+
+ThreadState& threadState() {
+    thread_local ThreadState state;
+    return state;
+}
+
+/// @brief Give the writer the buffers older than the flush interval of the threads which do
+///        not log anymore, and would keep them until their next message.
+void pullIdleBuffers(const BinaryLogWriter* writer) {
+    SharedState& state = shared();
+    // Skipped this time if binary_log_flush() holds the lock while waiting for the writer.
+    std::unique_lock lock(state.sessionMutex, std::try_to_lock);
+    if (!lock || state.writer.get() != writer) {
+        return;
+    }
+    const Clock::duration   interval{flushInterval.load(std::memory_order_relaxed)};
+    const Clock::time_point now = Clock::now();
+    for (ThreadState* thread : state.threads) {
+        // A thread writing a message gives its buffer itself when it is old.
+        std::unique_lock bufferLock(thread->busy, std::try_to_lock);
+        if (bufferLock && thread->buffer && thread->buffer->size != 0 &&
+            now - thread->bufferStart > interval) {
+            thread->submit();
+        }
+    }
+}
+
+void BinaryLogWriter::run() {
+    std::unique_lock lock(mMutex);
+    for (;;) {
+        // Wake up at the flush interval to take the buffers of the idle threads.
+        if (!mCondition.wait_for(lock, mFlushInterval, [&] { return mStop || !mQueue.empty(); })) {
+            lock.unlock();
+            pullIdleBuffers(this);
+            lock.lock();
+            continue;
+        }
+        if (mQueue.empty()) {
+            break;
+        }
+        std::vector<std::unique_ptr<Buffer>> batch;
+        batch.swap(mQueue);
+        lock.unlock();
+
+        writeFormats();
+        for (const auto& buffer : batch) {
+            std::fputc(kBufferBlock, mFile);
+            const auto size = static_cast<std::uint32_t>(buffer->size);
+            std::fwrite(&buffer->thread, sizeof(buffer->thread), 1, mFile);
+            std::fwrite(&size, sizeof(size), 1, mFile);
+            std::fwrite(buffer->data.get(), 1, buffer->size, mFile);
+        }
+        std::fflush(mFile);
+
+        lock.lock();
+        for (auto& buffer : batch) {
+            buffer->size = 0;
+            mFree.push_back(std::move(buffer));
+        }
+        mWritten += batch.size();
+        mWrittenCondition.notify_all();
+    }
+}
+
+void BinaryLogWriter::writeFormats() {
+    SharedState& state = shared();
+    std::string  blocks;
+    {
+        std::scoped_lock lock(state.formatsMutex);
+        for (; mFormatsWritten < state.formats.size(); mFormatsWritten++) {
+            const Format& format = state.formats[mFormatsWritten];
+            blocks += kFormatBlock;
+            append(blocks, static_cast<std::uint32_t>(mFormatsWritten));
+            append(blocks, static_cast<std::uint8_t>(format.category));
+            append(blocks, static_cast<std::uint8_t>(format.level));
+            append(blocks, format.line);
+            appendString(blocks, format.format);
+            appendString(blocks, format.tags);
+            appendString(blocks, format.file);
+        }
+    }
+    std::fwrite(blocks.data(), 1, blocks.size(), mFile);
+}
+
+/// @brief Return the id of the format of @p site in @p current, registered on first use.
+/// @return false if the session ended.
+bool formatId(fuse::detail::BinaryFormatSite& site, std::uint32_t current, std::uint32_t& id) {
+    std::uint64_t key = site.key.load(std::memory_order_acquire);
+    if (key >> 32 != current) {
+        SharedState&     state = shared();
+        std::scoped_lock lock(state.formatsMutex);
+        key = site.key.load(std::memory_order_relaxed);
+        if (key >> 32 != current) {
+            // The formats are cleared when the session ends.
+            if (!active.load(std::memory_order_relaxed) ||
+                session.load(std::memory_order_relaxed) != current) {
+                return false;
+            }
+            state.formats.push_back({site.category, site.level, std::string(site.format),
+                                     site.tags, std::string(site.file), site.line});
+            key = (std::uint64_t{current} << 32) | (state.formats.size() - 1);
+            site.key.store(key, std::memory_order_release);
+        }
+    }
+    id = static_cast<std::uint32_t>(key);
+    return true;
+}
+
+//
+// Decoder
+//
+
+using ArgValue =
+  std::variant<bool, char, std::int64_t, std::uint64_t, float, double, const void*, std::string>;
+
+/// @brief Read the values of a binary log, stop at the end of the data.
+class Reader {
+public:
+    explicit Reader(std::string_view data)
+        : mData(data) {}
+
+    [[nodiscard]] bool atEnd() const noexcept { return mPosition >= mData.size(); }
+
+    template <typename T>
+    bool read(T& value) {
+        if (mData.size() - mPosition < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, mData.data() + mPosition, sizeof(T));
+        mPosition += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(std::size_t size, std::string_view& bytes) {
+        if (mData.size() - mPosition < size) {
+            return false;
+        }
+        bytes = mData.substr(mPosition, size);
+        mPosition += size;
+        return true;
+    }
+
+    bool readString(std::string& str) {
+        std::uint32_t    size = 0;
+        std::string_view bytes;
+        if (!read(size) || !readBytes(size, bytes)) {
+            return false;
+        }
+        str.assign(bytes);
+        return true;
+    }
+
+private:
+    std::string_view mData;
+    std::size_t      mPosition{};
+};
+
+template <typename Stored, typename Value>
+bool readArg(Reader& reader, std::vector<ArgValue>& args) {
+    Stored value{};
+    if (!reader.read(value)) {
+        return false;
+    }
+    args.emplace_back(static_cast<Value>(value));
+    return true;
+}
+
+bool readArgs(Reader& reader, std::string_view tags, std::vector<ArgValue>& args) {
+    using enum fuse::detail::BinaryArg;
+    args.clear();
+    for (const char tag : tags) {
+        bool ok = false;
+        switch (static_cast<fuse::detail::BinaryArg>(tag)) {
+                // clang-format off
+            case Bool:   ok = readArg<bool, bool>(reader, args); break;
+            case Char:   ok = readArg<char, char>(reader, args); break;
+            case Int8:   ok = readArg<std::int8_t, std::int64_t>(reader, args); break;
+            case Int16:  ok = readArg<std::int16_t, std::int64_t>(reader, args); break;
+            case Int32:  ok = readArg<std::int32_t, std::int64_t>(reader, args); break;
+            case Int64:  ok = readArg<std::int64_t, std::int64_t>(reader, args); break;
+            case UInt8:  ok = readArg<std::uint8_t, std::uint64_t>(reader, args); break;
+            case UInt16: ok = readArg<std::uint16_t, std::uint64_t>(reader, args); break;
+            case UInt32: ok = readArg<std::uint32_t, std::uint64_t>(reader, args); break;
+            case UInt64: ok = readArg<std::uint64_t, std::uint64_t>(reader, args); break;
+            case Float:  ok = readArg<float, float>(reader, args); break;
+            case Double: ok = readArg<double, double>(reader, args); break;
+                // clang-format on
+            case Pointer: {
+                std::uint64_t value = 0;
+                ok                  = reader.read(value);
+                args.emplace_back(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(value)));
+                break;
+            }
+            case String: {
+                std::string value;
+                ok = reader.readString(value);
+                args.emplace_back(std::move(value));
+                break;
+            }
+            default:
+                return false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Format a message from its format string and its decoded arguments.
+///
+/// Each replacement field is formatted alone with its format spec. Dynamic width and
+/// precision (`{:{}}`) are not supported, such a field is written as is.
+std::string formatMessage(std::string_view format, const std::vector<ArgValue>& args) {
+    std::string out;
+    std::size_t nextArg = 0;
+    for (std::size_t i = 0; i < format.size(); i++) {
+        const char c = format[i];
+        if (c == '}') {
+            out += '}';
+            if (i + 1 < format.size() && format[i + 1] == '}') {
+                i++;
+            }
+            continue;
+        }
+        if (c != '{') {
+            out += c;
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '{') {
+            out += '{';
+            i++;
+            continue;
+        }
+
+        const std::size_t end = format.find('}', i);
+        if (end == std::string_view::npos) {
+            out += format.substr(i);
+            break;
+        }
+        const std::string_view field = format.substr(i + 1, end - i - 1);
+        const std::size_t      colon = field.find(':');
+        const std::string_view index = field.substr(0, colon);
+        std::size_t            arg   = nextArg++;
+        if (!index.empty()) {
+            std::from_chars(index.data(), index.data() + index.size(), arg);
+        }
+
+        const std::string spec =
+          std::format("{{{}}}", colon == std::string_view::npos ? "" : field.substr(colon));
+        if (arg < args.size() && field.find('{') == std::string_view::npos) {
+            try {
+                std::visit(
+                  [&](const auto& value) {
+                      std::vformat_to(std::back_inserter(out), spec, std::make_format_args(value));
+                  },
+                  args[arg]);
+            } catch (const std::format_error&) {
+                out += format.substr(i, end - i + 1);
+            }
+        } else {
+            out += format.substr(i, end - i + 1);
+        }
+        i = end;
+    }
+    return out;
+}
+
+} // namespace
+
+
+namespace fuse {
+
+namespace detail {
+
+std::byte* binaryLogReserve(BinaryFormatSite& site, std::size_t size) {
+    if (!active.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    const std::size_t needed   = kMessageHeaderSize + size;
+    const std::size_t capacity = bufferCapacity.load(std::memory_order_relaxed);
+    if (needed > capacity) {
+        return nullptr;
+    }
+    const std::uint32_t current = session.load(std::memory_order_relaxed);
+    std::uint32_t       id      = 0;
+    if (!formatId(site, current, id)) {
+        return nullptr;
+    }
+
+    ThreadState&          state = threadState();
+    const Clock::duration interval{flushInterval.load(std::memory_order_relaxed)};
+    Clock::time_point     now;
+    for (;;) {
+        state.busy.lock();
+        now = Clock::now();
+        if (state.buffer && state.bufferSession == current &&
+            state.buffer->size + needed <= capacity && now - state.bufferStart <= interval) {
+            break;
+        }
+        state.busy.unlock();
+        // A buffer of another session would not have the format of the message.
+        if (!state.renew() || state.bufferSession != current) {
+            return nullptr;
+        }
+    }
+
+    const Clock::time_point start{Clock::duration(startTime.load(std::memory_order_relaxed))};
+    const std::uint64_t     time =
+      static_cast<std::uint64_t>(std::chrono::nanoseconds(now - start).count());
+    std::byte* out = state.buffer->data.get() + state.buffer->size;
+    std::memcpy(out, &id, sizeof(id));
+    std::memcpy(out + sizeof(id), &time, sizeof(time));
+    state.buffer->size += needed;
+    return out + kMessageHeaderSize;
+}
+
+void binaryLogCommit() noexcept { threadState().busy.unlock(); }
+
+} // namespace detail
+
+bool binary_log_initialize(const BinaryLogConfig& config) {
+    binary_log_shutdown();
+
+    std::FILE* file = std::fopen(config.path.string().c_str(), "wb");
+    if (file == nullptr) {
+        FUSE_ERROR("Unable to open the binary log '{}'.", config.path.string());
+        return false;
+    }
+    // The writer thread would not see the end of main() otherwise.
+    static const bool shutdownAtExit = (std::atexit(binary_log_shutdown), true);
+    (void)shutdownAtExit;
+
+    SharedState&      state    = shared();
+    std::scoped_lock  lock(state.sessionMutex);
+    const std::size_t capacity = std::max(config.bufferSize, 2 * detail::kBinaryLogMaxString);
+    const auto        interval = std::max<Clock::duration>(
+      std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(config.flushInterval)),
+      std::chrono::milliseconds(1));
+    bufferCapacity.store(capacity, std::memory_order_relaxed);
+    flushInterval.store(interval.count(), std::memory_order_relaxed);
+    startTime.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    state.writer = std::make_unique<BinaryLogWriter>(file, capacity, interval);
+    session.fetch_add(1, std::memory_order_relaxed);
+    active.store(true, std::memory_order_release);
+    return true;
+}
+
+void binary_log_shutdown() {
+    SharedState&                     state = shared();
+    std::unique_ptr<BinaryLogWriter> stopped;
+    {
+        std::scoped_lock lock(state.sessionMutex);
+        if (!state.writer) {
+            return;
+        }
+        active.store(false, std::memory_order_relaxed);
+        for (ThreadState* thread : state.threads) {
+            std::scoped_lock bufferLock(thread->busy);
+            thread->submit();
+        }
+        stopped = std::move(state.writer);
+    }
+    // Write the buffers left and close the file.
+    stopped.reset();
+
+    // The next session registers the formats it uses again.
+    std::scoped_lock lock(state.formatsMutex);
+    state.formats.clear();
+}
+
+void binary_log_flush() {
+    ThreadState&     thread = threadState();
+    SharedState&     state  = shared();
+    std::scoped_lock lock(state.sessionMutex);
+    if (!state.writer) {
+        return;
+    }
+    {
+        std::scoped_lock bufferLock(thread.busy);
+        thread.submit();
+    }
+    state.writer->flush();
+}
+
+std::expected<std::vector<BinaryLogMessage>, std::string> decodeBinaryLog(
+  const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::unexpected(std::format("Unable to open '{}'.", path.string()));
+    }
+    const std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    Reader           reader(data);
+    std::string_view magic;
+    std::uint32_t    version = 0;
+    if (!reader.readBytes(sizeof(kMagic), magic) || magic != std::string_view(kMagic, 8) ||
+        !reader.read(version)) {
+        return std::unexpected(std::format("'{}' is not a binary log.", path.string()));
+    }
+    if (version != kVersion) {
+        return std::unexpected(std::format("Unsupported binary log version {}.", version));
+    }
+
+    // A log cut by a crash ends with a partial block, the messages before it are kept.
+    std::vector<Format>           fileFormats;
+    std::vector<BinaryLogMessage> messages;
+    std::vector<ArgValue>         args;
+    char                          type = 0;
+    while (reader.read(type)) {
+        if (type == kFormatBlock) {
+            std::uint32_t id       = 0;
+            std::uint8_t  category = 0;
+            std::uint8_t  level    = 0;
+            Format        format{};
+            if (!reader.read(id) || !reader.read(category) || !reader.read(level) ||
+                !reader.read(format.line) || !reader.readString(format.format) ||
+                !reader.readString(format.tags) || !reader.readString(format.file)) {
+                break;
+            }
+            // The writer gives the ids in order.
+            if (id != fileFormats.size()) {
+                return std::unexpected("Corrupted format in the binary log.");
+            }
+            format.category = static_cast<LogCategory>(category);
+            format.level    = static_cast<LogLevel>(level);
+            fileFormats.push_back(std::move(format));
+        } else if (type == kBufferBlock) {
+            std::uint32_t    thread = 0;
+            std::uint32_t    size   = 0;
+            std::string_view bytes;
+            if (!reader.read(thread) || !reader.read(size) || !reader.readBytes(size, bytes)) {
+                break;
+            }
+            Reader buffer(bytes);
+            while (!buffer.atEnd()) {
+                std::uint32_t id   = 0;
+                std::uint64_t time = 0;
+                if (!buffer.read(id) || !buffer.read(time) || id >= fileFormats.size()) {
+                    return std::unexpected("Corrupted message in the binary log.");
+                }
+                const Format& format = fileFormats[id];
+                if (!readArgs(buffer, format.tags, args)) {
+                    return std::unexpected("Corrupted message arguments in the binary log.");
+                }
+                messages.push_back({format.category, format.level, static_cast<double>(time) * 1e-9,
+                                    thread, formatMessage(format.format, args), format.file,
+                                    format.line});
+            }
+        } else {
+            return std::unexpected(std::format("Unknown block '{}' in the binary log.", type));
+        }
+    }
+    return messages;
+}
+
+} // namespace fuse
@@ -0,0 +1,98 @@
+#include "fuse/CpuFeatures.h"
+
+#if defined(_M_X64) || defined(_M_IX86)
+#    include <intrin.h>
+#    define FUSE_CPU_X86 1
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <cpuid.h>
+#    define FUSE_CPU_X86 1
+#endif
+
+namespace fuse {
+
+namespace {
+
+#if defined(FUSE_CPU_X86)
+
+struct CpuidRegisters {
+    unsigned eax{};
+    unsigned ebx{};
+    unsigned ecx{};
+    unsigned edx{};
+};
+
+CpuidRegisters cpuid(unsigned leaf, unsigned subLeaf = 0) noexcept {
+    CpuidRegisters r;
+#    if defined(_MSC_VER)
+    int registers[4];
+    __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    r.eax = static_cast<unsigned>(registers[0]);
+    r.ebx = static_cast<unsigned>(registers[1]);
+    r.ecx = static_cast<unsigned>(registers[2]);
+    r.edx = static_cast<unsigned>(registers[3]);
+#    else
+    __cpuid_count(leaf, subLeaf, r.eax, r.ebx, r.ecx, r.edx);
+#    endif
+    return r;
+}
+
+/// @brief Return the register states saved by the operating system (XCR0).
+/// @pre The OSXSAVE bit of cpuid is set.
+unsigned long long xgetbv() noexcept {
+#    if defined(_MSC_VER)
+    return _xgetbv(0);
+#    else
+    unsigned eax{};
+    unsigned edx{};
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#    endif
+}
+
+constexpr bool hasBit(unsigned value, unsigned bit) noexcept { return ((value >> bit) & 1) != 0; }
+
+CpuFeatures detectCpuFeatures() noexcept {
+    CpuFeatures features;
+
+    const unsigned maxLeaf = cpuid(0).eax;
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    const CpuidRegisters leaf1 = cpuid(1);
+    features.sse2              = hasBit(leaf1.edx, 26);
+    features.sse42             = hasBit(leaf1.ecx, 20);
+
+    // The AVX registers are usable only if the OS saves them (XMM and YMM states for AVX,
+    // opmask and ZMM states for AVX-512).
+    const bool               osxsave  = hasBit(leaf1.ecx, 27);
+    const unsigned long long xcr0     = osxsave ? xgetbv() : 0;
+    const bool               osAvx    = hasBit(leaf1.ecx, 28) && (xcr0 & 0x6) == 0x6;
+    const bool               osAvx512 = osAvx && (xcr0 & 0xE0) == 0xE0;
+
+    features.fma = osAvx && hasBit(leaf1.ecx, 12);
+    if (maxLeaf >= 7) {
+        const CpuidRegisters leaf7 = cpuid(7);
+        features.avx2              = osAvx && hasBit(leaf7.ebx, 5);
+        features.avx512f           = osAvx512 && hasBit(leaf7.ebx, 16);
+        features.avx512dq          = osAvx512 && hasBit(leaf7.ebx, 17);
+        features.avx512bw          = osAvx512 && hasBit(leaf7.ebx, 30);
+        features.avx512vl          = osAvx512 && hasBit(leaf7.ebx, 31);
+    }
+    return features;
+}
+
+#else
+
+CpuFeatures detectCpuFeatures() noexcept { return {}; }
+
+#endif
+
+} // namespace
+
+const CpuFeatures& cpuFeatures() noexcept {
+    static const CpuFeatures features = detectCpuFeatures();
+    return features;
+}
+
+} // namespace fuse
@@ -0,0 +1,221 @@
+#include "fuse/EventBus.h"
+
+#include "MpscRingBuffer.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace fuse {
+
+namespace {
+
+/// @brief Merge @p event into @p last when only the last state of both matters.
+/// @return false if the events can not be merged.
+bool coalesce(SDL_Event& last, const SDL_Event& event) noexcept {
+    if (last.type != event.type) {
+        return false;
+    }
+    switch (event.type) {
+        case SDL_EVENT_MOUSE_MOTION: {
+            SDL_MouseMotionEvent&       to   = last.motion;
+            const SDL_MouseMotionEvent& from = event.motion;
+            if (to.windowID != from.windowID || to.which != from.which ||
+                to.state != from.state) {
+                return false;
+            }
+            to.timestamp = from.timestamp;
+            to.x         = from.x;
+            to.y         = from.y;
+            to.xrel += from.xrel;
+            to.yrel += from.yrel;
+            return true;
+        }
+        case SDL_EVENT_MOUSE_WHEEL: {
+            SDL_MouseWheelEvent&       to   = last.wheel;
+            const SDL_MouseWheelEvent& from = event.wheel;
+            if (to.windowID != from.windowID || to.which != from.which ||
+                to.direction != from.direction) {
+                return false;
+            }
+            to.timestamp = from.timestamp;
+            to.mouse_x   = from.mouse_x;
+            to.mouse_y   = from.mouse_y;
+            to.x += from.x;
+            to.y += from.y;
+            to.integer_x += from.integer_x;
+            to.integer_y += from.integer_y;
+            return true;
+        }
+        default: return false;
+    }
+}
+
+} // namespace
+
+EventSubscription::EventSubscription(EventSubscription&& other) noexcept
+    : mBus(std::exchange(other.mBus, nullptr))
+    , mType(other.mType)
+    , mId(other.mId) {}
+
+EventSubscription& EventSubscription::operator=(EventSubscription&& other) noexcept {
+    if (this != &other) {
+        reset();
+        mBus  = std::exchange(other.mBus, nullptr);
+        mType = other.mType;
+        mId   = other.mId;
+    }
+    return *this;
+}
+
+void EventSubscription::reset() {
+    if (mBus != nullptr) {
+        std::exchange(mBus, nullptr)->unsubscribe(mType, mId);
+    }
+}
+
+EventBus::EventBus(std::size_t postCapacity)
+    : mPosted(std::make_unique<MpscRingBuffer<SDL_Event>>(postCapacity)) {}
+
+EventBus::~EventBus() = default;
+
+std::uint32_t EventBus::registerEventType() { return SDL_RegisterEvents(1); }
+
+EventSubscription EventBus::subscribe(std::uint32_t type, Callback callback, void* context,
+                                      int priority) {
+    assert(callback != nullptr && "A subscription needs a callback.");
+    const Subscriber subscriber{callback, context, priority, mNextId++};
+    if (mDispatching) {
+        mPendingInserts.emplace_back(type, subscriber);
+    } else {
+        insert(type, subscriber);
+    }
+    return {this, type, subscriber.id};
+}
+
+void EventBus::insert(std::uint32_t type, const Subscriber& subscriber) {
+    auto table = std::ranges::lower_bound(mTables, type, {}, &Table::type);
+    if (table == mTables.end() || table->type != type) {
+        table = mTables.insert(table, Table{type, {}});
+    }
+    // Before the subscribers of the same priority: the latest subscription is called first.
+    auto& subscribers = table->subscribers;
+    const auto position = std::ranges::find_if(subscribers, [&](const Subscriber& other) {
+        return other.priority <= subscriber.priority;
+    });
+    subscribers.insert(position, subscriber);
+}
+
+void EventBus::unsubscribe(std::uint32_t type, std::uint32_t id) {
+    if (std::erase_if(mPendingInserts, [id](const auto& pending) {
+            return pending.second.id == id;
+        }) != 0) {
+        return;
+    }
+    Table* table = find(type);
+    if (table == nullptr) {
+        return;
+    }
+    const auto it = std::ranges::find(table->subscribers, id, &Subscriber::id);
+    if (it == table->subscribers.end()) {
+        return;
+    }
+    if (mDispatching) {
+        // The table may be iterated, the subscriber is removed after the dispatch.
+        it->callback = nullptr;
+        mRemoved     = true;
+    } else {
+        table->subscribers.erase(it);
+    }
+}
+
+EventBus::Table* EventBus::find(std::uint32_t type) noexcept {
+    const auto table = std::ranges::lower_bound(mTables, type, {}, &Table::type);
+    return table != mTables.end() && table->type == type ? &*table : nullptr;
+}
+
+std::size_t EventBus::subscriberCount(std::uint32_t type) const noexcept {
+    const auto table = std::ranges::lower_bound(mTables, type, {}, &Table::type);
+    if (table == mTables.end() || table->type != type) {
+        return 0;
+    }
+    return static_cast<std::size_t>(std::ranges::count_if(
+      table->subscribers, [](const Subscriber& subscriber) { return subscriber.callback; }));
+}
+
+void EventBus::enqueue(const SDL_Event& event) {
+    if (mCoalescing && !mQueue.empty() && coalesce(mQueue.back(), event)) {
+        mCoalesced++;
+        return;
+    }
+    mQueue.push_back(event);
+}
+
+bool EventBus::post(const SDL_Event& event) {
+    return mPosted->tryPush([&event](SDL_Event& cell) { cell = event; });
+}
+
+bool EventBus::post(std::uint32_t type, std::int32_t code, void* data1, void* data2) {
+    SDL_Event event{};
+    event.user.type      = type;
+    event.user.timestamp = SDL_GetTicksNS();
+    event.user.code      = code;
+    event.user.data1     = data1;
+    event.user.data2     = data2;
+    return post(event);
+}
+
+std::size_t EventBus::queuedCount() const noexcept { return mQueue.size(); }
+
+void EventBus::dispatch() {
+    assert(!mDispatching && "dispatch() called from a callback.");
+    while (mPosted->tryPop([this](SDL_Event& event) { enqueue(event); })) {
+    }
+
+    mDispatching = true;
+    // The events queued by a callback go to the other vector and are delivered after.
+    while (!mQueue.empty()) {
+        mDelivered.swap(mQueue);
+        // Consecutive events often have the same type (motions, key repeats): the table is
+        // kept. The subscribers added by a callback wait for the end, the tables do not move.
+        const Table*  table = nullptr;
+        std::uint32_t type  = 0;
+        for (const SDL_Event& event : mDelivered) {
+            if (table == nullptr || type != event.type) {
+                type  = event.type;
+                table = find(type);
+            }
+            if (table == nullptr) {
+                continue;
+            }
+            for (const Subscriber& subscriber : table->subscribers) {
+                if (subscriber.callback != nullptr &&
+                    subscriber.callback(subscriber.context, event)) {
+                    break;
+                }
+            }
+        }
+        mDelivered.clear();
+    }
+    mDispatching = false;
+
+    if (mRemoved) {
+        compact();
+    }
+    for (const auto& [pendingType, subscriber] : mPendingInserts) {
+        insert(pendingType, subscriber);
+    }
+    mPendingInserts.clear();
+}
+
+void EventBus::compact() {
+    for (Table& table : mTables) {
+        std::erase_if(table.subscribers,
+                      [](const Subscriber& subscriber) { return subscriber.callback == nullptr; });
+    }
+    mRemoved = false;
+}
+
+} // namespace fuse
@@ -0,0 +1,48 @@
+#include "fuse/FixedTimestep.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+namespace fuse {
+
+FixedTimestep::FixedTimestep(Time step, unsigned maxSteps) noexcept
+    : mStep(step.asSeconds())
+    , mMaxSteps(maxSteps) {
+    assert(mStep > 0.0 && "The step must be greater than 0.");
+    assert(mMaxSteps > 0 && "At least one step per frame.");
+}
+
+unsigned FixedTimestep::advance(Time frameTime) noexcept {
+    mAccumulator += std::max(frameTime.asSeconds(), 0.0);
+
+    const double steps = std::floor(mAccumulator / mStep);
+    if (steps > static_cast<double>(mMaxSteps)) {
+        // Too far behind: run the maximum of steps and drop the whole steps left, keep the
+        // fraction so alpha() stays continuous.
+        const double dropped = (steps - static_cast<double>(mMaxSteps)) * mStep;
+        mDroppedTime += dropped;
+        mAccumulator -= dropped + static_cast<double>(mMaxSteps) * mStep;
+        return mMaxSteps;
+    }
+    mAccumulator -= steps * mStep;
+    return static_cast<unsigned>(steps);
+}
+
+float FixedTimestep::alpha() const noexcept {
+    // The subtractions may leave the accumulator a rounding error away from [0, step).
+    const auto alpha = static_cast<float>(mAccumulator / mStep);
+    return std::clamp(alpha, 0.f, std::nextafter(1.f, 0.f));
+}
+
+void FixedTimestep::setStep(Time step) noexcept {
+    assert(step.asSeconds() > 0.0 && "The step must be greater than 0.");
+    mStep = step.asSeconds();
+}
+
+void FixedTimestep::setMaxSteps(unsigned maxSteps) noexcept {
+    assert(maxSteps > 0 && "At least one step per frame.");
+    mMaxSteps = maxSteps;
+}
+
+} // namespace fuse
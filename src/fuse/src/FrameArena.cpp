@@ -0,0 +1,161 @@
+#include <fuse/FrameArena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+// The released memory is poisoned for AddressSanitizer in the debug mode only, FrameArena
+// unpoisons the allocations in this mode only.
+#if FUSE_FRAME_ARENA_DEBUG
+#    if defined(__SANITIZE_ADDRESS__)
+#        define FUSE_FRAME_ARENA_ASAN 1
+#    elif defined(__has_feature)
+#        if __has_feature(address_sanitizer)
+#            define FUSE_FRAME_ARENA_ASAN 1
+#        endif
+#    endif
+#endif
+#ifdef FUSE_FRAME_ARENA_ASAN
+#    include <sanitizer/asan_interface.h>
+#endif
+
+namespace {
+
+/// @brief Byte written in the memory released by a reset.
+constexpr unsigned char kPoison = 0xCD;
+
+/// @brief Incremented by resetFrameArenas(), the arenas of the threads compare it on use.
+std::atomic<std::uint64_t> frameEpoch{0};
+
+/// @brief The arena of a thread and the frame of its last reset.
+struct ThreadArena {
+    fuse::FrameArena         arena;
+    fuse::FrameArenaResource resource{arena};
+    std::uint64_t            epoch{0};
+};
+
+ThreadArena& threadArena() noexcept {
+    thread_local ThreadArena instance;
+    const std::uint64_t      epoch = frameEpoch.load(std::memory_order_relaxed);
+    if (instance.epoch != epoch) {
+        instance.epoch = epoch;
+        instance.arena.reset();
+    }
+    return instance;
+}
+
+} // namespace
+
+namespace fuse {
+
+FrameArena::~FrameArena() {
+#ifdef FUSE_FRAME_ARENA_ASAN
+    for (const Block& block : mBlocks) {
+        ASAN_UNPOISON_MEMORY_REGION(block.data.get(), block.size);
+    }
+#endif
+}
+
+void* FrameArena::allocateSlow(std::size_t size, std::size_t alignment) {
+    // The end of the current block stays unused.
+    mUsedInFullBlocks += mCurrent - mBegin;
+
+    const std::size_t blockSize = std::max(size + alignment, std::max(mBlockSize, mCapacity));
+    mBlocks.push_back({std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize});
+    mCapacity += blockSize;
+    useBlock(mBlocks.back());
+#ifdef FUSE_FRAME_ARENA_ASAN
+    ASAN_POISON_MEMORY_REGION(mBlocks.back().data.get(), blockSize);
+#endif
+    return allocate(size, alignment);
+}
+
+void FrameArena::useBlock(Block& block) noexcept {
+    mBegin   = reinterpret_cast<std::uintptr_t>(block.data.get());
+    mCurrent = mBegin;
+    mEnd     = mBegin + block.size;
+}
+
+void FrameArena::reset() noexcept {
+    mHighWaterMark = highWaterMark();
+    mGeneration++;
+
+#if FUSE_FRAME_ARENA_DEBUG
+    for (const Block& block : mBlocks) {
+#    ifdef FUSE_FRAME_ARENA_ASAN
+        ASAN_UNPOISON_MEMORY_REGION(block.data.get(), block.size);
+#    endif
+        const auto        begin = reinterpret_cast<std::uintptr_t>(block.data.get());
+        const std::size_t used  = begin == mBegin ? mCurrent - mBegin : block.size;
+        std::memset(block.data.get(), kPoison, used);
+#    ifdef FUSE_FRAME_ARENA_ASAN
+        ASAN_POISON_MEMORY_REGION(block.data.get(), block.size);
+#    endif
+    }
+#endif
+
+    if (mBlocks.size() > 1) {
+        // The frame did not fit in a block, the next ones get a single block of the total size.
+        const std::size_t capacity = mCapacity;
+        mBlocks.clear();
+        mBlocks.push_back({std::make_unique_for_overwrite<std::byte[]>(capacity), capacity});
+        mCapacity = capacity;
+#ifdef FUSE_FRAME_ARENA_ASAN
+        ASAN_POISON_MEMORY_REGION(mBlocks.back().data.get(), capacity);
+#endif
+    }
+    mUsedInFullBlocks = 0;
+    if (mBlocks.empty()) {
+        mBegin   = emptyBlock();
+        mCurrent = mBegin;
+        mEnd     = mBegin;
+    } else {
+        useBlock(mBlocks.front());
+    }
+}
+
+std::uintptr_t FrameArena::emptyBlock() noexcept {
+    alignas(std::max_align_t) static constinit std::byte block{};
+    return reinterpret_cast<std::uintptr_t>(&block);
+}
+
+void FrameArena::unpoison([[maybe_unused]] std::uintptr_t begin,
+                          [[maybe_unused]] std::size_t    size) noexcept {
+#ifdef FUSE_FRAME_ARENA_ASAN
+    ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(begin), size);
+#endif
+}
+
+void* FrameArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if FUSE_FRAME_ARENA_DEBUG
+    // The generation of the arena is stored before the block, checked by do_deallocate().
+    const std::size_t header = std::max(alignment, sizeof(std::uint64_t));
+    auto* block = static_cast<std::byte*>(mArena.allocate(header + bytes, header)) + header;
+    const std::uint64_t generation = mArena.generation();
+    std::memcpy(block - sizeof(generation), &generation, sizeof(generation));
+    return block;
+#else
+    return mArena.allocate(bytes, alignment);
+#endif
+}
+
+void FrameArenaResource::do_deallocate([[maybe_unused]] void*       p,
+                                       [[maybe_unused]] std::size_t bytes,
+                                       [[maybe_unused]] std::size_t alignment) {
+#if FUSE_FRAME_ARENA_DEBUG
+    std::uint64_t generation = 0;
+    std::memcpy(&generation, static_cast<const std::byte*>(p) - sizeof(generation),
+                sizeof(generation));
+    assert(generation == mArena.generation() &&
+           "Frame memory used after the reset of its arena, a container outlived the frame.");
+#endif
+}
+
+FrameArena& frameArena() noexcept { return threadArena().arena; }
+
+std::pmr::memory_resource* frameMemoryResource() noexcept { return &threadArena().resource; }
+
+void resetFrameArenas() noexcept { frameEpoch.fetch_add(1, std::memory_order_relaxed); }
+
+} // namespace fuse
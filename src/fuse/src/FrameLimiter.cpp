@@ -0,0 +1,137 @@
+#include "fuse/FrameLimiter.h"
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_timer.h>
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+namespace fuse {
+
+FrameLimiter::FrameLimiter() noexcept
+    : mTicksPerSecond(SDL_GetPerformanceFrequency()) {
+    mSecondsPerTick = 1.0 / static_cast<double>(mTicksPerSecond);
+    setIdleDelay(0.5);
+    setSpinThreshold(0.001);
+    mLastActivity = SDL_GetPerformanceCounter();
+}
+
+void FrameLimiter::setTargetFps(double fps) noexcept {
+    assert(fps > 0.0 && "The frame rate must be greater than 0.");
+    mTargetFps = fps;
+}
+
+void FrameLimiter::setIdleFps(double fps) noexcept {
+    assert(fps > 0.0 && "The frame rate must be greater than 0.");
+    mIdleFps = fps;
+}
+
+void FrameLimiter::setIdleDelay(Time delay) noexcept {
+    mIdleDelay = static_cast<std::uint64_t>(std::max(delay.asSeconds(), 0.0) / mSecondsPerTick);
+}
+
+void FrameLimiter::setSpinThreshold(Time threshold) noexcept {
+    mSpinThreshold =
+      static_cast<std::uint64_t>(std::max(threshold.asSeconds(), 0.0) / mSecondsPerTick);
+}
+
+void FrameLimiter::markActive() noexcept { mLastActivity = SDL_GetPerformanceCounter(); }
+
+bool FrameLimiter::isIdle() const noexcept {
+    return mMode == Mode::Adaptive && SDL_GetPerformanceCounter() - mLastActivity > mIdleDelay;
+}
+
+Time FrameLimiter::remaining() const noexcept {
+    const std::uint64_t frame = frameTicks();
+    if (frame == 0 || mFrameStart == 0) {
+        return 0.0;
+    }
+    const std::uint64_t deadline = mFrameStart + frame;
+    const std::uint64_t now      = SDL_GetPerformanceCounter();
+    return now >= deadline ? 0.0 : static_cast<double>(deadline - now) * mSecondsPerTick;
+}
+
+void FrameLimiter::waitForNextFrame() noexcept {
+    const std::uint64_t frame = frameTicks();
+    if (frame == 0 || mFrameStart == 0) {
+        const std::uint64_t now = SDL_GetPerformanceCounter();
+        record(now, 0, 0);
+        mFrameStart   = now;
+        mLastFrameEnd = now;
+        return;
+    }
+
+    const std::uint64_t deadline = mFrameStart + frame;
+    sleepUntil(deadline);
+    const std::uint64_t now = SDL_GetPerformanceCounter();
+    record(now, frame, deadline);
+
+    // The next deadline is one frame after this one, a frame a bit late is compensated by the
+    // next one. After a hitch of more than a frame, restart from now rather than running the
+    // next frames back to back.
+    mFrameStart   = now - deadline > frame ? now : deadline;
+    mLastFrameEnd = now;
+}
+
+void FrameLimiter::resetStats() noexcept {
+    mStats        = {};
+    mFrameTimeSum = 0.0;
+    mErrorSum     = 0.0;
+    mErrorCount   = 0;
+}
+
+std::uint64_t FrameLimiter::frameTicks() const noexcept {
+    switch (mMode) {
+        case Mode::Fixed:
+            return static_cast<std::uint64_t>(static_cast<double>(mTicksPerSecond) / mTargetFps);
+        case Mode::Adaptive: {
+            const double fps = isIdle() ? mIdleFps : mTargetFps;
+            return static_cast<std::uint64_t>(static_cast<double>(mTicksPerSecond) / fps);
+        }
+        case Mode::Unlimited:
+        default:
+            return 0;
+    }
+}
+
+void FrameLimiter::sleepUntil(std::uint64_t deadline) const noexcept {
+    // Sleep while far from the deadline, the OS may wake up the thread late.
+    for (;;) {
+        const std::uint64_t now = SDL_GetPerformanceCounter();
+        if (now >= deadline || deadline - now <= mSpinThreshold) {
+            break;
+        }
+        const double sleep = static_cast<double>(deadline - now - mSpinThreshold) * mSecondsPerTick;
+        SDL_DelayNS(static_cast<Uint64>(sleep * 1e9));
+    }
+
+    // Then spin for the last part.
+    while (SDL_GetPerformanceCounter() < deadline) {
+        SDL_CPUPauseInstruction();
+    }
+}
+
+void FrameLimiter::record(std::uint64_t now, std::uint64_t frame,
+                          std::uint64_t deadline) noexcept {
+    if (mLastFrameEnd != 0) {
+        const double frameTime = static_cast<double>(now - mLastFrameEnd) * mSecondsPerTick;
+        mStats.frames++;
+        mFrameTimeSum += frameTime;
+        mStats.averageFrameTime = mFrameTimeSum / mStats.frames;
+
+        if (frame != 0) {
+            const double error = std::abs(frameTime - static_cast<double>(frame) * mSecondsPerTick);
+            mErrorCount++;
+            mErrorSum += error;
+            mStats.averageError = mErrorSum / mErrorCount;
+            mStats.maxError     = std::max(mStats.maxError.asSeconds(), error);
+        }
+    }
+    if (frame != 0 && now > deadline) {
+        const double lateness = static_cast<double>(now - deadline) * mSecondsPerTick;
+        mStats.maxLateness    = std::max(mStats.maxLateness.asSeconds(), lateness);
+    }
+}
+
+} // namespace fuse
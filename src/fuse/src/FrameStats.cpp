@@ -0,0 +1,208 @@
+#include "fuse/FrameStats.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <print>
+#include <utility>
+
+namespace fuse {
+
+namespace {
+
+/// @brief Return the value of rank ceil(p * n) of the sorted values, the nearest-rank method.
+double percentile(const std::vector<float>& sorted, double p) noexcept {
+    const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+} // namespace
+
+std::string_view toString(FramePhase phase) noexcept {
+    using enum FramePhase;
+    switch (phase) {
+        // clang-format off
+        case Events:      return "Events";
+        case FixedUpdate: return "FixedUpdate";
+        case Update:      return "Update";
+        case Render:      return "Render";
+        case ImGui:       return "ImGui";
+        case Swap:        return "Swap";
+        case Wait:        return "Wait";
+        default:          std::unreachable();
+        // clang-format on
+    }
+}
+
+FrameStats::FrameStats(std::size_t capacity)
+    : mCapacity(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+    , mMask(2 * mCapacity - 1)
+    , mSlots(std::make_unique<Slot[]>(mMask + 1)) {}
+
+void FrameStats::setHitchThreshold(Time threshold) noexcept {
+    mHitchThreshold.store(static_cast<float>(threshold.asMilliSeconds()),
+                          std::memory_order_relaxed);
+}
+
+Time FrameStats::hitchThreshold() const noexcept {
+    return static_cast<double>(mHitchThreshold.load(std::memory_order_relaxed)) / 1000.0;
+}
+
+void FrameStats::addFrame(Time frameTime, const FramePhaseTimes& phases) noexcept {
+    const auto          milliseconds = static_cast<float>(frameTime.asMilliSeconds());
+    const std::uint64_t index        = mWritten.load(std::memory_order_relaxed);
+    Slot&               slot         = mSlots[index & mMask];
+    // Pairs with the fence of frames(): a reader that sees a field of this frame then sees
+    // mWritten >= index, and drops the frame it expected in the slot.
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.fields[0].store(milliseconds, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < kFramePhaseCount; i++) {
+        slot.fields[i + 1].store(phases[i], std::memory_order_relaxed);
+    }
+    mWritten.store(index + 1, std::memory_order_release);
+
+    mHistogram[bucketOf(milliseconds)].fetch_add(1, std::memory_order_relaxed);
+    if (milliseconds > mHitchThreshold.load(std::memory_order_relaxed)) {
+        mHitches.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void FrameStats::reset() noexcept {
+    mWritten.store(0, std::memory_order_release);
+    mHitches.store(0, std::memory_order_relaxed);
+    for (auto& count : mHistogram) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t FrameStats::frameCount() const noexcept {
+    return mWritten.load(std::memory_order_acquire);
+}
+
+std::uint64_t FrameStats::hitchCount() const noexcept {
+    return mHitches.load(std::memory_order_relaxed);
+}
+
+std::vector<FrameSample> FrameStats::frames() const {
+    const std::uint64_t end   = mWritten.load(std::memory_order_acquire);
+    const std::uint64_t begin = end > mCapacity ? end - mCapacity : 0;
+
+    std::vector<FrameSample> frames;
+    frames.reserve(end - begin);
+    for (std::uint64_t i = begin; i < end; i++) {
+        const Slot& slot  = mSlots[i & mMask];
+        FrameSample frame{};
+        frame.frameTime = slot.fields[0].load(std::memory_order_relaxed);
+        for (std::size_t p = 0; p < kFramePhaseCount; p++) {
+            frame.phases[p] = slot.fields[p + 1].load(std::memory_order_relaxed);
+        }
+        frames.push_back(frame);
+    }
+
+    // The writer may have lapped the copy: the frame it writes, `after`, reuses the slot of
+    // frame after - ring size. The frames up to that one may be mixed with newer ones.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t after = mWritten.load(std::memory_order_relaxed);
+    if (after < end) {
+        return {}; // reset() during the copy.
+    }
+    const std::uint64_t ringSize = mMask + 1;
+    if (after + 1 > begin + ringSize) {
+        const std::uint64_t firstValid = after + 1 - ringSize;
+        const auto dropped = static_cast<std::ptrdiff_t>(std::min(firstValid, end) - begin);
+        frames.erase(frames.begin(), frames.begin() + dropped);
+    }
+    return frames;
+}
+
+FrameTimeSummary FrameStats::summarize(std::size_t field) const {
+    const std::vector<FrameSample> frames = this->frames();
+    FrameTimeSummary               summary;
+    if (frames.empty()) {
+        return summary;
+    }
+
+    const float        threshold = mHitchThreshold.load(std::memory_order_relaxed);
+    std::vector<float> values;
+    values.reserve(frames.size());
+    for (const FrameSample& frame : frames) {
+        values.push_back(field == 0 ? frame.frameTime : frame.phases[field - 1]);
+        summary.hitches += frame.frameTime > threshold ? 1 : 0;
+    }
+    std::ranges::sort(values);
+
+    summary.frames  = values.size();
+    summary.average = std::accumulate(values.begin(), values.end(), 0.0) /
+                      static_cast<double>(values.size());
+    summary.p50 = percentile(values, 0.50);
+    summary.p95 = percentile(values, 0.95);
+    summary.p99 = percentile(values, 0.99);
+    summary.max = values.back();
+    return summary;
+}
+
+FrameTimeSummary FrameStats::summary() const { return summarize(0); }
+
+FrameTimeSummary FrameStats::summary(FramePhase phase) const {
+    return summarize(static_cast<std::size_t>(phase) + 1);
+}
+
+std::array<std::uint64_t, FrameStats::kHistogramBuckets> FrameStats::histogram() const noexcept {
+    std::array<std::uint64_t, kHistogramBuckets> histogram{};
+    for (std::size_t i = 0; i < kHistogramBuckets; i++) {
+        histogram[i] = mHistogram[i].load(std::memory_order_relaxed);
+    }
+    return histogram;
+}
+
+double FrameStats::bucketLowerBound(std::size_t bucket) noexcept {
+    if (bucket == 0) {
+        return 0.0;
+    }
+    return kHistogramMin * std::exp2(static_cast<double>(bucket - 1) * 0.5);
+}
+
+std::size_t FrameStats::bucketOf(double milliseconds) noexcept {
+    if (!(milliseconds >= kHistogramMin)) {
+        return 0;
+    }
+    const double halfOctaves = std::floor(2.0 * std::log2(milliseconds / kHistogramMin));
+    return std::min(static_cast<std::size_t>(halfOctaves) + 1, kHistogramBuckets - 1);
+}
+
+bool FrameStats::exportCsv(const std::filesystem::path& path) const {
+    std::FILE* file = std::fopen(path.string().c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    const auto write = [file](std::string_view series, const FrameTimeSummary& summary) {
+        std::println(file, "{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{}", series, summary.frames,
+                     summary.average, summary.p50, summary.p95, summary.p99, summary.max,
+                     summary.hitches);
+    };
+    std::println(file, "series,frames,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches");
+    write("Frame", summary());
+    for (std::size_t i = 0; i < kFramePhaseCount; i++) {
+        const auto phase = static_cast<FramePhase>(i);
+        write(toString(phase), summary(phase));
+    }
+    std::println(file, "Total,{},,,,,,{}", frameCount(), hitchCount());
+    return std::fclose(file) == 0;
+}
+
+bool FrameStats::exportHistogramCsv(const std::filesystem::path& path) const {
+    std::FILE* file = std::fopen(path.string().c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    std::println(file, "min_ms,frames");
+    const auto counts = histogram();
+    for (std::size_t i = 0; i < kHistogramBuckets; i++) {
+        std::println(file, "{:.4f},{}", bucketLowerBound(i), counts[i]);
+    }
+    return std::fclose(file) == 0;
+}
+
+} // namespace fuse
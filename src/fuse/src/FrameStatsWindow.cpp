@@ -0,0 +1,77 @@
+#include <fuse/FrameStats.h>
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <string_view>
+#include <vector>
+
+namespace fuse {
+
+namespace {
+
+void summaryRow(std::string_view name, const FrameTimeSummary& summary) {
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted(name.data(), name.data() + name.size());
+    for (const double value : {summary.average, summary.p50, summary.p95, summary.p99,
+                               summary.max}) {
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", value);
+    }
+}
+
+} // namespace
+
+void showFrameStatsWindow(const FrameStats& stats, bool* open) {
+    if (!ImGui::Begin("Frame times", open)) {
+        ImGui::End();
+        return;
+    }
+
+    const std::vector<FrameSample> frames  = stats.frames();
+    const FrameTimeSummary         summary = stats.summary();
+    std::vector<float>             times(frames.size());
+    std::ranges::transform(frames, times.begin(), &FrameSample::frameTime);
+
+    ImGui::Text("%llu frames, %llu hitches over %.1f ms",
+                static_cast<unsigned long long>(stats.frameCount()),
+                static_cast<unsigned long long>(stats.hitchCount()),
+                stats.hitchThreshold().asMilliSeconds());
+
+    // The scale keeps the hitch threshold in view, a spike above it is clipped.
+    const float scale = static_cast<float>(
+      std::max(summary.p99, stats.hitchThreshold().asMilliSeconds()) * 1.25);
+    ImGui::PlotLines("##FrameTimes", times.data(), static_cast<int>(times.size()), 0,
+                     "Frame time (ms)", 0.0f, scale, ImVec2(-1.0f, 80.0f));
+
+    constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+    if (ImGui::BeginTable("FrameTimeSummary", 6, flags)) {
+        ImGui::TableSetupColumn("ms");
+        ImGui::TableSetupColumn("Avg");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p95");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableHeadersRow();
+        summaryRow("Frame", summary);
+        for (std::size_t i = 0; i < kFramePhaseCount; i++) {
+            const auto phase = static_cast<FramePhase>(i);
+            summaryRow(toString(phase), stats.summary(phase));
+        }
+        ImGui::EndTable();
+    }
+
+    const auto counts = stats.histogram();
+    std::array<float, FrameStats::kHistogramBuckets> buckets{};
+    std::ranges::transform(counts, buckets.begin(),
+                           [](std::uint64_t count) { return static_cast<float>(count); });
+    ImGui::PlotHistogram("##Histogram", buckets.data(), static_cast<int>(buckets.size()), 0,
+                         "Histogram, 2 buckets per octave from 0.25 ms", 0.0f, FLT_MAX,
+                         ImVec2(-1.0f, 80.0f));
+
+    ImGui::End();
+}
+
+} // namespace fuse
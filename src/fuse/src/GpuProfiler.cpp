@@ -0,0 +1,177 @@
+#include <fuse/GpuProfiler.h>
+#include <fuse/Logger.h>
+
+#include <glad/gl.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <print>
+#include <string_view>
+
+namespace fuse {
+
+SlidingStats::SlidingStats(std::size_t window)
+    : mSamples(std::max<std::size_t>(window, 1)) {}
+
+void SlidingStats::add(double value) {
+    mSamples[mNext] = value;
+    mNext           = (mNext + 1) % mSamples.size();
+    mCount          = std::min(mCount + 1, mSamples.size());
+    mLast           = value;
+
+    // Recomputed from the window, a running sum would drift and the extremes leave the window.
+    mSum = 0.0;
+    mMin = value;
+    mMax = value;
+    for (std::size_t i = 0; i < mCount; i++) {
+        mSum += mSamples[i];
+        mMin = std::min(mMin, mSamples[i]);
+        mMax = std::max(mMax, mSamples[i]);
+    }
+}
+
+void SlidingStats::reset() noexcept {
+    mNext  = 0;
+    mCount = 0;
+    mSum   = 0.0;
+    mLast  = 0.0;
+    mMin   = 0.0;
+    mMax   = 0.0;
+}
+
+GpuProfiler::GpuProfiler(std::size_t window)
+    : mWindow(window) {
+    GLint bits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+    mSupported = bits > 0;
+    if (!mSupported) {
+        FUSE_LOG(LogCategory::Render, LogLevel::Warn,
+                 "GPU profiler: no timestamp queries, the GPU times are not measured.");
+        return;
+    }
+    for (Frame& frame : mFrames) {
+        glGenQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        frame.scopes.reserve(kMaxScopes);
+    }
+}
+
+GpuProfiler::~GpuProfiler() {
+    if (mSupported) {
+        for (Frame& frame : mFrames) {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        }
+    }
+}
+
+void GpuProfiler::beginFrame() {
+    if (!mSupported) {
+        return;
+    }
+    assert(mCurrent == nullptr && "beginFrame() called twice without endFrame().");
+
+    // From the oldest frame, the slot of the new frame holds the oldest one.
+    for (std::size_t i = 0; i < kFramesInFlight; i++) {
+        Frame& frame = mFrames[(mFrameIndex + i) % kFramesInFlight];
+        if (frame.pending) {
+            resolve(frame);
+        }
+    }
+
+    if (!mEnabled) {
+        return;
+    }
+    Frame& frame = mFrames[mFrameIndex % kFramesInFlight];
+    mFrameIndex++;
+    if (frame.pending) {
+        // Waiting for the results would stall the pipeline.
+        mDroppedFrames++;
+        return;
+    }
+    frame.scopes.clear();
+    frame.queryCount = 0;
+    mCurrent         = &frame;
+    mDepth           = 0;
+    mFrameScope      = beginScope("Frame");
+}
+
+void GpuProfiler::endFrame() {
+    if (mCurrent == nullptr) {
+        return;
+    }
+    endScope(mFrameScope);
+    assert(mDepth == 0 && "A GPU scope is still open at the end of the frame.");
+    mCurrent->pending = true;
+    mCurrent          = nullptr;
+}
+
+std::uint32_t GpuProfiler::beginScope(const char* name) {
+    if (mCurrent == nullptr || mCurrent->scopes.size() == kMaxScopes) {
+        return kInvalidScope;
+    }
+    // The end query is reserved now, the queries of a scope are next to each other.
+    const std::uint32_t query = mCurrent->queryCount;
+    mCurrent->queryCount += 2;
+    glQueryCounter(mCurrent->queries[query], GL_TIMESTAMP);
+    mCurrent->scopes.push_back({name, query, query + 1, mDepth++});
+    return static_cast<std::uint32_t>(mCurrent->scopes.size() - 1);
+}
+
+void GpuProfiler::endScope(std::uint32_t scope) {
+    if (scope == kInvalidScope || mCurrent == nullptr) {
+        return;
+    }
+    glQueryCounter(mCurrent->queries[mCurrent->scopes[scope].endQuery], GL_TIMESTAMP);
+    mDepth--;
+}
+
+void GpuProfiler::resolve(Frame& frame) {
+    // The queries complete in order, the end of the frame is the last one.
+    GLint available = 0;
+    glGetQueryObjectiv(frame.queries[frame.scopes.front().endQuery], GL_QUERY_RESULT_AVAILABLE,
+                       &available);
+    if (available == GL_FALSE) {
+        return;
+    }
+    frame.pending = false;
+
+    const auto timeOf = [&](std::uint32_t query) {
+        GLuint64 time = 0;
+        glGetQueryObjectui64v(frame.queries[query], GL_QUERY_RESULT, &time);
+        return static_cast<std::uint64_t>(time);
+    };
+    mLastFrame.clear();
+    const std::uint64_t frameBegin = timeOf(frame.scopes.front().beginQuery);
+    for (const Scope& scope : frame.scopes) {
+        const std::uint64_t begin = timeOf(scope.beginQuery) - frameBegin;
+        const std::uint64_t end   = std::max(timeOf(scope.endQuery) - frameBegin, begin);
+        mLastFrame.push_back({scope.name, begin, end, scope.depth});
+        statsOf(scope.name, scope.depth).time.add(static_cast<double>(end - begin) * 1e-6);
+    }
+}
+
+GpuScopeStats& GpuProfiler::statsOf(const char* name, std::uint32_t depth) {
+    const auto it = std::ranges::find_if(mStats, [&](const GpuScopeStats& stats) {
+        return stats.depth == depth && std::string_view(stats.name) == name;
+    });
+    if (it != mStats.end()) {
+        return *it;
+    }
+    return mStats.emplace_back(name, depth, SlidingStats(mWindow));
+}
+
+bool GpuProfiler::exportCsv(const std::filesystem::path& path) const {
+    std::FILE* file = std::fopen(path.string().c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+    std::println(file, "scope,depth,samples,last_ms,min_ms,avg_ms,max_ms");
+    for (const GpuScopeStats& stats : mStats) {
+        std::println(file, "\"{}\",{},{},{:.4f},{:.4f},{:.4f},{:.4f}", stats.name, stats.depth,
+                     stats.time.count(), stats.time.last(), stats.time.min(),
+                     stats.time.average(), stats.time.max());
+    }
+    return std::fclose(file) == 0;
+}
+
+} // namespace fuse
@@ -0,0 +1,231 @@
+#include <fuse/InputRecording.h>
+#include <fuse/Logger.h>
+
+#include <SDL3/SDL.h>
+
+#include <cassert>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+constexpr char          kMagic[8] = {'F', 'U', 'S', 'E', 'I', 'N', 'P', 'T'};
+constexpr std::uint32_t kVersion  = 1;
+
+/// @brief Return the size of the structure of a recorded event, 0 if the event is not recorded.
+std::size_t recordedSize(std::uint32_t type) noexcept {
+    switch (type) {
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP: return sizeof(SDL_KeyboardEvent);
+        case SDL_EVENT_MOUSE_MOTION: return sizeof(SDL_MouseMotionEvent);
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP: return sizeof(SDL_MouseButtonEvent);
+        case SDL_EVENT_MOUSE_WHEEL: return sizeof(SDL_MouseWheelEvent);
+        default: return 0;
+    }
+}
+
+std::size_t recordedSize(const SDL_Event& event) noexcept { return recordedSize(event.type); }
+
+template <typename T>
+void append(std::vector<std::byte>& out, const T& value) {
+    const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+/// @brief Read the values of a recording, every read checks the size left.
+class Reader {
+public:
+    explicit Reader(std::string_view data)
+        : mData(data) {}
+
+    [[nodiscard]] bool        atEnd() const noexcept { return mPosition >= mData.size(); }
+    [[nodiscard]] std::size_t position() const noexcept { return mPosition; }
+
+    template <typename T>
+    bool read(T& value) {
+        if (mData.size() - mPosition < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, mData.data() + mPosition, sizeof(T));
+        mPosition += sizeof(T);
+        return true;
+    }
+
+    bool skip(std::size_t size) {
+        if (mData.size() - mPosition < size) {
+            return false;
+        }
+        mPosition += size;
+        return true;
+    }
+
+private:
+    std::string_view mData;
+    std::size_t      mPosition{0};
+};
+
+} // namespace
+
+namespace fuse {
+
+bool isRecordedEvent(const SDL_Event& event) noexcept { return recordedSize(event) != 0; }
+
+bool InputRecorder::open(const std::filesystem::path& path) {
+    close();
+    mFile = std::fopen(path.string().c_str(), "wb");
+    if (mFile == nullptr) {
+        FUSE_ERROR("Unable to open the input recording '{}'.", path.string());
+        return false;
+    }
+    std::fwrite(kMagic, 1, sizeof(kMagic), mFile);
+    std::fwrite(&kVersion, sizeof(kVersion), 1, mFile);
+    mEvents.clear();
+    mEventCount = 0;
+    mFrame      = 0;
+    return true;
+}
+
+void InputRecorder::close() {
+    if (mFile == nullptr) {
+        return;
+    }
+    std::fclose(std::exchange(mFile, nullptr));
+}
+
+bool InputRecorder::record(const SDL_Event& event) {
+    const std::size_t size = recordedSize(event);
+    if (mFile == nullptr || size == 0) {
+        return false;
+    }
+    append(mEvents, static_cast<std::uint32_t>(event.type));
+    append(mEvents, static_cast<std::uint32_t>(size));
+    const auto* bytes = reinterpret_cast<const std::byte*>(&event);
+    mEvents.insert(mEvents.end(), bytes, bytes + size);
+    mEventCount++;
+    return true;
+}
+
+void InputRecorder::endFrame(Time delta) {
+    if (mFile == nullptr) {
+        return;
+    }
+    const double seconds = delta.asSeconds();
+    std::fwrite(&mFrame, sizeof(mFrame), 1, mFile);
+    std::fwrite(&mEventCount, sizeof(mEventCount), 1, mFile);
+    std::fwrite(&seconds, sizeof(seconds), 1, mFile);
+    std::fwrite(mEvents.data(), 1, mEvents.size(), mFile);
+    mEvents.clear();
+    mEventCount = 0;
+    mFrame++;
+}
+
+std::expected<InputReplay, std::string> InputReplay::load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::unexpected(std::format("Unable to open '{}'.", path.string()));
+    }
+
+    InputReplay replay;
+    replay.mData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    Reader        reader(replay.mData);
+    char          magic[sizeof(kMagic)]{};
+    std::uint32_t version = 0;
+    if (!reader.read(magic) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !reader.read(version)) {
+        return std::unexpected(std::format("'{}' is not an input recording.", path.string()));
+    }
+    if (version != kVersion) {
+        return std::unexpected(std::format("Unsupported input recording version {}.", version));
+    }
+
+    // The frames are checked now, the replay then reads them without checks. A recording cut
+    // by a crash ends with a partial frame, the frames before it are kept.
+    while (!reader.atEnd()) {
+        std::uint32_t number     = 0;
+        std::uint32_t eventCount = 0;
+        double        delta      = 0.0;
+        if (!reader.read(number) || !reader.read(eventCount) || !reader.read(delta)) {
+            break;
+        }
+        if (number != replay.mFrames.size()) {
+            return std::unexpected(std::format("Frame {} out of order in the input recording.",
+                                               number));
+        }
+        const std::size_t offset   = reader.position();
+        bool              complete = true;
+        for (std::uint32_t i = 0; i < eventCount && complete; i++) {
+            std::uint32_t type = 0;
+            std::uint32_t size = 0;
+            complete = reader.read(type) && reader.read(size);
+            if (!complete) {
+                break;
+            }
+            // pollEvent() copies the bytes in an SDL_Event and reads the member of their type.
+            const std::size_t expected = recordedSize(type);
+            if (expected == 0) {
+                return std::unexpected(
+                  std::format("Unsupported event of type {:#x} in the input recording.", type));
+            }
+            if (size != expected) {
+                return std::unexpected(std::format(
+                  "Event of type {:#x} of {} bytes in the input recording, {} expected.", type,
+                  size, expected));
+            }
+            std::uint32_t eventType = 0;
+            complete = reader.read(eventType) && reader.skip(size - sizeof(eventType));
+            if (complete && eventType != type) {
+                return std::unexpected(std::format(
+                  "Event of type {:#x} recorded as {:#x} in the input recording.", eventType,
+                  type));
+            }
+        }
+        if (!complete) {
+            break;
+        }
+        replay.mFrames.push_back({delta, offset, eventCount});
+    }
+    return replay;
+}
+
+Time InputReplay::nextFrame() {
+    assert(!finished() && "Every frame of the recording is replayed.");
+    const Frame& frame = mFrames[mNextFrame++];
+    mPosition          = frame.offset;
+    mEventsLeft        = frame.eventCount;
+    return frame.delta;
+}
+
+bool InputReplay::pollEvent(SDL_Event& event, std::uint32_t windowId) {
+    if (mEventsLeft == 0) {
+        return false;
+    }
+    mEventsLeft--;
+
+    std::uint32_t size = 0;
+    std::memcpy(&size, mData.data() + mPosition + sizeof(std::uint32_t), sizeof(size));
+    mPosition += 2 * sizeof(std::uint32_t);
+    event = {};
+    std::memcpy(&event, mData.data() + mPosition, size);
+    mPosition += size;
+
+    // The event happens now, in the current window.
+    event.common.timestamp = SDL_GetTicksNS();
+    switch (event.type) {
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP: event.key.windowID = windowId; break;
+        case SDL_EVENT_MOUSE_MOTION: event.motion.windowID = windowId; break;
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP: event.button.windowID = windowId; break;
+        case SDL_EVENT_MOUSE_WHEEL: event.wheel.windowID = windowId; break;
+        default: break;
+    }
+    return true;
+}
+
+} // namespace fuse
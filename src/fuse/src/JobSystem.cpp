@@ -0,0 +1,224 @@
+#include "fuse/JobSystem.h"
+#include "fuse/Profiler.h"
+
+#include "WorkStealingDeque.h"
+
+#include <cassert>
+#include <utility>
+
+namespace fuse {
+
+namespace {
+
+/// @brief Maximum number of jobs in the deque of a worker, a job scheduled on a full deque
+///        is run immediately.
+constexpr std::size_t kDequeCapacity = 4096;
+
+/// @brief Number of times an idle worker looks for a job before going to sleep.
+constexpr unsigned kSpinCount = 64;
+
+/// @brief The worker of the current thread.
+struct WorkerContext {
+    const JobSystem* system = nullptr;
+    std::size_t      index  = 0;
+};
+thread_local WorkerContext tlsWorker;
+
+} // namespace
+
+struct JobSystem::Job {
+    Function    function;
+    JobCounter* counter;
+};
+
+struct JobSystem::Worker {
+    WorkStealingDeque<Job> deque{kDequeCapacity};
+    std::thread            thread;
+};
+
+JobCounter::~JobCounter() {
+    assert(isDone() && "Destroying a counter with unfinished jobs.");
+    assert(mContinuations.empty() && "Destroying a counter with jobs waiting for it.");
+}
+
+JobSystem::JobSystem(unsigned workerCount)
+    : mOwnerThread(std::this_thread::get_id()) {
+    // Create all the deques first, the workers steal from each other as soon as they start.
+    for (unsigned i = 0; i <= workerCount; i++) {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 1; i < mWorkers.size(); i++) {
+        mWorkers[i]->thread = std::thread(&JobSystem::workerMain, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    mRunning.store(false);
+    mWakeEpoch.fetch_add(1);
+    mWakeEpoch.notify_all();
+    for (std::size_t i = 1; i < mWorkers.size(); i++) {
+        mWorkers[i]->thread.join();
+    }
+
+    // Without worker threads, the jobs never waited for are still pending. They are stolen:
+    // only the owner of a deque may pop, and the system can be destroyed by another thread.
+    while (Job* job = findJob(kNoWorker)) {
+        execute(job);
+    }
+}
+
+unsigned JobSystem::DefaultWorkerCount() noexcept {
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void JobSystem::schedule(Function function, JobCounter* counter) {
+    if (counter != nullptr) {
+        counter->mCount.fetch_add(1);
+    }
+    push(new Job{std::move(function), counter});
+}
+
+void JobSystem::schedule(Function function, JobCounter& dependency, JobCounter* counter) {
+    if (counter != nullptr) {
+        counter->mCount.fetch_add(1);
+    }
+    Job* job = new Job{std::move(function), counter};
+    {
+        // finish() takes the continuations under the same lock after the counter reach 0,
+        // either it sees this job or the job is pushed now.
+        std::scoped_lock lock(dependency.mMutex);
+        if (dependency.mCount.load() != 0) {
+            dependency.mContinuations.push_back(job);
+            return;
+        }
+    }
+    push(job);
+}
+
+void JobSystem::wait(const JobCounter& counter) {
+    const std::size_t worker = currentWorker();
+    while (!counter.isDone()) {
+        if (Job* job = findJob(worker)) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+std::size_t JobSystem::currentWorker() const noexcept {
+    if (tlsWorker.system == this) {
+        return tlsWorker.index;
+    }
+    if (std::this_thread::get_id() == mOwnerThread) {
+        return 0;
+    }
+    return kNoWorker;
+}
+
+void JobSystem::push(Job* job) {
+    const std::size_t worker = currentWorker();
+    if (worker != kNoWorker) {
+        if (!mWorkers[worker]->deque.push(job)) {
+            execute(job);
+            return;
+        }
+    } else {
+        std::scoped_lock lock(mSharedMutex);
+        mSharedJobs.push_back(job);
+    }
+    mWakeEpoch.fetch_add(1);
+    mWakeEpoch.notify_one();
+}
+
+JobSystem::Job* JobSystem::findJob(std::size_t worker) {
+    if (worker != kNoWorker) {
+        if (Job* job = mWorkers[worker]->deque.pop()) {
+            return job;
+        }
+    }
+
+    {
+        std::scoped_lock lock(mSharedMutex);
+        if (!mSharedJobs.empty()) {
+            Job* job = mSharedJobs.back();
+            mSharedJobs.pop_back();
+            return job;
+        }
+    }
+
+    // Steal from the next workers first, so the thieves do not all hit the same victim.
+    const std::size_t count = mWorkers.size();
+    const std::size_t start = worker != kNoWorker ? worker + 1 : 0;
+    for (std::size_t i = 0; i < count; i++) {
+        const std::size_t victim = (start + i) % count;
+        if (victim == worker) {
+            continue;
+        }
+        if (Job* job = mWorkers[victim]->deque.steal()) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::execute(Job* job) {
+    {
+        FUSE_PROFILE_SCOPE("Job");
+        job->function();
+    }
+    JobCounter* counter = job->counter;
+    delete job;
+    if (counter != nullptr) {
+        finish(*counter);
+    }
+}
+
+void JobSystem::finish(JobCounter& counter) {
+    std::vector<Job*> ready;
+    counter.mFinishing.fetch_add(1);
+    if (counter.mCount.fetch_sub(1) == 1) {
+        std::scoped_lock lock(counter.mMutex);
+        ready.swap(counter.mContinuations);
+    }
+    // The counter may be destroyed by a waiting thread from here.
+    counter.mFinishing.fetch_sub(1);
+
+    for (Job* job : ready) {
+        push(job);
+    }
+}
+
+void JobSystem::workerMain(std::size_t worker) {
+    tlsWorker = {this, worker};
+    FUSE_PROFILE_THREAD("Worker");
+    for (;;) {
+        Job* job = nullptr;
+        for (unsigned spin = 0; spin < kSpinCount && job == nullptr; spin++) {
+            job = findJob(worker);
+            if (job == nullptr) {
+                std::this_thread::yield();
+            }
+        }
+        if (job != nullptr) {
+            execute(job);
+            continue;
+        }
+
+        // Read the epoch before the last look for a job: a job pushed after it changes the
+        // epoch and wait() returns immediately.
+        const unsigned epoch = mWakeEpoch.load();
+        if (!mRunning.load()) {
+            break;
+        }
+        if (Job* last = findJob(worker)) {
+            execute(last);
+            continue;
+        }
+        mWakeEpoch.wait(epoch);
+    }
+    tlsWorker = {};
+}
+
+} // namespace fuse
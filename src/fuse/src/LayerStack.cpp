@@ -1,35 +1,166 @@
 #include "fuse/LayerStack.h"
 
 #include <algorithm>
+#include <cassert>
+#include <utility>
 
 namespace fuse {
 
+LayerStack::Iteration::Iteration(LayerStack& stack)
+    : mStack(stack) {
+    if (mStack.mIterationDepth++ == 0 && mStack.mDirty) {
+        mStack.rebuild();
+    }
+}
+
+LayerStack::Iteration::~Iteration() {
+    if (--mStack.mIterationDepth == 0 && !mStack.mPending.empty()) {
+        mStack.applyPendingChanges();
+    }
+}
+
 LayerStack::~LayerStack() { clear(); }
 
 void LayerStack::clear() {
+    assert(mIterationDepth == 0 && "LayerStack::clear() called from forEach().");
     for (Layer* layer : mLayers) {
         delete layer;
     }
+    mLayers.clear();
+    mSlots.clear();
+    mLayerInsertIndex = 0;
+    for (auto& layers : mDispatch) {
+        layers.clear();
+    }
+    mDirty = false;
 }
 
-void LayerStack::pushLayer(Layer* layer) {
-    mLayers.emplace(mLayers.begin() + mLayerInsertIndex, layer);
+void LayerStack::pushLayer(Layer* layer, LayerHooks hooks) {
+    if (mIterationDepth > 0) {
+        mPending.push_back({PendingChange::Kind::PushLayer, layer, hooks, true});
+        return;
+    }
+    insert(mLayerInsertIndex, layer, hooks);
     mLayerInsertIndex++;
 }
 
-void LayerStack::pushOverlay(Layer* overlay) { mLayers.emplace_back(overlay); }
+void LayerStack::pushOverlay(Layer* overlay, LayerHooks hooks) {
+    if (mIterationDepth > 0) {
+        mPending.push_back({PendingChange::Kind::PushOverlay, overlay, hooks, true});
+        return;
+    }
+    insert(mLayers.size(), overlay, hooks);
+}
+
+void LayerStack::popLayer(Layer* layer) { erase(layer, false); }
+
+void LayerStack::popOverlay(Layer* overlay) { erase(overlay, true); }
+
+void LayerStack::insert(std::size_t index, Layer* layer, LayerHooks hooks) {
+    mLayers.insert(mLayers.begin() + static_cast<std::ptrdiff_t>(index), layer);
+    mSlots.insert(mSlots.begin() + static_cast<std::ptrdiff_t>(index), Slot{hooks, true});
+    mDirty = true;
+}
 
-void LayerStack::popLayer(Layer* layer) {
-    if (auto it = std::ranges::find(mLayers, layer); it != mLayers.end()) {
-        mLayers.erase(it);
+void LayerStack::erase(Layer* layer, bool overlay) {
+    // Popped before its deferred push: neither happens.
+    const auto pending = std::ranges::find_if(mPending, [layer](const PendingChange& change) {
+        return change.layer == layer && (change.kind == PendingChange::Kind::PushLayer ||
+                                         change.kind == PendingChange::Kind::PushOverlay);
+    });
+    if (pending != mPending.end()) {
+        mPending.erase(pending);
+        return;
+    }
+
+    const auto it = std::ranges::find(mLayers, layer);
+    if (it == mLayers.end()) {
+        return;
+    }
+    if (mIterationDepth > 0) {
+        // Not called anymore, the lists keep their size until the iteration ends.
+        removeFromDispatch(layer);
+        const auto kind = overlay ? PendingChange::Kind::PopOverlay : PendingChange::Kind::PopLayer;
+        mPending.push_back({kind, layer, 0, false});
+        return;
+    }
+    const auto index = it - mLayers.begin();
+    mLayers.erase(it);
+    mSlots.erase(mSlots.begin() + index);
+    if (!overlay) {
         --mLayerInsertIndex;
     }
+    mDirty = true;
+}
+
+void LayerStack::setEnabled(Layer* layer, bool enabled) {
+    for (PendingChange& change : mPending) {
+        if (change.layer == layer) {
+            change.enabled = enabled;
+        }
+    }
+    const auto it = std::ranges::find(mLayers, layer);
+    if (it == mLayers.end()) {
+        return;
+    }
+    Slot& slot = mSlots[static_cast<std::size_t>(it - mLayers.begin())];
+    if (slot.enabled == enabled) {
+        return;
+    }
+    slot.enabled = enabled;
+    if (!enabled && mIterationDepth > 0) {
+        removeFromDispatch(layer);
+    }
+    mDirty = true;
+}
+
+bool LayerStack::isEnabled(const Layer* layer) const {
+    const auto it = std::ranges::find(mLayers, layer);
+    return it != mLayers.end() && mSlots[static_cast<std::size_t>(it - mLayers.begin())].enabled;
+}
+
+std::span<Layer* const> LayerStack::dispatchList(LayerPhase phase) {
+    if (mDirty && mIterationDepth == 0) {
+        rebuild();
+    }
+    return mDispatch[static_cast<std::size_t>(phase)];
+}
+
+void LayerStack::removeFromDispatch(const Layer* layer) {
+    for (auto& layers : mDispatch) {
+        std::ranges::replace(layers, layer, nullptr);
+    }
+}
+
+void LayerStack::applyPendingChanges() {
+    // A callback of a layer pushed now may push again: the list is moved first.
+    const std::vector<PendingChange> changes = std::exchange(mPending, {});
+    for (const PendingChange& change : changes) {
+        using enum PendingChange::Kind;
+        switch (change.kind) {
+            case PushLayer: pushLayer(change.layer, change.hooks); break;
+            case PushOverlay: pushOverlay(change.layer, change.hooks); break;
+            case PopLayer: popLayer(change.layer); break;
+            case PopOverlay: popOverlay(change.layer); break;
+        }
+        if ((change.kind == PushLayer || change.kind == PushOverlay) && !change.enabled) {
+            setEnabled(change.layer, false);
+        }
+    }
 }
 
-void LayerStack::popOverlay(Layer* overlay) {
-    if (auto it = std::ranges::find(mLayers, overlay); it != mLayers.end()) {
-        mLayers.erase(it);
+void LayerStack::rebuild() {
+    for (std::size_t phase = 0; phase < kLayerPhaseCount; phase++) {
+        const auto           hook   = layerHook(static_cast<LayerPhase>(phase));
+        std::vector<Layer*>& layers = mDispatch[phase];
+        layers.clear();
+        for (std::size_t i = 0; i < mLayers.size(); i++) {
+            if (mSlots[i].enabled && (mSlots[i].hooks & hook) != 0) {
+                layers.push_back(mLayers[i]);
+            }
+        }
     }
+    mDirty = false;
 }
 
 } // namespace fuse
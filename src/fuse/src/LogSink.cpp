@@ -0,0 +1,116 @@
+#include <fuse/LogSink.h>
+
+#include <format>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+namespace fuse {
+
+namespace {
+
+/// @brief Append `[Level] message` or `[Level][Category] message` and a new line.
+void appendMessage(std::string& buffer, const LogRecord& record) {
+    if (record.category == LogCategory::General) {
+        std::format_to(std::back_inserter(buffer), "[{}] {}\n", toString(record.level),
+                       record.message);
+    } else {
+        std::format_to(std::back_inserter(buffer), "[{}][{}] {}\n", toString(record.level),
+                       toString(record.category), record.message);
+    }
+}
+
+} // namespace
+
+void ConsoleSink::write(const LogRecord& record) { appendMessage(mBuffer, record); }
+
+void ConsoleSink::flush() {
+    if (mBuffer.empty()) {
+        return;
+    }
+    std::fwrite(mBuffer.data(), 1, mBuffer.size(), stdout);
+    std::fflush(stdout);
+    mBuffer.clear();
+}
+
+
+RotatingFileSink::RotatingFileSink(std::filesystem::path path, std::uintmax_t maxSize,
+                                   unsigned maxFiles)
+    : mPath(std::move(path))
+    , mMaxSize(maxSize)
+    , mMaxFiles(maxFiles) {
+    open();
+}
+
+RotatingFileSink::~RotatingFileSink() {
+    flush();
+    if (mFile) {
+        std::fclose(mFile);
+    }
+}
+
+void RotatingFileSink::write(const LogRecord& record) {
+    const std::size_t previous = mBuffer.size();
+    std::format_to(std::back_inserter(mBuffer), "[{:.6f}] ", record.time);
+    appendMessage(mBuffer, record);
+    const std::size_t length = mBuffer.size() - previous;
+
+    // A non empty file which would exceed the size is rotated, a single message larger than the
+    // maximum size still goes in its own file.
+    if (mSize > 0 && mSize + length > mMaxSize) {
+        const std::string line = mBuffer.substr(previous);
+        mBuffer.resize(previous);
+        rotate();
+        mBuffer += line;
+    }
+    mSize += length;
+}
+
+void RotatingFileSink::flush() {
+    if (mBuffer.empty() || !mFile) {
+        mBuffer.clear();
+        return;
+    }
+    std::fwrite(mBuffer.data(), 1, mBuffer.size(), mFile);
+    std::fflush(mFile);
+    mBuffer.clear();
+}
+
+void RotatingFileSink::open() {
+    std::error_code error;
+    if (mPath.has_parent_path()) {
+        std::filesystem::create_directories(mPath.parent_path(), error);
+    }
+    mFile = std::fopen(mPath.string().c_str(), "ab");
+    const std::uintmax_t size = std::filesystem::file_size(mPath, error);
+    mSize                     = error ? 0 : size;
+}
+
+void RotatingFileSink::rotate() {
+    flush();
+    if (mFile) {
+        std::fclose(mFile);
+        mFile = nullptr;
+    }
+
+    const auto numbered = [this](unsigned index) {
+        std::filesystem::path path = mPath;
+        path += std::format(".{}", index);
+        return path;
+    };
+
+    // Errors are ignored: the sink keeps writing in the current file rather than failing.
+    std::error_code error;
+    if (mMaxFiles == 0) {
+        std::filesystem::remove(mPath, error);
+    } else {
+        std::filesystem::remove(numbered(mMaxFiles), error);
+        for (unsigned i = mMaxFiles - 1; i > 0; i--) {
+            std::filesystem::rename(numbered(i), numbered(i + 1), error);
+        }
+        std::filesystem::rename(mPath, numbered(1), error);
+    }
+    open();
+}
+
+} // namespace fuse
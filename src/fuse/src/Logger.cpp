@@ -1,11 +1,209 @@
+#include <fuse/LogSink.h>
 #include <fuse/Logger.h>
+#include <fuse/MemoryTracker.h>
 
+#include "MpscRingBuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
 #include <print>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace {
 
-std::string_view logLevelAsString(fuse::LogLevel level) {
+using Clock = std::chrono::steady_clock;
+
+/// @brief Maximum number of messages written between 2 flushes of the sinks.
+constexpr std::size_t kBatchSize = 256;
+
+/// @brief A message waiting in the queue, the string keeps its capacity between uses.
+struct QueuedMessage {
+    fuse::LogCategory category{};
+    fuse::LogLevel    level{};
+    double            time{};
+    std::string       text;
+};
+
+std::mutex                                  sinksMutex;
+std::vector<std::unique_ptr<fuse::LogSink>> sinks;
+Clock::time_point                           startTime = Clock::now();
+std::atomic<std::uint64_t>                  writtenCount{0};
+std::atomic<std::uint64_t>                  droppedCount{0};
+
+double elapsedSeconds() {
+    return std::chrono::duration<double>(Clock::now() - startTime).count();
+}
+
+/// @brief Give a message to the sinks, sinksMutex must be locked.
+void writeToSinks(const fuse::LogRecord& record) {
+    if (sinks.empty()) {
+        if (record.category == fuse::LogCategory::General) {
+            std::println("[{}] {}", fuse::toString(record.level), record.message);
+        } else {
+            std::println("[{}][{}] {}", fuse::toString(record.level),
+                         fuse::toString(record.category), record.message);
+        }
+        return;
+    }
+    for (const auto& sink : sinks) {
+        sink->write(record);
+    }
+}
+
+/// @brief Flush the sinks, sinksMutex must be locked.
+void flushSinks() {
+    for (const auto& sink : sinks) {
+        sink->flush();
+    }
+}
+
+/// @brief The queue of messages and the thread writing them.
+class AsyncLogger {
+public:
+    explicit AsyncLogger(const fuse::LogConfig& config)
+        : mQueue(config.capacity)
+        , mOverflow(config.overflow)
+        , mMemory(fuse::MemTag::Log, mQueue.capacity() * sizeof(QueuedMessage))
+        , mThread(&AsyncLogger::run, this) {}
+
+    ~AsyncLogger() {
+        mRunning.store(false);
+        wake(true);
+        mThread.join();
+    }
+
+    AsyncLogger(const AsyncLogger&)            = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    void push(fuse::LogCategory category, fuse::LogLevel level, std::string_view msg) {
+        const auto write = [&](QueuedMessage& message) {
+            message.category = category;
+            message.level    = level;
+            message.time     = elapsedSeconds();
+            message.text.assign(msg);
+        };
+        if (!mQueue.tryPush(write)) {
+            if (mOverflow == fuse::LogOverflow::Drop && level != fuse::LogLevel::Fatal) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                mDroppedSinceReport.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            while (!mQueue.tryPush(write)) {
+                wake(true);
+                std::this_thread::yield();
+            }
+        }
+        wake(false);
+    }
+
+    void flush() {
+        const std::uint64_t target = mQueue.pushCount();
+        while (mWritten.load() < target) {
+            wake(true);
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    /// @brief Wake the thread if it sleeps, or always if @p force.
+    void wake(bool force) {
+        // Pairs with the fence of run(): either the thread sees the message or we see it sleeps.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (force || mSleeping.load(std::memory_order_relaxed)) {
+            mWakeEpoch.fetch_add(1);
+            mWakeEpoch.notify_one();
+        }
+    }
+
+    /// @brief Write a batch of messages, return the number of messages written.
+    std::size_t writeBatch() {
+        std::size_t      count = 0;
+        std::scoped_lock lock(sinksMutex);
+        while (count < kBatchSize && mQueue.tryPop([](QueuedMessage& message) {
+            writeToSinks({message.category, message.level, message.time, message.text});
+        })) {
+            count++;
+        }
+        const auto dropped = mDroppedSinceReport.exchange(0, std::memory_order_relaxed);
+        if (dropped != 0) {
+            const std::string msg =
+              std::format("{} messages dropped, the log queue was full.", dropped);
+            writeToSinks({fuse::LogCategory::General, fuse::LogLevel::Warn, elapsedSeconds(), msg});
+        }
+        if (count != 0 || dropped != 0) {
+            flushSinks();
+        }
+        return count;
+    }
+
+    void run() {
+        for (;;) {
+            const std::size_t count = writeBatch();
+            if (count != 0) {
+                writtenCount.fetch_add(count, std::memory_order_relaxed);
+                mWritten.store(mQueue.popCount());
+                continue;
+            }
+            if (!mRunning.load()) {
+                break;
+            }
+
+            mSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const unsigned epoch = mWakeEpoch.load();
+            if (mQueue.popCount() == mQueue.pushCount() && mRunning.load()) {
+                mWakeEpoch.wait(epoch);
+            }
+            mSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    fuse::MpscRingBuffer<QueuedMessage> mQueue;
+    fuse::LogOverflow                   mOverflow;
+    fuse::TrackedMemory                 mMemory;     ///< The cells of the queue.
+    std::atomic<std::uint64_t>          mWritten{0}; ///< Messages written and flushed.
+    std::atomic<std::uint64_t>          mDroppedSinceReport{0};
+    std::atomic<unsigned>               mWakeEpoch{0};
+    std::atomic<bool>                   mSleeping{false};
+    std::atomic<bool>                   mRunning{true};
+    std::thread                         mThread;
+};
+
+std::atomic<AsyncLogger*> asyncLogger{nullptr};
+
+} // namespace
+
+namespace fuse {
+
+namespace detail {
+
+namespace {
+
+template <std::size_t... Is>
+constexpr std::array<std::atomic<LogLevel>, kLogCategoryCount>
+makeLogLevels(std::index_sequence<Is...>) noexcept {
+    return {((void)Is, kCompiledLogLevel)...};
+}
+
+} // namespace
+
+// Constant initialized: a message logged by the static initializer of another translation
+// unit is filtered by the compiled level, not by zeroed atomics (Fatal).
+constinit std::array<std::atomic<LogLevel>, kLogCategoryCount> logLevels =
+  makeLogLevels(std::make_index_sequence<kLogCategoryCount>());
+
+std::string& logFormatBuffer() noexcept {
+    thread_local std::string buffer;
+    return buffer;
+}
+
+} // namespace detail
+
+std::string_view toString(LogLevel level) noexcept {
     using enum fuse::LogLevel;
     switch (level) {
             // clang-format off
@@ -20,19 +218,89 @@ std::string_view logLevelAsString(fuse::LogLevel level) {
     }
 }
 
-} // namespace
+std::string_view toString(LogCategory category) noexcept {
+    using enum fuse::LogCategory;
+    switch (category) {
+            // clang-format off
+        case General: return "General";
+        case Render:  return "Render";
+        case Math:    return "Math";
+        default: std::unreachable();
+            // clang-format on
+    }
+}
 
+void log_set_level(LogCategory category, LogLevel level) noexcept {
+    detail::logLevels[static_cast<std::size_t>(category)].store(level, std::memory_order_relaxed);
+}
 
-namespace fuse {
+void log_set_level(LogLevel level) noexcept {
+    for (auto& categoryLevel : detail::logLevels) {
+        categoryLevel.store(level, std::memory_order_relaxed);
+    }
+}
+
+LogLevel log_get_level(LogCategory category) noexcept {
+    return detail::logLevels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+}
+
+void log_initialize(const LogConfig& config) {
+    if (asyncLogger.load() != nullptr) {
+        return;
+    }
+    startTime = Clock::now();
+    writtenCount.store(0);
+    droppedCount.store(0);
+    if (config.console) {
+        log_add_sink(std::make_unique<ConsoleSink>());
+    }
+    asyncLogger.store(new AsyncLogger(config));
+}
+
+void log_shutdown() {
+    // Write the messages left and join the thread.
+    delete asyncLogger.exchange(nullptr);
+
+    std::scoped_lock lock(sinksMutex);
+    flushSinks();
+    sinks.clear();
+}
 
-void log_initialize() {}
+void log_add_sink(std::unique_ptr<LogSink> sink) {
+    std::scoped_lock lock(sinksMutex);
+    sinks.push_back(std::move(sink));
+}
 
-void log_shutdown() {}
+void log_flush() {
+    if (AsyncLogger* logger = asyncLogger.load()) {
+        logger->flush();
+    } else {
+        std::scoped_lock lock(sinksMutex);
+        flushSinks();
+    }
+}
 
-void log_message(LogLevel level, std::string_view msg) {
-    std::println("[{}] {}", logLevelAsString(level), msg);
+LogStats log_stats() noexcept {
+    return {writtenCount.load(std::memory_order_relaxed),
+            droppedCount.load(std::memory_order_relaxed)};
+}
+
+void log_message(LogCategory category, LogLevel level, std::string_view msg) {
+    if (!log_enabled(level, category)) {
+        return;
+    }
+
+    if (AsyncLogger* logger = asyncLogger.load()) {
+        logger->push(category, level, msg);
+    } else {
+        std::scoped_lock lock(sinksMutex);
+        writeToSinks({category, level, elapsedSeconds(), msg});
+        flushSinks();
+        writtenCount.fetch_add(1, std::memory_order_relaxed);
+    }
 
     if (level == LogLevel::Fatal) {
+        log_flush();
         std::abort();
     }
 }
@@ -0,0 +1,110 @@
+#include <fuse/MemoryTracker.h>
+
+#include <atomic>
+#include <format>
+#include <iterator>
+#include <utility>
+
+namespace {
+
+/// @brief The counters of a tag, on their own cache line so that the tags do not share one.
+struct alignas(64) TagCounters {
+    std::atomic<std::size_t>   liveBytes{0};
+    std::atomic<std::size_t>   peakBytes{0};
+    std::atomic<std::uint64_t> allocations{0}; ///< Allocations of the previous frames.
+    std::atomic<std::uint64_t> frameAllocations{0};
+    std::atomic<std::uint64_t> lastFrameAllocations{0};
+};
+
+std::array<TagCounters, fuse::kMemTagCount> counters;
+
+TagCounters& countersOf(fuse::MemTag tag) noexcept {
+    return counters[static_cast<std::size_t>(tag)];
+}
+
+/// @brief Format a size with the largest unit keeping at least 1, e.g. "1.50 MiB".
+std::string formatBytes(std::size_t bytes) {
+    constexpr const char* kUnits[] = {"B", "KiB", "MiB", "GiB"};
+    auto                  value    = static_cast<double>(bytes);
+    std::size_t           unit     = 0;
+    while (value >= 1024.0 && unit + 1 < std::size(kUnits)) {
+        value /= 1024.0;
+        unit++;
+    }
+    return unit == 0 ? std::format("{} B", bytes) : std::format("{:.2f} {}", value, kUnits[unit]);
+}
+
+} // namespace
+
+namespace fuse {
+
+std::string_view toString(MemTag tag) noexcept {
+    using enum fuse::MemTag;
+    switch (tag) {
+            // clang-format off
+        case General:  return "General";
+        case Geometry: return "Geometry";
+        case Texture:  return "Texture";
+        case Log:      return "Log";
+        case Profiler: return "Profiler";
+        default: std::unreachable();
+            // clang-format on
+    }
+}
+
+void trackAllocation(MemTag tag, std::size_t bytes) noexcept {
+    TagCounters&      tagCounters = countersOf(tag);
+    const std::size_t live = tagCounters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) +
+                             bytes;
+    std::size_t peak = tagCounters.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !tagCounters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    tagCounters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void trackDeallocation(MemTag tag, std::size_t bytes) noexcept {
+    countersOf(tag).liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void markMemoryFrame() noexcept {
+    for (TagCounters& tagCounters : counters) {
+        const auto frame = tagCounters.frameAllocations.exchange(0, std::memory_order_relaxed);
+        tagCounters.allocations.fetch_add(frame, std::memory_order_relaxed);
+        tagCounters.lastFrameAllocations.store(frame, std::memory_order_relaxed);
+    }
+}
+
+MemTagStats memoryStats(MemTag tag) noexcept {
+    const TagCounters&  tagCounters = countersOf(tag);
+    const std::uint64_t frame = tagCounters.frameAllocations.load(std::memory_order_relaxed);
+    return {
+      .tag                  = tag,
+      .liveBytes            = tagCounters.liveBytes.load(std::memory_order_relaxed),
+      .peakBytes            = tagCounters.peakBytes.load(std::memory_order_relaxed),
+      .allocations          = tagCounters.allocations.load(std::memory_order_relaxed) + frame,
+      .lastFrameAllocations = tagCounters.lastFrameAllocations.load(std::memory_order_relaxed),
+    };
+}
+
+std::array<MemTagStats, kMemTagCount> memoryStats() noexcept {
+    std::array<MemTagStats, kMemTagCount> stats{};
+    for (std::size_t i = 0; i < kMemTagCount; i++) {
+        stats[i] = memoryStats(static_cast<MemTag>(i));
+    }
+    return stats;
+}
+
+std::string memoryReport() {
+    std::string report = std::format("{:<10} {:>12} {:>12} {:>12} {:>12}\n", "Tag", "Live",
+                                      "Peak", "Allocations", "Per frame");
+    for (const MemTagStats& stats : memoryStats()) {
+        std::format_to(std::back_inserter(report), "{:<10} {:>12} {:>12} {:>12} {:>12}\n",
+                       toString(stats.tag), formatBytes(stats.liveBytes),
+                       formatBytes(stats.peakBytes), stats.allocations,
+                       stats.lastFrameAllocations);
+    }
+    return report;
+}
+
+} // namespace fuse
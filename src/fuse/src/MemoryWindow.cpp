@@ -0,0 +1,46 @@
+#include <fuse/MemoryTracker.h>
+
+#include <imgui.h>
+
+#include <string_view>
+
+namespace fuse {
+
+void showMemoryWindow(bool* open) {
+    if (!ImGui::Begin("Memory", open)) {
+        ImGui::End();
+        return;
+    }
+
+    constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+    if (ImGui::BeginTable("MemoryTags", 5, flags)) {
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn("Live (KiB)");
+        ImGui::TableSetupColumn("Peak (KiB)");
+        ImGui::TableSetupColumn("Allocations");
+        ImGui::TableSetupColumn("Last frame");
+        ImGui::TableHeadersRow();
+        for (const MemTagStats& stats : memoryStats()) {
+            const std::string_view name = toString(stats.tag);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name.data(), name.data() + name.size());
+            for (const std::size_t bytes : {stats.liveBytes, stats.peakBytes}) {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(bytes) / 1024.0);
+            }
+            for (const std::uint64_t count : {stats.allocations, stats.lastFrameAllocations}) {
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(count));
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImGui::Button("Copy report")) {
+        ImGui::SetClipboardText(memoryReport().c_str());
+    }
+
+    ImGui::End();
+}
+
+} // namespace fuse
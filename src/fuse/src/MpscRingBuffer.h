@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace fuse {
+
+/// @brief Bounded lock-free queue for many producers and a single consumer.
+///
+/// The elements are constructed once and reused: tryPush() and tryPop() give access to the
+/// element in its cell, so an element owning memory (e.g. a std::string) keeps its capacity
+/// from one use to the next and the queue does not allocate once warmed up.
+///
+/// @note Bounded queue of Dmitry Vyukov: each cell has a sequence number telling whether it is
+///       free for the producer of a position or ready for the consumer.
+template <typename T>
+class MpscRingBuffer {
+public:
+    /// @param capacity Maximum number of elements, rounded up to a power of 2.
+    explicit MpscRingBuffer(std::size_t capacity)
+        : mMask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+        , mCells(std::make_unique<Cell[]>(mMask + 1)) {
+        for (std::size_t i = 0; i <= mMask; i++) {
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Return the maximum number of elements.
+    [[nodiscard]] std::size_t capacity() const noexcept { return mMask + 1; }
+
+    /// @brief Claim a free cell and fill it, any thread.
+    /// @param write Called with the element of the cell, `void(T&)`.
+    /// @return false if the queue is full.
+    template <typename F>
+    bool tryPush(F&& write) {
+        std::uint64_t position = mEnqueuePos.load(std::memory_order_relaxed);
+        Cell*         cell     = nullptr;
+        for (;;) {
+            cell                         = &mCells[position & mMask];
+            const std::uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::int64_t>(sequence - position);
+            if (diff == 0) {
+                if (mEnqueuePos.compare_exchange_weak(
+                      position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = mEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        write(cell->value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Read the oldest element, consumer thread only.
+    /// @param read Called with the element of the cell, `void(T&)`, the cell is reused after.
+    /// @return false if the queue is empty or the oldest element is not written yet.
+    template <typename F>
+    bool tryPop(F&& read) {
+        const std::uint64_t position = mDequeuePos.load(std::memory_order_relaxed);
+        Cell&               cell     = mCells[position & mMask];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        read(cell.value);
+        cell.sequence.store(position + mMask + 1, std::memory_order_release);
+        mDequeuePos.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Return the number of cells claimed by the producers since the creation.
+    [[nodiscard]] std::uint64_t pushCount() const noexcept {
+        return mEnqueuePos.load(std::memory_order_acquire);
+    }
+
+    /// @brief Return the number of elements read by the consumer since the creation.
+    [[nodiscard]] std::uint64_t popCount() const noexcept {
+        return mDequeuePos.load(std::memory_order_acquire);
+    }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<std::uint64_t> sequence;
+        T                          value;
+    };
+
+    // The producers write mEnqueuePos and the consumer mDequeuePos, keep them apart.
+    alignas(64) std::atomic<std::uint64_t> mEnqueuePos{0};
+    alignas(64) std::atomic<std::uint64_t> mDequeuePos{0};
+    const std::uint64_t     mMask;
+    std::unique_ptr<Cell[]> mCells;
+};
+
+} // namespace fuse
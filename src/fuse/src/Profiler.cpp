@@ -0,0 +1,288 @@
+#include <fuse/MemoryTracker.h>
+#include <fuse/Profiler.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Number of frames kept by markProfileFrame().
+constexpr std::size_t kMaxFrames = 256;
+
+/// @brief The tid of the frames track in the Chrome traces, the threads start at 1.
+constexpr std::uint32_t kFramesTrack = 0;
+
+/// @brief The buffers of the threads, kept after the threads exit so that their scopes can
+///        still be exported. The buffer of an exited thread is given to the next new thread.
+struct Registry {
+    std::mutex                                                      mutex;
+    std::vector<std::unique_ptr<fuse::detail::ProfileThreadBuffer>> buffers;
+    std::vector<fuse::detail::ProfileThreadBuffer*>                 freeBuffers;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+thread_local fuse::detail::ProfileThreadBuffer* tlsBuffer = nullptr;
+
+/// @brief Give the buffer of a thread back to the registry when the thread exits.
+struct ThreadBufferOwner {
+    ThreadBufferOwner() {
+        Registry&        reg = registry();
+        std::scoped_lock lock(reg.mutex);
+        if (!reg.freeBuffers.empty()) {
+            buffer = reg.freeBuffers.back();
+            reg.freeBuffers.pop_back();
+            buffer->setName(nullptr);
+        } else {
+            const auto thread = static_cast<std::uint32_t>(reg.buffers.size() + 1);
+            reg.buffers.push_back(std::make_unique<fuse::detail::ProfileThreadBuffer>(thread));
+            fuse::trackAllocation(fuse::MemTag::Profiler,
+                                  sizeof(fuse::detail::ProfileThreadBuffer));
+            buffer = reg.buffers.back().get();
+        }
+    }
+
+    ~ThreadBufferOwner() {
+        tlsBuffer = nullptr;
+        Registry&        reg = registry();
+        std::scoped_lock lock(reg.mutex);
+        reg.freeBuffers.push_back(buffer);
+    }
+
+    ThreadBufferOwner(const ThreadBufferOwner&)            = delete;
+    ThreadBufferOwner& operator=(const ThreadBufferOwner&) = delete;
+
+    fuse::detail::ProfileThreadBuffer* buffer;
+};
+
+struct Frames {
+    std::mutex                                mutex;
+    std::array<fuse::ProfileFrame, kMaxFrames> ring{};
+    std::uint64_t                             count{0};    ///< Number of frames ended.
+    std::uint64_t                             lastMark{0}; ///< Start of the current frame.
+};
+Frames frames;
+
+#if FUSE_PROFILER_RDTSC
+/// @brief The first measure of the TSC frequency, at the start of the program.
+const Clock::time_point calibrationTime  = Clock::now();
+const std::uint64_t     calibrationTicks = fuse::profilerTicks();
+#endif
+
+/// @brief Append @p str to @p out as the content of a JSON string.
+void appendJsonString(std::string& out, std::string_view str) {
+    for (const char c : str) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += std::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    out += c;
+                }
+        }
+    }
+}
+
+} // namespace
+
+namespace fuse {
+
+namespace detail {
+
+std::atomic<bool> profilerEnabled{true};
+
+ProfileThreadBuffer& profileThreadBuffer() noexcept {
+    if (tlsBuffer == nullptr) [[unlikely]] {
+        thread_local ThreadBufferOwner owner;
+        tlsBuffer = owner.buffer;
+    }
+    return *tlsBuffer;
+}
+
+void ProfileThreadBuffer::collect(std::uint64_t begin, std::uint64_t end,
+                                  std::vector<ProfileEvent>& events) const {
+    const std::uint64_t written = mWritten.load(std::memory_order_acquire);
+    const std::uint64_t first   = written > kCapacity ? written - kCapacity : 0;
+
+    const std::size_t          start = events.size();
+    std::vector<std::uint64_t> indices;
+    for (std::uint64_t i = first; i < written; i++) {
+        const Slot&        slot = mSlots[i % kCapacity];
+        const ProfileEvent event{slot.name.load(std::memory_order_relaxed),
+                                 slot.begin.load(std::memory_order_relaxed),
+                                 slot.end.load(std::memory_order_relaxed),
+                                 mThread,
+                                 slot.depth.load(std::memory_order_relaxed)};
+        if (event.begin <= end && event.end >= begin) {
+            events.push_back(event);
+            indices.push_back(i);
+        }
+    }
+
+    // The slots claimed by the owner thread during the read may be torn, drop them.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t claimed = mClaimed.load(std::memory_order_relaxed);
+    if (claimed > first + kCapacity) {
+        const std::uint64_t oldestValid = claimed - kCapacity;
+        const auto          overwritten = static_cast<std::ptrdiff_t>(
+          std::ranges::lower_bound(indices, oldestValid) - indices.begin());
+        events.erase(events.begin() + static_cast<std::ptrdiff_t>(start),
+                     events.begin() + static_cast<std::ptrdiff_t>(start) + overwritten);
+    }
+}
+
+} // namespace detail
+
+double profilerSecondsPerTick() noexcept {
+#if FUSE_PROFILER_RDTSC
+    static const double secondsPerTick = [] {
+        constexpr auto minDuration = std::chrono::milliseconds(10);
+        const auto     elapsed     = Clock::now() - calibrationTime;
+        if (elapsed < minDuration) {
+            std::this_thread::sleep_for(minDuration - elapsed);
+        }
+        const std::uint64_t ticks = profilerTicks();
+        const auto          now   = Clock::now();
+        return std::chrono::duration<double>(now - calibrationTime).count() /
+               static_cast<double>(ticks - calibrationTicks);
+    }();
+    return secondsPerTick;
+#else
+    return std::chrono::duration<double>(Clock::duration(1)).count();
+#endif
+}
+
+void setProfilerEnabled(bool enabled) noexcept {
+    detail::profilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool isProfilerEnabled() noexcept {
+    return detail::profilerEnabled.load(std::memory_order_relaxed);
+}
+
+void markProfileFrame() noexcept {
+    const std::uint64_t now = profilerTicks();
+    std::scoped_lock    lock(frames.mutex);
+    if (frames.lastMark != 0) {
+        frames.ring[frames.count % kMaxFrames] = {frames.count, frames.lastMark, now};
+        frames.count++;
+    }
+    frames.lastMark = now;
+}
+
+std::vector<ProfileFrame> profileFrames() {
+    std::scoped_lock          lock(frames.mutex);
+    const std::uint64_t       first = frames.count > kMaxFrames ? frames.count - kMaxFrames : 0;
+    std::vector<ProfileFrame> result;
+    result.reserve(static_cast<std::size_t>(frames.count - first));
+    for (std::uint64_t i = first; i < frames.count; i++) {
+        result.push_back(frames.ring[i % kMaxFrames]);
+    }
+    return result;
+}
+
+std::vector<ProfileEvent> collectProfileEvents(std::uint64_t begin, std::uint64_t end) {
+    std::vector<ProfileEvent> events;
+    {
+        Registry&        reg = registry();
+        std::scoped_lock lock(reg.mutex);
+        for (const auto& buffer : reg.buffers) {
+            buffer->collect(begin, end, events);
+        }
+    }
+    // A thread records its scopes when they end, the inner scopes first.
+    std::ranges::sort(events, [](const ProfileEvent& a, const ProfileEvent& b) {
+        if (a.thread != b.thread) {
+            return a.thread < b.thread;
+        }
+        if (a.begin != b.begin) {
+            return a.begin < b.begin;
+        }
+        return a.depth < b.depth;
+    });
+    return events;
+}
+
+void setProfileThreadName(const char* name) noexcept {
+    detail::profileThreadBuffer().setName(name);
+}
+
+std::string profileThreadName(std::uint32_t thread) {
+    Registry&        reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    if (thread >= 1 && thread <= reg.buffers.size()) {
+        if (const char* name = reg.buffers[thread - 1]->name()) {
+            return name;
+        }
+    }
+    return std::format("Thread {}", thread);
+}
+
+bool exportChromeTrace(const std::filesystem::path& path, const ProfileFrame& first,
+                       const ProfileFrame& last) {
+    const auto events = collectProfileEvents(first.begin, last.end);
+
+    // Microseconds since the start of the first frame.
+    const double microsecondsPerTick = profilerSecondsPerTick() * 1e6;
+    const auto   toMicroseconds      = [&](std::uint64_t ticks) {
+        return static_cast<double>(static_cast<std::int64_t>(ticks - first.begin)) *
+               microsecondsPerTick;
+    };
+    const auto appendEvent = [&](std::string& out, std::string_view name, std::uint32_t tid,
+                                 std::uint64_t begin, std::uint64_t end) {
+        out += "{\"name\":\"";
+        appendJsonString(out, name);
+        out += std::format("\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}},\n",
+                           tid, toMicroseconds(begin), toMicroseconds(end) - toMicroseconds(begin));
+    };
+
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                       "\"args\":{{\"name\":\"Frames\"}}}},\n",
+                       kFramesTrack);
+    for (const ProfileFrame& frame : profileFrames()) {
+        if (frame.index >= first.index && frame.index <= last.index) {
+            appendEvent(out, std::format("Frame {}", frame.index), kFramesTrack, frame.begin,
+                        frame.end);
+        }
+    }
+    std::uint32_t thread = kFramesTrack;
+    for (const ProfileEvent& event : events) {
+        if (event.thread != thread) {
+            thread = event.thread;
+            out += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                               "\"args\":{{\"name\":\"",
+                               thread);
+            appendJsonString(out, profileThreadName(thread));
+            out += "\"}},\n";
+        }
+        appendEvent(out, event.name, event.thread, event.begin, event.end);
+    }
+    // Remove the last separator.
+    out.resize(out.size() - 2);
+    out += "\n]}\n";
+
+    std::FILE* file = std::fopen(path.string().c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+    return std::fclose(file) == 0 && written;
+}
+
+} // namespace fuse
@@ -0,0 +1,206 @@
+#include <fuse/GpuProfiler.h>
+#include <fuse/Profiler.h>
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/// @brief Files written by the export buttons, in the working directory.
+constexpr const char* kTracePath  = "fuse_trace.json";
+constexpr const char* kGpuCsvPath = "fuse_gpu.csv";
+
+/// @brief A stable color per scope name.
+ImU32 scopeColor(const char* name) {
+    const auto  hash = std::hash<std::string_view>{}(name);
+    const float hue  = static_cast<float>(hash % 360) / 360.0f;
+    return ImColor::HSV(hue, 0.45f, 0.75f);
+}
+
+/// @brief Draw the scopes of a thread in a frame, one row per depth.
+/// @param events The scopes of the thread, sorted by start.
+void drawThreadFlameGraph(std::span<const fuse::ProfileEvent> events,
+                          const fuse::ProfileFrame& frame, double msPerTick) {
+    std::uint32_t maxDepth = 0;
+    for (const auto& event : events) {
+        maxDepth = std::max(maxDepth, event.depth);
+    }
+
+    const float  rowHeight = ImGui::GetTextLineHeight() + 2.0f;
+    const ImVec2 origin    = ImGui::GetCursorScreenPos();
+    const float  width     = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+    const float  height    = rowHeight * static_cast<float>(maxDepth + 1);
+    const auto   duration  = static_cast<double>(frame.end - frame.begin);
+    const auto   toX       = [&](std::uint64_t ticks) {
+        const std::uint64_t clamped = std::clamp(ticks, frame.begin, frame.end);
+        return origin.x + static_cast<float>(static_cast<double>(clamped - frame.begin) /
+                                             duration * static_cast<double>(width));
+    };
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    for (const auto& event : events) {
+        const ImVec2 min{toX(event.begin), origin.y + rowHeight * static_cast<float>(event.depth)};
+        const ImVec2 max{std::max(toX(event.end), min.x + 1.0f), min.y + rowHeight - 1.0f};
+        drawList->AddRectFilled(min, max, scopeColor(event.name));
+
+        const double ms = static_cast<double>(event.end - event.begin) * msPerTick;
+        if (max.x - min.x > ImGui::CalcTextSize(event.name).x + 4.0f) {
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText({min.x + 2.0f, min.y + 1.0f}, IM_COL32_WHITE, event.name);
+            drawList->PopClipRect();
+        }
+        if (ImGui::IsMouseHoveringRect(min, max)) {
+            ImGui::SetTooltip("%s\n%.3f ms", event.name, ms);
+        }
+    }
+    ImGui::Dummy({width, height});
+}
+
+/// @brief Show the GPU times: a flame graph of the last frame read back and the statistics of
+///        the scopes.
+void showGpuTimes(const fuse::GpuProfiler& gpu, std::string& exportStatus) {
+    if (!gpu.isSupported()) {
+        ImGui::TextUnformatted("GPU: no timestamp queries.");
+        return;
+    }
+    const auto& last = gpu.lastFrame();
+    if (last.empty()) {
+        ImGui::TextUnformatted("GPU: no frame read back yet.");
+        return;
+    }
+
+    // The GPU times are in nanoseconds from the start of the frame on the GPU.
+    std::vector<fuse::ProfileEvent> events;
+    events.reserve(last.size());
+    for (const auto& scope : last) {
+        events.push_back({scope.name, scope.begin, scope.end, 0, scope.depth});
+    }
+    const fuse::ProfileFrame frame{0, 0, std::max<std::uint64_t>(last.front().end, 1)};
+    ImGui::Text("GPU (%llu frames dropped)", static_cast<unsigned long long>(gpu.droppedFrames()));
+    drawThreadFlameGraph(events, frame, 1e-6);
+
+    if (ImGui::Button("Export GPU times")) {
+        exportStatus = gpu.exportCsv(kGpuCsvPath) ? std::string("Written to ") + kGpuCsvPath
+                                                  : std::string("Can not write ") + kGpuCsvPath;
+    }
+    constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+    if (ImGui::BeginTable("GpuScopes", 5, flags)) {
+        ImGui::TableSetupColumn("Scope");
+        ImGui::TableSetupColumn("Last (ms)");
+        ImGui::TableSetupColumn("Min (ms)");
+        ImGui::TableSetupColumn("Avg (ms)");
+        ImGui::TableSetupColumn("Max (ms)");
+        ImGui::TableHeadersRow();
+        for (const auto& stats : gpu.stats()) {
+            ImGui::TableNextColumn();
+            ImGui::Text("%*s%s", static_cast<int>(stats.depth) * 2, "", stats.name);
+            for (const double value : {stats.time.last(), stats.time.min(), stats.time.average(),
+                                       stats.time.max()}) {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", value);
+            }
+        }
+        ImGui::EndTable();
+    }
+}
+
+} // namespace
+
+namespace fuse {
+
+void showProfilerWindow(bool* open, const GpuProfiler* gpu) {
+    static bool         paused       = false;
+    static ProfileFrame shown        = {};
+    static int          exportFrames = 60;
+    static std::string  exportStatus;
+
+    if (!ImGui::Begin("Profiler", open)) {
+        ImGui::End();
+        return;
+    }
+
+    bool enabled = isProfilerEnabled();
+    if (ImGui::Checkbox("Record", &enabled)) {
+        setProfilerEnabled(enabled);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Pause", &paused);
+
+    const auto frames = profileFrames();
+    if (frames.empty()) {
+        ImGui::TextUnformatted("No frame recorded, see FUSE_PROFILE_FRAME().");
+        ImGui::End();
+        return;
+    }
+    if (!paused || shown.end == 0) {
+        shown = frames.back();
+    }
+
+    // Frame times, a click on a bar shows the frame.
+    const double       msPerTick = profilerSecondsPerTick() * 1e3;
+    std::vector<float> frameTimes;
+    frameTimes.reserve(frames.size());
+    for (const auto& frame : frames) {
+        frameTimes.push_back(static_cast<float>(static_cast<double>(frame.end - frame.begin) *
+                                                msPerTick));
+    }
+    ImGui::PlotHistogram("##FrameTimes", frameTimes.data(), static_cast<int>(frameTimes.size()),
+                         0, "Frame times (ms)", 0.0f, FLT_MAX,
+                         {ImGui::GetContentRegionAvail().x, 60.0f});
+    if (ImGui::IsItemClicked()) {
+        // Clamped first, a negative float converted to an integer is undefined.
+        const float ratio = std::clamp((ImGui::GetMousePos().x - ImGui::GetItemRectMin().x) /
+                                         std::max(ImGui::GetItemRectSize().x, 1.0f),
+                                       0.0f, 1.0f);
+        const auto  index = std::min(
+          static_cast<std::size_t>(ratio * static_cast<float>(frameTimes.size())),
+          frames.size() - 1);
+        shown  = frames[index];
+        paused = true;
+    }
+
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderInt("Frames", &exportFrames, 1, static_cast<int>(frames.size()));
+    ImGui::SameLine();
+    if (ImGui::Button("Export trace")) {
+        const auto count = std::min(static_cast<std::size_t>(exportFrames), frames.size());
+        exportStatus     = exportChromeTrace(kTracePath, frames[frames.size() - count],
+                                             frames.back())
+                             ? std::string("Written to ") + kTracePath
+                             : std::string("Can not write ") + kTracePath;
+    }
+    if (!exportStatus.empty()) {
+        ImGui::SameLine();
+        ImGui::TextUnformatted(exportStatus.c_str());
+    }
+
+    ImGui::Separator();
+    ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(shown.index),
+                static_cast<double>(shown.end - shown.begin) * msPerTick);
+
+    const auto events = collectProfileEvents(shown.begin, shown.end);
+    for (auto first = events.begin(); first != events.end();) {
+        const auto last = std::find_if(first, events.end(), [&](const ProfileEvent& event) {
+            return event.thread != first->thread;
+        });
+        ImGui::TextUnformatted(profileThreadName(first->thread).c_str());
+        drawThreadFlameGraph({first, last}, shown, msPerTick);
+        first = last;
+    }
+
+    if (gpu != nullptr) {
+        ImGui::Separator();
+        showGpuTimes(*gpu, exportStatus);
+    }
+
+    ImGui::End();
+}
+
+} // namespace fuse
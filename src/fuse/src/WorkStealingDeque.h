@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace fuse {
+
+/// @brief Fixed capacity lock-free deque of pointers, for the work stealing of the JobSystem.
+///
+/// The owner thread push() and pop() at the back, the other threads steal() at the front.
+///
+/// @note Chase-Lev deque with the memory orders of "Correct and Efficient Work-Stealing for
+///       Weak Memory Models" (Lê, Pop, Cohen and Zappa Nardelli).
+template <typename T>
+class WorkStealingDeque {
+public:
+    /// @param capacity Maximum number of elements, must be a power of 2.
+    explicit WorkStealingDeque(std::size_t capacity)
+        : mMask(static_cast<std::int64_t>(capacity) - 1)
+        , mBuffer(std::make_unique<std::atomic<T*>[]>(capacity)) {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0 && "Capacity must be a power of 2");
+    }
+
+    /// @brief Add an element at the back, owner thread only.
+    /// @return false if the deque is full.
+    [[nodiscard]] bool push(T* item) noexcept {
+        const std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+        const std::int64_t top    = mTop.load(std::memory_order_acquire);
+        if (bottom - top > mMask) {
+            return false;
+        }
+        mBuffer[bottom & mMask].store(item, std::memory_order_relaxed);
+        // A release store rather than a release fence, same code on x86 and understood by TSan.
+        mBottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Remove the element at the back, owner thread only.
+    /// @return The element or null if the deque is empty.
+    [[nodiscard]] T* pop() noexcept {
+        const std::int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+        mBottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = mTop.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty.
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = mBuffer[bottom & mMask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element, race with the thieves.
+            if (!mTop.compare_exchange_strong(
+                  top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /// @brief Remove the element at the front, any thread.
+    /// @return The element or null if the deque is empty or another thread took it first.
+    [[nodiscard]] T* steal() noexcept {
+        std::int64_t top = mTop.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = mBottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        T* item = mBuffer[top & mMask].load(std::memory_order_relaxed);
+        if (!mTop.compare_exchange_strong(
+              top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+private:
+    // The indices are on their own cache line, the owner writes mBottom and the thieves mTop.
+    alignas(64) std::atomic<std::int64_t> mTop{0};
+    alignas(64) std::atomic<std::int64_t> mBottom{0};
+    alignas(64) const std::int64_t mMask;
+    std::unique_ptr<std::atomic<T*>[]> mBuffer;
+};
+
+} // namespace fuse
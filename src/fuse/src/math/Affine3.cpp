@@ -0,0 +1,113 @@
+#include "fuse/math/Affine3.h"
+
+#include "fuse/math/Angle.h"
+#include "kernels/AffineKernels.h"
+
+#include <assert.h>
+
+namespace fuse {
+
+namespace {
+
+/// @brief Return the inverse of @p m knowing @p inv, the inverse of its linear part,
+///        stored row-major in a 3x3 array.
+Affine3 inverseWith(const Affine3& m, const float (&inv)[3][3]) noexcept {
+    // x' = L * x + t  =>  x = L^-1 * x' - L^-1 * t
+    const float tx = m(0, 3);
+    const float ty = m(1, 3);
+    const float tz = m(2, 3);
+    return {
+      // clang-format off
+        inv[0][0], inv[0][1], inv[0][2], -(inv[0][0] * tx + inv[0][1] * ty + inv[0][2] * tz),
+        inv[1][0], inv[1][1], inv[1][2], -(inv[1][0] * tx + inv[1][1] * ty + inv[1][2] * tz),
+        inv[2][0], inv[2][1], inv[2][2], -(inv[2][0] * tx + inv[2][1] * ty + inv[2][2] * tz),
+      // clang-format on
+    };
+}
+
+} // namespace
+
+Affine3 Affine3::operator*(const Affine3& other) const noexcept {
+    Affine3 result;
+    kernels::active::affineMul(data(), other.data(), result.data());
+    return result;
+}
+
+Affine3& Affine3::operator*=(const Affine3& other) noexcept {
+    kernels::active::affineMul(data(), other.data(), data());
+    return *this;
+}
+
+Affine3 Affine3::inverse() const noexcept {
+    const auto& m = mData;
+    // Cofactors of the first column, reused by the determinant.
+    const float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    const float c10 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    const float c20 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    const float det = m[0][0] * c00 + m[0][1] * c10 + m[0][2] * c20;
+    assert(det != 0.f && "The transformation must be invertible.");
+    const float invDet = 1.f / det;
+
+    const float inv[3][3] = {
+      {c00 * invDet, (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet,
+       (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet},
+      {c10 * invDet, (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet,
+       (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet},
+      {c20 * invDet, (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet,
+       (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet},
+    };
+    return inverseWith(*this, inv);
+}
+
+Affine3 Affine3::inverseRigid() const noexcept {
+    const auto& m         = mData;
+    const float inv[3][3] = {
+      {m[0][0], m[1][0], m[2][0]},
+      {m[0][1], m[1][1], m[2][1]},
+      {m[0][2], m[1][2], m[2][2]},
+    };
+    return inverseWith(*this, inv);
+}
+
+Affine3 Affine3::inverseOrthogonal() const noexcept {
+    // L = R * S, L^-1 = S^-1 * R^T: the row i of L^-1 is the column i of L divided by s_i^2,
+    // the squared length of this column.
+    float inv[3][3];
+    for (unsigned col = 0; col < 3; col++) {
+        const float lengthSquared = mData[0][col] * mData[0][col] +
+                                    mData[1][col] * mData[1][col] +
+                                    mData[2][col] * mData[2][col];
+        assert(lengthSquared != 0.f && "The transformation must be invertible.");
+        const float invLengthSquared = 1.f / lengthSquared;
+        for (unsigned row = 0; row < 3; row++) {
+            inv[col][row] = mData[row][col] * invLengthSquared;
+        }
+    }
+    return inverseWith(*this, inv);
+}
+
+Affine3 Affine3::CreateTranslation(const Vec3& translation) noexcept {
+    return {Mat3::kIdentity, translation};
+}
+
+Affine3 Affine3::CreateScaling(const Vec3& scale) noexcept {
+    return {Mat3::CreateScaling(scale), Vec3::kZero};
+}
+
+Affine3 Affine3::CreateRotation(Angle angle, const Vec3& axis) noexcept {
+    return {Mat3::CreateRotation(angle, axis), Vec3::kZero};
+}
+
+Affine3 Affine3::CreateTRS(const Vec3& translation, const Mat3& rotation,
+                           const Vec3& scale) noexcept {
+    // R * S scale the columns of R.
+    Affine3 result(rotation, translation);
+    for (unsigned row = 0; row < 3; row++) {
+        result.mData[row][0] *= scale.x;
+        result.mData[row][1] *= scale.y;
+        result.mData[row][2] *= scale.z;
+    }
+    return result;
+}
+
+} // namespace fuse
@@ -0,0 +1,71 @@
+#include "fuse/math/BatchTransform.h"
+
+#include "fuse/JobSystem.h"
+
+#include "kernels/TransformKernels.h"
+
+#include <assert.h>
+
+#include <algorithm>
+
+namespace fuse {
+
+static_assert(sizeof(Vec3) == 3 * sizeof(float), "The kernels expect tightly packed Vec3.");
+static_assert(sizeof(Vec4) == 4 * sizeof(float), "The kernels expect tightly packed Vec4.");
+
+namespace {
+
+using Kernel = void (*)(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @brief Run @p kernel over the whole span, split in contiguous chunks across the jobs.
+template <typename T>
+void run(Kernel kernel, const Mat4& m, std::span<const T> in, std::span<T> out,
+         const BatchOptions& options) {
+    assert(out.size() >= in.size());
+    assert(in.data() == out.data() || in.data() + in.size() <= out.data() ||
+           out.data() + in.size() <= in.data());
+
+    constexpr std::size_t kFloats = sizeof(T) / sizeof(float);
+
+    const auto* src   = reinterpret_cast<const float*>(in.data());
+    auto*       dst   = reinterpret_cast<float*>(out.data());
+    const auto  count = in.size();
+
+    const std::size_t minElements = std::max<std::size_t>(options.minElementsPerJob, 1);
+    if (options.jobs == nullptr || count < 2 * minElements) {
+        kernel(m.data(), src, dst, count);
+        return;
+    }
+
+    // A few chunks per thread so the threads finishing first steal from the others, each a
+    // multiple of the widest kernel so only the last one has a tail.
+    constexpr std::size_t kBlock = 8;
+    const std::size_t     chunks = 4 * (std::size_t{options.jobs->workerCount()} + 1);
+    const std::size_t     chunk =
+      (std::max(minElements, count / chunks) + kBlock - 1) / kBlock * kBlock;
+    options.jobs->parallelFor(
+      0, count,
+      [&](std::size_t first, std::size_t last) {
+          kernel(m.data(), src + first * kFloats, dst + first * kFloats, last - first);
+      },
+      chunk);
+}
+
+} // namespace
+
+void transformPoints(const Mat4& m, std::span<const Vec3> in, std::span<Vec3> out,
+                     const BatchOptions& options) {
+    run(&kernels::active::transformPoints, m, in, out, options);
+}
+
+void transformDirections(const Mat4& m, std::span<const Vec3> in, std::span<Vec3> out,
+                         const BatchOptions& options) {
+    run(&kernels::active::transformDirections, m, in, out, options);
+}
+
+void transformVec4(const Mat4& m, std::span<const Vec4> in, std::span<Vec4> out,
+                   const BatchOptions& options) {
+    run(&kernels::active::transformVec4, m, in, out, options);
+}
+
+} // namespace fuse
@@ -0,0 +1,128 @@
+#include "fuse/math/Dispatch.h"
+
+#include "fuse/CpuFeatures.h"
+#include "fuse/Logger.h"
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "kernels/Dispatch.h"
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace fuse {
+
+#if defined(FUSE_SIMD_DISPATCH)
+std::atomic<int> kernels::detail::gIsa{-1};
+#endif
+
+namespace {
+
+#if defined(FUSE_SIMD_DISPATCH)
+
+/// @brief Return the instruction set named @p name, case insensitive.
+std::optional<Isa> parseIsa(std::string_view name) noexcept {
+    const auto equal = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) ==
+               std::tolower(static_cast<unsigned char>(b));
+    };
+    for (const Isa isa : {Isa::Scalar, Isa::SSE, Isa::AVX2, Isa::AVX512}) {
+        if (std::ranges::equal(name, toString(isa), equal)) {
+            return isa;
+        }
+    }
+    return std::nullopt;
+}
+
+/// @brief Return the best instruction set supported by the CPU.
+Isa supportedIsa() noexcept {
+    const CpuFeatures& cpu = cpuFeatures();
+    // The AVX-512 kernels are compiled with /arch:AVX512 (or the matching GCC options), the
+    // compiler may use the BW, DQ and VL instructions anywhere in them.
+    if (cpu.avx512f && cpu.avx512bw && cpu.avx512dq && cpu.avx512vl && cpu.avx2 && cpu.fma) {
+        return Isa::AVX512;
+    }
+    if (cpu.avx2 && cpu.fma) {
+        return Isa::AVX2;
+    }
+    if (cpu.sse2) {
+        return Isa::SSE;
+    }
+    return Isa::Scalar;
+}
+
+#endif
+
+Isa selectIsa() {
+    const char* forced = std::getenv("FUSE_FORCE_ISA");
+#if defined(FUSE_SIMD_DISPATCH)
+    const Isa best = std::min(compiledIsa(), supportedIsa());
+    if (forced == nullptr || *forced == '\0') {
+        return best;
+    }
+
+    const std::optional<Isa> isa = parseIsa(forced);
+    if (!isa) {
+        FUSE_LOG(LogCategory::Math, LogLevel::Warn,
+                 "FUSE_FORCE_ISA: unknown instruction set '{}', using {}.", forced, toString(best));
+        return best;
+    }
+    if (*isa > best) {
+        FUSE_LOG(LogCategory::Math, LogLevel::Warn,
+                 "FUSE_FORCE_ISA: {} is not supported by this CPU, using {}.", toString(*isa),
+                 toString(best));
+        return best;
+    }
+    return *isa;
+#else
+    if (forced != nullptr && *forced != '\0') {
+        FUSE_LOG(LogCategory::Math, LogLevel::Warn,
+                 "FUSE_FORCE_ISA is ignored, the library is built for {} only (FUSE_SIMD).",
+                 toString(compiledIsa()));
+    }
+    return compiledIsa();
+#endif
+}
+
+} // namespace
+
+std::string_view toString(Isa isa) noexcept {
+    switch (isa) {
+            // clang-format off
+        case Isa::Scalar: return "Scalar";
+        case Isa::SSE:    return "SSE";
+        case Isa::AVX2:   return "AVX2";
+        case Isa::AVX512: return "AVX512";
+        default: std::unreachable();
+            // clang-format on
+    }
+}
+
+Isa compiledIsa() noexcept {
+#if defined(FUSE_SIMD_AVX512)
+    return Isa::AVX512;
+#elif defined(FUSE_SIMD_AVX2)
+    return Isa::AVX2;
+#elif defined(FUSE_SIMD_SSE)
+    return Isa::SSE;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+Isa activeIsa() {
+    static const Isa isa = [] {
+        const Isa selected = selectIsa();
+#if defined(FUSE_SIMD_DISPATCH)
+        kernels::detail::gIsa.store(static_cast<int>(selected), std::memory_order_relaxed);
+#endif
+        return selected;
+    }();
+    return isa;
+}
+
+} // namespace fuse
@@ -0,0 +1,34 @@
+#include "fuse/math/FastTrig.h"
+
+#include "kernels/TrigKernels.h"
+
+#include <assert.h>
+
+namespace fuse {
+
+static_assert(sizeof(Angle) == sizeof(float), "The kernels expect an Angle to be a float.");
+
+void sincos(std::span<const Angle> angles, std::span<float> sin, std::span<float> cos,
+            TrigPrecision precision) noexcept {
+    assert(sin.empty() || sin.size() >= angles.size());
+    assert(cos.empty() || cos.size() >= angles.size());
+    kernels::active::sincos(reinterpret_cast<const float*>(angles.data()),
+                            sin.empty() ? nullptr : sin.data(), cos.empty() ? nullptr : cos.data(),
+                            angles.size(), precision);
+}
+
+void fastSin(std::span<const Angle> angles, std::span<float> out,
+             TrigPrecision precision) noexcept {
+    assert(out.size() >= angles.size());
+    kernels::active::sincos(reinterpret_cast<const float*>(angles.data()), out.data(), nullptr,
+                            angles.size(), precision);
+}
+
+void fastCos(std::span<const Angle> angles, std::span<float> out,
+             TrigPrecision precision) noexcept {
+    assert(out.size() >= angles.size());
+    kernels::active::sincos(reinterpret_cast<const float*>(angles.data()), nullptr, out.data(),
+                            angles.size(), precision);
+}
+
+} // namespace fuse
@@ -0,0 +1,94 @@
+#include "fuse/math/Frustum.h"
+
+#include "kernels/CullingKernels.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+namespace fuse {
+
+static_assert(sizeof(Plane) == 4 * sizeof(float), "The kernels expect packed Plane.");
+static_assert(sizeof(Frustum) == 6 * sizeof(Plane), "The kernels expect packed Frustum.");
+static_assert(sizeof(BoundingSphere) == 4 * sizeof(float),
+              "The kernels expect packed BoundingSphere.");
+static_assert(sizeof(AABB) == 6 * sizeof(float), "The kernels expect packed AABB.");
+
+namespace {
+
+/// @brief Return the plane row[3] + sign * row[axis] of the matrix, normalized.
+Plane extractPlane(const Mat4& m, unsigned axis, float sign) noexcept {
+    const Vec3 normal(m(3, 0) + sign * m(axis, 0),
+                      m(3, 1) + sign * m(axis, 1),
+                      m(3, 2) + sign * m(axis, 2));
+    return Plane(normal, m(3, 3) + sign * m(axis, 3)).normalize();
+}
+
+/// @brief Projection of the extents of a box on the normal of a plane.
+float projectedRadius(const Plane& plane, const Vec3& extents) noexcept {
+    return std::abs(plane.normal.x) * extents.x + std::abs(plane.normal.y) * extents.y +
+           std::abs(plane.normal.z) * extents.z;
+}
+
+} // namespace
+
+Frustum Frustum::FromMatrix(const Mat4& viewProjection) noexcept {
+    // A point p is inside the clip volume when -w <= x <= w where x = row0 . p and
+    // w = row3 . p, so (row3 + row0) . p >= 0 and (row3 - row0) . p >= 0.
+    const Mat4& m = viewProjection;
+    return Frustum({
+      extractPlane(m, 0, +1.f), // Left
+      extractPlane(m, 0, -1.f), // Right
+      extractPlane(m, 1, +1.f), // Bottom
+      extractPlane(m, 1, -1.f), // Top
+      extractPlane(m, 2, +1.f), // Near
+      extractPlane(m, 2, -1.f), // Far
+    });
+}
+
+bool Frustum::contains(const Vec3& point) const noexcept {
+    return std::ranges::all_of(mPlanes,
+                               [&](const Plane& plane) { return plane.distance(point) >= 0.f; });
+}
+
+bool Frustum::intersects(const BoundingSphere& sphere) const noexcept {
+    // Same test as the cull() kernel.
+    return std::ranges::none_of(mPlanes, [&](const Plane& plane) {
+        return plane.distance(sphere.center) + sphere.radius < 0.f;
+    });
+}
+
+bool Frustum::intersects(const AABB& box) const noexcept {
+    // Same test as the cull() kernel.
+    const Vec3 center  = box.center();
+    const Vec3 extents = box.extents();
+    return std::ranges::none_of(mPlanes, [&](const Plane& plane) {
+        return plane.distance(center) + projectedRadius(plane, extents) < 0.f;
+    });
+}
+
+void cull(const Frustum& frustum, std::span<const BoundingSphere> spheres,
+          std::span<std::uint32_t> visibility) noexcept {
+    if (spheres.empty()) {
+        return;
+    }
+    const std::size_t words = visibilityMaskSize(spheres.size());
+    assert(visibility.size() >= words);
+    std::fill_n(visibility.begin(), words, 0u);
+    kernels::active::cullSpheres(
+      &frustum.planes()[0].normal.x, &spheres.data()->center.x, visibility.data(), spheres.size());
+}
+
+void cull(const Frustum& frustum, std::span<const AABB> boxes,
+          std::span<std::uint32_t> visibility) noexcept {
+    if (boxes.empty()) {
+        return;
+    }
+    const std::size_t words = visibilityMaskSize(boxes.size());
+    assert(visibility.size() >= words);
+    std::fill_n(visibility.begin(), words, 0u);
+    kernels::active::cullBoxes(
+      &frustum.planes()[0].normal.x, &boxes.data()->min.x, visibility.data(), boxes.size());
+}
+
+} // namespace fuse
@@ -2,8 +2,9 @@
 
 namespace fuse {
 
-Mat2 operator*(const Mat2& mat, float value) noexcept {
-    Mat2 result;
+template <typename T>
+TMat2<T> operator*(const TMat2<T>& mat, std::type_identity_t<T> value) noexcept {
+    TMat2<T> result;
     for (unsigned i = 0; i < 2; i++) {
         for (unsigned j = 0; j < 2; j++) {
             result(i, j) = mat(i, j) * value;
@@ -12,23 +13,34 @@ Mat2 operator*(const Mat2& mat, float value) noexcept {
     return result;
 }
 
-Mat2 operator*(float value, const Mat2& mat) noexcept { return mat * value; }
+template <typename T>
+TMat2<T> operator*(std::type_identity_t<T> value, const TMat2<T>& mat) noexcept {
+    return mat * value;
+}
 
-Mat2& operator*=(Mat2& mat, float value) noexcept { return mat = mat * value; }
+template <typename T>
+TMat2<T>& operator*=(TMat2<T>& mat, std::type_identity_t<T> value) noexcept {
+    return mat = mat * value;
+}
 
-Vec2 operator*(const Mat2& m, const Vec2& v) noexcept {
+template <typename T>
+TVec2<T> operator*(const TMat2<T>& m, const TVec2<T>& v) noexcept {
     const auto x = m(0, 0) * v.x + m(0, 1) * v.y;
     const auto y = m(1, 0) * v.x + m(1, 1) * v.y;
     return {x, y};
 }
 
-Mat2& Mat2::operator+=(const Mat2& other) noexcept { return *this = *this + other; }
+template <typename T>
+TMat2<T>& TMat2<T>::operator+=(const TMat2& other) noexcept { return *this = *this + other; }
 
-Mat2& Mat2::operator-=(const Mat2& other) noexcept { return *this = *this - other; }
+template <typename T>
+TMat2<T>& TMat2<T>::operator-=(const TMat2& other) noexcept { return *this = *this - other; }
 
-Mat2& Mat2::operator*=(const Mat2& other) noexcept { return *this = *this * other; }
+template <typename T>
+TMat2<T>& TMat2<T>::operator*=(const TMat2& other) noexcept { return *this = *this * other; }
 
-Mat2 Mat2::operator+(const Mat2& other) const noexcept {
+template <typename T>
+TMat2<T> TMat2<T>::operator+(const TMat2& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) + other(0, 0);
     const auto  m01 = m(0, 1) + other(0, 1);
@@ -37,7 +49,8 @@ Mat2 Mat2::operator+(const Mat2& other) const noexcept {
     return {m00, m01, m10, m11};
 }
 
-Mat2 Mat2::operator-(const Mat2& other) const noexcept {
+template <typename T>
+TMat2<T> TMat2<T>::operator-(const TMat2& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) - other(0, 0);
     const auto  m01 = m(0, 1) - other(0, 1);
@@ -46,7 +59,8 @@ Mat2 Mat2::operator-(const Mat2& other) const noexcept {
     return {m00, m01, m10, m11};
 }
 
-Mat2 Mat2::operator*(const Mat2& other) const noexcept {
+template <typename T>
+TMat2<T> TMat2<T>::operator*(const TMat2& other) const noexcept {
     const auto& m = *this;
 
     const auto m00 = m(0, 0) * other(0, 0) + m(0, 1) * other(1, 0);
@@ -57,4 +71,16 @@ Mat2 Mat2::operator*(const Mat2& other) const noexcept {
     return {m00, m01, m10, m11};
 }
 
+template class TMat2<float>;
+template class TMat2<double>;
+
+template Mat2 operator*(const Mat2&, float) noexcept;
+template Mat2d operator*(const Mat2d&, double) noexcept;
+template Mat2 operator*(float, const Mat2&) noexcept;
+template Mat2d operator*(double, const Mat2d&) noexcept;
+template Mat2& operator*=(Mat2&, float) noexcept;
+template Mat2d& operator*=(Mat2d&, double) noexcept;
+template Vec2 operator*(const Mat2&, const Vec2&) noexcept;
+template Vec2d operator*(const Mat2d&, const Vec2d&) noexcept;
+
 } // namespace fuse
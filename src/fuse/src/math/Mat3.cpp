@@ -6,8 +6,9 @@
 
 namespace fuse {
 
-Mat3 operator*(const Mat3& mat, float value) noexcept {
-    Mat3 result;
+template <typename T>
+TMat3<T> operator*(const TMat3<T>& mat, std::type_identity_t<T> value) noexcept {
+    TMat3<T> result;
     for (unsigned i = 0; i < 3; i++) {
         for (unsigned j = 0; j < 3; j++) {
             result(i, j) = mat(i, j) * value;
@@ -16,31 +17,43 @@ Mat3 operator*(const Mat3& mat, float value) noexcept {
     return result;
 }
 
-Mat3 operator*(float value, const Mat3& mat) noexcept { return mat * value; }
+template <typename T>
+TMat3<T> operator*(std::type_identity_t<T> value, const TMat3<T>& mat) noexcept {
+    return mat * value;
+}
 
-Mat3& operator*=(Mat3& mat, float value) noexcept { return mat = mat * value; }
+template <typename T>
+TMat3<T>& operator*=(TMat3<T>& mat, std::type_identity_t<T> value) noexcept {
+    return mat = mat * value;
+}
 
-Vec3 operator*(const Mat3& m, const Vec3& v) noexcept {
+template <typename T>
+TVec3<T> operator*(const TMat3<T>& m, const TVec3<T>& v) noexcept {
     const auto x = m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z;
     const auto y = m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z;
     const auto z = m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z;
     return {x, y, z};
 }
 
-Vec3 operator*(const Vec3& v, const Mat3& m) noexcept {
+template <typename T>
+TVec3<T> operator*(const TVec3<T>& v, const TMat3<T>& m) noexcept {
     const auto x = v.x * m(0, 0) + v.y * m(1, 0) + v.z * m(2, 0);
     const auto y = v.x * m(0, 1) + v.y * m(1, 1) + v.z * m(2, 1);
     const auto z = v.x * m(0, 2) + v.y * m(1, 2) + v.z * m(2, 2);
     return {x, y, z};
 }
 
-Mat3& Mat3::operator+=(const Mat3& other) noexcept { return *this = *this + other; }
+template <typename T>
+TMat3<T>& TMat3<T>::operator+=(const TMat3& other) noexcept { return *this = *this + other; }
 
-Mat3& Mat3::operator-=(const Mat3& other) noexcept { return *this = *this - other; }
+template <typename T>
+TMat3<T>& TMat3<T>::operator-=(const TMat3& other) noexcept { return *this = *this - other; }
 
-Mat3& Mat3::operator*=(const Mat3& other) noexcept { return *this = *this * other; }
+template <typename T>
+TMat3<T>& TMat3<T>::operator*=(const TMat3& other) noexcept { return *this = *this * other; }
 
-Mat3 Mat3::operator+(const Mat3& other) const noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::operator+(const TMat3& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) + other(0, 0);
     const auto  m01 = m(0, 1) + other(0, 1);
@@ -62,7 +75,8 @@ Mat3 Mat3::operator+(const Mat3& other) const noexcept {
     };
 }
 
-Mat3 Mat3::operator-(const Mat3& other) const noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::operator-(const TMat3& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) - other(0, 0);
     const auto  m01 = m(0, 1) - other(0, 1);
@@ -84,7 +98,8 @@ Mat3 Mat3::operator-(const Mat3& other) const noexcept {
     };
 }
 
-Mat3 Mat3::operator*(const Mat3& other) const noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::operator*(const TMat3& other) const noexcept {
     const auto& m = *this;
     // clang-format off
     const auto m00 = m(0, 0) * other(0, 0) + m(0, 1) * other(1, 0) + m(0, 2) * other(2, 0);
@@ -106,26 +121,28 @@ Mat3 Mat3::operator*(const Mat3& other) const noexcept {
     // clang-format on
 }
 
-Mat3 Mat3::CreateScaling(const Vec3& scale) noexcept {
-    Mat3 mat  = Mat3::kIdentity;
+template <typename T>
+TMat3<T> TMat3<T>::CreateScaling(const TVec3<T>& scale) noexcept {
+    TMat3 mat = kIdentity;
     mat(0, 0) = scale.x;
     mat(1, 1) = scale.y;
     mat(2, 2) = scale.z;
     return mat;
 }
 
-Mat3 Mat3::CreateScaling(float scale, const Vec3& direction) noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::CreateScaling(T scale, const TVec3<T>& direction) noexcept {
     //assert(direction.lengthSquared() == 1 && "The normal vector must be non-zero.");
-    scale -= 1.f;
-    const float x    = direction.x * scale;
-    const float y    = direction.y * scale;
-    const float z    = direction.z * scale;
-    const float axay = x * direction.y;
-    const float axaz = x * direction.z;
-    const float ayaz = y * direction.z;
-    const float m00  = x * direction.x + 1.f;
-    const float m11  = y * direction.y + 1.f;
-    const float m22  = z * direction.z + 1.f;
+    scale -= T(1);
+    const T x    = direction.x * scale;
+    const T y    = direction.y * scale;
+    const T z    = direction.z * scale;
+    const T axay = x * direction.y;
+    const T axaz = x * direction.z;
+    const T ayaz = y * direction.z;
+    const T m00  = x * direction.x + T(1);
+    const T m11  = y * direction.y + T(1);
+    const T m22  = z * direction.z + T(1);
     return {
       // clang-format off
         m00,  axay, axaz,
@@ -135,39 +152,43 @@ Mat3 Mat3::CreateScaling(float scale, const Vec3& direction) noexcept {
     };
 }
 
-Mat3 Mat3::CreateRotationX(const Angle& angle) noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::CreateRotationX(const Angle& angle) noexcept {
     // 1      0    0
     // 0 cos(a) -sin(a)
     // 0 sin(a)  cos(a)
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
     return {1, 0, 0, 0, cos, -sin, 0, sin, cos};
 }
 
-Mat3 Mat3::CreateRotationY(const Angle& angle) noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::CreateRotationY(const Angle& angle) noexcept {
     // cos(a)   0   sin(a)
     //      0   1     0
     // -sin(a)  0   cos(a)
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
     return {cos, 0, sin, 0, 1, 0, -sin, 0, cos};
 }
 
-Mat3 Mat3::CreateRotationZ(const Angle& angle) noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::CreateRotationZ(const Angle& angle) noexcept {
     // cos(a) -sin(a)  0
     // sin(a)  cos(a)  0
     //     0       0   1
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
     return {cos, -sin, 0, sin, cos, 0, 0, 0, 1};
 }
 
-Mat3 Mat3::CreateRotation(Angle angle, const Vec3& axis) noexcept {
-    const float cos         = std::cos(angle);
-    const float sin         = std::sin(angle);
-    const float oneMinusCos = 1 - cos;
-    const Vec3  axisNorm    = axis.normalize();
-    Mat3        rot;
+template <typename T>
+TMat3<T> TMat3<T>::CreateRotation(Angle angle, const TVec3<T>& axis) noexcept {
+    const T        cos         = std::cos(static_cast<T>(angle.asRadians()));
+    const T        sin         = std::sin(static_cast<T>(angle.asRadians()));
+    const T        oneMinusCos = 1 - cos;
+    const TVec3<T> axisNorm    = axis.normalize();
+    TMat3          rot;
     // First row
     rot(0, 0) = cos + oneMinusCos * (axisNorm.x * axisNorm.x);
     rot(0, 1) = axisNorm.x * axisNorm.y * oneMinusCos - axisNorm.z * sin;
@@ -185,17 +206,18 @@ Mat3 Mat3::CreateRotation(Angle angle, const Vec3& axis) noexcept {
     return rot;
 }
 
-Mat3 Mat3::CreateReflection(const Vec3& normal) noexcept {
+template <typename T>
+TMat3<T> TMat3<T>::CreateReflection(const TVec3<T>& normal) noexcept {
     assert(normal.lengthSquared() == 1 && "The normal vector must be non-zero.");
-    const float x    = normal.x * -2.f;
-    const float y    = normal.y * -2.f;
-    const float z    = normal.z * -2.f;
-    const float axay = x * normal.y;
-    const float axaz = x * normal.z;
-    const float ayaz = y * normal.z;
-    const float m00  = x * normal.x + 1.f;
-    const float m11  = y * normal.y + 1.f;
-    const float m22  = z * normal.z + 1.f;
+    const T x    = normal.x * -T(2);
+    const T y    = normal.y * -T(2);
+    const T z    = normal.z * -T(2);
+    const T axay = x * normal.y;
+    const T axaz = x * normal.z;
+    const T ayaz = y * normal.z;
+    const T m00  = x * normal.x + T(1);
+    const T m11  = y * normal.y + T(1);
+    const T m22  = z * normal.z + T(1);
     return {
       // clang-format off
         m00,  axay, axaz,
@@ -205,4 +227,18 @@ Mat3 Mat3::CreateReflection(const Vec3& normal) noexcept {
     };
 }
 
+template class TMat3<float>;
+template class TMat3<double>;
+
+template Mat3 operator*(const Mat3&, float) noexcept;
+template Mat3d operator*(const Mat3d&, double) noexcept;
+template Mat3 operator*(float, const Mat3&) noexcept;
+template Mat3d operator*(double, const Mat3d&) noexcept;
+template Mat3& operator*=(Mat3&, float) noexcept;
+template Mat3d& operator*=(Mat3d&, double) noexcept;
+template Vec3 operator*(const Mat3&, const Vec3&) noexcept;
+template Vec3d operator*(const Mat3d&, const Vec3d&) noexcept;
+template Vec3 operator*(const Vec3&, const Mat3&) noexcept;
+template Vec3d operator*(const Vec3d&, const Mat3d&) noexcept;
+
 } // namespace fuse
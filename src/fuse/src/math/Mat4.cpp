@@ -2,13 +2,42 @@
 
 #include "fuse/math/Angle.h"
 #include "fuse/math/Vec3.h"
+#include "kernels/Mat4Kernels.h"
 
 #include <assert.h>
 
 namespace fuse {
 
-Mat4 operator*(const Mat4& mat, float value) noexcept {
-    Mat4 result;
+namespace {
+
+// The float and double kernels have distinct names (the runtime dispatch needs a single function
+// per name), these overloads select the kernel from the scalar type.
+
+void mat4Mul(const float* a, const float* b, float* out) noexcept {
+    kernels::active::mat4Mul(a, b, out);
+}
+
+void mat4Mul(const double* a, const double* b, double* out) noexcept {
+    kernels::active::mat4dMul(a, b, out);
+}
+
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept {
+    kernels::active::mat4MulVec4(m, v, out);
+}
+
+void mat4MulVec4(const double* m, const double* v, double* out) noexcept {
+    kernels::active::mat4dMulVec4(m, v, out);
+}
+
+void mat4Inverse(const float* m, float* out) noexcept { kernels::active::mat4Inverse(m, out); }
+
+void mat4Inverse(const double* m, double* out) noexcept { kernels::active::mat4dInverse(m, out); }
+
+} // namespace
+
+template <typename T>
+TMat4<T> operator*(const TMat4<T>& mat, std::type_identity_t<T> value) noexcept {
+    TMat4<T> result;
     for (unsigned i = 0; i < 4; i++) {
         for (unsigned j = 0; j < 4; j++) {
             result(i, j) = mat(i, j) * value;
@@ -17,19 +46,25 @@ Mat4 operator*(const Mat4& mat, float value) noexcept {
     return result;
 }
 
-Mat4 operator*(float value, const Mat4& mat) noexcept { return mat * value; }
+template <typename T>
+TMat4<T> operator*(std::type_identity_t<T> value, const TMat4<T>& mat) noexcept {
+    return mat * value;
+}
 
-Mat4& operator*=(Mat4& mat, float value) noexcept { return mat = mat * value; }
+template <typename T>
+TMat4<T>& operator*=(TMat4<T>& mat, std::type_identity_t<T> value) noexcept {
+    return mat = mat * value;
+}
 
-Vec4 operator*(const Mat4& m, const Vec4& v) noexcept {
-    const auto x = m(0, 0) * v.x + m(0, 1) * v.y + m(0, 2) * v.z + m(0, 3) * v.w;
-    const auto y = m(1, 0) * v.x + m(1, 1) * v.y + m(1, 2) * v.z + m(1, 3) * v.w;
-    const auto z = m(2, 0) * v.x + m(2, 1) * v.y + m(2, 2) * v.z + m(2, 3) * v.w;
-    const auto w = m(3, 0) * v.x + m(3, 1) * v.y + m(3, 2) * v.z + m(3, 3) * v.w;
-    return {x, y, z, w};
+template <typename T>
+TVec4<T> operator*(const TMat4<T>& m, const TVec4<T>& v) noexcept {
+    TVec4<T> result;
+    mat4MulVec4(m.data(), &v.x, &result.x);
+    return result;
 }
 
-Vec4 operator*(const Vec4& v, const Mat4& m) noexcept {
+template <typename T>
+TVec4<T> operator*(const TVec4<T>& v, const TMat4<T>& m) noexcept {
     const auto x = v.x * m(0, 0) + v.y * m(1, 0) + v.z * m(2, 0) + v.w * m(3, 0);
     const auto y = v.x * m(0, 1) + v.y * m(1, 1) + v.z * m(2, 1) + v.w * m(3, 1);
     const auto z = v.x * m(0, 2) + v.y * m(1, 2) + v.z * m(2, 2) + v.w * m(3, 2);
@@ -37,13 +72,17 @@ Vec4 operator*(const Vec4& v, const Mat4& m) noexcept {
     return {x, y, z, w};
 }
 
-Mat4& Mat4::operator+=(const Mat4& other) noexcept { return *this = *this + other; }
+template <typename T>
+TMat4<T>& TMat4<T>::operator+=(const TMat4& other) noexcept { return *this = *this + other; }
 
-Mat4& Mat4::operator-=(const Mat4& other) noexcept { return *this = *this - other; }
+template <typename T>
+TMat4<T>& TMat4<T>::operator-=(const TMat4& other) noexcept { return *this = *this - other; }
 
-Mat4& Mat4::operator*=(const Mat4& other) noexcept { return *this = *this * other; }
+template <typename T>
+TMat4<T>& TMat4<T>::operator*=(const TMat4& other) noexcept { return *this = *this * other; }
 
-Mat4 Mat4::operator+(const Mat4& other) const noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::operator+(const TMat4& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) + other(0, 0);
     const auto  m01 = m(0, 1) + other(0, 1);
@@ -74,7 +113,8 @@ Mat4 Mat4::operator+(const Mat4& other) const noexcept {
     };
 }
 
-Mat4 Mat4::operator-(const Mat4& other) const noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::operator-(const TMat4& other) const noexcept {
     const auto& m   = *this;
     const auto  m00 = m(0, 0) - other(0, 0);
     const auto  m01 = m(0, 1) - other(0, 1);
@@ -105,88 +145,75 @@ Mat4 Mat4::operator-(const Mat4& other) const noexcept {
     };
 }
 
-Mat4 Mat4::operator*(const Mat4& other) const noexcept {
-    const auto& m = *this;
-    // clang-format off
-    const auto m00 = m(0, 0) * other(0, 0) + m(0, 1) * other(1, 0) + m(0, 2) * other(2, 0) + m(0, 3) * other(3, 0);
-    const auto m01 = m(0, 0) * other(0, 1) + m(0, 1) * other(1, 1) + m(0, 2) * other(2, 1) + m(0, 3) * other(3, 1);
-    const auto m02 = m(0, 0) * other(0, 2) + m(0, 1) * other(1, 2) + m(0, 2) * other(2, 2) + m(0, 3) * other(3, 2);
-    const auto m03 = m(0, 0) * other(0, 3) + m(0, 1) * other(1, 3) + m(0, 2) * other(2, 3) + m(0, 3) * other(3, 3);
-
-    const auto m10 = m(1, 0) * other(0, 0) + m(1, 1) * other(1, 0) + m(1, 2) * other(2, 0) + m(1, 3) * other(3, 0);
-    const auto m11 = m(1, 0) * other(0, 1) + m(1, 1) * other(1, 1) + m(1, 2) * other(2, 1) + m(1, 3) * other(3, 1);
-    const auto m12 = m(1, 0) * other(0, 2) + m(1, 1) * other(1, 2) + m(1, 2) * other(2, 2) + m(1, 3) * other(3, 2);
-    const auto m13 = m(1, 0) * other(0, 3) + m(1, 1) * other(1, 3) + m(1, 2) * other(2, 3) + m(1, 3) * other(3, 3);
-
-    const auto m20 = m(2, 0) * other(0, 0) + m(2, 1) * other(1, 0) + m(2, 2) * other(2, 0) + m(2, 3) * other(3, 0);
-    const auto m21 = m(2, 0) * other(0, 1) + m(2, 1) * other(1, 1) + m(2, 2) * other(2, 1) + m(2, 3) * other(3, 1);
-    const auto m22 = m(2, 0) * other(0, 2) + m(2, 1) * other(1, 2) + m(2, 2) * other(2, 2) + m(2, 3) * other(3, 2);
-    const auto m23 = m(2, 0) * other(0, 3) + m(2, 1) * other(1, 3) + m(2, 2) * other(2, 3) + m(2, 3) * other(3, 3);
-
-    const auto m30 = m(3, 0) * other(0, 0) + m(3, 1) * other(1, 0) + m(3, 2) * other(2, 0) + m(3, 3) * other(3, 0);
-    const auto m31 = m(3, 0) * other(0, 1) + m(3, 1) * other(1, 1) + m(3, 2) * other(2, 1) + m(3, 3) * other(3, 1);
-    const auto m32 = m(3, 0) * other(0, 2) + m(3, 1) * other(1, 2) + m(3, 2) * other(2, 2) + m(3, 3) * other(3, 2);
-    const auto m33 = m(3, 0) * other(0, 3) + m(3, 1) * other(1, 3) + m(3, 2) * other(2, 3) + m(3, 3) * other(3, 3);
-    return {
-        m00, m01, m02, m03,
-        m10, m11, m12, m13,
-        m20, m21, m22, m23,
-        m30, m31, m32, m33
-    };
-    // clang-format on
+template <typename T>
+TMat4<T> TMat4<T>::operator*(const TMat4& other) const noexcept {
+    TMat4<T> result;
+    mat4Mul(data(), other.data(), result.data());
+    return result;
+}
+
+template <typename T>
+TMat4<T> TMat4<T>::inverse() const noexcept {
+    TMat4<T> result;
+    mat4Inverse(data(), result.data());
+    return result;
 }
 
 // =========================================================
 //                      Transform
 // =========================================================
 
-Mat4 Mat4::CreateTranslation(const Vec3& translation) noexcept {
-    Mat4 mat  = Mat4::kIdentity;
+template <typename T>
+TMat4<T> TMat4<T>::CreateTranslation(const TVec3<T>& translation) noexcept {
+    TMat4 mat = kIdentity;
     mat(0, 3) = translation.x;
     mat(1, 3) = translation.y;
     mat(2, 3) = translation.z;
     return mat;
 }
 
-Mat4 Mat4::CreateScaling(const Vec3& scale) noexcept {
-    Mat4 mat  = Mat4::kIdentity;
+template <typename T>
+TMat4<T> TMat4<T>::CreateScaling(const TVec3<T>& scale) noexcept {
+    TMat4 mat = kIdentity;
     mat(0, 0) = scale.x;
     mat(1, 1) = scale.y;
     mat(2, 2) = scale.z;
     return mat;
 }
 
-Mat4 Mat4::CreateScaling(float scale, const Vec3& direction) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateScaling(T scale, const TVec3<T>& direction) noexcept {
     //assert(direction.lengthSquared() == 1 && "The normal vector must be non-zero.");
-    scale -= 1.f;
-    const float x    = direction.x * scale;
-    const float y    = direction.y * scale;
-    const float z    = direction.z * scale;
-    const float axay = x * direction.y;
-    const float axaz = x * direction.z;
-    const float ayaz = y * direction.z;
-    const float m00  = x * direction.x + 1.f;
-    const float m11  = y * direction.y + 1.f;
-    const float m22  = z * direction.z + 1.f;
+    scale -= T(1);
+    const T x    = direction.x * scale;
+    const T y    = direction.y * scale;
+    const T z    = direction.z * scale;
+    const T axay = x * direction.y;
+    const T axaz = x * direction.z;
+    const T ayaz = y * direction.z;
+    const T m00  = x * direction.x + T(1);
+    const T m11  = y * direction.y + T(1);
+    const T m22  = z * direction.z + T(1);
     return {
       // clang-format off
-        m00,  axay, axaz, 0.f,
-        axay, m11,  ayaz, 0.f,
-        axaz, ayaz,  m22, 0.f,
-           0,    0,    0, 1.f
+        m00,  axay, axaz, 0,
+        axay, m11,  ayaz, 0,
+        axaz, ayaz,  m22, 0,
+           0,    0,    0, 1
       // clang-format on
     };
 }
 
-Mat4 Mat4::CreateRotationX(const Angle& angle) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateRotationX(const Angle& angle) noexcept {
     // 1      0    0    0
     // 0 cos(a) -sin(a) 0
     // 0 sin(a)  cos(a) 0
     // 0      0     1   1
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
 
-    Mat4 rot  = Mat4::kIdentity;
+    TMat4 rot = kIdentity;
     rot(1, 1) = cos;
     rot(1, 2) = -sin;
     rot(2, 1) = sin;
@@ -194,15 +221,16 @@ Mat4 Mat4::CreateRotationX(const Angle& angle) noexcept {
     return rot;
 }
 
-Mat4 Mat4::CreateRotationY(const Angle& angle) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateRotationY(const Angle& angle) noexcept {
     // cos(a)   0   sin(a)  0
     //      0   1     0     0
     // -sin(a)  0   cos(a)  0
     //    0     0     1     1
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
 
-    Mat4 rot  = Mat4::kIdentity;
+    TMat4 rot = kIdentity;
     rot(0, 0) = cos;
     rot(0, 2) = sin;
     rot(2, 0) = -sin;
@@ -210,15 +238,16 @@ Mat4 Mat4::CreateRotationY(const Angle& angle) noexcept {
     return rot;
 }
 
-Mat4 Mat4::CreateRotationZ(const Angle& angle) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateRotationZ(const Angle& angle) noexcept {
     // cos(a) -sin(a)  0  0
     // sin(a)  cos(a)  0  0
     //     0       0   1  0
     //     0       0   0  1
-    const float sin = std::sin(angle);
-    const float cos = std::cos(angle);
+    const T sin = std::sin(static_cast<T>(angle.asRadians()));
+    const T cos = std::cos(static_cast<T>(angle.asRadians()));
 
-    Mat4 rot  = Mat4::kIdentity;
+    TMat4 rot = kIdentity;
     rot(0, 0) = cos;
     rot(0, 1) = -sin;
     rot(1, 0) = sin;
@@ -226,12 +255,13 @@ Mat4 Mat4::CreateRotationZ(const Angle& angle) noexcept {
     return rot;
 }
 
-Mat4 Mat4::CreateRotation(Angle angle, const Vec3& axis) noexcept {
-    const float cos         = std::cos(angle);
-    const float sin         = std::sin(angle);
-    const float oneMinusCos = 1 - cos;
-    const Vec3  axisNorm    = axis.normalize();
-    Mat4        rot         = Mat4::kIdentity;
+template <typename T>
+TMat4<T> TMat4<T>::CreateRotation(Angle angle, const TVec3<T>& axis) noexcept {
+    const T        cos         = std::cos(static_cast<T>(angle.asRadians()));
+    const T        sin         = std::sin(static_cast<T>(angle.asRadians()));
+    const T        oneMinusCos = 1 - cos;
+    const TVec3<T> axisNorm    = axis.normalize();
+    TMat4          rot         = kIdentity;
     // First row
     rot(0, 0) = cos + oneMinusCos * (axisNorm.x * axisNorm.x);
     rot(0, 1) = axisNorm.x * axisNorm.y * oneMinusCos - axisNorm.z * sin;
@@ -249,23 +279,24 @@ Mat4 Mat4::CreateRotation(Angle angle, const Vec3& axis) noexcept {
     return rot;
 }
 
-Mat4 Mat4::CreateReflection(const Vec3& normal) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateReflection(const TVec3<T>& normal) noexcept {
     assert(normal.lengthSquared() == 1 && "The normal vector must be non-zero.");
-    const float x    = normal.x * -2.f;
-    const float y    = normal.y * -2.f;
-    const float z    = normal.z * -2.f;
-    const float axay = x * normal.y;
-    const float axaz = x * normal.z;
-    const float ayaz = y * normal.z;
-    const float m00  = x * normal.x + 1.f;
-    const float m11  = y * normal.y + 1.f;
-    const float m22  = z * normal.z + 1.f;
+    const T x    = normal.x * -T(2);
+    const T y    = normal.y * -T(2);
+    const T z    = normal.z * -T(2);
+    const T axay = x * normal.y;
+    const T axaz = x * normal.z;
+    const T ayaz = y * normal.z;
+    const T m00  = x * normal.x + T(1);
+    const T m11  = y * normal.y + T(1);
+    const T m22  = z * normal.z + T(1);
     return {
       // clang-format off
-        m00,  axay, axaz, 0.f,
-        axay,  m11, ayaz, 0.f,
-        axaz, ayaz,  m22, 0.f,
-         0.f,  0.f,  0.f, 1.f
+        m00,  axay, axaz, 0,
+        axay,  m11, ayaz, 0,
+        axaz, ayaz,  m22, 0,
+           0,    0,    0, 1
       // clang-format on
     };
 }
@@ -274,8 +305,9 @@ Mat4 Mat4::CreateReflection(const Vec3& normal) noexcept {
 //                   View matrix
 // ======================================================
 
-Mat4 Mat4::CreateViewLookAt(const Vec3& position, const Vec3& target,
-                            const Vec3& upVector) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateViewLookAt(const TVec3<T>& position, const TVec3<T>& target,
+                                     const TVec3<T>& upVector) noexcept {
     assert(target != position);
     // View matrix
     //   Rx  Ry  Rz -Tx
@@ -293,7 +325,7 @@ Mat4 Mat4::CreateViewLookAt(const Vec3& position, const Vec3& target,
     const auto xAxis = upVector.cross(zAxis).normalize(); // The "right" vector.
     const auto yAxis = zAxis.cross(xAxis).normalize();    // The "up" vector.
 
-    Mat4 mat = Mat4::kIdentity;
+    TMat4 mat = kIdentity;
     // set the rotation part.
     mat(0, 0) = xAxis.x;
     mat(0, 1) = xAxis.y;
@@ -312,15 +344,16 @@ Mat4 Mat4::CreateViewLookAt(const Vec3& position, const Vec3& target,
     mat(1, 3) = -yAxis.dot(position);
     mat(2, 3) = -zAxis.dot(position);
 
-    mat(3, 0) = 0.0f;
-    mat(3, 1) = 0.0f;
-    mat(3, 2) = 0.0f;
-    mat(3, 3) = 1.0f;
+    mat(3, 0) = T(0);
+    mat(3, 1) = T(0);
+    mat(3, 2) = T(0);
+    mat(3, 3) = T(1);
     return mat;
 }
 
-Mat4 Mat4::CreateViewLookTo(const Vec3& position, const Vec3& direction,
-                            const Vec3& upVector) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateViewLookTo(const TVec3<T>& position, const TVec3<T>& direction,
+                                     const TVec3<T>& upVector) noexcept {
 
     const auto target = position + direction;
     return CreateViewLookAt(position, target, upVector);
@@ -330,17 +363,19 @@ Mat4 Mat4::CreateViewLookTo(const Vec3& position, const Vec3& direction,
 //                  Projection matrix
 // ======================================================
 
-Mat4 Mat4::ProjOrtho(float width, float height, float near, float far) noexcept {
-    return ProjOrthoOffCenter(-width * 0.5f,
-                              width * 0.5f,
-                              -height * 0.5f,
-                              height * 0.5f,
+template <typename T>
+TMat4<T> TMat4<T>::ProjOrtho(T width, T height, T near, T far) noexcept {
+    return ProjOrthoOffCenter(-width * T(0.5),
+                              width * T(0.5),
+                              -height * T(0.5),
+                              height * T(0.5),
                               near,
                               far);
 }
 
-Mat4 Mat4::ProjOrthoOffCenter(float left, float right, float bottom, float top, float near /* =-1*/,
-                              float far /*= 1*/) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::ProjOrthoOffCenter(T left, T right, T bottom, T top, T near /* =-1*/,
+                                       T far /*= 1*/) noexcept {
     // ============================================================
     //  P = A(ATA)−1AT
     //  The projection matrix will be defined as fallow
@@ -360,45 +395,46 @@ Mat4 Mat4::ProjOrthoOffCenter(float left, float right, float bottom, float top,
     //
     // ============================================================
 
-    const float width  = (right - left);
-    const float height = (top - bottom);
-    const float depth  = (far - near);
+    const T width  = (right - left);
+    const T height = (top - bottom);
+    const T depth  = (far - near);
 
-    const float invWidth  = 1.0f / width;
-    const float invHeight = 1.0f / height;
-    const float invDepth  = 1.0f / depth;
+    const T invWidth  = T(1) / width;
+    const T invHeight = T(1) / height;
+    const T invDepth  = T(1) / depth;
 
     // compute the translation
-    const float tx = -(right + left) * invWidth;
-    const float ty = -(top + bottom) * invHeight;
-    const float tz = -(far + near) * invDepth;
+    const T tx = -(right + left) * invWidth;
+    const T ty = -(top + bottom) * invHeight;
+    const T tz = -(far + near) * invDepth;
 
-    Mat4 mat;
+    TMat4 mat;
 
-    mat(0, 0) = 2.0f * invWidth;
-    mat(0, 1) = 0.0f;
-    mat(0, 2) = 0.0f;
+    mat(0, 0) = T(2) * invWidth;
+    mat(0, 1) = T(0);
+    mat(0, 2) = T(0);
     mat(0, 3) = tx;
 
-    mat(1, 0) = 0.0f;
-    mat(1, 1) = 2.0f * invHeight;
-    mat(1, 2) = 0.0f;
+    mat(1, 0) = T(0);
+    mat(1, 1) = T(2) * invHeight;
+    mat(1, 2) = T(0);
     mat(1, 3) = ty;
 
-    mat(2, 0) = 0.0f;
-    mat(2, 1) = 0.0f;
-    mat(2, 2) = -2.0f * invDepth;
+    mat(2, 0) = T(0);
+    mat(2, 1) = T(0);
+    mat(2, 2) = -T(2) * invDepth;
     mat(2, 3) = tz;
 
-    mat(3, 0) = 0.0f;
-    mat(3, 1) = 0.0f;
-    mat(3, 2) = 0.0f;
-    mat(3, 3) = 1.0f;
+    mat(3, 0) = T(0);
+    mat(3, 1) = T(0);
+    mat(3, 2) = T(0);
+    mat(3, 3) = T(1);
     return mat;
 }
 
-Mat4 Mat4::CreateProjectionPerspectiveOffCenter(float left, float right, float bottom, float top,
-                                                float zNear, float zFar) noexcept {
+template <typename T>
+TMat4<T> TMat4<T>::CreateProjectionPerspectiveOffCenter(T left, T right, T bottom, T top,
+                                                         T zNear, T zFar) noexcept {
     // ============================================================
     //
     //  The projection matrix will be defined as fallow
@@ -421,32 +457,33 @@ Mat4 Mat4::CreateProjectionPerspectiveOffCenter(float left, float right, float b
     assert(zFar > 0);
     assert(zNear != 0);
 
-    const float width     = right - left;
-    const float height    = top - bottom;
-    const float depth     = zFar - zNear;
-    const float invWidth  = 1.0f / width;
-    const float invHeight = 1.0f / height;
-    const float invDepth  = 1.0f / depth;
-
-    const float a = 2.0f * zNear * invWidth;
-    const float b = (right + left) * invWidth;
-    const float c = 2.0f * zNear * invHeight;
-    const float d = (top + bottom) * invHeight;
-    const float e = -(zFar + zNear) * invDepth;
-    const float f = -2.0f * zFar * zNear * invDepth;
-
-    Mat4 matrix = Mat4::kIdentity;
+    const T width     = right - left;
+    const T height    = top - bottom;
+    const T depth     = zFar - zNear;
+    const T invWidth  = T(1) / width;
+    const T invHeight = T(1) / height;
+    const T invDepth  = T(1) / depth;
+
+    const T a = T(2) * zNear * invWidth;
+    const T b = (right + left) * invWidth;
+    const T c = T(2) * zNear * invHeight;
+    const T d = (top + bottom) * invHeight;
+    const T e = -(zFar + zNear) * invDepth;
+    const T f = -T(2) * zFar * zNear * invDepth;
+
+    TMat4 matrix = kIdentity;
     // clang-format off
-    matrix(0, 0) = a;    matrix(0, 1) = 0.0f; matrix(0, 2) =  b;   matrix(0, 3) = 0.0f;
-    matrix(1, 0) = 0.0f; matrix(1, 1) = c;    matrix(1, 2) =  d;   matrix(1, 3) = 0.0f;
-    matrix(2, 0) = 0.0f; matrix(2, 1) = 0.0f; matrix(2, 2) =  e;   matrix(2, 3) = f;
-    matrix(3, 0) = 0.0f; matrix(3, 1) = 0.0f; matrix(3, 2) = -1.f; matrix(3, 3) = 0.0f;
+    matrix(0, 0) = a; matrix(0, 1) = 0; matrix(0, 2) =  b; matrix(0, 3) = 0;
+    matrix(1, 0) = 0; matrix(1, 1) = c; matrix(1, 2) =  d; matrix(1, 3) = 0;
+    matrix(2, 0) = 0; matrix(2, 1) = 0; matrix(2, 2) =  e; matrix(2, 3) = f;
+    matrix(3, 0) = 0; matrix(3, 1) = 0; matrix(3, 2) = -1; matrix(3, 3) = 0;
     // clang-format on
     return matrix;
 }
 
-Mat4 Mat4::CreateProjectionPerspectiveFOVX(const Angle& fovx, float aspectRatio, float zNear,
-                                           float zFar) {
+template <typename T>
+TMat4<T> TMat4<T>::CreateProjectionPerspectiveFOVX(const Angle& fovx, T aspectRatio, T zNear,
+                                                    T zFar) {
     // =====================================
     // Frustum view from top
     //
@@ -470,8 +507,8 @@ Mat4 Mat4::CreateProjectionPerspectiveFOVX(const Angle& fovx, float aspectRatio,
     //  tan(a) = w / n => w = n * tan(a)
     //
     // =====================================
-    const float nearHalfWidth  = zNear * std::tan(0.5f * fovx);
-    const float nearHalfHeight = nearHalfWidth / aspectRatio;
+    const T nearHalfWidth  = zNear * std::tan(static_cast<T>((0.5f * fovx).asRadians()));
+    const T nearHalfHeight = nearHalfWidth / aspectRatio;
     return CreateProjectionPerspectiveOffCenter(-nearHalfWidth,
                                                 nearHalfWidth,
                                                 -nearHalfHeight,
@@ -480,8 +517,9 @@ Mat4 Mat4::CreateProjectionPerspectiveFOVX(const Angle& fovx, float aspectRatio,
                                                 zFar);
 }
 
-Mat4 Mat4::CreateProjectionPerspectiveFOVY(const Angle& fovY, float aspectRatio, float zNear,
-                                           float zFar) {
+template <typename T>
+TMat4<T> TMat4<T>::CreateProjectionPerspectiveFOVY(const Angle& fovY, T aspectRatio, T zNear,
+                                                    T zFar) {
     // =====================================
     //  Frustum view from side
     //
@@ -503,8 +541,8 @@ Mat4 Mat4::CreateProjectionPerspectiveFOVY(const Angle& fovY, float aspectRatio,
     // By definition tan(x) = opposite / adjacent so,
     //  tan(a) = h / n => h = n * tan(a)
     // =====================================
-    const float nearHalfHeight = zNear * std::tan(fovY * 0.5f);
-    const float nearHalfWidth  = nearHalfHeight * aspectRatio;
+    const T nearHalfHeight = zNear * std::tan(static_cast<T>((fovY * 0.5f).asRadians()));
+    const T nearHalfWidth  = nearHalfHeight * aspectRatio;
     return CreateProjectionPerspectiveOffCenter(-nearHalfWidth,
                                                 nearHalfWidth,
                                                 -nearHalfHeight,
@@ -513,5 +551,18 @@ Mat4 Mat4::CreateProjectionPerspectiveFOVY(const Angle& fovY, float aspectRatio,
                                                 zFar);
 }
 
+template class TMat4<float>;
+template class TMat4<double>;
+
+template Mat4 operator*(const Mat4&, float) noexcept;
+template Mat4d operator*(const Mat4d&, double) noexcept;
+template Mat4 operator*(float, const Mat4&) noexcept;
+template Mat4d operator*(double, const Mat4d&) noexcept;
+template Mat4& operator*=(Mat4&, float) noexcept;
+template Mat4d& operator*=(Mat4d&, double) noexcept;
+template Vec4 operator*(const Mat4&, const Vec4&) noexcept;
+template Vec4d operator*(const Mat4d&, const Vec4d&) noexcept;
+template Vec4 operator*(const Vec4&, const Mat4&) noexcept;
+template Vec4d operator*(const Vec4d&, const Mat4d&) noexcept;
 
 } // namespace fuse
@@ -2,80 +2,87 @@
 
 #include "fuse/math/Angle.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace fuse {
 
-Quaternion::Quaternion(const Vec3& axis, const Angle& angle) noexcept {
+template <typename T>
+TQuaternion<T>::TQuaternion(const TVec3<T>& axis, const Angle& angle) noexcept {
     fromAxisAngle(axis, angle);
 }
 
-std::array<Vec3, 3> Quaternion::axis() const noexcept {
+template <typename T>
+std::array<TVec3<T>, 3> TQuaternion<T>::axis() const noexcept {
     // Ensure quaternion is normalized to produce orthonormal axes
-    //const float len = std::sqrt(x * x + y * y + z * z + w * w);
-    float qx = x;
-    float qy = y;
-    float qz = z;
-    float qw = w;
-    //if (len > 0.f) {
-    //    const float inv = 1.f / len;
+    //const T len = std::sqrt(x * x + y * y + z * z + w * w);
+    T qx = x;
+    T qy = y;
+    T qz = z;
+    T qw = w;
+    //if (len > 0) {
+    //    const T inv = 1 / len;
     //    qx *= inv;
     //    qy *= inv;
     //    qz *= inv;
     //    qw *= inv;
     //}
 
-    const float xx = qx * qx;
-    const float yy = qy * qy;
-    const float zz = qz * qz;
-    const float xy = qx * qy;
-    const float xz = qx * qz;
-    const float yz = qy * qz;
-    const float wx = qw * qx;
-    const float wy = qw * qy;
-    const float wz = qw * qz;
+    const T xx = qx * qx;
+    const T yy = qy * qy;
+    const T zz = qz * qz;
+    const T xy = qx * qy;
+    const T xz = qx * qz;
+    const T yz = qy * qz;
+    const T wx = qw * qx;
+    const T wy = qw * qy;
+    const T wz = qw * qz;
 
-    const float m00 = 1.f - 2.f * (yy + zz);
-    const float m01 = 2.f * (xy - wz);
-    const float m02 = 2.f * (xz + wy);
+    const T m00 = 1 - 2 * (yy + zz);
+    const T m01 = 2 * (xy - wz);
+    const T m02 = 2 * (xz + wy);
 
-    const float m10 = 2.f * (xy + wz);
-    const float m11 = 1.f - 2.f * (xx + zz);
-    const float m12 = 2.f * (yz - wx);
+    const T m10 = 2 * (xy + wz);
+    const T m11 = 1 - 2 * (xx + zz);
+    const T m12 = 2 * (yz - wx);
 
-    const float m20 = 2.f * (xz - wy);
-    const float m21 = 2.f * (yz + wx);
-    const float m22 = 1.f - 2.f * (xx + yy);
+    const T m20 = 2 * (xz - wy);
+    const T m21 = 2 * (yz + wx);
+    const T m22 = 1 - 2 * (xx + yy);
 
     // Return columns of the rotation matrix as the rotated basis axes
-    return {Vec3(m00, m10, m20), Vec3(m01, m11, m21), Vec3(m02, m12, m22)};
+    return {TVec3<T>(m00, m10, m20), TVec3<T>(m01, m11, m21), TVec3<T>(m02, m12, m22)};
 }
 
-Vec3 Quaternion::axisX() const noexcept {
-    return {1.f - 2.f * (y * y + z * z), 2.f * (x * y + w * z), 2.f * (x * z - w * y)};
+template <typename T>
+TVec3<T> TQuaternion<T>::axisX() const noexcept {
+    return {1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y)};
 }
 
-Vec3 Quaternion::axisY() const noexcept {
-    return {2.f * (x * y - w * z), 1.f - 2.f * (x * x + z * z), 2.f * (y * z + w * x)};
+template <typename T>
+TVec3<T> TQuaternion<T>::axisY() const noexcept {
+    return {2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x)};
 }
 
-Vec3 Quaternion::axisZ() const noexcept {
-    return {2.f * (x * z + w * y), 2.f * (y * z - w * x), 1.f - 2.f * (x * x + y * y)};
+template <typename T>
+TVec3<T> TQuaternion<T>::axisZ() const noexcept {
+    return {2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y)};
 }
 
-Mat3 Quaternion::asMatrix() const noexcept {
-    const float xx  = x * x;
-    const float yy  = y * y;
-    const float zz  = z * z;
-    const float m00 = 1 - 2 * yy - 2 * zz;
-    const float m01 = 2 * x * y - 2 * w * z;
-    const float m02 = 2 * x * z + 2 * w * y;
-    const float m10 = 2 * x * y + 2 * w * z;
-    const float m11 = 1 - 2 * xx - 2 * zz;
-    const float m12 = 2 * y * z - 2 * w * x;
-    const float m20 = 2 * x * z - 2 * w * y;
-    const float m21 = 2 * y * z + 2 * w * x;
-    const float m22 = 1 - 2 * xx - 2 * yy;
+template <typename T>
+TMat3<T> TQuaternion<T>::asMatrix() const noexcept {
+    const T xx  = x * x;
+    const T yy  = y * y;
+    const T zz  = z * z;
+    const T m00 = 1 - 2 * yy - 2 * zz;
+    const T m01 = 2 * x * y - 2 * w * z;
+    const T m02 = 2 * x * z + 2 * w * y;
+    const T m10 = 2 * x * y + 2 * w * z;
+    const T m11 = 1 - 2 * xx - 2 * zz;
+    const T m12 = 2 * y * z - 2 * w * x;
+    const T m20 = 2 * x * z - 2 * w * y;
+    const T m21 = 2 * y * z + 2 * w * x;
+    const T m22 = 1 - 2 * xx - 2 * yy;
     return {
       // clang-format off
         m00, m01, m02,
@@ -85,85 +92,124 @@ Mat3 Quaternion::asMatrix() const noexcept {
     };
 }
 
-void Quaternion::setMatrix(const Mat3& rot) noexcept {
+template <typename T>
+void TQuaternion<T>::setMatrix(const TMat3<T>& rot) noexcept {
     // from Foundations of Game Engine Development Volume 1 Mathematics
-    const float m00   = rot(0, 0);
-    const float m11   = rot(1, 1);
-    const float m22   = rot(2, 2);
-    const float trace = m00 + m11 + m22;
-    if (trace > 0.0F) {
-        w             = std::sqrt(trace + 1.0f) * 0.5f;
-        const float f = 0.25F / w;
-        x             = (rot(2, 1) - rot(1, 2)) * f;
-        y             = (rot(0, 2) - rot(2, 0)) * f;
-        z             = (rot(1, 0) - rot(0, 1)) * f;
+    const T m00   = rot(0, 0);
+    const T m11   = rot(1, 1);
+    const T m22   = rot(2, 2);
+    const T trace = m00 + m11 + m22;
+    if (trace > 0) {
+        w         = std::sqrt(trace + 1) * T(0.5);
+        const T f = T(0.25) / w;
+        x         = (rot(2, 1) - rot(1, 2)) * f;
+        y         = (rot(0, 2) - rot(2, 0)) * f;
+        z         = (rot(1, 0) - rot(0, 1)) * f;
     } else if ((m00 > m11) && (m00 > m22)) {
-        x             = std::sqrt(m00 - m11 - m22 + 1.0F) * 0.5F;
-        const float f = 0.25F / x;
-        y             = (rot(1, 0) + rot(0, 1)) * f;
-        z             = (rot(0, 2) + rot(2, 0)) * f;
-        w             = (rot(2, 1) - rot(1, 2)) * f;
+        x         = std::sqrt(m00 - m11 - m22 + 1) * T(0.5);
+        const T f = T(0.25) / x;
+        y         = (rot(1, 0) + rot(0, 1)) * f;
+        z         = (rot(0, 2) + rot(2, 0)) * f;
+        w         = (rot(2, 1) - rot(1, 2)) * f;
     } else if (m11 > m22) {
-        y             = std::sqrt(m11 - m00 - m22 + 1.0F) * 0.5F;
-        const float f = 0.25F / y;
-        x             = (rot(1, 0) + rot(0, 1)) * f;
-        z             = (rot(2, 1) + rot(1, 2)) * f;
-        w             = (rot(0, 2) - rot(2, 0)) * f;
+        y         = std::sqrt(m11 - m00 - m22 + 1) * T(0.5);
+        const T f = T(0.25) / y;
+        x         = (rot(1, 0) + rot(0, 1)) * f;
+        z         = (rot(2, 1) + rot(1, 2)) * f;
+        w         = (rot(0, 2) - rot(2, 0)) * f;
     } else {
-        z             = std::sqrt(m22 - m00 - m11 + 1.0F) * 0.5F;
-        const float f = 0.25F / z;
-        x             = (rot(0, 2) + rot(2, 0)) * f;
-        y             = (rot(2, 1) + rot(1, 2)) * f;
-        w             = (rot(1, 0) - rot(0, 1)) * f;
+        z         = std::sqrt(m22 - m00 - m11 + 1) * T(0.5);
+        const T f = T(0.25) / z;
+        x         = (rot(0, 2) + rot(2, 0)) * f;
+        y         = (rot(2, 1) + rot(1, 2)) * f;
+        w         = (rot(1, 0) - rot(0, 1)) * f;
     }
 }
 
-Quaternion& Quaternion::fromAxisAngle(const Vec3& axis, Angle angle) noexcept {
-    const float halfAngle = (angle * 0.5f).asRadians();
-    const float sin       = std::sin(halfAngle);
-    x                     = axis.x * sin;
-    y                     = axis.y * sin;
-    z                     = axis.z * sin;
-    w                     = std::cos(halfAngle);
+template <typename T>
+TQuaternion<T>& TQuaternion<T>::fromAxisAngle(const TVec3<T>& axis, Angle angle) noexcept {
+    const T halfAngle = static_cast<T>((angle * 0.5f).asRadians());
+    const T sin       = std::sin(halfAngle);
+    x                 = axis.x * sin;
+    y                 = axis.y * sin;
+    z                 = axis.z * sin;
+    w                 = std::cos(halfAngle);
     return *this;
 }
 
-void Quaternion::toAxisAngle(Vec3& pAxis, Angle& pAngle) const noexcept {
+template <typename T>
+void TQuaternion<T>::toAxisAngle(TVec3<T>& pAxis, Angle& pAngle) const noexcept {
     // q = cos(A/2) + sin(A/2)*(x*i+y*j+z*k)
 
-    const float sqrLength = x * x + y * y + z * z;
-    if (sqrLength > 0.0f) {
-        pAngle = radians(2.0f * std::acos(w));
+    const T sqrLength = x * x + y * y + z * z;
+    if (sqrLength > 0) {
+        pAngle = radians(static_cast<float>(2 * std::acos(w)));
 
-        const float invLength = 1.f / std::sqrt(sqrLength);
-        pAxis.x               = x * invLength;
-        pAxis.y               = y * invLength;
-        pAxis.z               = z * invLength;
+        const T invLength = 1 / std::sqrt(sqrLength);
+        pAxis.x           = x * invLength;
+        pAxis.y           = y * invLength;
+        pAxis.z           = z * invLength;
     } else {
         // Angle is 0 (mod 2*pi), so any axis will do
         pAngle  = {};
-        pAxis.x = 0.0f;
-        pAxis.y = 0.0f;
-        pAxis.z = 0.0f;
+        pAxis.x = 0;
+        pAxis.y = 0;
+        pAxis.z = 0;
     }
 }
 
-Quaternion Quaternion::MakeRotationX(Angle angle) noexcept {
-    const auto cos = std::cos(angle * 0.5F);
-    const auto sin = std::sin(angle * 0.5F);
-    return {sin, 0.0F, 0.0F, cos};
+template <typename T>
+TQuaternion<T> nlerp(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                     std::type_identity_t<T> t) noexcept {
+    const TQuaternion<T> to = a.dot(b) < 0 ? -1 * b : b;
+    return (a * (1 - t) + to * t).normalize();
 }
 
-Quaternion Quaternion::MakeRotationY(Angle angle) noexcept {
-    const auto cos = std::cos(angle * 0.5F);
-    const auto sin = std::sin(angle * 0.5F);
-    return {0.0F, sin, 0.0F, cos};
+template <typename T>
+TQuaternion<T> slerp(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                     std::type_identity_t<T> t) noexcept {
+    const T cos = std::clamp(a.dot(b), T(-1), T(1));
+    if (cos > T(0.9995)) {
+        // sin(angle) is close to 0, the arc is almost a line.
+        return (a * (1 - t) + b * t).normalize();
+    }
+    const T angle = std::acos(cos);
+    const T sin   = std::sin(angle);
+    return (a * std::sin((1 - t) * angle) + b * std::sin(t * angle)) / sin;
+}
+
+template <typename T>
+TQuaternion<T> slerpShortestPath(const TQuaternion<T>& a, const TQuaternion<T>& b,
+                                 std::type_identity_t<T> t) noexcept {
+    return slerp(a, a.dot(b) < 0 ? -1 * b : b, t);
+}
+
+template <typename T>
+TQuaternion<T> TQuaternion<T>::MakeRotationX(Angle angle) noexcept {
+    const T halfAngle = static_cast<T>((angle * 0.5F).asRadians());
+    return {std::sin(halfAngle), 0, 0, std::cos(halfAngle)};
 }
 
-Quaternion Quaternion::MakeRotationZ(Angle angle) noexcept {
-    const auto cos = std::cos(angle * 0.5F);
-    const auto sin = std::sin(angle * 0.5F);
-    return {0.0F, 0.0F, sin, cos};
+template <typename T>
+TQuaternion<T> TQuaternion<T>::MakeRotationY(Angle angle) noexcept {
+    const T halfAngle = static_cast<T>((angle * 0.5F).asRadians());
+    return {0, std::sin(halfAngle), 0, std::cos(halfAngle)};
 }
 
+template <typename T>
+TQuaternion<T> TQuaternion<T>::MakeRotationZ(Angle angle) noexcept {
+    const T halfAngle = static_cast<T>((angle * 0.5F).asRadians());
+    return {0, 0, std::sin(halfAngle), std::cos(halfAngle)};
+}
+
+template struct TQuaternion<float>;
+template struct TQuaternion<double>;
+
+template Quaternion nlerp(const Quaternion&, const Quaternion&, float) noexcept;
+template Quaterniond nlerp(const Quaterniond&, const Quaterniond&, double) noexcept;
+template Quaternion slerp(const Quaternion&, const Quaternion&, float) noexcept;
+template Quaterniond slerp(const Quaterniond&, const Quaterniond&, double) noexcept;
+template Quaternion slerpShortestPath(const Quaternion&, const Quaternion&, float) noexcept;
+template Quaterniond slerpShortestPath(const Quaterniond&, const Quaterniond&, double) noexcept;
+
 } // namespace fuse
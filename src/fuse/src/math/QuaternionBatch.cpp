@@ -0,0 +1,59 @@
+#include "fuse/math/QuaternionBatch.h"
+
+#include "kernels/QuaternionKernels.h"
+
+#include <assert.h>
+
+namespace fuse {
+
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "The kernels expect packed Quaternion.");
+static_assert(sizeof(Mat3) == 9 * sizeof(float), "The kernels expect packed Mat3.");
+static_assert(sizeof(Mat4) == 16 * sizeof(float), "The kernels expect packed Mat4.");
+
+namespace {
+
+using Kernel = void (*)(const float* a, const float* b, const float* t, float* out,
+                        std::size_t count) noexcept;
+
+/// @brief Return true when @p out is the same span as @p in or does not overlap it.
+[[maybe_unused]] bool sameOrDisjoint(std::span<const Quaternion> in, std::span<Quaternion> out) noexcept {
+    return in.data() == out.data() || in.data() + in.size() <= out.data() ||
+           out.data() + in.size() <= in.data();
+}
+
+void run(Kernel kernel, std::span<const Quaternion> a, std::span<const Quaternion> b,
+         std::span<const float> t, std::span<Quaternion> out) noexcept {
+    assert(a.size() == b.size() && a.size() == t.size());
+    assert(out.size() >= a.size());
+    assert(sameOrDisjoint(a, out) && sameOrDisjoint(b, out));
+    kernel(&a.data()->x, &b.data()->x, t.data(), &out.data()->x, a.size());
+}
+
+} // namespace
+
+void nlerp(std::span<const Quaternion> a, std::span<const Quaternion> b,
+           std::span<const float> t, std::span<Quaternion> out) noexcept {
+    run(kernels::active::nlerp, a, b, t, out);
+}
+
+void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b,
+           std::span<const float> t, std::span<Quaternion> out) noexcept {
+    run(kernels::active::slerp, a, b, t, out);
+}
+
+void slerpShortestPath(std::span<const Quaternion> a, std::span<const Quaternion> b,
+                       std::span<const float> t, std::span<Quaternion> out) noexcept {
+    run(kernels::active::slerpShortestPath, a, b, t, out);
+}
+
+void toMatrices(std::span<const Quaternion> q, std::span<Mat3> out) noexcept {
+    assert(out.size() >= q.size());
+    kernels::active::quaternionToMat3(&q.data()->x, out.data()->data(), q.size());
+}
+
+void toMatrices(std::span<const Quaternion> q, std::span<Mat4> out) noexcept {
+    assert(out.size() >= q.size());
+    kernels::active::quaternionToMat4(&q.data()->x, out.data()->data(), q.size());
+}
+
+} // namespace fuse
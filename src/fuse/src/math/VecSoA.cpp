@@ -0,0 +1,260 @@
+#include "fuse/math/VecSoA.h"
+
+#include "kernels/SoAKernels.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace fuse {
+
+namespace {
+
+constexpr std::size_t kFloatsPerBlock = VecSoA<3>::kAlignment / sizeof(float);
+
+float* allocate(std::size_t count) {
+    return static_cast<float*>(
+      ::operator new(count * sizeof(float), std::align_val_t{VecSoA<3>::kAlignment}));
+}
+
+void deallocate(float* data) noexcept {
+    ::operator delete(data, std::align_val_t{VecSoA<3>::kAlignment});
+}
+
+template <unsigned N>
+std::array<const float*, N> streams(const VecSoA<N>& v) noexcept {
+    std::array<const float*, N> result;
+    for (unsigned c = 0; c < N; c++) {
+        result[c] = v.stream(c).data();
+    }
+    return result;
+}
+
+template <unsigned N>
+std::array<float*, N> streams(VecSoA<N>& v) noexcept {
+    std::array<float*, N> result;
+    for (unsigned c = 0; c < N; c++) {
+        result[c] = v.stream(c).data();
+    }
+    return result;
+}
+
+template <unsigned N>
+void add(const VecSoA<N>& a, const VecSoA<N>& b, VecSoA<N>& out) {
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    for (unsigned c = 0; c < N; c++) {
+        kernels::active::add(a.stream(c).data(), b.stream(c).data(), out.stream(c).data(),
+                             a.size());
+    }
+}
+
+template <unsigned N>
+void mulAdd(const VecSoA<N>& a, float s, const VecSoA<N>& b, VecSoA<N>& out) {
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    for (unsigned c = 0; c < N; c++) {
+        kernels::active::mulAdd(a.stream(c).data(), s, b.stream(c).data(), out.stream(c).data(),
+                                a.size());
+    }
+}
+
+template <unsigned N>
+void dot(const VecSoA<N>& a, const VecSoA<N>& b, std::span<float> out) noexcept {
+    assert(a.size() == b.size());
+    assert(out.size() >= a.size());
+    kernels::active::dot(streams(a).data(), streams(b).data(), N, out.data(), a.size());
+}
+
+template <unsigned N>
+void normalize(const VecSoA<N>& a, VecSoA<N>& out) {
+    out.resize(a.size());
+    kernels::active::normalize(streams(a).data(), streams(out).data(), N, a.size());
+}
+
+template <unsigned N>
+void length(const VecSoA<N>& a, std::span<float> out) noexcept {
+    assert(out.size() >= a.size());
+    kernels::active::length(streams(a).data(), N, out.data(), a.size());
+}
+
+} // namespace
+
+//
+// VecSoA
+//
+
+template <unsigned N>
+VecSoA<N>::VecSoA(std::size_t size) {
+    resize(size);
+}
+
+template <unsigned N>
+VecSoA<N>::VecSoA(const VecSoA& other) {
+    reserve(other.mSize);
+    mSize = other.mSize;
+    for (unsigned c = 0; c < N; c++) {
+        std::copy_n(other.mData + c * other.mCapacity, mSize, mData + c * mCapacity);
+    }
+}
+
+template <unsigned N>
+VecSoA<N>::VecSoA(VecSoA&& other) noexcept
+    : mData(std::exchange(other.mData, nullptr))
+    , mSize(std::exchange(other.mSize, 0))
+    , mCapacity(std::exchange(other.mCapacity, 0)) {}
+
+template <unsigned N>
+VecSoA<N>& VecSoA<N>::operator=(const VecSoA& other) {
+    if (this != &other) {
+        clear();
+        reserve(other.mSize);
+        mSize = other.mSize;
+        for (unsigned c = 0; c < N; c++) {
+            std::copy_n(other.mData + c * other.mCapacity, mSize, mData + c * mCapacity);
+        }
+    }
+    return *this;
+}
+
+template <unsigned N>
+VecSoA<N>& VecSoA<N>::operator=(VecSoA&& other) noexcept {
+    if (this != &other) {
+        deallocate(mData);
+        mData     = std::exchange(other.mData, nullptr);
+        mSize     = std::exchange(other.mSize, 0);
+        mCapacity = std::exchange(other.mCapacity, 0);
+    }
+    return *this;
+}
+
+template <unsigned N>
+VecSoA<N>::~VecSoA() {
+    deallocate(mData);
+}
+
+template <unsigned N>
+void VecSoA<N>::resize(std::size_t size) {
+    if (size > mCapacity) {
+        reserve(std::max(size, mCapacity * 2));
+    }
+    for (unsigned c = 0; c < N && size > mSize; c++) {
+        std::fill(mData + c * mCapacity + mSize, mData + c * mCapacity + size, 0.f);
+    }
+    mSize = size;
+}
+
+template <unsigned N>
+void VecSoA<N>::reserve(std::size_t capacity) {
+    if (capacity <= mCapacity) {
+        return;
+    }
+    // Round up so every stream start on a kAlignment boundary.
+    capacity = (capacity + kFloatsPerBlock - 1) / kFloatsPerBlock * kFloatsPerBlock;
+
+    float* data = allocate(capacity * N);
+    for (unsigned c = 0; c < N; c++) {
+        std::copy_n(mData + c * mCapacity, mSize, data + c * capacity);
+    }
+    deallocate(mData);
+    mData     = data;
+    mCapacity = capacity;
+}
+
+template class VecSoA<3>;
+template class VecSoA<4>;
+
+//
+// Vec3SoA
+//
+
+Vec3SoA::Vec3SoA(std::span<const Vec3> vectors) {
+    gather(vectors);
+}
+
+void Vec3SoA::gather(std::span<const Vec3> vectors) {
+    static_assert(sizeof(Vec3) == 3 * sizeof(float), "The kernels expect tightly packed Vec3.");
+    resize(vectors.size());
+    kernels::active::deinterleave(reinterpret_cast<const float*>(vectors.data()),
+                                  streams(*this).data(), 3, mSize);
+}
+
+void Vec3SoA::scatter(std::span<Vec3> vectors) const noexcept {
+    assert(vectors.size() >= mSize);
+    kernels::active::interleave(streams(*this).data(), reinterpret_cast<float*>(vectors.data()), 3,
+                                mSize);
+}
+
+std::vector<Vec3> Vec3SoA::toVector() const {
+    std::vector<Vec3> vectors(mSize);
+    scatter(vectors);
+    return vectors;
+}
+
+//
+// Vec4SoA
+//
+
+Vec4SoA::Vec4SoA(std::span<const Vec4> vectors) {
+    gather(vectors);
+}
+
+void Vec4SoA::gather(std::span<const Vec4> vectors) {
+    static_assert(sizeof(Vec4) == 4 * sizeof(float), "The kernels expect tightly packed Vec4.");
+    resize(vectors.size());
+    kernels::active::deinterleave(reinterpret_cast<const float*>(vectors.data()),
+                                  streams(*this).data(), 4, mSize);
+}
+
+void Vec4SoA::scatter(std::span<Vec4> vectors) const noexcept {
+    assert(vectors.size() >= mSize);
+    kernels::active::interleave(streams(*this).data(), reinterpret_cast<float*>(vectors.data()), 4,
+                                mSize);
+}
+
+std::vector<Vec4> Vec4SoA::toVector() const {
+    std::vector<Vec4> vectors(mSize);
+    scatter(vectors);
+    return vectors;
+}
+
+//
+// Operations
+//
+
+void add(const Vec3SoA& a, const Vec3SoA& b, Vec3SoA& out) { add<3>(a, b, out); }
+
+void mulAdd(const Vec3SoA& a, float s, const Vec3SoA& b, Vec3SoA& out) {
+    mulAdd<3>(a, s, b, out);
+}
+
+void dot(const Vec3SoA& a, const Vec3SoA& b, std::span<float> out) noexcept { dot<3>(a, b, out); }
+
+void cross(const Vec3SoA& a, const Vec3SoA& b, Vec3SoA& out) {
+    assert(a.size() == b.size());
+    out.resize(a.size());
+    kernels::active::cross(streams<3>(a).data(), streams<3>(b).data(), streams<3>(out).data(),
+                           a.size());
+}
+
+void normalize(const Vec3SoA& a, Vec3SoA& out) { normalize<3>(a, out); }
+
+void length(const Vec3SoA& a, std::span<float> out) noexcept { length<3>(a, out); }
+
+void add(const Vec4SoA& a, const Vec4SoA& b, Vec4SoA& out) { add<4>(a, b, out); }
+
+void mulAdd(const Vec4SoA& a, float s, const Vec4SoA& b, Vec4SoA& out) {
+    mulAdd<4>(a, s, b, out);
+}
+
+void dot(const Vec4SoA& a, const Vec4SoA& b, std::span<float> out) noexcept { dot<4>(a, b, out); }
+
+void normalize(const Vec4SoA& a, Vec4SoA& out) { normalize<4>(a, out); }
+
+void length(const Vec4SoA& a, std::span<float> out) noexcept { length<4>(a, out); }
+
+} // namespace fuse
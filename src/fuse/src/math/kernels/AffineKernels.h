@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the Affine3 operations.
+///
+/// Same organisation as Mat4Kernels.h. A row of an affine transformation fits a 128 bits
+/// register so the avx2 kernels are the sse ones compiled with FMA (see AffineKernelsImpl.h).
+///
+/// All transformations are 12 floats in row-major order (The Affine3 memory layout).
+/// Pointers do not need to be aligned and the output may alias an input.
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief out = a * b, 36 multiply-adds.
+void affineMul(const float* a, const float* b, float* out) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::affineMul()
+void affineMul(const float* a, const float* b, float* out) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::affineMul()
+void affineMul(const float* a, const float* b, float* out) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void affineMul(const float* a, const float* b, float* out) noexcept {
+    dispatch<scalar::affineMul, sse::affineMul, avx2::affineMul>(a, b, out);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
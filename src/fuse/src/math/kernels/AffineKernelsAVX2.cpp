@@ -0,0 +1,11 @@
+#include "AffineKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "AffineKernelsImpl.h"
+
+namespace fuse::kernels::avx2 {
+
+void affineMul(const float* a, const float* b, float* out) noexcept { impl::affineMul(a, b, out); }
+
+} // namespace fuse::kernels::avx2
+#endif
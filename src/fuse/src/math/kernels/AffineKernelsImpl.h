@@ -0,0 +1,43 @@
+#pragma once
+
+/// @file
+/// @brief Implementation of the SIMD affine kernels (AffineKernels.h).
+///
+/// A row of an affine transformation fits a 128 bits register, so the sse and avx2 kernels
+/// share this implementation, the avx2 one is compiled with FMA (see simd::madd()).
+
+#include "Simd.h"
+#include "Target.h"
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Return the row @p a of the left side multiplied by the rows of the right side.
+///
+/// The translation of @p a (lane 3) is added by keeping only its lane 3 as the initial value.
+[[nodiscard]] inline __m128 affineMulRow(__m128 a, __m128 translationMask, __m128 b0, __m128 b1,
+                                         __m128 b2) noexcept {
+    __m128 r = _mm_and_ps(a, translationMask);
+    r        = simd::madd(r, simd::splat<0>(a), b0);
+    r        = simd::madd(r, simd::splat<1>(a), b1);
+    r        = simd::madd(r, simd::splat<2>(a), b2);
+    return r;
+}
+
+/// @brief out = a * b
+inline void affineMul(const float* a, const float* b, float* out) noexcept {
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    // Load everything before writing out, out may alias a or b.
+    const __m128 a0 = _mm_loadu_ps(a + 0);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 b0 = _mm_loadu_ps(b + 0);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    const __m128 b2 = _mm_loadu_ps(b + 8);
+    _mm_storeu_ps(out + 0, affineMulRow(a0, mask, b0, b1, b2));
+    _mm_storeu_ps(out + 4, affineMulRow(a1, mask, b0, b1, b2));
+    _mm_storeu_ps(out + 8, affineMulRow(a2, mask, b0, b1, b2));
+}
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
@@ -0,0 +1,11 @@
+#include "AffineKernels.h"
+
+#if defined(FUSE_SIMD_SSE)
+#    include "AffineKernelsImpl.h"
+
+namespace fuse::kernels::sse {
+
+void affineMul(const float* a, const float* b, float* out) noexcept { impl::affineMul(a, b, out); }
+
+} // namespace fuse::kernels::sse
+#endif
@@ -0,0 +1,20 @@
+#include "AffineKernels.h"
+
+#include <cstring>
+
+namespace fuse::kernels::scalar {
+
+void affineMul(const float* a, const float* b, float* out) noexcept {
+    // a[row * 4 + col], the implicit last row (0, 0, 0, 1) is never multiplied.
+    float result[12];
+    for (unsigned row = 0; row < 3; row++) {
+        const float* ar = a + row * 4;
+        for (unsigned col = 0; col < 4; col++) {
+            result[row * 4 + col] = ar[0] * b[col] + ar[1] * b[4 + col] + ar[2] * b[8 + col];
+        }
+        result[row * 4 + 3] += ar[3];
+    }
+    std::memcpy(out, result, sizeof(result));
+}
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,88 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the frustum culling (Frustum.h).
+///
+/// Like Mat4Kernels.h, each kernel exists in one namespace per instruction set and
+/// the namespace @b active alias the best one enabled by the build system.
+///
+/// The frustum is 6 planes of 4 floats (nx, ny, nz, d), the normals point inside.
+/// Spheres are 4 floats per element (x, y, z, radius), boxes are 6 floats per element
+/// (min x, y, z then max x, y, z). Pointers do not need to be aligned.
+///
+/// The kernels set the bit of the visible objects in @p visibility (bit `i % 32` of the word
+/// `i / 32`) and leave the other bits untouched, the caller clears the mask first.
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief Set the bit of the spheres which are not entirely behind one of the planes.
+void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                 std::size_t count) noexcept;
+
+/// @brief Set the bit of the boxes which are not entirely behind one of the planes.
+void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+               std::size_t count) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::cullSpheres()
+void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                 std::size_t count) noexcept;
+
+/// @copydoc scalar::cullBoxes()
+void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+               std::size_t count) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::cullSpheres()
+void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                 std::size_t count) noexcept;
+
+/// @copydoc scalar::cullBoxes()
+void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+               std::size_t count) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                        std::size_t count) noexcept {
+    dispatch<scalar::cullSpheres, sse::cullSpheres, avx2::cullSpheres>(
+      planes, spheres, visibility, count);
+}
+
+inline void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+                      std::size_t count) noexcept {
+    dispatch<scalar::cullBoxes, sse::cullBoxes, avx2::cullBoxes>(planes, boxes, visibility, count);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
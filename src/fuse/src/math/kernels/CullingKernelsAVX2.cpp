@@ -0,0 +1,25 @@
+#include "CullingKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "CullingKernelsImpl.h"
+#    include "Simd.h"
+
+namespace fuse::kernels::avx2 {
+
+using Ops = simd::Avx2Ops;
+using impl::ScalarOps;
+
+void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                 std::size_t count) noexcept {
+    const auto i = impl::cullSpheres<Ops>(planes, spheres, visibility, 0, count);
+    impl::cullSpheres<ScalarOps>(planes, spheres, visibility, i, count);
+}
+
+void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+               std::size_t count) noexcept {
+    const auto i = impl::cullBoxes<Ops>(planes, boxes, visibility, 0, count);
+    impl::cullBoxes<ScalarOps>(planes, boxes, visibility, i, count);
+}
+
+} // namespace fuse::kernels::avx2
+#endif
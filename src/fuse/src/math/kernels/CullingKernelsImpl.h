@@ -0,0 +1,131 @@
+#pragma once
+
+/// @file
+/// @brief Implementation of the culling kernels (CullingKernels.h) written once for all
+///        instruction sets.
+///
+/// Same conventions as SoAKernelsImpl.h: the functions are templated on an @b Ops type,
+/// process the elements from @p begin by blocks of Ops::kWidth and return the index of the
+/// first element not processed. A block never straddles 2 words of the visibility mask
+/// since the blocks start at a multiple of Ops::kWidth.
+
+#include "ScalarOps.h"
+#include "Target.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Number of planes of a frustum.
+inline constexpr unsigned kPlanes = 6;
+
+/// @brief The planes of the frustum, each component broadcast to all the lanes.
+template <typename Ops>
+struct FrustumPlanes {
+    using Type = typename Ops::Type;
+    Type nx[kPlanes], ny[kPlanes], nz[kPlanes], d[kPlanes];
+    Type ax[kPlanes], ay[kPlanes], az[kPlanes]; ///< Absolute value of the normals.
+
+    explicit FrustumPlanes(const float* planes) noexcept {
+        for (unsigned p = 0; p < kPlanes; p++) {
+            nx[p] = Ops::set1(planes[p * 4 + 0]);
+            ny[p] = Ops::set1(planes[p * 4 + 1]);
+            nz[p] = Ops::set1(planes[p * 4 + 2]);
+            d[p]  = Ops::set1(planes[p * 4 + 3]);
+            ax[p] = Ops::set1(std::abs(planes[p * 4 + 0]));
+            ay[p] = Ops::set1(std::abs(planes[p * 4 + 1]));
+            az[p] = Ops::set1(std::abs(planes[p * 4 + 2]));
+        }
+    }
+
+    /// @brief Signed distance of the points to the plane @p p, same order as Plane::distance().
+    Type distance(unsigned p, Type x, Type y, Type z) const noexcept {
+        Type r = Ops::mul(nx[p], x);
+        r      = Ops::madd(r, ny[p], y);
+        r      = Ops::madd(r, nz[p], z);
+        return Ops::add(r, d[p]);
+    }
+
+    /// @brief Projection of the extents of the boxes on the normal of the plane @p p.
+    Type radius(unsigned p, Type ex, Type ey, Type ez) const noexcept {
+        Type r = Ops::mul(ax[p], ex);
+        r      = Ops::madd(r, ay[p], ey);
+        return Ops::madd(r, az[p], ez);
+    }
+};
+
+/// @brief Set the bits of the visible objects of the block starting at @p i.
+template <typename Ops>
+void storeVisibility(std::uint32_t* visibility, std::size_t i,
+                     typename Ops::Mask outside) noexcept {
+    constexpr unsigned kBlockMask = (1u << Ops::kWidth) - 1u;
+    const unsigned     visible    = ~Ops::toBits(outside) & kBlockMask;
+    visibility[i / 32] |= static_cast<std::uint32_t>(visible) << (i % 32);
+}
+
+template <typename Ops>
+std::size_t cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                        std::size_t begin, std::size_t count) noexcept {
+    const FrustumPlanes<Ops> frustum(planes);
+    const auto               zero = Ops::set1(0.f);
+
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        typename Ops::Type x, y, z, r;
+        Ops::loadAoS4(spheres + i * 4, x, y, z, r);
+        // Outside when the sphere is entirely behind one of the planes: distance < -radius.
+        auto outside = Ops::lessThan(Ops::add(frustum.distance(0, x, y, z), r), zero);
+        for (unsigned p = 1; p < kPlanes; p++) {
+            const auto behind = Ops::lessThan(Ops::add(frustum.distance(p, x, y, z), r), zero);
+            outside           = Ops::maskOr(outside, behind);
+        }
+        storeVisibility<Ops>(visibility, i, outside);
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+                      std::size_t begin, std::size_t count) noexcept {
+    const FrustumPlanes<Ops> frustum(planes);
+    const auto               zero = Ops::set1(0.f);
+    const auto               half = Ops::set1(0.5f);
+
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const float* box  = boxes + i * 6;
+        const auto   minX = Ops::gather(box + 0, 6);
+        const auto   minY = Ops::gather(box + 1, 6);
+        const auto   minZ = Ops::gather(box + 2, 6);
+        const auto   maxX = Ops::gather(box + 3, 6);
+        const auto   maxY = Ops::gather(box + 4, 6);
+        const auto   maxZ = Ops::gather(box + 5, 6);
+
+        // Same as AABB::center() and AABB::extents().
+        const auto cx = Ops::mul(Ops::add(minX, maxX), half);
+        const auto cy = Ops::mul(Ops::add(minY, maxY), half);
+        const auto cz = Ops::mul(Ops::add(minZ, maxZ), half);
+        const auto ex = Ops::mul(Ops::sub(maxX, minX), half);
+        const auto ey = Ops::mul(Ops::sub(maxY, minY), half);
+        const auto ez = Ops::mul(Ops::sub(maxZ, minZ), half);
+
+        // Outside when the corner the most in front of a plane is behind it.
+        const auto behind = [&](unsigned p) {
+            const auto front =
+              Ops::add(frustum.distance(p, cx, cy, cz), frustum.radius(p, ex, ey, ez));
+            return Ops::lessThan(front, zero);
+        };
+        auto outside = behind(0);
+        for (unsigned p = 1; p < kPlanes; p++) {
+            outside = Ops::maskOr(outside, behind(p));
+        }
+        storeVisibility<Ops>(visibility, i, outside);
+    }
+    return i;
+}
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
@@ -0,0 +1,18 @@
+#include "CullingKernels.h"
+#include "CullingKernelsImpl.h"
+
+namespace fuse::kernels::scalar {
+
+using Ops = impl::ScalarOps;
+
+void cullSpheres(const float* planes, const float* spheres, std::uint32_t* visibility,
+                 std::size_t count) noexcept {
+    impl::cullSpheres<Ops>(planes, spheres, visibility, 0, count);
+}
+
+void cullBoxes(const float* planes, const float* boxes, std::uint32_t* visibility,
+               std::size_t count) noexcept {
+    impl::cullBoxes<Ops>(planes, boxes, visibility, 0, count);
+}
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file
+/// @brief Runtime selection of the kernels, used by the kernel headers when the build system
+///        compiles every instruction set (FUSE_SIMD=DISPATCH).
+
+#include "fuse/math/Dispatch.h"
+
+#include <atomic>
+
+namespace fuse::kernels {
+
+namespace detail {
+
+/// @brief The instruction set returned by activeIsa(), -1 until it is selected.
+extern std::atomic<int> gIsa;
+
+} // namespace detail
+
+/// @brief Same as activeIsa(), without the function call once the instruction set is selected.
+/// @note Application selects it on construction, before any kernel runs: only a kernel
+///       called without an Application makes the selection, and its logging, from here.
+[[nodiscard]] inline Isa isa() noexcept {
+    const int isa = detail::gIsa.load(std::memory_order_relaxed);
+    return isa < 0 ? activeIsa() : static_cast<Isa>(isa);
+}
+
+/// @brief Call the kernel of the active instruction set with @p args.
+///
+/// An instruction set without a dedicated kernel uses the kernel of the previous one.
+template <auto kScalar, auto kSse, auto kAvx2 = kSse, auto kAvx512 = kAvx2, typename... Args>
+void dispatch(Args... args) noexcept {
+    switch (isa()) {
+        case Isa::AVX512:
+            kAvx512(args...);
+            break;
+        case Isa::AVX2:
+            kAvx2(args...);
+            break;
+        case Isa::SSE:
+            kSse(args...);
+            break;
+        case Isa::Scalar:
+        default:
+            kScalar(args...);
+            break;
+    }
+}
+
+} // namespace fuse::kernels
@@ -0,0 +1,128 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the Mat4 operations.
+///
+/// Each kernel exists in one namespace per instruction set (scalar, sse, avx2, avx512).
+/// Only the instruction sets enabled by the build system (FUSE_SIMD) are compiled,
+/// the namespace @b active alias the best one. With FUSE_SIMD=DISPATCH, the functions of
+/// @b active call the kernel of the instruction set selected at runtime (see Dispatch.h).
+/// An instruction set without a dedicated kernel uses the one of the previous instruction set.
+///
+/// All matrices are 16 floats in column-major order (The Mat4 memory layout), the mat4d kernels
+/// are the same operations on 16 doubles (The Mat4d memory layout).
+/// Pointers do not need to be aligned and the output may alias an input.
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief out = a * b
+void mat4Mul(const float* a, const float* b, float* out) noexcept;
+
+/// @brief out = m * v where @p v is a column vector of 4 floats.
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept;
+
+/// @brief out = inverse(m)
+void mat4Inverse(const float* m, float* out) noexcept;
+
+/// @copydoc mat4Mul()
+void mat4dMul(const double* a, const double* b, double* out) noexcept;
+
+/// @copydoc mat4MulVec4()
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept;
+
+/// @copydoc mat4Inverse()
+void mat4dInverse(const double* m, double* out) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::mat4Mul()
+void mat4Mul(const float* a, const float* b, float* out) noexcept;
+
+/// @copydoc scalar::mat4MulVec4()
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept;
+
+/// @copydoc scalar::mat4Inverse()
+void mat4Inverse(const float* m, float* out) noexcept;
+
+/// @copydoc scalar::mat4dMul()
+void mat4dMul(const double* a, const double* b, double* out) noexcept;
+
+/// @copydoc scalar::mat4dMulVec4()
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept;
+
+/// @copydoc scalar::mat4dInverse()
+void mat4dInverse(const double* m, double* out) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::mat4Mul()
+void mat4Mul(const float* a, const float* b, float* out) noexcept;
+
+/// @copydoc scalar::mat4MulVec4()
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept;
+
+/// @copydoc scalar::mat4Inverse()
+void mat4Inverse(const float* m, float* out) noexcept;
+
+/// @copydoc scalar::mat4dMul()
+void mat4dMul(const double* a, const double* b, double* out) noexcept;
+
+/// @copydoc scalar::mat4dMulVec4()
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept;
+
+/// @copydoc scalar::mat4dInverse()
+void mat4dInverse(const double* m, double* out) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void mat4Mul(const float* a, const float* b, float* out) noexcept {
+    dispatch<scalar::mat4Mul, sse::mat4Mul, avx2::mat4Mul>(a, b, out);
+}
+
+inline void mat4MulVec4(const float* m, const float* v, float* out) noexcept {
+    dispatch<scalar::mat4MulVec4, sse::mat4MulVec4, avx2::mat4MulVec4>(m, v, out);
+}
+
+inline void mat4Inverse(const float* m, float* out) noexcept {
+    dispatch<scalar::mat4Inverse, sse::mat4Inverse, avx2::mat4Inverse>(m, out);
+}
+
+inline void mat4dMul(const double* a, const double* b, double* out) noexcept {
+    dispatch<scalar::mat4dMul, sse::mat4dMul, avx2::mat4dMul>(a, b, out);
+}
+
+inline void mat4dMulVec4(const double* m, const double* v, double* out) noexcept {
+    dispatch<scalar::mat4dMulVec4, sse::mat4dMulVec4, avx2::mat4dMulVec4>(m, v, out);
+}
+
+inline void mat4dInverse(const double* m, double* out) noexcept {
+    dispatch<scalar::mat4dInverse, sse::mat4dInverse, avx2::mat4dInverse>(m, out);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
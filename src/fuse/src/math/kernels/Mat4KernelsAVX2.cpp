@@ -0,0 +1,81 @@
+#include "Mat4Kernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "Simd.h"
+
+namespace fuse::kernels::avx2 {
+
+void mat4Mul(const float* a, const float* b, float* out) noexcept {
+    // Each 256 bits register hold 2 columns, the columns of a are duplicated in both lanes.
+    __m128 columns[4];
+    simd::loadColumns(a, columns);
+    const __m256 a0 = _mm256_set_m128(columns[0], columns[0]);
+    const __m256 a1 = _mm256_set_m128(columns[1], columns[1]);
+    const __m256 a2 = _mm256_set_m128(columns[2], columns[2]);
+    const __m256 a3 = _mm256_set_m128(columns[3], columns[3]);
+
+    // Load both halves of b before writing out, out may alias b.
+    const __m256 b01 = _mm256_loadu_ps(b + 0);
+    const __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b01, b01, 0x00));
+    r01        = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b01, b01, 0x55), r01);
+    r01        = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b01, b01, 0xAA), r01);
+    r01        = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b01, b01, 0xFF), r01);
+
+    __m256 r23 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b23, b23, 0x00));
+    r23        = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b23, b23, 0x55), r23);
+    r23        = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b23, b23, 0xAA), r23);
+    r23        = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b23, b23, 0xFF), r23);
+
+    _mm256_storeu_ps(out + 0, r01);
+    _mm256_storeu_ps(out + 8, r23);
+}
+
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept {
+    __m128 columns[4];
+    simd::loadColumns(m, columns);
+    // The vector is often built just before the call, loading its components one by one
+    // avoid a store forwarding stall.
+    __m128 r = _mm_mul_ps(columns[0], _mm_load1_ps(v + 0));
+    r        = simd::madd(r, columns[1], _mm_load1_ps(v + 1));
+    r        = simd::madd(r, columns[2], _mm_load1_ps(v + 2));
+    r        = simd::madd(r, columns[3], _mm_load1_ps(v + 3));
+    _mm_storeu_ps(out, r);
+}
+
+void mat4Inverse(const float* m, float* out) noexcept {
+    // The block-wise inverse only use 128 bits operations, the SSE kernel is already optimal.
+    sse::mat4Inverse(m, out);
+}
+
+void mat4dMul(const double* a, const double* b, double* out) noexcept {
+    // Each 256 bits register hold a column of a.
+    const __m256d a0 = _mm256_loadu_pd(a + 0);
+    const __m256d a1 = _mm256_loadu_pd(a + 4);
+    const __m256d a2 = _mm256_loadu_pd(a + 8);
+    const __m256d a3 = _mm256_loadu_pd(a + 12);
+    for (unsigned col = 0; col < 4; col++) {
+        // Load the column of b before writing it, out may alias b.
+        const double* bc = b + col * 4;
+        __m256d       r  = _mm256_mul_pd(a0, _mm256_broadcast_sd(bc + 0));
+        r                = simd::madd(r, a1, _mm256_broadcast_sd(bc + 1));
+        r                = simd::madd(r, a2, _mm256_broadcast_sd(bc + 2));
+        r                = simd::madd(r, a3, _mm256_broadcast_sd(bc + 3));
+        _mm256_storeu_pd(out + col * 4, r);
+    }
+}
+
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept {
+    __m256d r = _mm256_mul_pd(_mm256_loadu_pd(m + 0), _mm256_broadcast_sd(v + 0));
+    r         = simd::madd(r, _mm256_loadu_pd(m + 4), _mm256_broadcast_sd(v + 1));
+    r         = simd::madd(r, _mm256_loadu_pd(m + 8), _mm256_broadcast_sd(v + 2));
+    r         = simd::madd(r, _mm256_loadu_pd(m + 12), _mm256_broadcast_sd(v + 3));
+    _mm256_storeu_pd(out, r);
+}
+
+void mat4dInverse(const double* m, double* out) noexcept { sse::mat4dInverse(m, out); }
+
+} // namespace fuse::kernels::avx2
+
+#endif
@@ -0,0 +1,176 @@
+#include "Mat4Kernels.h"
+
+#if defined(FUSE_SIMD_SSE)
+#    include "Simd.h"
+
+namespace {
+
+using namespace fuse::kernels::simd;
+
+// The inverse work on 2x2 blocks, each block is stored in a __m128 as [m00 m01 m10 m11].
+
+/// @brief Return a * b
+__m128 mat2Mul(__m128 a, __m128 b) noexcept {
+    return _mm_add_ps(_mm_mul_ps(a, FUSE_SWIZZLE(b, 0, 3, 0, 3)),
+                      _mm_mul_ps(FUSE_SWIZZLE(a, 1, 0, 3, 2), FUSE_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/// @brief Return adjugate(a) * b
+__m128 mat2AdjMul(__m128 a, __m128 b) noexcept {
+    return _mm_sub_ps(_mm_mul_ps(FUSE_SWIZZLE(a, 3, 3, 0, 0), b),
+                      _mm_mul_ps(FUSE_SWIZZLE(a, 1, 1, 2, 2), FUSE_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+/// @brief Return a * adjugate(b)
+__m128 mat2MulAdj(__m128 a, __m128 b) noexcept {
+    return _mm_sub_ps(_mm_mul_ps(a, FUSE_SWIZZLE(b, 3, 0, 3, 0)),
+                      _mm_mul_ps(FUSE_SWIZZLE(a, 1, 0, 3, 2), FUSE_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+} // namespace
+
+namespace fuse::kernels::sse {
+
+void mat4Mul(const float* a, const float* b, float* out) noexcept {
+    __m128 columns[4];
+    loadColumns(a, columns);
+    // Load all columns of b before writing out, out may alias b.
+    const __m128 b0 = _mm_loadu_ps(b + 0);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    const __m128 b2 = _mm_loadu_ps(b + 8);
+    const __m128 b3 = _mm_loadu_ps(b + 12);
+    _mm_storeu_ps(out + 0, transform(columns, b0));
+    _mm_storeu_ps(out + 4, transform(columns, b1));
+    _mm_storeu_ps(out + 8, transform(columns, b2));
+    _mm_storeu_ps(out + 12, transform(columns, b3));
+}
+
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept {
+    __m128 columns[4];
+    loadColumns(m, columns);
+    // The vector is often built just before the call, loading its components one by one
+    // avoid a store forwarding stall.
+    __m128 r = _mm_mul_ps(columns[0], _mm_load1_ps(v + 0));
+    r        = madd(r, columns[1], _mm_load1_ps(v + 1));
+    r        = madd(r, columns[2], _mm_load1_ps(v + 2));
+    r        = madd(r, columns[3], _mm_load1_ps(v + 3));
+    _mm_storeu_ps(out, r);
+}
+
+void mat4Inverse(const float* m, float* out) noexcept {
+    // Block-wise inversion:
+    //
+    //      | A B |                   | X Y |
+    //  M = | C D |   inverse(M) =    | Z W | * 1 / det(M)
+    //
+    // Where each block is a 2x2 matrix. Inverting the transpose gives the transpose of the
+    // inverse, so the algorithm works the same way on the columns of a column-major matrix.
+    __m128 c[4];
+    loadColumns(m, c);
+
+    const __m128 A = _mm_movelh_ps(c[0], c[1]);
+    const __m128 B = _mm_movehl_ps(c[1], c[0]);
+    const __m128 C = _mm_movelh_ps(c[2], c[3]);
+    const __m128 D = _mm_movehl_ps(c[3], c[2]);
+
+    // The 4 blocks determinants (|A| |B| |C| |D|).
+    const __m128 detLeft  = _mm_mul_ps(FUSE_SHUFFLE(c[0], c[2], 0, 2, 0, 2),
+                                       FUSE_SHUFFLE(c[1], c[3], 1, 3, 1, 3));
+    const __m128 detRight = _mm_mul_ps(FUSE_SHUFFLE(c[0], c[2], 1, 3, 1, 3),
+                                       FUSE_SHUFFLE(c[1], c[3], 0, 2, 0, 2));
+    const __m128 detSub   = _mm_sub_ps(detLeft, detRight);
+    const __m128 detA = splat<0>(detSub);
+    const __m128 detB = splat<1>(detSub);
+    const __m128 detC = splat<2>(detSub);
+    const __m128 detD = splat<3>(detSub);
+
+    const __m128 DC = mat2AdjMul(D, C);
+    const __m128 AB = mat2AdjMul(A, B);
+
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, DC));
+
+    // det(M) = |A||D| + |B||C| - trace(AB * DC)
+    __m128 tr = _mm_mul_ps(AB, FUSE_SWIZZLE(DC, 0, 2, 1, 3));
+    tr        = _mm_add_ps(tr, FUSE_SWIZZLE(tr, 1, 0, 3, 2));
+    tr        = _mm_add_ps(tr, FUSE_SWIZZLE(tr, 2, 3, 0, 1));
+
+    __m128 detM = _mm_mul_ps(detA, detD);
+    detM        = _mm_add_ps(detM, _mm_mul_ps(detB, detC));
+    detM        = _mm_sub_ps(detM, tr);
+
+    // The adjugate of each block alternate the sign of the off-diagonal elements.
+    const __m128 invDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+    X                    = _mm_mul_ps(X, invDetM);
+    Y                    = _mm_mul_ps(Y, invDetM);
+    Z                    = _mm_mul_ps(Z, invDetM);
+    W                    = _mm_mul_ps(W, invDetM);
+
+    _mm_storeu_ps(out + 0, FUSE_SHUFFLE(X, Y, 3, 1, 3, 1));
+    _mm_storeu_ps(out + 4, FUSE_SHUFFLE(X, Y, 2, 0, 2, 0));
+    _mm_storeu_ps(out + 8, FUSE_SHUFFLE(Z, W, 3, 1, 3, 1));
+    _mm_storeu_ps(out + 12, FUSE_SHUFFLE(Z, W, 2, 0, 2, 0));
+}
+
+void mat4dMul(const double* a, const double* b, double* out) noexcept {
+    // Each column of a is split in 2 registers, rows 0-1 and rows 2-3.
+    __m128d lo[4];
+    __m128d hi[4];
+    for (unsigned i = 0; i < 4; i++) {
+        lo[i] = _mm_loadu_pd(a + i * 4);
+        hi[i] = _mm_loadu_pd(a + i * 4 + 2);
+    }
+    for (unsigned col = 0; col < 4; col++) {
+        // Load the column of b before writing it, out may alias b.
+        const double* bc = b + col * 4;
+        const __m128d b0 = _mm_load1_pd(bc + 0);
+        const __m128d b1 = _mm_load1_pd(bc + 1);
+        const __m128d b2 = _mm_load1_pd(bc + 2);
+        const __m128d b3 = _mm_load1_pd(bc + 3);
+
+        __m128d rlo = _mm_mul_pd(lo[0], b0);
+        rlo         = madd(rlo, lo[1], b1);
+        rlo         = madd(rlo, lo[2], b2);
+        rlo         = madd(rlo, lo[3], b3);
+
+        __m128d rhi = _mm_mul_pd(hi[0], b0);
+        rhi         = madd(rhi, hi[1], b1);
+        rhi         = madd(rhi, hi[2], b2);
+        rhi         = madd(rhi, hi[3], b3);
+
+        _mm_storeu_pd(out + col * 4, rlo);
+        _mm_storeu_pd(out + col * 4 + 2, rhi);
+    }
+}
+
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept {
+    const __m128d v0 = _mm_load1_pd(v + 0);
+    const __m128d v1 = _mm_load1_pd(v + 1);
+    const __m128d v2 = _mm_load1_pd(v + 2);
+    const __m128d v3 = _mm_load1_pd(v + 3);
+
+    __m128d lo = _mm_mul_pd(_mm_loadu_pd(m + 0), v0);
+    lo         = madd(lo, _mm_loadu_pd(m + 4), v1);
+    lo         = madd(lo, _mm_loadu_pd(m + 8), v2);
+    lo         = madd(lo, _mm_loadu_pd(m + 12), v3);
+
+    __m128d hi = _mm_mul_pd(_mm_loadu_pd(m + 2), v0);
+    hi         = madd(hi, _mm_loadu_pd(m + 6), v1);
+    hi         = madd(hi, _mm_loadu_pd(m + 10), v2);
+    hi         = madd(hi, _mm_loadu_pd(m + 14), v3);
+
+    _mm_storeu_pd(out + 0, lo);
+    _mm_storeu_pd(out + 2, hi);
+}
+
+void mat4dInverse(const double* m, double* out) noexcept {
+    // A 2x2 block of doubles does not fit in one register, the block-wise inverse of the float
+    // kernel lose its advantage over the cofactors of the scalar kernel.
+    scalar::mat4dInverse(m, out);
+}
+
+} // namespace fuse::kernels::sse
+
+#endif
@@ -0,0 +1,115 @@
+#include "Mat4Kernels.h"
+
+#include <cstring>
+
+namespace {
+
+// The float and double kernels share the same implementation.
+
+template <typename T>
+void mul(const T* a, const T* b, T* out) noexcept {
+    // Each column of the result is a linear combination of the columns of a.
+    T result[16];
+    for (unsigned col = 0; col < 4; col++) {
+        const T* bc = b + col * 4;
+        for (unsigned row = 0; row < 4; row++) {
+            result[col * 4 + row] =
+              a[row] * bc[0] + a[4 + row] * bc[1] + a[8 + row] * bc[2] + a[12 + row] * bc[3];
+        }
+    }
+    std::memcpy(out, result, sizeof(result));
+}
+
+template <typename T>
+void mulVec4(const T* m, const T* v, T* out) noexcept {
+    T result[4];
+    for (unsigned row = 0; row < 4; row++) {
+        result[row] = m[row] * v[0] + m[4 + row] * v[1] + m[8 + row] * v[2] + m[12 + row] * v[3];
+    }
+    std::memcpy(out, result, sizeof(result));
+}
+
+template <typename T>
+void inverse(const T* m, T* out) noexcept {
+    // m[col * 4 + row]
+    const T m00 = m[0], m01 = m[4], m02 = m[8], m03 = m[12];
+    const T m10 = m[1], m11 = m[5], m12 = m[9], m13 = m[13];
+    const T m20 = m[2], m21 = m[6], m22 = m[10], m23 = m[14];
+    const T m30 = m[3], m31 = m[7], m32 = m[11], m33 = m[15];
+
+    T v0 = m20 * m31 - m21 * m30;
+    T v1 = m20 * m32 - m22 * m30;
+    T v2 = m20 * m33 - m23 * m30;
+    T v3 = m21 * m32 - m22 * m31;
+    T v4 = m21 * m33 - m23 * m31;
+    T v5 = m22 * m33 - m23 * m32;
+
+    const T t00 = +(v5 * m11 - v4 * m12 + v3 * m13);
+    const T t10 = -(v5 * m10 - v2 * m12 + v1 * m13);
+    const T t20 = +(v4 * m10 - v2 * m11 + v0 * m13);
+    const T t30 = -(v3 * m10 - v1 * m11 + v0 * m12);
+
+    const T invDet = 1 / (t00 * m00 + t10 * m01 + t20 * m02 + t30 * m03);
+
+    const T d00 = t00 * invDet;
+    const T d10 = t10 * invDet;
+    const T d20 = t20 * invDet;
+    const T d30 = t30 * invDet;
+
+    const T d01 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const T d11 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const T d21 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const T d31 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    v0 = m10 * m31 - m11 * m30;
+    v1 = m10 * m32 - m12 * m30;
+    v2 = m10 * m33 - m13 * m30;
+    v3 = m11 * m32 - m12 * m31;
+    v4 = m11 * m33 - m13 * m31;
+    v5 = m12 * m33 - m13 * m32;
+
+    const T d02 = +(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const T d12 = -(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const T d22 = +(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const T d32 = -(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    v0 = m21 * m10 - m20 * m11;
+    v1 = m22 * m10 - m20 * m12;
+    v2 = m23 * m10 - m20 * m13;
+    v3 = m22 * m11 - m21 * m12;
+    v4 = m23 * m11 - m21 * m13;
+    v5 = m23 * m12 - m22 * m13;
+
+    const T d03 = -(v5 * m01 - v4 * m02 + v3 * m03) * invDet;
+    const T d13 = +(v5 * m00 - v2 * m02 + v1 * m03) * invDet;
+    const T d23 = -(v4 * m00 - v2 * m01 + v0 * m03) * invDet;
+    const T d33 = +(v3 * m00 - v1 * m01 + v0 * m02) * invDet;
+
+    // clang-format off
+    const T result[16] = {
+        d00, d10, d20, d30, // column 0
+        d01, d11, d21, d31, // column 1
+        d02, d12, d22, d32, // column 2
+        d03, d13, d23, d33  // column 3
+    };
+    // clang-format on
+    std::memcpy(out, result, sizeof(result));
+}
+
+} // namespace
+
+namespace fuse::kernels::scalar {
+
+void mat4Mul(const float* a, const float* b, float* out) noexcept { mul(a, b, out); }
+
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept { mulVec4(m, v, out); }
+
+void mat4Inverse(const float* m, float* out) noexcept { inverse(m, out); }
+
+void mat4dMul(const double* a, const double* b, double* out) noexcept { mul(a, b, out); }
+
+void mat4dMulVec4(const double* m, const double* v, double* out) noexcept { mulVec4(m, v, out); }
+
+void mat4dInverse(const double* m, double* out) noexcept { inverse(m, out); }
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,123 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the quaternion batch operations (QuaternionBatch.h).
+///
+/// Like Mat4Kernels.h, each kernel exists in one namespace per instruction set and
+/// the namespace @b active alias the best one enabled by the build system.
+///
+/// Quaternion arrays are 4 floats per element (x, y, z, w). Mat3 and Mat4 arrays are 9 and
+/// 16 floats per element in column-major order. Pointers do not need to be aligned,
+/// @p out may be equal to an input but must not partially overlap it.
+
+#include <cstddef>
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief out[i] = nlerp(a[i], b[i], t[i]), the shortest path is taken.
+void nlerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @brief out[i] = slerp(a[i], b[i], t[i])
+void slerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @brief out[i] = slerpShortestPath(a[i], b[i], t[i])
+void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                       std::size_t count) noexcept;
+
+/// @brief Convert @p count unit quaternions to rotation matrices (Mat3).
+void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept;
+
+/// @brief Convert @p count unit quaternions to rotation matrices (Mat4).
+void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::nlerp()
+void nlerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::slerp()
+void slerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::slerpShortestPath()
+void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                       std::size_t count) noexcept;
+
+/// @copydoc scalar::quaternionToMat3()
+void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::quaternionToMat4()
+void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::nlerp()
+void nlerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::slerp()
+void slerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::slerpShortestPath()
+void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                       std::size_t count) noexcept;
+
+/// @copydoc scalar::quaternionToMat3()
+void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::quaternionToMat4()
+void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void nlerp(const float* a, const float* b, const float* t, float* out,
+                  std::size_t count) noexcept {
+    dispatch<scalar::nlerp, sse::nlerp, avx2::nlerp>(a, b, t, out, count);
+}
+
+inline void slerp(const float* a, const float* b, const float* t, float* out,
+                  std::size_t count) noexcept {
+    dispatch<scalar::slerp, sse::slerp, avx2::slerp>(a, b, t, out, count);
+}
+
+inline void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                              std::size_t count) noexcept {
+    dispatch<scalar::slerpShortestPath, sse::slerpShortestPath, avx2::slerpShortestPath>(
+      a, b, t, out, count);
+}
+
+inline void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept {
+    dispatch<scalar::quaternionToMat3, sse::quaternionToMat3, avx2::quaternionToMat3>(
+      q, out, count);
+}
+
+inline void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept {
+    dispatch<scalar::quaternionToMat4, sse::quaternionToMat4, avx2::quaternionToMat4>(
+      q, out, count);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
@@ -0,0 +1,43 @@
+#include "QuaternionKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "QuaternionKernelsImpl.h"
+#    include "Simd.h"
+
+namespace fuse::kernels::avx2 {
+
+using Ops = simd::Avx2Ops;
+using impl::ScalarOps;
+
+template <impl::Interpolation kInterpolation>
+void interpolate(const float* a, const float* b, const float* t, float* out,
+                 std::size_t count) noexcept {
+    const auto i = impl::interpolate<Ops, kInterpolation>(a, b, t, out, 0, count);
+    impl::interpolate<ScalarOps, kInterpolation>(a, b, t, out, i, count);
+}
+
+void nlerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept {
+    interpolate<impl::Interpolation::Nlerp>(a, b, t, out, count);
+}
+
+void slerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept {
+    interpolate<impl::Interpolation::Slerp>(a, b, t, out, count);
+}
+
+void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                       std::size_t count) noexcept {
+    interpolate<impl::Interpolation::SlerpShortestPath>(a, b, t, out, count);
+}
+
+void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept {
+    const auto i = impl::quaternionToMat3<Ops>(q, out, 0, count);
+    impl::quaternionToMat3<ScalarOps>(q, out, i, count);
+}
+
+void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept {
+    const auto i = impl::quaternionToMat4<Ops>(q, out, 0, count);
+    impl::quaternionToMat4<ScalarOps>(q, out, i, count);
+}
+
+} // namespace fuse::kernels::avx2
+#endif
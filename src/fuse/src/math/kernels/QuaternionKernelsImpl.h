@@ -0,0 +1,221 @@
+#pragma once
+
+/// @file
+/// @brief Implementation of the quaternion kernels (QuaternionKernels.h) written once for all
+///        instruction sets.
+///
+/// Same conventions as SoAKernelsImpl.h: the functions are templated on an @b Ops type,
+/// process the elements from @p begin by blocks of Ops::kWidth and return the index of the
+/// first element not processed.
+
+#include "ScalarOps.h"
+#include "Target.h"
+
+#include <cstddef>
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Number of terms of the series used to compute the slerp weights.
+inline constexpr unsigned kSlerpTerms = 12;
+
+/// @brief Coefficients of the slerp series.
+///
+/// From "A Fast and Accurate Algorithm for Computing SLERP" (David Eberly).
+/// With x = cos(a), sin(t * a) / sin(a) = t * (1 + b0 * (1 + b1 * (1 + ...)))
+/// where b_i = (u_i * t^2 - v_i) * (x - 1), u_i = 1 / (i * (2i + 1)), v_i = i / (2i + 1).
+/// The last term is scaled to compensate for the truncation of the series.
+/// The maximum error is below 1e-6 for x in [0, 1] and below 1e-7 for x in [0.5, 1],
+/// the series diverges for x < 0.
+struct SlerpSeries {
+    float u[kSlerpTerms];
+    float v[kSlerpTerms];
+};
+
+inline constexpr SlerpSeries kSlerpSeries = [] {
+    constexpr double kLastTermScale = 1.893725;
+    SlerpSeries      series{};
+    for (unsigned i = 0; i < kSlerpTerms; i++) {
+        const double n  = i + 1;
+        const double sn = i + 1 == kSlerpTerms ? kLastTermScale : 1.0;
+        series.u[i]     = static_cast<float>(sn / (n * (2.0 * n + 1.0)));
+        series.v[i]     = static_cast<float>(sn * n / (2.0 * n + 1.0));
+    }
+    return series;
+}();
+
+/// @brief Kind of interpolation computed by interpolate().
+enum class Interpolation { Nlerp, Slerp, SlerpShortestPath };
+
+/// @brief kWidth quaternions, one register per component.
+template <typename Ops>
+struct QuaternionBlock {
+    using Type = typename Ops::Type;
+    Type x, y, z, w;
+
+    static QuaternionBlock load(const float* p) noexcept {
+        QuaternionBlock q;
+        Ops::loadAoS4(p, q.x, q.y, q.z, q.w);
+        return q;
+    }
+
+    void store(float* p) const noexcept { Ops::storeAoS4(p, 4, x, y, z, w); }
+
+    Type dot(const QuaternionBlock& o) const noexcept {
+        Type r = Ops::mul(x, o.x);
+        r      = Ops::madd(r, y, o.y);
+        r      = Ops::madd(r, z, o.z);
+        return Ops::madd(r, w, o.w);
+    }
+
+    QuaternionBlock scale(Type s) const noexcept {
+        return {Ops::mul(x, s), Ops::mul(y, s), Ops::mul(z, s), Ops::mul(w, s)};
+    }
+
+    /// @brief Return this + o * s
+    QuaternionBlock madd(const QuaternionBlock& o, Type s) const noexcept {
+        return {Ops::madd(x, o.x, s), Ops::madd(y, o.y, s), Ops::madd(z, o.z, s),
+                Ops::madd(w, o.w, s)};
+    }
+
+    QuaternionBlock normalize() const noexcept {
+        // Same operations as Quaternion::normalize().
+        return scale(Ops::div(Ops::set1(1.f), Ops::sqrt(dot(*this))));
+    }
+
+    static QuaternionBlock select(typename Ops::Mask mask, const QuaternionBlock& a,
+                                  const QuaternionBlock& b) noexcept {
+        return {Ops::select(mask, a.x, b.x), Ops::select(mask, a.y, b.y),
+                Ops::select(mask, a.z, b.z), Ops::select(mask, a.w, b.w)};
+    }
+};
+
+/// @brief Return sin(t * a) / sin(a) where @p xm1 is cos(a) - 1, see SlerpSeries.
+template <typename Ops>
+typename Ops::Type slerpWeight(typename Ops::Type t, typename Ops::Type xm1) noexcept {
+    const auto one = Ops::set1(1.f);
+    const auto tt  = Ops::mul(t, t);
+    auto       s   = one;
+    for (unsigned i = kSlerpTerms; i-- > 0;) {
+        const auto u = Ops::set1(kSlerpSeries.u[i]);
+        const auto v = Ops::set1(kSlerpSeries.v[i]);
+        s            = Ops::madd(one, Ops::mul(Ops::sub(Ops::mul(u, tt), v), xm1), s);
+    }
+    return Ops::mul(t, s);
+}
+
+template <typename Ops, Interpolation kInterpolation>
+std::size_t interpolate(const float* a, const float* b, const float* t, float* out,
+                        std::size_t begin, std::size_t count) noexcept {
+    using Block     = QuaternionBlock<Ops>;
+    const auto zero = Ops::set1(0.f);
+    const auto one  = Ops::set1(1.f);
+    const auto half = Ops::set1(0.5f);
+
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        auto qa = Block::load(a + i * 4);
+        auto qb = Block::load(b + i * 4);
+        auto ti = Ops::load(t + i);
+        auto d  = qa.dot(qb);
+
+        if constexpr (kInterpolation != Interpolation::Slerp) {
+            // q and -q are the same rotation, negate b when it is in the other hemisphere.
+            const auto flip = Ops::lessThan(d, zero);
+            qb              = Block::select(flip, qb.scale(Ops::set1(-1.f)), qb);
+            d               = Ops::select(flip, Ops::sub(zero, d), d);
+        }
+
+        Block result;
+        if constexpr (kInterpolation == Interpolation::Nlerp) {
+            result = qa.scale(Ops::sub(one, ti)).madd(qb, ti).normalize();
+        } else {
+            // The series only converges for angles up to 90 degrees and is accurate to 1e-7
+            // up to 60 degrees. For wider angles, interpolate on the half of the arc
+            // containing t: [a, m] or [m, b] where m is the middle of the arc.
+            const auto wide      = Ops::lessThan(d, half);
+            const auto firstHalf = Ops::lessThan(ti, half);
+            const auto middle    = qa.madd(qb, one).normalize();
+            const auto t2        = Ops::add(ti, ti);
+            const auto from      = Block::select(firstHalf, qa, middle);
+            const auto to        = Block::select(firstHalf, middle, qb);
+            qa = Block::select(wide, from, qa);
+            qb = Block::select(wide, to, qb);
+            ti = Ops::select(wide, Ops::select(firstHalf, t2, Ops::sub(t2, one)), ti);
+            d  = Ops::select(wide, qa.dot(qb), d);
+
+            const auto xm1 = Ops::sub(d, one);
+            const auto wa  = slerpWeight<Ops>(Ops::sub(one, ti), xm1);
+            const auto wb  = slerpWeight<Ops>(ti, xm1);
+            result         = qa.scale(wa).madd(qb, wb);
+        }
+        result.store(out + i * 4);
+    }
+    return i;
+}
+
+/// @brief Rotation matrix of kWidth quaternions, same formula as Quaternion::asMatrix().
+template <typename Ops>
+struct RotationBlock {
+    using Type = typename Ops::Type;
+    Type m[3][3]; ///< m[row][col]
+
+    explicit RotationBlock(const QuaternionBlock<Ops>& q) noexcept {
+        const auto one = Ops::set1(1.f);
+        const auto x2  = Ops::add(q.x, q.x);
+        const auto y2  = Ops::add(q.y, q.y);
+        const auto z2  = Ops::add(q.z, q.z);
+        const auto xx  = Ops::mul(q.x, x2);
+        const auto yy  = Ops::mul(q.y, y2);
+        const auto zz  = Ops::mul(q.z, z2);
+        const auto xy  = Ops::mul(q.x, y2);
+        const auto xz  = Ops::mul(q.x, z2);
+        const auto yz  = Ops::mul(q.y, z2);
+        const auto wx  = Ops::mul(q.w, x2);
+        const auto wy  = Ops::mul(q.w, y2);
+        const auto wz  = Ops::mul(q.w, z2);
+        m[0][0]        = Ops::sub(one, Ops::add(yy, zz));
+        m[0][1]        = Ops::sub(xy, wz);
+        m[0][2]        = Ops::add(xz, wy);
+        m[1][0]        = Ops::add(xy, wz);
+        m[1][1]        = Ops::sub(one, Ops::add(xx, zz));
+        m[1][2]        = Ops::sub(yz, wx);
+        m[2][0]        = Ops::sub(xz, wy);
+        m[2][1]        = Ops::add(yz, wx);
+        m[2][2]        = Ops::sub(one, Ops::add(xx, yy));
+    }
+};
+
+template <typename Ops>
+std::size_t quaternionToMat3(const float* q, float* out, std::size_t begin,
+                             std::size_t count) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const RotationBlock<Ops> r(QuaternionBlock<Ops>::load(q + i * 4));
+        float*                   dst = out + i * 9;
+        for (unsigned col = 0; col < 3; col++) {
+            Ops::storeAoS3(dst + col * 3, 9, r.m[0][col], r.m[1][col], r.m[2][col]);
+        }
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t quaternionToMat4(const float* q, float* out, std::size_t begin,
+                             std::size_t count) noexcept {
+    const auto  zero = Ops::set1(0.f);
+    const auto  one  = Ops::set1(1.f);
+    std::size_t i    = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const RotationBlock<Ops> r(QuaternionBlock<Ops>::load(q + i * 4));
+        float*                   dst = out + i * 16;
+        for (unsigned col = 0; col < 3; col++) {
+            Ops::storeAoS4(dst + col * 4, 16, r.m[0][col], r.m[1][col], r.m[2][col], zero);
+        }
+        Ops::storeAoS4(dst + 12, 16, zero, zero, zero, one);
+    }
+    return i;
+}
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
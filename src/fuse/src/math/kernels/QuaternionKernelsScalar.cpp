@@ -0,0 +1,35 @@
+#include "QuaternionKernels.h"
+#include "QuaternionKernelsImpl.h"
+
+namespace fuse::kernels::scalar {
+
+using Ops = impl::ScalarOps;
+
+template <impl::Interpolation kInterpolation>
+void interpolate(const float* a, const float* b, const float* t, float* out,
+                 std::size_t count) noexcept {
+    impl::interpolate<Ops, kInterpolation>(a, b, t, out, 0, count);
+}
+
+void nlerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept {
+    interpolate<impl::Interpolation::Nlerp>(a, b, t, out, count);
+}
+
+void slerp(const float* a, const float* b, const float* t, float* out, std::size_t count) noexcept {
+    interpolate<impl::Interpolation::Slerp>(a, b, t, out, count);
+}
+
+void slerpShortestPath(const float* a, const float* b, const float* t, float* out,
+                       std::size_t count) noexcept {
+    interpolate<impl::Interpolation::SlerpShortestPath>(a, b, t, out, count);
+}
+
+void quaternionToMat3(const float* q, float* out, std::size_t count) noexcept {
+    impl::quaternionToMat3<Ops>(q, out, 0, count);
+}
+
+void quaternionToMat4(const float* q, float* out, std::size_t count) noexcept {
+    impl::quaternionToMat4<Ops>(q, out, 0, count);
+}
+
+} // namespace fuse::kernels::scalar
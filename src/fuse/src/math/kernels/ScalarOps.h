@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file
+/// @brief Operations on a single float with the same interface as simd::SseOps and simd::Avx2Ops.
+///
+/// The kernels written once for all the instruction sets (SoAKernelsImpl.h,
+/// QuaternionKernelsImpl.h) use it for the scalar kernels and the tails.
+
+#include "Target.h"
+
+#include <cmath>
+#include <cstddef>
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Operations on a single float, used for the scalar kernels and the tails.
+struct ScalarOps {
+    using Type                          = float;
+    using Mask                          = bool;
+    static constexpr std::size_t kWidth = 1;
+
+    static Type load(const float* p) noexcept { return *p; }
+    static void store(float* p, Type v) noexcept { *p = v; }
+    static Type set1(float v) noexcept { return v; }
+    static Type add(Type a, Type b) noexcept { return a + b; }
+    static Type sub(Type a, Type b) noexcept { return a - b; }
+    static Type mul(Type a, Type b) noexcept { return a * b; }
+    static Type div(Type a, Type b) noexcept { return a / b; }
+    static Type sqrt(Type v) noexcept { return std::sqrt(v); }
+    static Type madd(Type a, Type b, Type c) noexcept { return a + b * c; }
+
+    static Mask lessThan(Type a, Type b) noexcept { return a < b; }
+    static Mask maskXor(Mask a, Mask b) noexcept { return a != b; }
+    static Mask maskOr(Mask a, Mask b) noexcept { return a || b; }
+    /// @brief Return the mask as an integer, the bit @b i is the lane @b i.
+    static unsigned toBits(Mask mask) noexcept { return mask ? 1u : 0u; }
+    static Type select(Mask mask, Type a, Type b) noexcept { return mask ? a : b; }
+
+    using Int = int;
+    /// @brief Convert to integer, rounding toward zero.
+    static Int  truncate(Type v) noexcept { return static_cast<int>(v); }
+    static Type toFloat(Int v) noexcept { return static_cast<float>(v); }
+    /// @brief Return true where the bit @p bit of @p v is set.
+    static Mask testBit(Int v, int bit) noexcept { return (v & bit) != 0; }
+
+    /// @brief Load the first float of kWidth records, the record @b i is at `p + i * stride`.
+    static Type gather(const float* p, std::size_t) noexcept { return *p; }
+
+    /// @brief Load kWidth records of 4 floats and return one register per field.
+    static void loadAoS4(const float* p, Type& x, Type& y, Type& z, Type& w) noexcept {
+        x = p[0];
+        y = p[1];
+        z = p[2];
+        w = p[3];
+    }
+
+    /// @brief Inverse of loadAoS4(), the record @b i is stored at `p + i * stride`.
+    static void storeAoS4(float* p, std::size_t, Type x, Type y, Type z, Type w) noexcept {
+        p[0] = x;
+        p[1] = y;
+        p[2] = z;
+        p[3] = w;
+    }
+
+    /// @brief Same as storeAoS4() for records of 3 floats.
+    static void storeAoS3(float* p, std::size_t, Type x, Type y, Type z) noexcept {
+        p[0] = x;
+        p[1] = y;
+        p[2] = z;
+    }
+};
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
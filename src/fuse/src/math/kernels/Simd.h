@@ -0,0 +1,319 @@
+#pragma once
+
+/// @file
+/// @brief Small helpers on top of the x86 intrinsics shared by the SIMD kernels.
+///
+/// Only include this file from a kernel translation unit compiled for SSE, AVX2 or AVX-512.
+/// The helpers available depend on the instruction set the translation unit is compiled for
+/// (__AVX2__, __AVX512F__) and not on FUSE_SIMD_*, which only tell which kernels exist.
+
+#if !defined(FUSE_SIMD_SSE)
+#    error "Simd.h require FUSE_SIMD_SSE."
+#endif
+
+#include "Target.h"
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+namespace fuse::kernels::simd {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Shuffle 2 vectors, result is (a[x], a[y], b[z], b[w]).
+#define FUSE_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+
+/// @brief Swizzle a vector, result is (v[x], v[y], v[z], v[w]).
+#define FUSE_SWIZZLE(v, x, y, z, w) FUSE_SHUFFLE(v, v, x, y, z, w)
+
+/// @brief Broadcast the lane @p I of @p v to all lanes.
+template <int I>
+[[nodiscard]] inline __m128 splat(__m128 v) noexcept {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I));
+}
+
+/// @brief Return a + b * c
+[[nodiscard]] inline __m128 madd(__m128 a, __m128 b, __m128 c) noexcept {
+#if defined(__AVX2__)
+    return _mm_fmadd_ps(b, c, a);
+#else
+    return _mm_add_ps(a, _mm_mul_ps(b, c));
+#endif
+}
+
+/// @copydoc madd(__m128, __m128, __m128)
+[[nodiscard]] inline __m128d madd(__m128d a, __m128d b, __m128d c) noexcept {
+#if defined(__AVX2__)
+    return _mm_fmadd_pd(b, c, a);
+#else
+    return _mm_add_pd(a, _mm_mul_pd(b, c));
+#endif
+}
+
+/// @brief Return the matrix @p m (4 columns) multiplied by the column vector @p v.
+[[nodiscard]] inline __m128 transform(const __m128 m[4], __m128 v) noexcept {
+    __m128 r = _mm_mul_ps(m[0], splat<0>(v));
+    r        = madd(r, m[1], splat<1>(v));
+    r        = madd(r, m[2], splat<2>(v));
+    r        = madd(r, m[3], splat<3>(v));
+    return r;
+}
+
+/// @brief Load the 4 columns of a column-major matrix.
+inline void loadColumns(const float* m, __m128 columns[4]) noexcept {
+    columns[0] = _mm_loadu_ps(m + 0);
+    columns[1] = _mm_loadu_ps(m + 4);
+    columns[2] = _mm_loadu_ps(m + 8);
+    columns[3] = _mm_loadu_ps(m + 12);
+}
+
+/// @brief Store the 3 first lanes of @p v.
+inline void storeu3(float* p, __m128 v) noexcept {
+    _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+}
+
+/// @brief Convert 4 packed Vec3 (AoS) to one register per component (SoA).
+///
+/// The input is (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3).
+inline void deinterleave3(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z) noexcept {
+    x = FUSE_SHUFFLE(a, FUSE_SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+    y = FUSE_SHUFFLE(FUSE_SHUFFLE(a, b, 1, 1, 0, 0), FUSE_SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+    z = FUSE_SHUFFLE(FUSE_SHUFFLE(a, b, 2, 2, 1, 1), c, 0, 2, 0, 3);
+}
+
+/// @brief Inverse of deinterleave3(), convert one register per component to 4 packed Vec3.
+inline void interleave3(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c) noexcept {
+    a = FUSE_SHUFFLE(FUSE_SHUFFLE(x, y, 0, 0, 0, 0), FUSE_SHUFFLE(z, x, 0, 0, 1, 1), 0, 2, 0, 2);
+    b = FUSE_SHUFFLE(FUSE_SHUFFLE(y, z, 1, 1, 1, 1), FUSE_SHUFFLE(x, y, 2, 2, 2, 2), 0, 2, 0, 2);
+    c = FUSE_SHUFFLE(FUSE_SHUFFLE(z, x, 2, 2, 3, 3), FUSE_SHUFFLE(y, z, 3, 3, 3, 3), 0, 2, 0, 2);
+}
+
+#if defined(__AVX2__)
+
+/// @brief Same as FUSE_SHUFFLE() on both 128 bits lanes of 256 bits registers.
+#    define FUSE_SHUFFLE256(a, b, x, y, z, w) _mm256_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+
+/// @brief Return a + b * c
+[[nodiscard]] inline __m256 madd(__m256 a, __m256 b, __m256 c) noexcept {
+    return _mm256_fmadd_ps(b, c, a);
+}
+
+/// @copydoc madd(__m256, __m256, __m256)
+[[nodiscard]] inline __m256d madd(__m256d a, __m256d b, __m256d c) noexcept {
+    return _mm256_fmadd_pd(b, c, a);
+}
+
+/// @brief deinterleave3() on both 128 bits lanes.
+inline void deinterleave3(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z) noexcept {
+    x = FUSE_SHUFFLE256(a, FUSE_SHUFFLE256(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+    y = FUSE_SHUFFLE256(FUSE_SHUFFLE256(a, b, 1, 1, 0, 0), FUSE_SHUFFLE256(b, c, 3, 3, 2, 2), 0, 2,
+                        0, 2);
+    z = FUSE_SHUFFLE256(FUSE_SHUFFLE256(a, b, 2, 2, 1, 1), c, 0, 2, 0, 3);
+}
+
+/// @brief interleave3() on both 128 bits lanes.
+inline void interleave3(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c) noexcept {
+    a = FUSE_SHUFFLE256(FUSE_SHUFFLE256(x, y, 0, 0, 0, 0), FUSE_SHUFFLE256(z, x, 0, 0, 1, 1), 0, 2,
+                        0, 2);
+    b = FUSE_SHUFFLE256(FUSE_SHUFFLE256(y, z, 1, 1, 1, 1), FUSE_SHUFFLE256(x, y, 2, 2, 2, 2), 0, 2,
+                        0, 2);
+    c = FUSE_SHUFFLE256(FUSE_SHUFFLE256(z, x, 2, 2, 3, 3), FUSE_SHUFFLE256(y, z, 3, 3, 3, 3), 0, 2,
+                        0, 2);
+}
+
+/// @brief Load 2 unaligned 128 bits values in the low and high lanes.
+[[nodiscard]] inline __m256 loadu2(const float* low, const float* high) noexcept {
+    return _mm256_set_m128(_mm_loadu_ps(high), _mm_loadu_ps(low));
+}
+
+/// @brief Store the low and high lanes to 2 unaligned addresses.
+inline void storeu2(float* low, float* high, __m256 v) noexcept {
+    _mm_storeu_ps(low, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(high, _mm256_extractf128_ps(v, 1));
+}
+
+/// @brief Transpose the 4x4 matrix formed by @p a, @p b, @p c, @p d in each 128 bits lane.
+inline void transpose4(__m256& a, __m256& b, __m256& c, __m256& d) noexcept {
+    const __m256 t0 = _mm256_unpacklo_ps(a, b);
+    const __m256 t1 = _mm256_unpackhi_ps(a, b);
+    const __m256 t2 = _mm256_unpacklo_ps(c, d);
+    const __m256 t3 = _mm256_unpackhi_ps(c, d);
+    a               = FUSE_SHUFFLE256(t0, t2, 0, 1, 0, 1);
+    b               = FUSE_SHUFFLE256(t0, t2, 2, 3, 2, 3);
+    c               = FUSE_SHUFFLE256(t1, t3, 0, 1, 0, 1);
+    d               = FUSE_SHUFFLE256(t1, t3, 2, 3, 2, 3);
+}
+
+#endif
+
+/// @brief Operations on 4 floats, used by the kernels written once for all the instruction sets.
+/// @see ScalarOps
+struct SseOps {
+    using Type                          = __m128;
+    static constexpr std::size_t kWidth = 4;
+
+    static Type load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Type v) noexcept { _mm_storeu_ps(p, v); }
+    static Type set1(float v) noexcept { return _mm_set1_ps(v); }
+    static Type add(Type a, Type b) noexcept { return _mm_add_ps(a, b); }
+    static Type sub(Type a, Type b) noexcept { return _mm_sub_ps(a, b); }
+    static Type mul(Type a, Type b) noexcept { return _mm_mul_ps(a, b); }
+    static Type div(Type a, Type b) noexcept { return _mm_div_ps(a, b); }
+    static Type sqrt(Type v) noexcept { return _mm_sqrt_ps(v); }
+    static Type madd(Type a, Type b, Type c) noexcept { return simd::madd(a, b, c); }
+
+    using Mask = __m128;
+    static Mask lessThan(Type a, Type b) noexcept { return _mm_cmplt_ps(a, b); }
+    static Mask maskXor(Mask a, Mask b) noexcept { return _mm_xor_ps(a, b); }
+    static Mask maskOr(Mask a, Mask b) noexcept { return _mm_or_ps(a, b); }
+    static unsigned toBits(Mask mask) noexcept {
+        return static_cast<unsigned>(_mm_movemask_ps(mask));
+    }
+    static Type select(Mask mask, Type a, Type b) noexcept {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    using Int = __m128i;
+    static Int  truncate(Type v) noexcept { return _mm_cvttps_epi32(v); }
+    static Type toFloat(Int v) noexcept { return _mm_cvtepi32_ps(v); }
+    static Mask testBit(Int v, int bit) noexcept {
+        const Int b = _mm_set1_epi32(bit);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(v, b), b));
+    }
+
+    static Type gather(const float* p, std::size_t stride) noexcept {
+        return _mm_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride]);
+    }
+
+    static void loadAoS4(const float* p, Type& x, Type& y, Type& z, Type& w) noexcept {
+        x = _mm_loadu_ps(p);
+        y = _mm_loadu_ps(p + 4);
+        z = _mm_loadu_ps(p + 8);
+        w = _mm_loadu_ps(p + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+    }
+
+    static void storeAoS4(float* p, std::size_t stride, Type x, Type y, Type z, Type w) noexcept {
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(p, x);
+        _mm_storeu_ps(p + stride, y);
+        _mm_storeu_ps(p + 2 * stride, z);
+        _mm_storeu_ps(p + 3 * stride, w);
+    }
+
+    static void storeAoS3(float* p, std::size_t stride, Type x, Type y, Type z) noexcept {
+        Type w = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        storeu3(p, x);
+        storeu3(p + stride, y);
+        storeu3(p + 2 * stride, z);
+        storeu3(p + 3 * stride, w);
+    }
+};
+
+#if defined(__AVX2__)
+/// @brief Operations on 8 floats.
+/// @see SseOps
+struct Avx2Ops {
+    using Type                          = __m256;
+    static constexpr std::size_t kWidth = 8;
+
+    static Type load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float* p, Type v) noexcept { _mm256_storeu_ps(p, v); }
+    static Type set1(float v) noexcept { return _mm256_set1_ps(v); }
+    static Type add(Type a, Type b) noexcept { return _mm256_add_ps(a, b); }
+    static Type sub(Type a, Type b) noexcept { return _mm256_sub_ps(a, b); }
+    static Type mul(Type a, Type b) noexcept { return _mm256_mul_ps(a, b); }
+    static Type div(Type a, Type b) noexcept { return _mm256_div_ps(a, b); }
+    static Type sqrt(Type v) noexcept { return _mm256_sqrt_ps(v); }
+    static Type madd(Type a, Type b, Type c) noexcept { return simd::madd(a, b, c); }
+
+    using Mask = __m256;
+    static Mask lessThan(Type a, Type b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask maskXor(Mask a, Mask b) noexcept { return _mm256_xor_ps(a, b); }
+    static Mask maskOr(Mask a, Mask b) noexcept { return _mm256_or_ps(a, b); }
+    static unsigned toBits(Mask mask) noexcept {
+        return static_cast<unsigned>(_mm256_movemask_ps(mask));
+    }
+    static Type select(Mask mask, Type a, Type b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+
+    using Int = __m256i;
+    static Int  truncate(Type v) noexcept { return _mm256_cvttps_epi32(v); }
+    static Type toFloat(Int v) noexcept { return _mm256_cvtepi32_ps(v); }
+    static Mask testBit(Int v, int bit) noexcept {
+        const Int b = _mm256_set1_epi32(bit);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(v, b), b));
+    }
+
+    static Type gather(const float* p, std::size_t stride) noexcept {
+        return _mm256_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride], p[4 * stride],
+                              p[5 * stride], p[6 * stride], p[7 * stride]);
+    }
+
+    // The records i and i + 4 share the same register, one in each 128 bits lane.
+
+    static void loadAoS4(const float* p, Type& x, Type& y, Type& z, Type& w) noexcept {
+        x = loadu2(p, p + 16);
+        y = loadu2(p + 4, p + 20);
+        z = loadu2(p + 8, p + 24);
+        w = loadu2(p + 12, p + 28);
+        transpose4(x, y, z, w);
+    }
+
+    static void storeAoS4(float* p, std::size_t stride, Type x, Type y, Type z, Type w) noexcept {
+        transpose4(x, y, z, w);
+        storeu2(p, p + 4 * stride, x);
+        storeu2(p + stride, p + 5 * stride, y);
+        storeu2(p + 2 * stride, p + 6 * stride, z);
+        storeu2(p + 3 * stride, p + 7 * stride, w);
+    }
+
+    static void storeAoS3(float* p, std::size_t stride, Type x, Type y, Type z) noexcept {
+        Type w = _mm256_setzero_ps();
+        transpose4(x, y, z, w);
+        const Type records[4] = {x, y, z, w};
+        for (std::size_t i = 0; i < 4; i++) {
+            storeu3(p + i * stride, _mm256_castps256_ps128(records[i]));
+            storeu3(p + (i + 4) * stride, _mm256_extractf128_ps(records[i], 1));
+        }
+    }
+};
+#endif
+
+#if defined(__AVX512F__)
+/// @brief Operations on 16 floats, the masks are AVX-512 mask registers.
+/// @note There is no loadAoS4() / storeAoS4(), only the stream kernels use it.
+/// @see SseOps
+struct Avx512Ops {
+    using Type                          = __m512;
+    static constexpr std::size_t kWidth = 16;
+
+    static Type load(const float* p) noexcept { return _mm512_loadu_ps(p); }
+    static void store(float* p, Type v) noexcept { _mm512_storeu_ps(p, v); }
+    static Type set1(float v) noexcept { return _mm512_set1_ps(v); }
+    static Type add(Type a, Type b) noexcept { return _mm512_add_ps(a, b); }
+    static Type sub(Type a, Type b) noexcept { return _mm512_sub_ps(a, b); }
+    static Type mul(Type a, Type b) noexcept { return _mm512_mul_ps(a, b); }
+    static Type div(Type a, Type b) noexcept { return _mm512_div_ps(a, b); }
+    static Type sqrt(Type v) noexcept { return _mm512_sqrt_ps(v); }
+    static Type madd(Type a, Type b, Type c) noexcept { return _mm512_fmadd_ps(b, c, a); }
+
+    using Mask = __mmask16;
+    static Mask lessThan(Type a, Type b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static Mask maskXor(Mask a, Mask b) noexcept { return _kxor_mask16(a, b); }
+    static Type select(Mask mask, Type a, Type b) noexcept {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+
+    using Int = __m512i;
+    static Int  truncate(Type v) noexcept { return _mm512_cvttps_epi32(v); }
+    static Type toFloat(Int v) noexcept { return _mm512_cvtepi32_ps(v); }
+    static Mask testBit(Int v, int bit) noexcept {
+        return _mm512_test_epi32_mask(v, _mm512_set1_epi32(bit));
+    }
+};
+#endif
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::simd
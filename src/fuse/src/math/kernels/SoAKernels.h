@@ -0,0 +1,202 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the structure of arrays vectors (VecSoA.h).
+///
+/// Like Mat4Kernels.h, each kernel exists in one namespace per instruction set and
+/// the namespace @b active alias the best one enabled by the build system. These kernels are
+/// bound by the arithmetic and have an avx512 version.
+///
+/// A vector stream is an array of pointers, one per component (x, y, z, w), each pointing
+/// to @p count floats. Pointers do not need to be aligned. An output stream may be equal
+/// to an input stream but must not partially overlap it.
+
+#include <cstddef>
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief out[i] = a[i] + b[i]
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept;
+
+/// @brief out[i] = a[i] * s + b[i]
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept;
+
+/// @brief out[i] = dot(a[i], b[i]) where @p a and @p b are streams of @p n components.
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept;
+
+/// @brief out[i] = length(a[i]) where @p a is a stream of @p n components.
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept;
+
+/// @brief out[i] = normalize(a[i]) where @p a and @p out are streams of @p n components.
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @brief out[i] = cross(a[i], b[i]) where all streams have 3 components.
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept;
+
+/// @brief Convert @p count packed vectors of @p n components (3 or 4) to a stream.
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @brief Convert a stream of @p n components (3 or 4) to @p count packed vectors.
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::add()
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::mulAdd()
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::dot()
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept;
+
+/// @copydoc scalar::length()
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::normalize()
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::cross()
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept;
+
+/// @copydoc scalar::deinterleave()
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::interleave()
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::add()
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::mulAdd()
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::dot()
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept;
+
+/// @copydoc scalar::length()
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::normalize()
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::cross()
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept;
+
+/// @copydoc scalar::deinterleave()
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::interleave()
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_AVX512)
+namespace avx512 {
+
+/// @copydoc scalar::add()
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::mulAdd()
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::dot()
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept;
+
+/// @copydoc scalar::length()
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::normalize()
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::cross()
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept;
+
+/// @copydoc scalar::deinterleave()
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept;
+
+/// @copydoc scalar::interleave()
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept;
+
+} // namespace avx512
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void add(const float* a, const float* b, float* out, std::size_t count) noexcept {
+    dispatch<scalar::add, sse::add, avx2::add, avx512::add>(a, b, out, count);
+}
+
+inline void mulAdd(const float* a, float s, const float* b, float* out,
+                   std::size_t count) noexcept {
+    dispatch<scalar::mulAdd, sse::mulAdd, avx2::mulAdd, avx512::mulAdd>(a, s, b, out, count);
+}
+
+inline void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+                std::size_t count) noexcept {
+    dispatch<scalar::dot, sse::dot, avx2::dot, avx512::dot>(a, b, n, out, count);
+}
+
+inline void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept {
+    dispatch<scalar::length, sse::length, avx2::length, avx512::length>(a, n, out, count);
+}
+
+inline void normalize(const float* const* a, float* const* out, unsigned n,
+                      std::size_t count) noexcept {
+    dispatch<scalar::normalize, sse::normalize, avx2::normalize, avx512::normalize>(
+      a, out, n, count);
+}
+
+inline void cross(const float* const* a, const float* const* b, float* const* out,
+                  std::size_t count) noexcept {
+    dispatch<scalar::cross, sse::cross, avx2::cross, avx512::cross>(a, b, out, count);
+}
+
+inline void deinterleave(const float* in, float* const* out, unsigned n,
+                         std::size_t count) noexcept {
+    dispatch<scalar::deinterleave, sse::deinterleave, avx2::deinterleave, avx512::deinterleave>(
+      in, out, n, count);
+}
+
+inline void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept {
+    dispatch<scalar::interleave, sse::interleave, avx2::interleave, avx512::interleave>(
+      in, out, n, count);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX512)
+namespace active = avx512;
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
@@ -0,0 +1,89 @@
+#include "SoAKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "SoAKernelsImpl.h"
+#    include "Simd.h"
+
+namespace fuse::kernels::avx2 {
+
+using Ops = simd::Avx2Ops;
+using impl::ScalarOps;
+
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::add<Ops>(a, b, out, 0, count);
+    impl::add<ScalarOps>(a, b, out, i, count);
+}
+
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::mulAdd<Ops>(a, s, b, out, 0, count);
+    impl::mulAdd<ScalarOps>(a, s, b, out, i, count);
+}
+
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept {
+    const auto i = impl::dot<Ops>(a, b, n, out, 0, count);
+    impl::dot<ScalarOps>(a, b, n, out, i, count);
+}
+
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept {
+    const auto i = impl::length<Ops>(a, n, out, 0, count);
+    impl::length<ScalarOps>(a, n, out, i, count);
+}
+
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept {
+    const auto i = impl::normalize<Ops>(a, out, n, 0, count);
+    impl::normalize<ScalarOps>(a, out, n, i, count);
+}
+
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept {
+    const auto i = impl::cross<Ops>(a, b, out, 0, count);
+    impl::cross<ScalarOps>(a, b, out, i, count);
+}
+
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept {
+    if (n != 3) {
+        // 4 components vectors are a plain 4x4 transpose, the SSE kernel is already optimal.
+        sse::deinterleave(in, out, n, count);
+        return;
+    }
+
+    // The low lane holds the vectors [i, i + 4) and the high lane [i + 4, i + 8),
+    // so each component register ends up in order.
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* src = in + i * 3;
+        __m256       x, y, z;
+        simd::deinterleave3(simd::loadu2(src, src + 12), simd::loadu2(src + 4, src + 16),
+                            simd::loadu2(src + 8, src + 20), x, y, z);
+        _mm256_storeu_ps(out[0] + i, x);
+        _mm256_storeu_ps(out[1] + i, y);
+        _mm256_storeu_ps(out[2] + i, z);
+    }
+    float* const tail[3] = {out[0] + i, out[1] + i, out[2] + i};
+    sse::deinterleave(in + i * 3, tail, n, count - i);
+}
+
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept {
+    if (n != 3) {
+        sse::interleave(in, out, n, count);
+        return;
+    }
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float* dst = out + i * 3;
+        __m256 a, b, c;
+        simd::interleave3(_mm256_loadu_ps(in[0] + i), _mm256_loadu_ps(in[1] + i),
+                          _mm256_loadu_ps(in[2] + i), a, b, c);
+        simd::storeu2(dst, dst + 12, a);
+        simd::storeu2(dst + 4, dst + 16, b);
+        simd::storeu2(dst + 8, dst + 20, c);
+    }
+    const float* const tail[3] = {in[0] + i, in[1] + i, in[2] + i};
+    sse::interleave(tail, out + i * 3, n, count - i);
+}
+
+} // namespace fuse::kernels::avx2
+
+#endif
@@ -0,0 +1,57 @@
+#include "SoAKernels.h"
+
+#if defined(FUSE_SIMD_AVX512)
+#    include "SoAKernelsImpl.h"
+#    include "Simd.h"
+
+namespace fuse::kernels::avx512 {
+
+using Ops = simd::Avx512Ops;
+using impl::ScalarOps;
+
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::add<Ops>(a, b, out, 0, count);
+    impl::add<ScalarOps>(a, b, out, i, count);
+}
+
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::mulAdd<Ops>(a, s, b, out, 0, count);
+    impl::mulAdd<ScalarOps>(a, s, b, out, i, count);
+}
+
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept {
+    const auto i = impl::dot<Ops>(a, b, n, out, 0, count);
+    impl::dot<ScalarOps>(a, b, n, out, i, count);
+}
+
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept {
+    const auto i = impl::length<Ops>(a, n, out, 0, count);
+    impl::length<ScalarOps>(a, n, out, i, count);
+}
+
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept {
+    const auto i = impl::normalize<Ops>(a, out, n, 0, count);
+    impl::normalize<ScalarOps>(a, out, n, i, count);
+}
+
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept {
+    const auto i = impl::cross<Ops>(a, b, out, 0, count);
+    impl::cross<ScalarOps>(a, b, out, i, count);
+}
+
+// The conversions are bound by the shuffles, which do not cross the 128 bits lanes,
+// 512 bits registers would not shuffle more floats per instruction than the AVX2 kernels.
+
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept {
+    avx2::deinterleave(in, out, n, count);
+}
+
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept {
+    avx2::interleave(in, out, n, count);
+}
+
+} // namespace fuse::kernels::avx512
+
+#endif
@@ -0,0 +1,143 @@
+#pragma once
+
+/// @file
+/// @brief Implementation of the SoA kernels (SoAKernels.h) written once for all instruction sets.
+///
+/// The functions are templated on an @b Ops type (ScalarOps, simd::SseOps, simd::Avx2Ops)
+/// which provides the load/store and arithmetic operations on Ops::kWidth floats.
+/// Each function processes the elements from @p begin by blocks of Ops::kWidth, stops before
+/// exceeding @p count and returns the index of the first element not processed.
+/// The caller finishes the tail with ScalarOps.
+
+#include "ScalarOps.h"
+#include "Target.h"
+
+#include <cstddef>
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+template <typename Ops>
+std::size_t add(const float* a, const float* b, float* out, std::size_t begin,
+                std::size_t count) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        Ops::store(out + i, Ops::add(Ops::load(a + i), Ops::load(b + i)));
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t mulAdd(const float* a, float s, const float* b, float* out, std::size_t begin,
+                   std::size_t count) noexcept {
+    const auto  scale = Ops::set1(s);
+    std::size_t i     = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        Ops::store(out + i, Ops::madd(Ops::load(b + i), Ops::load(a + i), scale));
+    }
+    return i;
+}
+
+/// @brief Dot product of the element @p i, same order of operations as Vec3::dot().
+template <typename Ops, unsigned N>
+typename Ops::Type dotAt(const float* const* a, const float* const* b, std::size_t i) noexcept {
+    auto result = Ops::mul(Ops::load(a[0] + i), Ops::load(b[0] + i));
+    for (unsigned c = 1; c < N; c++) {
+        result = Ops::madd(result, Ops::load(a[c] + i), Ops::load(b[c] + i));
+    }
+    return result;
+}
+
+template <typename Ops, unsigned N>
+std::size_t dot(const float* const* a, const float* const* b, float* out, std::size_t begin,
+                std::size_t count) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        Ops::store(out + i, dotAt<Ops, N>(a, b, i));
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t dot(const float* const* a, const float* const* b, unsigned n, float* out,
+                std::size_t begin, std::size_t count) noexcept {
+    // The number of components is a template parameter so the loop over them is unrolled.
+    return n == 3 ? dot<Ops, 3>(a, b, out, begin, count) : dot<Ops, 4>(a, b, out, begin, count);
+}
+
+template <typename Ops, unsigned N>
+std::size_t length(const float* const* a, float* out, std::size_t begin,
+                   std::size_t count) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        Ops::store(out + i, Ops::sqrt(dotAt<Ops, N>(a, a, i)));
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t length(const float* const* a, unsigned n, float* out, std::size_t begin,
+                   std::size_t count) noexcept {
+    return n == 3 ? length<Ops, 3>(a, out, begin, count) : length<Ops, 4>(a, out, begin, count);
+}
+
+template <typename Ops, unsigned N>
+std::size_t normalize(const float* const* a, float* const* out, std::size_t begin,
+                      std::size_t count) noexcept {
+    const auto  one = Ops::set1(1.f);
+    std::size_t i   = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        // Same operations as Vec3::normalize().
+        const auto invLength = Ops::div(one, Ops::sqrt(dotAt<Ops, N>(a, a, i)));
+        for (unsigned c = 0; c < N; c++) {
+            Ops::store(out[c] + i, Ops::mul(Ops::load(a[c] + i), invLength));
+        }
+    }
+    return i;
+}
+
+template <typename Ops>
+std::size_t normalize(const float* const* a, float* const* out, unsigned n, std::size_t begin,
+                      std::size_t count) noexcept {
+    return n == 3 ? normalize<Ops, 3>(a, out, begin, count)
+                  : normalize<Ops, 4>(a, out, begin, count);
+}
+
+template <typename Ops>
+std::size_t cross(const float* const* a, const float* const* b, float* const* out,
+                  std::size_t begin, std::size_t count) noexcept {
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        const auto ax = Ops::load(a[0] + i);
+        const auto ay = Ops::load(a[1] + i);
+        const auto az = Ops::load(a[2] + i);
+        const auto bx = Ops::load(b[0] + i);
+        const auto by = Ops::load(b[1] + i);
+        const auto bz = Ops::load(b[2] + i);
+        Ops::store(out[0] + i, Ops::sub(Ops::mul(ay, bz), Ops::mul(az, by)));
+        Ops::store(out[1] + i, Ops::sub(Ops::mul(az, bx), Ops::mul(ax, bz)));
+        Ops::store(out[2] + i, Ops::sub(Ops::mul(ax, by), Ops::mul(ay, bx)));
+    }
+    return i;
+}
+
+inline void deinterleave(const float* in, float* const* out, unsigned n, std::size_t begin,
+                         std::size_t count) noexcept {
+    for (std::size_t i = begin; i < count; i++) {
+        for (unsigned c = 0; c < n; c++) {
+            out[c][i] = in[i * n + c];
+        }
+    }
+}
+
+inline void interleave(const float* const* in, float* out, unsigned n, std::size_t begin,
+                       std::size_t count) noexcept {
+    for (std::size_t i = begin; i < count; i++) {
+        for (unsigned c = 0; c < n; c++) {
+            out[i * n + c] = in[c][i];
+        }
+    }
+}
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
@@ -0,0 +1,104 @@
+#include "SoAKernels.h"
+
+#if defined(FUSE_SIMD_SSE)
+#    include "SoAKernelsImpl.h"
+#    include "Simd.h"
+
+namespace fuse::kernels::sse {
+
+using Ops = simd::SseOps;
+using impl::ScalarOps;
+
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::add<Ops>(a, b, out, 0, count);
+    impl::add<ScalarOps>(a, b, out, i, count);
+}
+
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept {
+    const auto i = impl::mulAdd<Ops>(a, s, b, out, 0, count);
+    impl::mulAdd<ScalarOps>(a, s, b, out, i, count);
+}
+
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept {
+    const auto i = impl::dot<Ops>(a, b, n, out, 0, count);
+    impl::dot<ScalarOps>(a, b, n, out, i, count);
+}
+
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept {
+    const auto i = impl::length<Ops>(a, n, out, 0, count);
+    impl::length<ScalarOps>(a, n, out, i, count);
+}
+
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept {
+    const auto i = impl::normalize<Ops>(a, out, n, 0, count);
+    impl::normalize<ScalarOps>(a, out, n, i, count);
+}
+
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept {
+    const auto i = impl::cross<Ops>(a, b, out, 0, count);
+    impl::cross<ScalarOps>(a, b, out, i, count);
+}
+
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept {
+    std::size_t i = 0;
+    if (n == 3) {
+        for (; i + 4 <= count; i += 4) {
+            const float* src = in + i * 3;
+            __m128       x, y, z;
+            simd::deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x,
+                                y, z);
+            _mm_storeu_ps(out[0] + i, x);
+            _mm_storeu_ps(out[1] + i, y);
+            _mm_storeu_ps(out[2] + i, z);
+        }
+    } else if (n == 4) {
+        for (; i + 4 <= count; i += 4) {
+            const float* src = in + i * 4;
+            __m128       x   = _mm_loadu_ps(src);
+            __m128       y   = _mm_loadu_ps(src + 4);
+            __m128       z   = _mm_loadu_ps(src + 8);
+            __m128       w   = _mm_loadu_ps(src + 12);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(out[0] + i, x);
+            _mm_storeu_ps(out[1] + i, y);
+            _mm_storeu_ps(out[2] + i, z);
+            _mm_storeu_ps(out[3] + i, w);
+        }
+    }
+    impl::deinterleave(in, out, n, i, count);
+}
+
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept {
+    std::size_t i = 0;
+    if (n == 3) {
+        for (; i + 4 <= count; i += 4) {
+            float* dst = out + i * 3;
+            __m128 a, b, c;
+            simd::interleave3(_mm_loadu_ps(in[0] + i), _mm_loadu_ps(in[1] + i),
+                              _mm_loadu_ps(in[2] + i), a, b, c);
+            _mm_storeu_ps(dst, a);
+            _mm_storeu_ps(dst + 4, b);
+            _mm_storeu_ps(dst + 8, c);
+        }
+    } else if (n == 4) {
+        for (; i + 4 <= count; i += 4) {
+            float* dst = out + i * 4;
+            __m128 v0  = _mm_loadu_ps(in[0] + i);
+            __m128 v1  = _mm_loadu_ps(in[1] + i);
+            __m128 v2  = _mm_loadu_ps(in[2] + i);
+            __m128 v3  = _mm_loadu_ps(in[3] + i);
+            _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+            _mm_storeu_ps(dst, v0);
+            _mm_storeu_ps(dst + 4, v1);
+            _mm_storeu_ps(dst + 8, v2);
+            _mm_storeu_ps(dst + 12, v3);
+        }
+    }
+    impl::interleave(in, out, n, i, count);
+}
+
+} // namespace fuse::kernels::sse
+
+#endif
@@ -0,0 +1,42 @@
+#include "SoAKernels.h"
+#include "SoAKernelsImpl.h"
+
+namespace fuse::kernels::scalar {
+
+using Ops = impl::ScalarOps;
+
+void add(const float* a, const float* b, float* out, std::size_t count) noexcept {
+    impl::add<Ops>(a, b, out, 0, count);
+}
+
+void mulAdd(const float* a, float s, const float* b, float* out, std::size_t count) noexcept {
+    impl::mulAdd<Ops>(a, s, b, out, 0, count);
+}
+
+void dot(const float* const* a, const float* const* b, unsigned n, float* out,
+         std::size_t count) noexcept {
+    impl::dot<Ops>(a, b, n, out, 0, count);
+}
+
+void length(const float* const* a, unsigned n, float* out, std::size_t count) noexcept {
+    impl::length<Ops>(a, n, out, 0, count);
+}
+
+void normalize(const float* const* a, float* const* out, unsigned n, std::size_t count) noexcept {
+    impl::normalize<Ops>(a, out, n, 0, count);
+}
+
+void cross(const float* const* a, const float* const* b, float* const* out,
+           std::size_t count) noexcept {
+    impl::cross<Ops>(a, b, out, 0, count);
+}
+
+void deinterleave(const float* in, float* const* out, unsigned n, std::size_t count) noexcept {
+    impl::deinterleave(in, out, n, 0, count);
+}
+
+void interleave(const float* const* in, float* out, unsigned n, std::size_t count) noexcept {
+    impl::interleave(in, out, n, 0, count);
+}
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,18 @@
+#pragma once
+
+/// @file
+/// @brief Name of the code generation target of the current translation unit.
+///
+/// With FUSE_SIMD=DISPATCH, the kernel translation units are compiled with different
+/// instruction sets (see FuseSimd.cmake). The inline functions and templates shared by the
+/// kernels (Simd.h, ScalarOps.h, *Impl.h) are declared in the inline namespace FUSE_SIMD_TARGET,
+/// so each instruction set gets its own symbols and the linker can never replace the baseline
+/// version of a function by an AVX one.
+
+#if defined(__AVX512F__)
+#    define FUSE_SIMD_TARGET avx512_target
+#elif defined(__AVX2__)
+#    define FUSE_SIMD_TARGET avx2_target
+#else
+#    define FUSE_SIMD_TARGET baseline_target
+#endif
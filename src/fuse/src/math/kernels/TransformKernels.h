@@ -0,0 +1,93 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the batch transformations (BatchTransform.h).
+///
+/// Like Mat4Kernels.h, each kernel exists in one namespace per instruction set and
+/// the namespace @b active alias the best one enabled by the build system.
+///
+/// The matrix is 16 floats in column-major order. Vec3 arrays are tightly packed
+/// (3 floats per element) and Vec4 arrays 4 floats per element.
+/// Pointers do not need to be aligned, @p out may be equal to @p in but must not
+/// partially overlap it.
+
+#include <cstddef>
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief Transform @p count points (x, y, z, 1) and drop the w component.
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @brief Transform @p count directions (x, y, z, 0) and drop the w component.
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @brief Transform @p count 4D vectors.
+void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::transformPoints()
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::transformDirections()
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::transformVec4()
+void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::transformPoints()
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::transformDirections()
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+/// @copydoc scalar::transformVec4()
+void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void transformPoints(const float* m, const float* in, float* out,
+                            std::size_t count) noexcept {
+    dispatch<scalar::transformPoints, sse::transformPoints, avx2::transformPoints>(
+      m, in, out, count);
+}
+
+inline void transformDirections(const float* m, const float* in, float* out,
+                                std::size_t count) noexcept {
+    dispatch<scalar::transformDirections, sse::transformDirections, avx2::transformDirections>(
+      m, in, out, count);
+}
+
+inline void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    dispatch<scalar::transformVec4, sse::transformVec4, avx2::transformVec4>(m, in, out, count);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
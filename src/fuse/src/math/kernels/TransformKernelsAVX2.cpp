@@ -0,0 +1,104 @@
+#include "TransformKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "Simd.h"
+
+namespace {
+
+using namespace fuse::kernels::simd;
+
+/// @brief Transform the vectors (x, y, z, 1) or (x, y, z, 0) and drop the w component.
+///
+/// 8 vectors are processed per iteration, each 128 bits lane holds 4 of them and
+/// runs the same algorithm as the SSE kernel.
+template <bool Translate>
+void transformVec3(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    const __m256 m00 = _mm256_set1_ps(m[0]);
+    const __m256 m01 = _mm256_set1_ps(m[4]);
+    const __m256 m02 = _mm256_set1_ps(m[8]);
+    const __m256 m10 = _mm256_set1_ps(m[1]);
+    const __m256 m11 = _mm256_set1_ps(m[5]);
+    const __m256 m12 = _mm256_set1_ps(m[9]);
+    const __m256 m20 = _mm256_set1_ps(m[2]);
+    const __m256 m21 = _mm256_set1_ps(m[6]);
+    const __m256 m22 = _mm256_set1_ps(m[10]);
+    const __m256 m03 = Translate ? _mm256_set1_ps(m[12]) : _mm256_setzero_ps();
+    const __m256 m13 = Translate ? _mm256_set1_ps(m[13]) : _mm256_setzero_ps();
+    const __m256 m23 = Translate ? _mm256_set1_ps(m[14]) : _mm256_setzero_ps();
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* src = in + i * 3;
+        float*       dst = out + i * 3;
+
+        __m256 x, y, z;
+        deinterleave3(loadu2(src, src + 12), loadu2(src + 4, src + 16), loadu2(src + 8, src + 20),
+                      x, y, z);
+
+        const __m256 rx = madd(madd(madd(m03, m00, x), m01, y), m02, z);
+        const __m256 ry = madd(madd(madd(m13, m10, x), m11, y), m12, z);
+        const __m256 rz = madd(madd(madd(m23, m20, x), m21, y), m22, z);
+
+        __m256 a, b, c;
+        interleave3(rx, ry, rz, a, b, c);
+        storeu2(dst, dst + 12, a);
+        storeu2(dst + 4, dst + 16, b);
+        storeu2(dst + 8, dst + 20, c);
+    }
+
+    // Tail, less than 8 vectors left.
+    if constexpr (Translate) {
+        fuse::kernels::sse::transformPoints(m, in + i * 3, out + i * 3, count - i);
+    } else {
+        fuse::kernels::sse::transformDirections(m, in + i * 3, out + i * 3, count - i);
+    }
+}
+
+} // namespace
+
+namespace fuse::kernels::avx2 {
+
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<true>(m, in, out, count);
+}
+
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<false>(m, in, out, count);
+}
+
+void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    // Each 256 bits register holds 2 vectors, the columns are duplicated in both lanes.
+    __m128 columns[4];
+    loadColumns(m, columns);
+    const __m256 c0 = _mm256_set_m128(columns[0], columns[0]);
+    const __m256 c1 = _mm256_set_m128(columns[1], columns[1]);
+    const __m256 c2 = _mm256_set_m128(columns[2], columns[2]);
+    const __m256 c3 = _mm256_set_m128(columns[3], columns[3]);
+
+    const auto transform2 = [&](__m256 v) noexcept {
+        __m256 r = _mm256_mul_ps(c0, FUSE_SHUFFLE256(v, v, 0, 0, 0, 0));
+        r        = madd(r, c1, FUSE_SHUFFLE256(v, v, 1, 1, 1, 1));
+        r        = madd(r, c2, FUSE_SHUFFLE256(v, v, 2, 2, 2, 2));
+        r        = madd(r, c3, FUSE_SHUFFLE256(v, v, 3, 3, 3, 3));
+        return r;
+    };
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 v01 = _mm256_loadu_ps(in + i * 4 + 0);
+        const __m256 v23 = _mm256_loadu_ps(in + i * 4 + 8);
+        const __m256 v45 = _mm256_loadu_ps(in + i * 4 + 16);
+        const __m256 v67 = _mm256_loadu_ps(in + i * 4 + 24);
+        _mm256_storeu_ps(out + i * 4 + 0, transform2(v01));
+        _mm256_storeu_ps(out + i * 4 + 8, transform2(v23));
+        _mm256_storeu_ps(out + i * 4 + 16, transform2(v45));
+        _mm256_storeu_ps(out + i * 4 + 24, transform2(v67));
+    }
+
+    // Tail, less than 8 vectors left.
+    sse::transformVec4(m, in + i * 4, out + i * 4, count - i);
+}
+
+} // namespace fuse::kernels::avx2
+
+#endif
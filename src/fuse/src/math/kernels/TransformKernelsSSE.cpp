@@ -0,0 +1,85 @@
+#include "TransformKernels.h"
+
+#if defined(FUSE_SIMD_SSE)
+#    include "Simd.h"
+
+namespace {
+
+using namespace fuse::kernels::simd;
+
+/// @brief Transform the vectors (x, y, z, 1) or (x, y, z, 0) and drop the w component.
+///
+/// 4 vectors are processed per iteration: the 12 floats are loaded in 3 registers and
+/// converted to one register per component, so no lane is wasted on the w component.
+template <bool Translate>
+void transformVec3(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    const __m128 m00 = _mm_set1_ps(m[0]), m01 = _mm_set1_ps(m[4]), m02 = _mm_set1_ps(m[8]);
+    const __m128 m10 = _mm_set1_ps(m[1]), m11 = _mm_set1_ps(m[5]), m12 = _mm_set1_ps(m[9]);
+    const __m128 m20 = _mm_set1_ps(m[2]), m21 = _mm_set1_ps(m[6]), m22 = _mm_set1_ps(m[10]);
+    const __m128 m03 = Translate ? _mm_set1_ps(m[12]) : _mm_setzero_ps();
+    const __m128 m13 = Translate ? _mm_set1_ps(m[13]) : _mm_setzero_ps();
+    const __m128 m23 = Translate ? _mm_set1_ps(m[14]) : _mm_setzero_ps();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = in + i * 3;
+        float*       dst = out + i * 3;
+
+        __m128 x, y, z;
+        deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), x, y, z);
+
+        const __m128 rx = madd(madd(madd(m03, m00, x), m01, y), m02, z);
+        const __m128 ry = madd(madd(madd(m13, m10, x), m11, y), m12, z);
+        const __m128 rz = madd(madd(madd(m23, m20, x), m21, y), m22, z);
+
+        __m128 a, b, c;
+        interleave3(rx, ry, rz, a, b, c);
+        _mm_storeu_ps(dst, a);
+        _mm_storeu_ps(dst + 4, b);
+        _mm_storeu_ps(dst + 8, c);
+    }
+
+    // Tail, less than 4 vectors left.
+    if constexpr (Translate) {
+        fuse::kernels::scalar::transformPoints(m, in + i * 3, out + i * 3, count - i);
+    } else {
+        fuse::kernels::scalar::transformDirections(m, in + i * 3, out + i * 3, count - i);
+    }
+}
+
+} // namespace
+
+namespace fuse::kernels::sse {
+
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<true>(m, in, out, count);
+}
+
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<false>(m, in, out, count);
+}
+
+void transformVec4(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    __m128 columns[4];
+    loadColumns(m, columns);
+
+    // Vec4 already fill a register, 4 independent vectors per iteration hide the latency.
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v0 = _mm_loadu_ps(in + i * 4 + 0);
+        const __m128 v1 = _mm_loadu_ps(in + i * 4 + 4);
+        const __m128 v2 = _mm_loadu_ps(in + i * 4 + 8);
+        const __m128 v3 = _mm_loadu_ps(in + i * 4 + 12);
+        _mm_storeu_ps(out + i * 4 + 0, transform(columns, v0));
+        _mm_storeu_ps(out + i * 4 + 4, transform(columns, v1));
+        _mm_storeu_ps(out + i * 4 + 8, transform(columns, v2));
+        _mm_storeu_ps(out + i * 4 + 12, transform(columns, v3));
+    }
+    for (; i < count; i++) {
+        _mm_storeu_ps(out + i * 4, transform(columns, _mm_loadu_ps(in + i * 4)));
+    }
+}
+
+} // namespace fuse::kernels::sse
+
+#endif
@@ -0,0 +1,53 @@
+#include "TransformKernels.h"
+
+#include <cstring>
+
+namespace {
+
+/// @brief Transform the vectors (x, y, z, w) and drop the w component of the result.
+template <unsigned W>
+void transformVec3(const float* matrix, const float* in, float* out, std::size_t count) noexcept {
+    // Local copy, otherwise the matrix is reloaded after each store since out may alias it.
+    float m[16];
+    std::memcpy(m, matrix, sizeof(m));
+
+    constexpr auto w = static_cast<float>(W);
+    for (std::size_t i = 0; i < count; i++) {
+        const float x = in[i * 3 + 0];
+        const float y = in[i * 3 + 1];
+        const float z = in[i * 3 + 2];
+        out[i * 3 + 0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+        out[i * 3 + 1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+        out[i * 3 + 2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+    }
+}
+
+} // namespace
+
+namespace fuse::kernels::scalar {
+
+void transformPoints(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<1>(m, in, out, count);
+}
+
+void transformDirections(const float* m, const float* in, float* out, std::size_t count) noexcept {
+    transformVec3<0>(m, in, out, count);
+}
+
+void transformVec4(const float* matrix, const float* in, float* out, std::size_t count) noexcept {
+    float m[16];
+    std::memcpy(m, matrix, sizeof(m));
+
+    for (std::size_t i = 0; i < count; i++) {
+        const float x = in[i * 4 + 0];
+        const float y = in[i * 4 + 1];
+        const float z = in[i * 4 + 2];
+        const float w = in[i * 4 + 3];
+        out[i * 4 + 0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+        out[i * 4 + 1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+        out[i * 4 + 2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+        out[i * 4 + 3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+    }
+}
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file
+/// @brief Low level kernels used to implement the batch trigonometric functions (FastTrig.h).
+///
+/// Like Mat4Kernels.h, each kernel exists in one namespace per instruction set and
+/// the namespace @b active alias the best one enabled by the build system. These kernels are
+/// bound by the arithmetic and have an avx512 version.
+///
+/// The angles are arrays of floats in degrees. Pointers do not need to be aligned.
+
+#include "fuse/math/FastTrig.h"
+
+#include <cstddef>
+
+#if defined(FUSE_SIMD_DISPATCH)
+#    include "Dispatch.h"
+#endif
+
+namespace fuse::kernels {
+
+namespace scalar {
+
+/// @brief sin[i], cos[i] = sincos(degrees[i]), @p sin or @p cos may be null to skip it.
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept;
+
+} // namespace scalar
+
+#if defined(FUSE_SIMD_SSE)
+namespace sse {
+
+/// @copydoc scalar::sincos()
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept;
+
+} // namespace sse
+#endif
+
+#if defined(FUSE_SIMD_AVX2)
+namespace avx2 {
+
+/// @copydoc scalar::sincos()
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept;
+
+} // namespace avx2
+#endif
+
+#if defined(FUSE_SIMD_AVX512)
+namespace avx512 {
+
+/// @copydoc scalar::sincos()
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept;
+
+} // namespace avx512
+#endif
+
+#if defined(FUSE_SIMD_DISPATCH)
+namespace active {
+
+inline void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+                   TrigPrecision precision) noexcept {
+    dispatch<scalar::sincos, sse::sincos, avx2::sincos, avx512::sincos>(
+      degrees, sin, cos, count, precision);
+}
+
+} // namespace active
+#elif defined(FUSE_SIMD_AVX512)
+namespace active = avx512;
+#elif defined(FUSE_SIMD_AVX2)
+namespace active = avx2;
+#elif defined(FUSE_SIMD_SSE)
+namespace active = sse;
+#else
+namespace active = scalar;
+#endif
+
+} // namespace fuse::kernels
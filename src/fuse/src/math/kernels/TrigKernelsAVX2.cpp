@@ -0,0 +1,40 @@
+#include "TrigKernels.h"
+
+#if defined(FUSE_SIMD_AVX2)
+#    include "Simd.h"
+#    include "TrigKernelsImpl.h"
+
+namespace fuse::kernels::avx2 {
+
+using Ops = simd::Avx2Ops;
+using impl::ScalarOps;
+
+namespace {
+
+template <TrigPrecision kPrecision>
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count) noexcept {
+    const auto i = impl::sincos<Ops, kPrecision>(degrees, sin, cos, 0, count);
+    impl::sincos<ScalarOps, kPrecision>(degrees, sin, cos, i, count);
+}
+
+} // namespace
+
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept {
+    switch (precision) {
+        case TrigPrecision::Low:
+            sincos<TrigPrecision::Low>(degrees, sin, cos, count);
+            break;
+        case TrigPrecision::Medium:
+            sincos<TrigPrecision::Medium>(degrees, sin, cos, count);
+            break;
+        case TrigPrecision::High:
+            sincos<TrigPrecision::High>(degrees, sin, cos, count);
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace fuse::kernels::avx2
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file
+/// @brief Implementation of the trigonometric kernels (TrigKernels.h) written once for all
+///        instruction sets.
+///
+/// Same conventions as SoAKernelsImpl.h: the functions are templated on an @b Ops type,
+/// process the elements from @p begin by blocks of Ops::kWidth and return the index of the
+/// first element not processed. The operations are the same as sincos(Angle).
+
+#include "ScalarOps.h"
+#include "Target.h"
+#include "fuse/math/FastTrig.h"
+
+#include <cstddef>
+#include <numbers>
+
+namespace fuse::kernels::impl {
+inline namespace FUSE_SIMD_TARGET {
+
+/// @brief Evaluate a polynomial in @p x2 with the Horner scheme, see detail::horner().
+template <typename Ops, std::size_t N>
+typename Ops::Type horner(const float (&coefficients)[N], typename Ops::Type x2) noexcept {
+    auto r = Ops::set1(coefficients[N - 1]);
+    for (std::size_t i = N - 1; i-- > 0;) {
+        r = Ops::madd(Ops::set1(coefficients[i]), x2, r);
+    }
+    return r;
+}
+
+template <typename Ops, TrigPrecision kPrecision>
+std::size_t sincos(const float* degrees, float* sin, float* cos, std::size_t begin,
+                   std::size_t count) noexcept {
+    using Polynomial        = fuse::detail::TrigPolynomial<kPrecision>;
+    const auto zero         = Ops::set1(0.f);
+    const auto invQuadrant  = Ops::set1(1.f / 90.f);
+    const auto quadrantSize = Ops::set1(90.f);
+    const auto degreeToRad  = Ops::set1(std::numbers::pi_v<float> / 180.f);
+    const auto half         = Ops::set1(0.5f);
+    const auto negativeHalf = Ops::set1(-0.5f);
+
+    std::size_t i = begin;
+    for (; i + Ops::kWidth <= count; i += Ops::kWidth) {
+        // Round to the nearest quadrant, halfway cases away from zero.
+        const auto degree   = Ops::load(degrees + i);
+        const auto n        = Ops::mul(degree, invQuadrant);
+        const auto quadrant = Ops::truncate(
+          Ops::add(n, Ops::select(Ops::lessThan(n, zero), negativeHalf, half)));
+
+        const auto x  = Ops::mul(Ops::sub(degree, Ops::mul(Ops::toFloat(quadrant), quadrantSize)),
+                                 degreeToRad);
+        const auto x2 = Ops::mul(x, x);
+        const auto s  = Ops::mul(x, horner<Ops>(Polynomial::kSin, x2));
+        const auto c  = horner<Ops>(Polynomial::kCos, x2);
+
+        // sin(x + q * 90) is (s, c, -s, -c) and cos(x + q * 90) is (c, -s, -c, s) for q = 0..3
+        const auto swap = Ops::testBit(quadrant, 1);
+        const auto bit1 = Ops::testBit(quadrant, 2);
+        if (sin) {
+            const auto r = Ops::select(swap, c, s);
+            Ops::store(sin + i, Ops::select(bit1, Ops::sub(zero, r), r));
+        }
+        if (cos) {
+            const auto r = Ops::select(swap, s, c);
+            Ops::store(cos + i, Ops::select(Ops::maskXor(swap, bit1), Ops::sub(zero, r), r));
+        }
+    }
+    return i;
+}
+
+} // namespace FUSE_SIMD_TARGET
+} // namespace fuse::kernels::impl
@@ -0,0 +1,25 @@
+#include "TrigKernels.h"
+#include "TrigKernelsImpl.h"
+
+namespace fuse::kernels::scalar {
+
+using Ops = impl::ScalarOps;
+
+void sincos(const float* degrees, float* sin, float* cos, std::size_t count,
+            TrigPrecision precision) noexcept {
+    switch (precision) {
+        case TrigPrecision::Low:
+            impl::sincos<Ops, TrigPrecision::Low>(degrees, sin, cos, 0, count);
+            break;
+        case TrigPrecision::Medium:
+            impl::sincos<Ops, TrigPrecision::Medium>(degrees, sin, cos, 0, count);
+            break;
+        case TrigPrecision::High:
+            impl::sincos<Ops, TrigPrecision::High>(degrees, sin, cos, 0, count);
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace fuse::kernels::scalar
@@ -0,0 +1,60 @@
+#include <fuse/BinaryLog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <print>
+#include <string_view>
+
+// Format a binary log written with FUSE_LOG_BINARY().
+//
+// Usage: fuse-logdecode [--sort] [--source] <file>
+//   --sort   : interleave the messages of the threads by time, they are grouped by buffer
+//              otherwise.
+//   --source : write the file and the line of the call site of each message.
+
+int main(int argc, char** argv) {
+    bool             sort   = false;
+    bool             source = false;
+    std::string_view path;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if (arg == "--sort") {
+            sort = true;
+        } else if (arg == "--source") {
+            source = true;
+        } else if (path.empty() && !arg.starts_with("--")) {
+            path = arg;
+        } else {
+            path = {};
+            break;
+        }
+    }
+    if (path.empty()) {
+        std::println(stderr, "Usage: fuse-logdecode [--sort] [--source] <file>");
+        return EXIT_FAILURE;
+    }
+
+    auto messages = fuse::decodeBinaryLog(path);
+    if (!messages) {
+        std::println(stderr, "fuse-logdecode: {}", messages.error());
+        return EXIT_FAILURE;
+    }
+    if (sort) {
+        std::ranges::stable_sort(*messages, {}, &fuse::BinaryLogMessage::time);
+    }
+
+    for (const auto& message : *messages) {
+        const std::string_view category =
+          message.category == fuse::LogCategory::General ? "" : fuse::toString(message.category);
+        std::print("[{:.6f}] [T{}] [{}]", message.time, message.thread,
+                   fuse::toString(message.level));
+        if (!category.empty()) {
+            std::print("[{}]", category);
+        }
+        if (source) {
+            std::print(" {}:{}", message.file, message.line);
+        }
+        std::println(" {}", message.message);
+    }
+    return EXIT_SUCCESS;
+}
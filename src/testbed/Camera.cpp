@@ -34,7 +34,7 @@ Mat4 Camera::getViewMatrix() const {
 
 
 fuse::Mat4 Camera::getViewProjectionMatrix() const {
-    return getViewMatrix() * getProjectionMatrix();
+    return getProjectionMatrix() * getViewMatrix();
 }
 
 float Camera::getFarWindowHeight() const { return 2.0f * mFarZ * std::tan(0.5f * mFoVy); }
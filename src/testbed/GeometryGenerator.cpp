@@ -1,8 +1,27 @@
 #include "GeometryGenerator.h"
 
+#include "fuse/math/BatchTransform.h"
+#include "fuse/math/FastTrig.h"
+
 #include <cassert>
 #include <numbers>
 
+namespace {
+
+/// @brief Compute the sine and the cosine of the angles of the @p sliceCount + 1 vertices of a
+/// ring, the first and last vertices are both at 0 degree.
+void computeRing(unsigned int sliceCount, std::vector<float>& sinTheta,
+                 std::vector<float>& cosTheta) {
+    std::vector<fuse::Angle> angles(sliceCount + 1);
+    for (unsigned int i = 0; i <= sliceCount; ++i) {
+        angles[i] = fuse::degrees(360.f * (float)i / (float)sliceCount);
+    }
+    sinTheta.resize(angles.size());
+    cosTheta.resize(angles.size());
+    fuse::sincos(angles, sinTheta, cosTheta);
+}
+
+} // namespace
 
 //------------------------------------------------------------------------
 GeometryGenerator::MeshData GeometryGenerator::createBox(float width, float height, float pDepth,
@@ -248,18 +267,22 @@ GeometryGenerator::MeshData GeometryGenerator::createCylinder(float bottomRadius
 
     const unsigned int ringCount = stackCount + 1;
 
+    // All the rings have the same angles.
+    std::vector<float> sinTheta;
+    std::vector<float> cosTheta;
+    computeRing(sliceCount, sinTheta, cosTheta);
+
     // Compute vertices for each stack ring starting at the bottom and moving up.
     for (unsigned int i = 0; i < ringCount; i++) {
         const float y = -0.5f * height + (float)i * stackHeight;
         const float r = bottomRadius + (float)i * radiusStep;
 
         // Vertices of ring
-        const float dTheta = 2.0f * std::numbers::pi_v<float> / (float)sliceCount;
         for (unsigned int j = 0; j <= sliceCount; j++) {
             Vertex vertex;
 
-            float c = std::cos((float)j * dTheta);
-            float s = std::sin((float)j * dTheta);
+            float c = cosTheta[j];
+            float s = sinTheta[j];
 
             vertex.Position = fuse::Vec3(r * c, y, r * s);
             vertex.TexC.x   = (float)j / (float)sliceCount;
@@ -343,9 +366,15 @@ GeometryGenerator::MeshData GeometryGenerator::createSphere(float radius, unsign
     const float phiStep   = std::numbers::pi_v<float> / (float)stackCount;
     const float thetaStep = 2.0f * std::numbers::pi_v<float> / (float)sliceCount;
 
+    // All the rings have the same theta angles.
+    std::vector<float> sinTheta;
+    std::vector<float> cosTheta;
+    computeRing(sliceCount, sinTheta, cosTheta);
+
     // Compute vertices for each stack ring (do not count the poles as rings).
     for (unsigned int i = 1; i <= stackCount - 1; ++i) {
-        float phi = (float)i * phiStep;
+        float      phi       = (float)i * phiStep;
+        const auto phiSinCos = fuse::sincos(fuse::degrees(180.f * (float)i / (float)stackCount));
 
         // Vertices of ring.
         for (unsigned int j = 0; j <= sliceCount; ++j) {
@@ -354,14 +383,14 @@ GeometryGenerator::MeshData GeometryGenerator::createSphere(float radius, unsign
             Vertex v;
 
             // spherical to cartesian
-            v.Position.x = radius * sinf(phi) * cosf(theta);
-            v.Position.y = radius * cosf(phi);
-            v.Position.z = radius * sinf(phi) * sinf(theta);
+            v.Position.x = radius * phiSinCos.sin * cosTheta[j];
+            v.Position.y = radius * phiSinCos.cos;
+            v.Position.z = radius * phiSinCos.sin * sinTheta[j];
 
             // Partial derivative of P with respect to theta
-            v.TangentU.x = -radius * sinf(phi) * sinf(theta);
+            v.TangentU.x = -radius * phiSinCos.sin * sinTheta[j];
             v.TangentU.y = 0.0f;
-            v.TangentU.z = +radius * sinf(phi) * cosf(theta);
+            v.TangentU.z = +radius * phiSinCos.sin * cosTheta[j];
 
             v.TangentU = v.TangentU.normalize();
 
@@ -486,6 +515,32 @@ GeometryGenerator::MeshData GeometryGenerator::CreateQuad(float x, float y, floa
     return meshData;
 }
 
+//------------------------------------------------------------------------
+void GeometryGenerator::transform(MeshData& meshData, const fuse::Mat4& transform) {
+    // The vertices interleave all the attributes, gather each attribute in its own array
+    // so they can be transformed in batch.
+    const size_t            vertexCount = meshData.Vertices.size();
+    std::vector<fuse::Vec3> positions(vertexCount);
+    std::vector<fuse::Vec3> normals(vertexCount);
+    std::vector<fuse::Vec3> tangents(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        positions[i] = meshData.Vertices[i].Position;
+        normals[i]   = meshData.Vertices[i].Normal;
+        tangents[i]  = meshData.Vertices[i].TangentU;
+    }
+
+    const fuse::Mat4 normalTransform = transform.inverse().transpose();
+    fuse::transformPoints(transform, positions, positions);
+    fuse::transformDirections(normalTransform, normals, normals);
+    fuse::transformDirections(transform, tangents, tangents);
+
+    for (size_t i = 0; i < vertexCount; ++i) {
+        meshData.Vertices[i].Position = positions[i];
+        meshData.Vertices[i].Normal   = normals[i].normalize();
+        meshData.Vertices[i].TangentU = tangents[i].normalize();
+    }
+}
+
 //------------------------------------------------------------------------
 void GeometryGenerator::subdivide(MeshData& meshData) {
     // Save a copy of the input geometry.
@@ -550,13 +605,16 @@ void GeometryGenerator::buildCylinderTopCap(float topRadius, float height, unsig
                                             MeshData& meshData) {
     const unsigned int baseIndex = (unsigned int)meshData.Vertices.size();
 
-    const float y      = 0.5f * height;
-    const float dTheta = 2.0f * std::numbers::pi_v<float> / (float)sliceCount;
+    const float y = 0.5f * height;
+
+    std::vector<float> sinTheta;
+    std::vector<float> cosTheta;
+    computeRing(sliceCount, sinTheta, cosTheta);
 
     // Duplicate cap ring vertices because the texture coordinates and normals differ.
     for (unsigned int i = 0; i <= sliceCount; ++i) {
-        const float x = topRadius * cosf((float)i * dTheta);
-        const float z = topRadius * sinf((float)i * dTheta);
+        const float x = topRadius * cosTheta[i];
+        const float z = topRadius * sinTheta[i];
 
         // Scale down by the height to try and make top cap texture coord area
         // proportional to base.
@@ -591,10 +649,12 @@ void GeometryGenerator::buildCylinderBottomCap(float bottomRadius, float height,
     const float        y         = -0.5f * height;
 
     // vertices of ring
-    const float dTheta = 2.0f * std::numbers::pi_v<float> / (float)sliceCount;
+    std::vector<float> sinTheta;
+    std::vector<float> cosTheta;
+    computeRing(sliceCount, sinTheta, cosTheta);
     for (unsigned int i = 0; i <= sliceCount; ++i) {
-        const float x = bottomRadius * cosf((float)i * dTheta);
-        const float z = bottomRadius * sinf((float)i * dTheta);
+        const float x = bottomRadius * cosTheta[i];
+        const float z = bottomRadius * sinTheta[i];
 
         // Scale down by the height to try and make top cap texture coord area
         // proportional to base.
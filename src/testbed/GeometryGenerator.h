@@ -1,4 +1,5 @@
 #pragma once
+#include "fuse/math/Mat4.h"
 #include "fuse/math/Vec2.h"
 #include "fuse/math/Vec3.h"
 
@@ -100,6 +101,14 @@ public:
     /// This is useful for postprocessing and screen effects.
     MeshData CreateQuad(float x, float y, float w, float h, float depth);
 
+    /// @brief Pre-transform the vertices of a mesh.
+    ///
+    /// The positions and the tangents are transformed by @p transform, the normals by its
+    /// inverse transpose, the normals and tangents are re-normalized.
+    /// @param meshData The mesh to transform.
+    /// @param transform The transformation to apply, must be invertible.
+    void transform(MeshData& meshData, const fuse::Mat4& transform);
+
 private:
     void   subdivide(MeshData& meshData);
     Vertex midPoint(const Vertex& v0, const Vertex& v1);
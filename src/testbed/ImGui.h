@@ -1,13 +1,16 @@
 #pragma once
+#include "fuse/FrameArena.h"
+#include "fuse/math/Fwd.h"
+
 #include <imgui.h>
 #include <imgui_internal.h>
 
 #include <format>
+#include <iterator>
+#include <string>
 
 namespace fuse {
 class Angle;
-struct Vec3;
-class Mat4;
 } // namespace fuse
 
 namespace fuse::Imgui {
@@ -18,12 +21,16 @@ namespace fuse::Imgui {
 /// This is wrapper for ImGui::Text() which used C++ 20 format library
 /// comparing to ImGui::Text() which use C style variadic paramater.
 ///
+/// The string is formatted in the frame arena, it does not allocate on the heap.
+///
 /// @param fmt  The formating string.
 /// @param args The arguments to display inside the string.
 template <typename... Args>
 void TextFmt(const std::format_string<Args...>& fmt, const Args&... args) {
-    std::string str = std::vformat(fmt.get(), std::make_format_args(args...));
-    ImGui::TextUnformatted(str.c_str(), &str[str.size()]);
+    std::pmr::string str(fuse::frameMemoryResource());
+    str.reserve(128);
+    std::vformat_to(std::back_inserter(str), fmt.get(), std::make_format_args(args...));
+    ImGui::TextUnformatted(str.data(), str.data() + str.size());
 }
 
 /// @brief Display formatted tooltips text with ImGui.
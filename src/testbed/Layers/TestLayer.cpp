@@ -1,12 +1,26 @@
 #include "TestLayer.h"
 #include "../ImGui.h"
 #include "../TextureGenerator.h"
+#include <fuse/Application.h>
+#include <fuse/FrameLimiter.h>
+#include <fuse/FrameStats.h>
+#include <fuse/GpuProfiler.h>
+#include <fuse/MemoryTracker.h>
+#include <fuse/Profiler.h>
+#include <fuse/math/Affine3.h>
+#include <fuse/math/Frustum.h>
 #include <SDL3/SDL_events.h>
-#include <SDL3/SDL_timer.h>
 #include <imgui.h>
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+
 static void onImGuiRender(Camera camera ) {
     static bool wireframeEnable = false;
+    static bool showProfiler    = false;
+    static bool showMemory      = false;
+    static bool showFrameStats  = false;
 
     ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
 
@@ -47,6 +61,36 @@ static void onImGuiRender(Camera camera ) {
     }
     fuse::Imgui::TextFmt("{:.3f} ms/frame", 1000.0f / ImGui::GetIO().Framerate);
     fuse::Imgui::TextFmt("{:.1f} FPS", ImGui::GetIO().Framerate);
+    auto&      frameStats = fuse::Application::Get()->getFrameStats();
+    const auto frameTimes = frameStats.summary();
+    fuse::Imgui::TextFmt("p50 {:.2f} ms | p99 {:.2f} ms | max {:.2f} ms | {} hitches",
+                         frameTimes.p50,
+                         frameTimes.p99,
+                         frameTimes.max,
+                         frameTimes.hitches);
+    ImGui::Checkbox("Profiler", &showProfiler);
+    ImGui::SameLine();
+    ImGui::Checkbox("Memory", &showMemory);
+    ImGui::SameLine();
+    ImGui::Checkbox("Frame times", &showFrameStats);
+    ImGui::Separator();
+    auto&      limiter = fuse::Application::Get()->getFrameLimiter();
+    int        mode    = static_cast<int>(limiter.getMode());
+    if (ImGui::Combo("Frame limit", &mode, "Unlimited\0Fixed\0Adaptive\0")) {
+        limiter.setMode(static_cast<fuse::FrameLimiter::Mode>(mode));
+        limiter.resetStats();
+    }
+    auto targetFps = static_cast<float>(limiter.getTargetFps());
+    if (ImGui::SliderFloat("Target FPS", &targetFps, 10.f, 240.f, "%.0f")) {
+        limiter.setTargetFps(targetFps);
+        limiter.resetStats();
+    }
+    const auto& pacing = limiter.getStats();
+    fuse::Imgui::TextFmt("Pacing {} | jitter avg {:.1f} us, max {:.1f} us | late max {:.1f} us",
+                         limiter.isIdle() ? "idle" : "active",
+                         pacing.averageError.asSeconds() * 1e6,
+                         pacing.maxError.asSeconds() * 1e6,
+                         pacing.maxLateness.asSeconds() * 1e6);
     ImGui::Separator();
     fuse::Imgui::TextFmt("Fov          => {:.2f} / {:.2f}", camera.getFovY(), camera.getFovX());
     fuse::Imgui::TextFmt("Aspect Ratio => {:.2f}", camera.getAspectRatio());
@@ -80,12 +124,23 @@ static void onImGuiRender(Camera camera ) {
     ImGui::End();
 
     ImGui::PopStyleVar(1);
+
+    if (showProfiler) {
+        fuse::showProfilerWindow(&showProfiler, &fuse::Application::Get()->getGpuProfiler());
+    }
+    if (showMemory) {
+        fuse::showMemoryWindow(&showMemory);
+    }
+    if (showFrameStats) {
+        fuse::showFrameStatsWindow(frameStats, &showFrameStats);
+    }
 }
 
 
 
 
-TestLayer::TestLayer() {
+TestLayer::TestLayer()
+    : Layer("TestLayer") {
     shader = new Shader();
     unsigned int VAO;
     glGenVertexArrays(1, &VAO);
@@ -112,10 +167,18 @@ TestLayer::TestLayer() {
     grass2        = Texture::Create(TextureGenerator::generateGrass2(1024, 1024));
 
     boxMesh       = Mesh::CreateBox();
-    gridMesh      = Mesh::CreateGrid();
+    gridMesh      = Mesh::CreateGrid(fuse::Mat4::CreateScaling({20, 1, 20}));
     geoSphereMesh = Mesh::CreateGeoSphere();
     sphereMesh    = Mesh::CreateSphere();
     cylinderMesh  = Mesh::CreateCylinder();
+
+    auto& bus     = fuse::Application::Get()->getEventBus();
+    subscriptions = {
+      bus.subscribe<&TestLayer::onResize>(SDL_EVENT_WINDOW_RESIZED, this),
+      bus.subscribe<&TestLayer::onMouseWheel>(SDL_EVENT_MOUSE_WHEEL, this),
+      bus.subscribe<&TestLayer::onMouseMotion>(SDL_EVENT_MOUSE_MOTION, this),
+      bus.subscribe<&TestLayer::onKeyDown>(SDL_EVENT_KEY_DOWN, this),
+    };
 }
 
 
@@ -123,72 +186,76 @@ TestLayer::~TestLayer() {
     delete shader;
 }
 
-bool TestLayer::onEvent(const SDL_Event& e) {
-    if (e.type == SDL_EVENT_WINDOW_RESIZED) {
-        const auto width  = e.window.data1;
-        const auto height = e.window.data2;
-        glViewport(0, 0, width, height);
-        camera.setAspectRatio((float)width / (float)height);
+void TestLayer::onResize(const SDL_Event& e) {
+    const auto width  = e.window.data1;
+    const auto height = e.window.data2;
+    glViewport(0, 0, width, height);
+    camera.setAspectRatio((float)width / (float)height);
+}
+
+void TestLayer::onMouseWheel(const SDL_Event& e) {
+    camera.setFovY(camera.getFovY() + fuse::degrees(e.wheel.y * 10));
+}
+
+void TestLayer::onMouseMotion(const SDL_Event& e) {
+    const bool isLeftDown = (e.motion.state & SDL_BUTTON_LMASK) == SDL_BUTTON_LMASK;
+    if (!ImGui::GetIO().WantCaptureMouse && isLeftDown) {
+        const auto yaw   = e.motion.xrel * fuse::degrees(0.125f);
+        const auto pitch = e.motion.yrel * fuse::degrees(0.125f);
+        camera.yaw(-yaw);
+        camera.pitch(-pitch);
     }
-    if (e.type == SDL_EVENT_MOUSE_WHEEL) {
-        camera.setFovY(camera.getFovY() + fuse::degrees(e.wheel.y * 10));
+}
+
+void TestLayer::onKeyDown(const SDL_Event& e) {
+    if (e.key.scancode == SDL_SCANCODE_1) {
+        //floorTextureID = (floorTextureID + 1) % (unsigned)textures.size();
     }
-    if (e.type == SDL_EVENT_MOUSE_MOTION) {
-        const bool isLeftDown = (e.motion.state & SDL_BUTTON_LMASK) == SDL_BUTTON_LMASK;
-        if (!ImGui::GetIO().WantCaptureMouse && isLeftDown) {
-            const auto yaw   = e.motion.xrel * fuse::degrees(0.125f);
-            const auto pitch = e.motion.yrel * fuse::degrees(0.125f);
-            camera.yaw(-yaw);
-            camera.pitch(-pitch);
-        }
+    if (e.key.scancode == SDL_SCANCODE_2) {
+        //floorTextureID =
+        //  floorTextureID == 0u ? (unsigned)textures.size() - 1u : floorTextureID - 1u;
     }
-    if (e.type == SDL_EVENT_KEY_DOWN) {
-        if (e.key.scancode == SDL_SCANCODE_1) {
-            //floorTextureID = (floorTextureID + 1) % (unsigned)textures.size();
-        }
-        if (e.key.scancode == SDL_SCANCODE_2) {
-            //floorTextureID =
-            //  floorTextureID == 0u ? (unsigned)textures.size() - 1u : floorTextureID - 1u;
-        }
-        if (e.key.scancode == SDL_SCANCODE_KP_0) {
-            //cubeTextureID = (cubeTextureID + 1) % (unsigned)brickTextures.size();
-        }
-        if (e.key.scancode == SDL_SCANCODE_KP_1) {
-            //cubeTextureID = cubeTextureID == 0u ? (unsigned)brickTextures.size() - 1u
-            //                                    : cubeTextureID - 1u;
-        }
-        if (e.key.scancode == SDL_SCANCODE_W) {
-            camera.moveForward(1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_S) {
-            camera.moveForward(-1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_D) {
-            camera.moveRight(1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_A) {
-            camera.moveRight(-1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_Q) {
-            camera.moveUp(1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_E) {
-            camera.moveUp(-1.f);
-        }
-        if (e.key.scancode == SDL_SCANCODE_Z) {
-            camera.moveUp(1.f, false);
-        }
-        if (e.key.scancode == SDL_SCANCODE_X) {
-            camera.moveUp(-1.f, false);
-        }
+    if (e.key.scancode == SDL_SCANCODE_KP_0) {
+        //cubeTextureID = (cubeTextureID + 1) % (unsigned)brickTextures.size();
+    }
+    if (e.key.scancode == SDL_SCANCODE_KP_1) {
+        //cubeTextureID = cubeTextureID == 0u ? (unsigned)brickTextures.size() - 1u
+        //                                    : cubeTextureID - 1u;
+    }
+    if (e.key.scancode == SDL_SCANCODE_W) {
+        camera.moveForward(1.f);
+    }
+    if (e.key.scancode == SDL_SCANCODE_S) {
+        camera.moveForward(-1.f);
+    }
+    if (e.key.scancode == SDL_SCANCODE_D) {
+        camera.moveRight(1.f);
     }
+    if (e.key.scancode == SDL_SCANCODE_A) {
+        camera.moveRight(-1.f);
+    }
+    if (e.key.scancode == SDL_SCANCODE_Q) {
+        camera.moveUp(1.f);
+    }
+    if (e.key.scancode == SDL_SCANCODE_E) {
+        camera.moveUp(-1.f);
+    }
+    if (e.key.scancode == SDL_SCANCODE_Z) {
+        camera.moveUp(1.f, false);
+    }
+    if (e.key.scancode == SDL_SCANCODE_X) {
+        camera.moveUp(-1.f, false);
+    }
+}
 
-    return false;
+void TestLayer::onFixedUpdate(fuse::Time step) {
+    previousSphereAngle = sphereAngle;
+    sphereAngle += fuse::degrees(35) * (float)step.asSeconds();
 }
 
 void TestLayer::onUpdate(fuse::Time /*deltaTime*/) {}
 
-void TestLayer::onRender() {
+void TestLayer::onRender(float alpha) {
     glEnable(GL_DEPTH_TEST);
     glEnable(GL_CULL_FACE);
     glEnable(GL_FRAMEBUFFER_SRGB);
@@ -201,9 +268,13 @@ void TestLayer::onRender() {
     shader->setMatrix("proj", camera.getProjectionMatrix());
     shader->setMatrix("view", camera.getViewMatrix());
 
+    // Skip the meshes out of view
+    const auto frustum = fuse::Frustum::FromMatrix(camera.getViewProjectionMatrix());
+
     // first grid
     {
-        shader->setMatrix("model", fuse::Mat4::CreateScaling({20, 1, 20}));
+        // Scaled when created.
+        shader->setMatrix("model", fuse::Mat4::kIdentity);
         shader->setVector("diffuseColor", {1, 1, 1, 1});
         shader->setVector("uvScale", {1, 1, 0, 0});
         gridMesh.render();
@@ -211,58 +282,55 @@ void TestLayer::onRender() {
 
     // Cylinder
     glBindTexture(GL_TEXTURE_2D, blackWhiteCheckBoardtexture.getId());
-    const unsigned count   = 10;
-    const float    spacing = 5.f;
+    constexpr unsigned count   = 10;
+    const float        spacing = 5.f;
+    // The cylinder has a radius of 1 and a height of 3, centered on the origin.
+    const float cylinderRadius = std::sqrt(1.f + 1.5f * 1.5f);
+    std::array<fuse::BoundingSphere, count>                    cylinderBounds;
+    std::array<std::uint32_t, fuse::visibilityMaskSize(count)> cylinderVisibility;
     for (unsigned int i = 0; i < count; i++) {
         float x = (count / 2.f) * -5.f;
         x += ((float)i * spacing);
-        shader->setMatrix("model", fuse::Mat4::CreateTranslation({x, 1, -5}));
+        cylinderBounds[i] = {{x, 1, -5}, cylinderRadius};
+    }
+    fuse::cull(frustum, cylinderBounds, cylinderVisibility);
+    for (unsigned int i = 0; i < count; i++) {
+        if (!fuse::isVisible(cylinderVisibility, i)) {
+            continue;
+        }
+        shader->setMatrix("model", fuse::Mat4::CreateTranslation(cylinderBounds[i].center));
         shader->setVector("diffuseColor", {1, 1, 1, 1});
         shader->setVector("uvScale", {1, 1, 0, 0});
         cylinderMesh.render();
     }
 
     // Sphere
-    {
+    if (frustum.intersects(fuse::BoundingSphere({-10, 2, 0}, 1.f))) {
         glBindTexture(GL_TEXTURE_2D, blackWhiteCheckBoardtexture.getId());
-        const auto        t     = fuse::Mat4::CreateTranslation({-10, 2, 0});
-        const fuse::Angle angle = fuse::degrees(35) * (float)SDL_GetTicks() / 1000.f;
-        const auto        r = fuse::Mat4::CreateRotation(angle, fuse::Vec3(0, 1, 0).normalize());
+        const auto        t     = fuse::Affine3::CreateTranslation({-10, 2, 0});
+        const fuse::Angle angle = previousSphereAngle + (sphereAngle - previousSphereAngle) * alpha;
+        const auto        r = fuse::Affine3::CreateRotation(angle, fuse::Vec3(0, 1, 0).normalize());
         const auto        transform = t * r;
-        shader->setMatrix("model", transform);
+        shader->setMatrix("model", transform.toMat4());
         shader->setVector("diffuseColor", {1, 1, 1, 1});
         sphereMesh.render();
     }
     // wall of box
     {
         glBindTexture(GL_TEXTURE_2D, brickTexture4.getId());
-        auto transform = fuse::Mat4::CreateTranslation({+10, 1, 5});
+        auto transform = fuse::Affine3::CreateTranslation({+10, 1, 5});
         shader->setVector("diffuseColor", {1, 1, 1, 1});
 
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 0});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
-
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 1});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
-
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 1});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
-
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 1});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
-
-
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 1});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
-
-        transform *= fuse::Mat4::CreateTranslation({0, 0, 1});
-        shader->setMatrix("model", transform);
-        boxMesh.render();
+        const auto step = fuse::Affine3::CreateTranslation({0, 0, 1});
+        for (int i = 0; i < 6; i++, transform *= step) {
+            const auto bounds =
+              fuse::AABB::FromCenterExtents(transform.translation(), {0.5f, 0.5f, 0.5f});
+            if (!frustum.intersects(bounds)) {
+                continue;
+            }
+            shader->setMatrix("model", transform.toMat4());
+            boxMesh.render();
+        }
     }
 }
 
@@ -4,12 +4,14 @@
 #include "../Shader.h"
 #include "../Texture.h"
 
+#include <fuse/EventBus.h>
 #include <fuse/Layer.h>
 
-class TestLayer : public fuse::Layer {
+#include <array>
+
+class TestLayer final : public fuse::Layer {
 private:
     Camera  camera;
-    // FIXME: All OpenGL are leaking
     Texture debugMipmap;
     Texture blackWhiteCheckBoardtexture;
     Texture checkBoardtexture;
@@ -29,15 +31,26 @@ private:
     Mesh    cylinderMesh;
     Shader* shader;
 
+    // Rotation of the sphere, advanced by the fixed steps and interpolated for rendering.
+    fuse::Angle sphereAngle{};
+    fuse::Angle previousSphereAngle{};
+
+    std::array<fuse::EventSubscription, 4> subscriptions;
+
+    void onResize(const SDL_Event& e);
+    void onMouseWheel(const SDL_Event& e);
+    void onMouseMotion(const SDL_Event& e);
+    void onKeyDown(const SDL_Event& e);
+
 public:
     TestLayer();
     ~TestLayer() override;
 
-    bool onEvent(const SDL_Event& e) override;
+    void onFixedUpdate(fuse::Time step) override;
 
     void onUpdate(fuse::Time deltaTime) override;
 
-    void onRender() override;
+    void onRender(float alpha) override;
 
     void onImGui() override;
 };
@@ -48,51 +48,55 @@ void Mesh::render() const {
     glDrawElements(GL_TRIANGLES, mNbIndices, GL_UNSIGNED_INT, nullptr);
 }
 
-void Mesh::upload(const GeometryGenerator::MeshData& data, Mesh& mesh) {
-    mesh.mVertexBuffer =
-      Buffer((GLsizeiptr)(data.Vertices.size() * sizeof(GeometryGenerator::Vertex)),
-             (void*)data.Vertices.data());
-    mesh.mIndexBuffer =
-      Buffer((GLsizeiptr)(data.Indices.size() * sizeof(unsigned)), (void*)data.Indices.data());
-    mesh.mNbIndices = (GLsizei)data.Indices.size();
+void Mesh::upload(GeometryGenerator& geometryGenerator, GeometryGenerator::MeshData& data,
+                  const fuse::Mat4& transform, Mesh& mesh) {
+    if (transform != fuse::Mat4::kIdentity) {
+        geometryGenerator.transform(data, transform);
+    }
+    const std::size_t vertexBytes = data.Vertices.size() * sizeof(GeometryGenerator::Vertex);
+    const std::size_t indexBytes  = data.Indices.size() * sizeof(unsigned);
+    mesh.mVertexBuffer = Buffer((GLsizeiptr)vertexBytes, (void*)data.Vertices.data());
+    mesh.mIndexBuffer  = Buffer((GLsizeiptr)indexBytes, (void*)data.Indices.data());
+    mesh.mNbIndices    = (GLsizei)data.Indices.size();
+    mesh.mGpuMemory    = fuse::TrackedMemory(fuse::MemTag::Geometry, vertexBytes + indexBytes);
 }
 
 
-Mesh Mesh::CreateBox() {
+Mesh Mesh::CreateBox(const fuse::Mat4& transform) {
     Mesh              mesh;
     GeometryGenerator geometryGenerator;
-    const auto        data = geometryGenerator.createBox(1, 1, 1, 0);
-    mesh.upload(data, mesh);
+    auto              data = geometryGenerator.createBox(1, 1, 1, 0);
+    mesh.upload(geometryGenerator, data, transform, mesh);
     return mesh;
 }
 
-Mesh Mesh::CreateGrid() {
+Mesh Mesh::CreateGrid(const fuse::Mat4& transform) {
     Mesh              mesh;
     GeometryGenerator geometryGenerator;
-    const auto        data = geometryGenerator.createGrid(1, 1, 2, 2);
-    mesh.upload(data, mesh);
+    auto              data = geometryGenerator.createGrid(1, 1, 2, 2);
+    mesh.upload(geometryGenerator, data, transform, mesh);
     return mesh;
 }
-Mesh Mesh::CreateGeoSphere() {
+Mesh Mesh::CreateGeoSphere(const fuse::Mat4& transform) {
     Mesh              mesh;
     GeometryGenerator geometryGenerator;
-    const auto        data = geometryGenerator.createGeoSphere(1, 4);
-    mesh.upload(data, mesh);
+    auto              data = geometryGenerator.createGeoSphere(1, 4);
+    mesh.upload(geometryGenerator, data, transform, mesh);
     return mesh;
 }
 
-Mesh Mesh::CreateSphere() {
+Mesh Mesh::CreateSphere(const fuse::Mat4& transform) {
     Mesh              mesh;
     GeometryGenerator geometryGenerator;
-    const auto        data = geometryGenerator.createSphere(1, 25, 25);
-    mesh.upload(data, mesh);
+    auto              data = geometryGenerator.createSphere(1, 25, 25);
+    mesh.upload(geometryGenerator, data, transform, mesh);
     return mesh;
 }
 
-Mesh Mesh::CreateCylinder() {
+Mesh Mesh::CreateCylinder(const fuse::Mat4& transform) {
     Mesh              mesh;
     GeometryGenerator geometryGenerator;
-    const auto        data = geometryGenerator.createCylinder(1, 1, 3, 10, 2);
-    mesh.upload(data, mesh);
+    auto              data = geometryGenerator.createCylinder(1, 1, 3, 10, 2);
+    mesh.upload(geometryGenerator, data, transform, mesh);
     return mesh;
 }
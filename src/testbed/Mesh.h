@@ -2,6 +2,8 @@
 #include "Buffer.h"
 #include "GeometryGenerator.h"
 
+#include <fuse/MemoryTracker.h>
+
 
 /// @brief
 class Mesh {
@@ -15,16 +17,19 @@ public:
 
     void render() const;
 
-    static Mesh CreateBox();
-    static Mesh CreateGrid();
-    static Mesh CreateGeoSphere();
-    static Mesh CreateSphere();
-    static Mesh CreateCylinder();
+    /// @brief Create the meshes, their vertices pre-transformed by @p transform.
+    static Mesh CreateBox(const fuse::Mat4& transform = fuse::Mat4::kIdentity);
+    static Mesh CreateGrid(const fuse::Mat4& transform = fuse::Mat4::kIdentity);
+    static Mesh CreateGeoSphere(const fuse::Mat4& transform = fuse::Mat4::kIdentity);
+    static Mesh CreateSphere(const fuse::Mat4& transform = fuse::Mat4::kIdentity);
+    static Mesh CreateCylinder(const fuse::Mat4& transform = fuse::Mat4::kIdentity);
 
 private:
-    void upload(const GeometryGenerator::MeshData& data, Mesh& mesh);
+    void upload(GeometryGenerator& geometryGenerator, GeometryGenerator::MeshData& data,
+                const fuse::Mat4& transform, Mesh& mesh);
 
-    Buffer  mVertexBuffer;
-    Buffer  mIndexBuffer;
-    GLsizei mNbIndices;
+    Buffer              mVertexBuffer;
+    Buffer              mIndexBuffer;
+    GLsizei             mNbIndices;
+    fuse::TrackedMemory mGpuMemory; ///< The size of the buffers, in fuse::MemTag::Geometry.
 };
@@ -1,12 +1,9 @@
 #pragma once
+#include "fuse/math/Fwd.h"
+
 #include <glad/gl.h>
 #include <utility>
 
-namespace fuse {
-class Mat4;
-struct Vec4;
-} // namespace fuse
-
 struct Vec4;
 
 /// @brief Thing wrapper around OpenGL Shader.
@@ -42,6 +42,31 @@ GLFormatDesc getGLFormat(PixelFormat format) {
     }
 }
 
+/// @brief Return the size of a pixel, as requested to the driver.
+std::size_t bytesPerPixel(PixelFormat format) {
+    using PF = PixelFormat;
+    switch (format) {
+            // clang-format off
+        case PF::R8_UNORM:         return 1;
+        case PF::RG8_UNORM:        return 2;
+        case PF::RGB8_UNORM:       return 3;
+        case PF::RGBA8_UNORM:      return 4;
+        case PF::R16_UNORM:        return 2;
+        case PF::RG16_UNORM:       return 4;
+        case PF::RGB16_UNORM:      return 6;
+        case PF::RGBA16_UNORM:     return 8;
+        case PF::RGB8_UNORM_SRGB:  return 3;
+        case PF::RGBA8_UNORM_SRGB: return 4;
+        case PF::R32F:             return 4;
+        case PF::RG32F:            return 8;
+        case PF::RGB32F:           return 12;
+        case PF::RGBA32F:          return 16;
+        case PF::Count:
+        default: std::unreachable();
+            // clang-format on
+    }
+}
+
 } // namespace
 
 
@@ -82,6 +107,13 @@ Texture Texture::Create(const Texture2DCreateInfo& createInfo) {
                        (GLsizei)createInfo.width,
                        (GLsizei)createInfo.height);
 
+    std::size_t bytes = 0;
+    for (unsigned i = 0; i < level; i++) {
+        bytes += std::size_t{std::max(createInfo.width >> i, 1u)} *
+                 std::max(createInfo.height >> i, 1u) * bytesPerPixel(createInfo.format);
+    }
+    texture.mGpuMemory = fuse::TrackedMemory(fuse::MemTag::Texture, bytes);
+
     return texture;
 }
 
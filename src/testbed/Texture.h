@@ -1,6 +1,8 @@
 #pragma once
 #include <glad/gl.h>
 
+#include <fuse/MemoryTracker.h>
+
 #include <algorithm>
 #include <utility>
 
@@ -66,11 +68,13 @@ public:
     Texture(Texture&& o) {
         o.mId = std::exchange(mId, o.mId);
         o.mCreateInfo = std::exchange(mCreateInfo, o.mCreateInfo);
+        std::swap(mGpuMemory, o.mGpuMemory);
     }
 
     Texture& operator=(Texture&& o) {
         o.mId = std::exchange(mId, o.mId);
         o.mCreateInfo = std::exchange(mCreateInfo, o.mCreateInfo);
+        std::swap(mGpuMemory, o.mGpuMemory);
         return *this;
     }
 
@@ -105,4 +109,5 @@ public:
 private:
     Texture2DCreateInfo mCreateInfo{};
     GLuint mId{0};
+    fuse::TrackedMemory mGpuMemory; ///< The size of the levels, in fuse::MemTag::Texture.
 };
@@ -1,5 +1,5 @@
 #pragma once
-#include <vector>
+#include <fuse/MemoryTracker.h>
 
 /// @brief Namespace which contains function to generate images.
 /// @todo Review brick generation texture for similitude/duplicate
@@ -22,9 +22,10 @@ struct ImageData {
         return pixels[row * width + col];
     }
 
-    std::vector<Color> pixels;
-    unsigned           width;
-    unsigned           height;
+    /// The pixels, counted in fuse::MemTag::Texture.
+    fuse::TrackedVector<Color, fuse::MemTag::Texture> pixels;
+    unsigned                                          width;
+    unsigned                                          height;
 };
 
 /// @brief Generate an image with a single color.
@@ -1,14 +1,45 @@
 #include "fuse/Application.h"
 #include "Layers/TestLayer.h"
 #include <fuse/Assert.h>
+#include <fuse/FrameLimiter.h>
 #include <fuse/Logger.h>
 
+#include <cstdlib>
+#include <string_view>
 
-int main(int, char**) {
-    fuse::Application app;
-    auto              layer = new TestLayer();
-    app.pushLayer(layer);
+
+/// Options:
+///  --headless   Run without a window, e.g. on the build agents.
+///  --frames N   Stop after N frames, 600 by default in headless mode.
+///  --record F   Record the input into the file F.
+///  --replay F   Replay the input recorded in the file F, e.g. to compare the frame times of
+///               two builds over the same camera path. Runs until the end of the recording.
+///  --stats F    Write the frame time percentiles to the CSV file F at exit.
+int main(int argc, char** argv) {
+    fuse::ApplicationConfig config;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if (arg == "--headless") {
+            config.headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            config.frameCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--record" && i + 1 < argc) {
+            config.recordInput = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            config.replayInput = argv[++i];
+        } else if (arg == "--stats" && i + 1 < argc) {
+            config.frameStatsCsv = argv[++i];
+        }
+    }
+    if (config.headless && config.frameCount == 0 && config.replayInput.empty()) {
+        config.frameCount = 600;
+    }
+
+    fuse::Application app(config);
+    app.pushLayer(new TestLayer());
     app.run();
-    delete layer; // FIXME: All GL ressource will leak because the context is already destroyed
+
+    const auto& stats = app.getFrameLimiter().getStats();
+    FUSE_INFO("{} frames, {:.3f} ms/frame", stats.frames, stats.averageFrameTime.asMilliSeconds());
     return 0;
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include <fuse/math/Fwd.h>
+
 #include <gtest/gtest.h>
 
 #include <ostream>
@@ -6,13 +8,6 @@
 namespace fuse {
 
 class Angle;
-struct Vec2;
-struct Vec3;
-struct Vec4;
-class Mat2;
-class Mat3;
-class Mat4;
-struct Quaternion;
 
 // teach gtest how to print data
 // they need be be in namespace fuse otherwise GTest will not find them.
@@ -0,0 +1,45 @@
+#include <fuse/math/AABB.h>
+#include <fuse/math/Vec3.h>
+
+#include <gtest/gtest.h>
+
+using namespace fuse;
+
+TEST(AABB, traits) {
+    static_assert(std::is_trivially_copyable_v<AABB>);
+    static_assert(sizeof(AABB) == 6 * sizeof(float));
+}
+
+TEST(AABB, centerExtents) {
+    constexpr AABB box({-1.f, 0.f, 2.f}, {3.f, 1.f, 6.f});
+    static_assert(box.center() == Vec3(1.f, 0.5f, 4.f));
+    static_assert(box.extents() == Vec3(2.f, 0.5f, 2.f));
+    static_assert(AABB::FromCenterExtents(box.center(), box.extents()) == box);
+}
+
+TEST(AABB, contains) {
+    constexpr AABB box({-1.f, -1.f, -1.f}, {1.f, 2.f, 3.f});
+    static_assert(box.contains({0.f, 0.f, 0.f}));
+    static_assert(box.contains({-1.f, 2.f, 3.f}));
+    static_assert(!box.contains({-1.5f, 0.f, 0.f}));
+    static_assert(!box.contains({0.f, 2.5f, 0.f}));
+    static_assert(!box.contains({0.f, 0.f, -3.f}));
+}
+
+TEST(AABB, intersects) {
+    constexpr AABB box({0.f, 0.f, 0.f}, {1.f, 1.f, 1.f});
+    static_assert(box.intersects(box));
+    static_assert(box.intersects({{0.5f, 0.5f, 0.5f}, {2.f, 2.f, 2.f}}));
+    static_assert(box.intersects({{1.f, 0.f, 0.f}, {2.f, 1.f, 1.f}}));
+    static_assert(box.intersects({{-5.f, -5.f, -5.f}, {5.f, 5.f, 5.f}}));
+    static_assert(!box.intersects({{0.f, 1.5f, 0.f}, {1.f, 2.f, 1.f}}));
+    static_assert(!box.intersects({{0.f, 0.f, -2.f}, {1.f, 1.f, -0.5f}}));
+}
+
+TEST(AABB, merge) {
+    constexpr AABB a({0.f, 0.f, 0.f}, {1.f, 1.f, 1.f});
+    constexpr AABB b({-1.f, 0.5f, 2.f}, {0.5f, 3.f, 4.f});
+    static_assert(a.merge(b) == AABB({-1.f, 0.f, 0.f}, {1.f, 3.f, 4.f}));
+    static_assert(a.merge(b) == b.merge(a));
+    static_assert(a.merge(a) == a);
+}
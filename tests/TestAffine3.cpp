@@ -0,0 +1,133 @@
+#include "GTestUtils.h"
+
+#include <fuse/math/Affine3.h>
+#include <fuse/math/Angle.h>
+#include <fuse/math/Mat3.h>
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Vec3.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace fuse;
+using namespace testing;
+
+namespace {
+
+void expectNear(const Mat4& expected, const Mat4& actual, float absError = 1e-5f) {
+    for (unsigned row = 0; row < 4; row++) {
+        for (unsigned col = 0; col < 4; col++) {
+            EXPECT_NEAR(expected(row, col), actual(row, col), absError)
+              << "row " << row << " col " << col;
+        }
+    }
+}
+
+} // namespace
+
+TEST(Affine3, traits) {
+    static_assert(std::is_trivially_copyable_v<Affine3>);
+    static_assert(sizeof(Affine3) == 12 * sizeof(float));
+}
+
+TEST(Affine3, constants) {
+    static_assert(Affine3::kIdentity.toMat4() == Mat4::kIdentity);
+    static_assert(Affine3::kIdentity.linear() == Mat3::kIdentity);
+    static_assert(Affine3::kIdentity.translation() == Vec3::kZero);
+}
+
+TEST(Affine3, constructor) {
+    constexpr Affine3 m(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    static_assert(m(0, 0) == 1 && m(0, 3) == 4 && m(1, 2) == 7 && m(2, 3) == 12);
+    EXPECT_EQ(Mat3(1, 2, 3, 5, 6, 7, 9, 10, 11), m.linear());
+    EXPECT_EQ(Vec3(4, 8, 12), m.translation());
+    EXPECT_EQ(m, Affine3(m.linear(), m.translation()));
+    EXPECT_EQ(1.f, m.data()[0]);
+    EXPECT_EQ(5.f, m.data()[4]);
+}
+
+TEST(Affine3, mat4_conversion) {
+    const Mat4 mat(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 1);
+    const auto affine = Affine3(mat);
+    EXPECT_EQ(Affine3(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12), affine);
+    EXPECT_EQ(mat, affine.toMat4());
+}
+
+TEST(Affine3, multiply) {
+    const Affine3 a(2, 2, 3, 4, 5, 6, 7, 8, 9, 3, 11, 12);
+    const Affine3 b(-1, 0.5f, 2, 3, 4, -2, 1, 0, 0.25f, 1, -3, 5);
+
+    // Small integers, the result must be exact.
+    EXPECT_EQ(a.toMat4() * b.toMat4(), (a * b).toMat4());
+    EXPECT_EQ(b.toMat4() * a.toMat4(), (b * a).toMat4());
+
+    auto c = a;
+    c *= b;
+    EXPECT_EQ(a * b, c);
+    c = b;
+    c *= c;
+    EXPECT_EQ(b * b, c);
+}
+
+TEST(Affine3, transform) {
+    const Affine3 m(2, 2, 3, 4, 5, 6, 7, 8, 9, 3, 11, 12);
+    const Vec3    v(1, -2, 0.5f);
+
+    const Vec4 point = m.toMat4() * Vec4(v.x, v.y, v.z, 1.f);
+    EXPECT_EQ(Vec3(point.x, point.y, point.z), m.transformPoint(v));
+    const Vec4 direction = m.toMat4() * Vec4(v.x, v.y, v.z, 0.f);
+    EXPECT_EQ(Vec3(direction.x, direction.y, direction.z), m.transformDirection(v));
+}
+
+TEST(Affine3, factories) {
+    const Vec3 axis(1, 2, -0.5f);
+    EXPECT_EQ(Mat4::CreateTranslation({1, 2, 3}),
+              Affine3::CreateTranslation({1, 2, 3}).toMat4());
+    EXPECT_EQ(Mat4::CreateScaling({1, 2, 3}), Affine3::CreateScaling({1, 2, 3}).toMat4());
+    expectNear(Mat4::CreateRotation(degrees(30), axis),
+               Affine3::CreateRotation(degrees(30), axis).toMat4());
+
+    const auto rotation = Mat3::CreateRotation(degrees(-70), axis);
+    const auto expected = Affine3::CreateTranslation({4, -5, 6}) *
+                          Affine3(rotation, Vec3::kZero) * Affine3::CreateScaling({2, 3, 0.5f});
+    expectNear(expected.toMat4(),
+               Affine3::CreateTRS({4, -5, 6}, rotation, {2, 3, 0.5f}).toMat4());
+}
+
+TEST(Affine3, inverse) {
+    {
+        // Same matrix as the Mat4.inverse test, without the last row.
+        const Affine3 m(2, 2, 3, 4, 5, 6, 7, 8, 9, 3, 11, 12);
+        EXPECT_EQ(m.linear().determinant(), m.determinant());
+        expectNear(m.toMat4().inverse(), m.inverse().toMat4());
+        // The translation is large compared to the linear part, allow more rounding error.
+        expectNear(Mat4::kIdentity, (m * m.inverse()).toMat4(), 1e-4f);
+        expectNear(Mat4::kIdentity, (m.inverse() * m).toMat4(), 1e-4f);
+    }
+    {
+        const Affine3 m(0.5f, -1.25f, 3.0f, 0.75f, 2.5f, 0.1f, -0.3f, 4.0f, -1.0f, 0.2f, 1.5f,
+                        -2.25f);
+        expectNear(m.toMat4().inverse(), m.inverse().toMat4());
+    }
+}
+
+TEST(Affine3, inverseRigid) {
+    const auto m = Affine3::CreateTranslation({1, -2, 3}) *
+                   Affine3::CreateRotation(degrees(40), {1, 1, 0});
+    expectNear(m.inverse().toMat4(), m.inverseRigid().toMat4());
+    expectNear(Mat4::kIdentity, (m * m.inverseRigid()).toMat4());
+
+    // Without rotation, the inverse is exact.
+    const auto t = Affine3::CreateTranslation({1, -2, 3});
+    EXPECT_EQ(Affine3::CreateTranslation({-1, 2, -3}), t.inverseRigid());
+}
+
+TEST(Affine3, inverseOrthogonal) {
+    const auto rotation = Mat3::CreateRotation(degrees(125), {0, 1, 2});
+    const auto m        = Affine3::CreateTRS({1, -2, 3}, rotation, {2, 0.5f, 4});
+    expectNear(m.inverse().toMat4(), m.inverseOrthogonal().toMat4());
+    expectNear(Mat4::kIdentity, (m * m.inverseOrthogonal()).toMat4());
+
+    const auto s = Affine3::CreateScaling({2, 4, 0.5f});
+    EXPECT_EQ(Affine3::CreateScaling({0.5f, 0.25f, 2}), s.inverseOrthogonal());
+}
@@ -0,0 +1,117 @@
+#include <fuse/Application.h>
+#include <fuse/Layer.h>
+
+#include <glad/gl.h>
+#include <SDL3/SDL.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Clear the framebuffer with a color and count the callbacks.
+class ClearLayer final : public Layer {
+public:
+    ClearLayer()
+        : Layer("ClearLayer") {}
+
+    void onUpdate(Time /*deltaTime*/) override { updates++; }
+
+    void onRender(float /*alpha*/) override {
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        renders++;
+    }
+
+    void onImGui() override { imguis++; }
+
+    int updates{0};
+    int renders{0};
+    int imguis{0};
+};
+
+/// @brief Skipped when the offscreen video driver has no OpenGL 4.5 context, run with
+///        LIBGL_ALWAYS_SOFTWARE=1 to use Mesa llvmpipe.
+class HeadlessApplicationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        if (!SDL_Init(SDL_INIT_VIDEO)) {
+            GTEST_SKIP() << "No offscreen video driver: " << SDL_GetError();
+        }
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+        SDL_Window*   window  = SDL_CreateWindow("TestApplication", 64, 64,
+                                                 SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+        SDL_GLContext context = window != nullptr ? SDL_GL_CreateContext(window) : nullptr;
+        const bool    supported = context != nullptr;
+        if (context != nullptr) {
+            SDL_GL_DestroyContext(context);
+        }
+        if (window != nullptr) {
+            SDL_DestroyWindow(window);
+        }
+        SDL_Quit();
+        if (!supported) {
+            GTEST_SKIP() << "No OpenGL 4.5 context: " << SDL_GetError();
+        }
+    }
+
+    static ApplicationConfig headlessConfig(std::uint64_t frameCount) {
+        ApplicationConfig config;
+        config.width      = 64;
+        config.height     = 32;
+        config.headless   = true;
+        config.frameCount = frameCount;
+        return config;
+    }
+};
+
+} // namespace
+
+TEST_F(HeadlessApplicationTest, frameCount) {
+    Application app(headlessConfig(3));
+    auto*       layer = new ClearLayer();
+    app.pushLayer(layer);
+    EXPECT_TRUE(app.isHeadless());
+    EXPECT_NE(0u, app.getFramebuffer());
+
+    app.run();
+    EXPECT_EQ(3u, app.getFrameIndex());
+    EXPECT_EQ(3, layer->updates);
+    EXPECT_EQ(3, layer->renders);
+    EXPECT_EQ(3, layer->imguis);
+
+    // The next call continues.
+    app.run();
+    EXPECT_EQ(6u, app.getFrameIndex());
+    EXPECT_EQ(6, layer->renders);
+}
+
+TEST_F(HeadlessApplicationTest, stopPredicate) {
+    Application app(headlessConfig(0));
+    auto*       layer = new ClearLayer();
+    app.pushLayer(layer);
+    app.run([layer] { return layer->renders == 5; });
+    EXPECT_EQ(5u, app.getFrameIndex());
+}
+
+TEST_F(HeadlessApplicationTest, readPixels) {
+    Application app(headlessConfig(1));
+    app.pushLayer(new ClearLayer());
+    app.run();
+
+    const std::vector<std::uint8_t> pixels = app.readPixels();
+    ASSERT_EQ(std::size_t{64} * 32 * 4, pixels.size());
+    const std::size_t center = (16 * 64 + 32) * 4;
+    EXPECT_EQ(255, pixels[center + 0]);
+    EXPECT_EQ(0, pixels[center + 1]);
+    EXPECT_EQ(0, pixels[center + 2]);
+    EXPECT_EQ(255, pixels[center + 3]);
+}
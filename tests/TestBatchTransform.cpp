@@ -0,0 +1,144 @@
+#include "GTestUtils.h"
+
+#include <fuse/JobSystem.h>
+#include <fuse/math/BatchTransform.h>
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Vec3.h>
+#include <fuse/math/Vec4.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace fuse;
+using namespace testing;
+
+namespace {
+
+// All values are exactly representable, the results do not depend on the kernel
+// (SIMD, FMA or scalar) and can be compared exactly.
+// clang-format off
+const Mat4 kMatrix(
+    0.5f, -1.25f,  2.f,    3.f,
+    1.f,   0.25f, -0.5f,  -4.f,
+   -2.f,   1.5f,   0.75f,  5.f,
+    0.f,   0.f,    0.f,    1.f
+);
+
+const Mat4 kProjective(
+    1.f,  2.f,  3.f,  4.f,
+    5.f,  6.f,  7.f,  8.f,
+    9.f,  10.f, 11.f, 12.f,
+    13.f, 14.f, 15.f, 16.f
+);
+// clang-format on
+
+std::vector<Vec3> makeVec3(std::size_t count) {
+    std::vector<Vec3> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        vectors[i]   = Vec3(f, -2.f * f + 1.f, 3.f - f);
+    }
+    return vectors;
+}
+
+std::vector<Vec4> makeVec4(std::size_t count) {
+    std::vector<Vec4> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i);
+        vectors[i]   = Vec4(f, -2.f * f + 1.f, 3.f - f, f * 0.5f);
+    }
+    return vectors;
+}
+
+Vec3 point(const Mat4& m, const Vec3& v) {
+    const Vec4 r = m * Vec4(v.x, v.y, v.z, 1.f);
+    return {r.x, r.y, r.z};
+}
+
+Vec3 direction(const Mat4& m, const Vec3& v) {
+    const Vec4 r = m * Vec4(v.x, v.y, v.z, 0.f);
+    return {r.x, r.y, r.z};
+}
+
+} // namespace
+
+TEST(BatchTransform, points) {
+    // Every size up to 3 full AVX2 blocks, to cover all the tails.
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto        in = makeVec3(count);
+        std::vector<Vec3> out(count);
+        transformPoints(kMatrix, in, out);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(point(kMatrix, in[i]), out[i]) << "count=" << count << " i=" << i;
+        }
+    }
+}
+
+TEST(BatchTransform, directions) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto        in = makeVec3(count);
+        std::vector<Vec3> out(count);
+        transformDirections(kMatrix, in, out);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(direction(kMatrix, in[i]), out[i]) << "count=" << count << " i=" << i;
+        }
+    }
+}
+
+TEST(BatchTransform, vec4) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto        in = makeVec4(count);
+        std::vector<Vec4> out(count);
+        transformVec4(kProjective, in, out);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(kProjective * in[i], out[i]) << "count=" << count << " i=" << i;
+        }
+    }
+}
+
+TEST(BatchTransform, output_larger_than_input) {
+    const auto        in = makeVec3(5);
+    std::vector<Vec3> out(7, Vec3(42.f));
+    transformPoints(kMatrix, in, out);
+    EXPECT_EQ(point(kMatrix, in[4]), out[4]);
+    EXPECT_EQ(Vec3(42.f), out[5]);
+    EXPECT_EQ(Vec3(42.f), out[6]);
+}
+
+TEST(BatchTransform, in_place) {
+    const auto expected = makeVec3(19);
+    auto       vectors  = expected;
+    transformPoints(kMatrix, vectors, vectors);
+    for (std::size_t i = 0; i < vectors.size(); i++) {
+        EXPECT_EQ(point(kMatrix, expected[i]), vectors[i]);
+    }
+
+    const auto expected4 = makeVec4(19);
+    auto       vectors4  = expected4;
+    transformVec4(kProjective, vectors4, vectors4);
+    for (std::size_t i = 0; i < vectors4.size(); i++) {
+        EXPECT_EQ(kProjective * expected4[i], vectors4[i]);
+    }
+}
+
+TEST(BatchTransform, multi_threads) {
+    // Uneven split, the last chunk is smaller and has a tail.
+    JobSystem          jobs(3);
+    const BatchOptions options{.jobs = &jobs, .minElementsPerJob = 100};
+
+    const auto        in = makeVec3(1003);
+    std::vector<Vec3> out(in.size());
+    transformPoints(kMatrix, in, out, options);
+    for (std::size_t i = 0; i < in.size(); i++) {
+        ASSERT_EQ(point(kMatrix, in[i]), out[i]) << "i=" << i;
+    }
+
+    const auto        in4 = makeVec4(1003);
+    std::vector<Vec4> out4(in4.size());
+    transformVec4(kProjective, in4, out4, options);
+    for (std::size_t i = 0; i < in4.size(); i++) {
+        ASSERT_EQ(kProjective * in4[i], out4[i]) << "i=" << i;
+    }
+}
@@ -0,0 +1,237 @@
+#include <fuse/BinaryLog.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+class BinaryLog : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!isLogLevelCompiled(LogLevel::Verbose)) {
+            GTEST_SKIP() << "The tests log every level, FUSE_LOG_LEVEL removes some.";
+        }
+        mPath = std::filesystem::temp_directory_path() / "FuseTestBinaryLog.blog";
+        ASSERT_TRUE(binary_log_initialize({.path = mPath, .bufferSize = 1024}));
+    }
+
+    void TearDown() override {
+        binary_log_shutdown();
+        std::filesystem::remove(mPath);
+    }
+
+    std::vector<BinaryLogMessage> decode() {
+        binary_log_shutdown();
+        auto messages = decodeBinaryLog(mPath);
+        EXPECT_TRUE(messages.has_value()) << messages.error();
+        return messages.value_or(std::vector<BinaryLogMessage>{});
+    }
+
+    std::filesystem::path mPath;
+};
+
+} // namespace
+
+TEST_F(BinaryLog, arguments) {
+    const std::string name = "player";
+    const int         value = 0;
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Empty");
+    FUSE_LOG_BINARY(LogCategory::Render, LogLevel::Warn, "{} {} {} {}", true, 'x', -42, 42u);
+    FUSE_LOG_BINARY(LogCategory::Math, LogLevel::Debug, "{} {} {}", std::int8_t{-8},
+                    std::uint16_t{16}, std::int64_t{-1} << 40);
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Error, "{:.2f} {:.3f}", 1.5f, 2.25);
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{} '{}' {}", name, "literal",
+                    std::string_view("view"));
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{}", std::uint8_t{2});
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{}", static_cast<const void*>(&value));
+    const auto messages = decode();
+
+    ASSERT_EQ(7u, messages.size());
+    EXPECT_EQ("Empty", messages[0].message);
+    EXPECT_EQ(LogCategory::General, messages[0].category);
+    EXPECT_EQ(LogLevel::Info, messages[0].level);
+    EXPECT_EQ("true x -42 42", messages[1].message);
+    EXPECT_EQ(LogCategory::Render, messages[1].category);
+    EXPECT_EQ(LogLevel::Warn, messages[1].level);
+    EXPECT_EQ("-8 16 -1099511627776", messages[2].message);
+    EXPECT_EQ("1.50 2.250", messages[3].message);
+    EXPECT_EQ("player 'literal' view", messages[4].message);
+    EXPECT_EQ("2", messages[5].message);
+    EXPECT_EQ(std::format("{}", static_cast<const void*>(&value)), messages[6].message);
+
+    EXPECT_TRUE(messages[0].file.ends_with("TestBinaryLog.cpp"));
+    EXPECT_LT(messages[0].line, messages[1].line);
+    for (std::size_t i = 1; i < messages.size(); i++) {
+        EXPECT_LE(messages[i - 1].time, messages[i].time);
+    }
+}
+
+TEST_F(BinaryLog, formatSpecs) {
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{{{}}} [{:>4}] {:#x} {:+.1e}", 1, 2,
+                    255, 1500.0);
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{1}{0}{1} {0:03}", 7, 8);
+    const auto messages = decode();
+    ASSERT_EQ(2u, messages.size());
+    EXPECT_EQ("{1} [   2] 0xff +1.5e+03", messages[0].message);
+    EXPECT_EQ("878 007", messages[1].message);
+}
+
+TEST_F(BinaryLog, longString) {
+    const std::string text(detail::kBinaryLogMaxString + 100, 'a');
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "{}", text);
+    const auto messages = decode();
+    ASSERT_EQ(1u, messages.size());
+    EXPECT_EQ(std::string(detail::kBinaryLogMaxString, 'a'), messages[0].message);
+}
+
+TEST_F(BinaryLog, runtimeLevel) {
+    log_set_level(LogCategory::Render, LogLevel::Warn);
+    FUSE_LOG_BINARY(LogCategory::Render, LogLevel::Info, "Filtered {}", 1);
+    FUSE_LOG_BINARY(LogCategory::Render, LogLevel::Error, "Kept {}", 2);
+    log_set_level(LogCategory::Render, kCompiledLogLevel);
+    const auto messages = decode();
+    ASSERT_EQ(1u, messages.size());
+    EXPECT_EQ("Kept 2", messages[0].message);
+}
+
+TEST_F(BinaryLog, manyBuffersAndThreads) {
+    constexpr int kThreads  = 4;
+    constexpr int kMessages = 5000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kMessages; i++) {
+                FUSE_LOG_BINARY(LogCategory::General, LogLevel::Verbose, "{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto messages = decode();
+
+    // Every message is written, the messages of a thread keep their order.
+    ASSERT_EQ(static_cast<std::size_t>(kThreads * kMessages), messages.size());
+    std::vector<int> next(kThreads, 0);
+    for (const auto& message : messages) {
+        int thread = 0;
+        int index  = 0;
+        ASSERT_EQ(2, std::sscanf(message.message.c_str(), "%d %d", &thread, &index));
+        EXPECT_EQ(next[thread], index);
+        next[thread] = index + 1;
+    }
+}
+
+TEST_F(BinaryLog, flush) {
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Before flush {}", 1);
+    binary_log_flush();
+
+    // Readable while the log is still open.
+    const auto messages = decodeBinaryLog(mPath);
+    ASSERT_TRUE(messages.has_value());
+    ASSERT_EQ(1u, messages->size());
+    EXPECT_EQ("Before flush 1", messages->front().message);
+}
+
+TEST_F(BinaryLog, sessions) {
+    const auto logSession = [](int session) {
+        FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Session {}", session);
+    };
+    logSession(1);
+    const auto first = decode();
+    ASSERT_EQ(1u, first.size());
+    EXPECT_EQ("Session 1", first[0].message);
+
+    // The formats are registered again in the new file, with new ids.
+    ASSERT_TRUE(binary_log_initialize({.path = mPath, .bufferSize = 1024}));
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Other {}", 2);
+    logSession(3);
+    const auto second = decode();
+    ASSERT_EQ(2u, second.size());
+    EXPECT_EQ("Other 2", second[0].message);
+    EXPECT_EQ("Session 3", second[1].message);
+}
+
+TEST_F(BinaryLog, idleThread) {
+    ASSERT_TRUE(binary_log_initialize({.path = mPath, .bufferSize = 1024, .flushInterval = 0.01}));
+    std::atomic<bool> done{false};
+    std::thread       thread([&done] {
+        FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Idle {}", 1);
+        while (!done.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // The writer thread takes the buffer of the thread, which logs nothing more.
+    // A read during a write may see a partial block: only the complete blocks are decoded.
+    std::size_t count = 0;
+    for (int i = 0; i < 500 && count == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const auto messages = decodeBinaryLog(mPath);
+        if (messages.has_value()) {
+            count = messages->size();
+        }
+    }
+    done.store(true);
+    thread.join();
+    EXPECT_EQ(1u, count);
+}
+
+TEST_F(BinaryLog, truncatedFile) {
+    // Several buffers of 8 KiB, each message is 16 bytes.
+    for (int i = 0; i < 2000; i++) {
+        FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Message {}", i);
+    }
+    binary_log_shutdown();
+    const auto size = std::filesystem::file_size(mPath);
+    std::filesystem::resize_file(mPath, size - 10);
+
+    // The buffer cut by a crash is lost, the buffers before it are kept.
+    const auto messages = decodeBinaryLog(mPath);
+    ASSERT_TRUE(messages.has_value());
+    EXPECT_LT(messages->size(), 2000u);
+    EXPECT_GT(messages->size(), 0u);
+}
+
+TEST_F(BinaryLog, corruptedFormatId) {
+    FUSE_LOG_BINARY(LogCategory::General, LogLevel::Info, "Message {}", 1);
+    binary_log_shutdown();
+
+    // The id of the first format block, after the magic, the version and the block type.
+    {
+        const std::uint32_t id   = UINT32_MAX;
+        std::FILE*          file = std::fopen(mPath.string().c_str(), "r+b");
+        ASSERT_NE(nullptr, file);
+        std::fseek(file, 8 + 4 + 1, SEEK_SET);
+        std::fwrite(&id, sizeof(id), 1, file);
+        std::fclose(file);
+    }
+    const auto messages = decodeBinaryLog(mPath);
+    ASSERT_FALSE(messages.has_value());
+    EXPECT_EQ("Corrupted format in the binary log.", messages.error());
+}
+
+TEST(BinaryLogDecode, notABinaryLog) {
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestNotBinaryLog.blog";
+    {
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        std::fputs("[Info] text log", file);
+        std::fclose(file);
+    }
+    EXPECT_FALSE(decodeBinaryLog(path).has_value());
+    EXPECT_FALSE(decodeBinaryLog(path.string() + ".missing").has_value());
+    std::filesystem::remove(path);
+}
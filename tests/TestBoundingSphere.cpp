@@ -0,0 +1,29 @@
+#include <fuse/math/BoundingSphere.h>
+#include <fuse/math/Vec3.h>
+
+#include <gtest/gtest.h>
+
+using namespace fuse;
+
+TEST(BoundingSphere, traits) {
+    static_assert(std::is_trivially_copyable_v<BoundingSphere>);
+    static_assert(sizeof(BoundingSphere) == 4 * sizeof(float));
+}
+
+TEST(BoundingSphere, contains) {
+    constexpr BoundingSphere sphere({1.f, 2.f, 3.f}, 2.f);
+    static_assert(sphere.contains({1.f, 2.f, 3.f}));
+    static_assert(sphere.contains({3.f, 2.f, 3.f}));
+    static_assert(sphere.contains({1.f, 1.f, 4.f}));
+    static_assert(!sphere.contains({3.f, 3.f, 3.f}));
+    static_assert(!sphere.contains({1.f, 2.f, 5.5f}));
+}
+
+TEST(BoundingSphere, intersects) {
+    constexpr BoundingSphere sphere({0.f, 0.f, 0.f}, 1.f);
+    static_assert(sphere.intersects(sphere));
+    static_assert(sphere.intersects({{1.5f, 0.f, 0.f}, 1.f}));
+    static_assert(sphere.intersects({{0.f, 3.f, 0.f}, 2.f}));
+    static_assert(sphere.intersects({{0.f, 0.f, 0.f}, 10.f}));
+    static_assert(!sphere.intersects({{0.f, 0.f, -3.f}, 1.5f}));
+}
@@ -0,0 +1,73 @@
+#include "fuse/CpuFeatures.h"
+#include "fuse/math/Dispatch.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string_view>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Return true if the CPU can run the kernels of @p isa.
+bool isSupported(Isa isa) {
+    const CpuFeatures& cpu = cpuFeatures();
+    switch (isa) {
+        case Isa::Scalar:
+            return true;
+        case Isa::SSE:
+            return cpu.sse2;
+        case Isa::AVX2:
+            return cpu.avx2 && cpu.fma;
+        case Isa::AVX512:
+            return cpu.avx512f && cpu.avx512bw && cpu.avx512dq && cpu.avx512vl && cpu.avx2 &&
+                   cpu.fma;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+TEST(Dispatch, toString) {
+    EXPECT_EQ(toString(Isa::Scalar), "Scalar");
+    EXPECT_EQ(toString(Isa::SSE), "SSE");
+    EXPECT_EQ(toString(Isa::AVX2), "AVX2");
+    EXPECT_EQ(toString(Isa::AVX512), "AVX512");
+}
+
+TEST(Dispatch, cpuFeatures) {
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is part of x86-64.
+    EXPECT_TRUE(cpuFeatures().sse2);
+#endif
+    EXPECT_EQ(&cpuFeatures(), &cpuFeatures());
+}
+
+TEST(Dispatch, activeIsa) {
+    const Isa isa = activeIsa();
+    EXPECT_LE(isa, compiledIsa());
+    EXPECT_TRUE(isSupported(isa)) << toString(isa);
+    EXPECT_EQ(activeIsa(), isa);
+}
+
+TEST(Dispatch, forceIsa) {
+    // Set by the tests run once per instruction set with FUSE_SIMD=DISPATCH (tests/CMakeLists.txt).
+    const char* forced = std::getenv("FUSE_FORCE_ISA");
+    if (forced == nullptr) {
+        GTEST_SKIP() << "FUSE_FORCE_ISA is not set.";
+    }
+
+    constexpr std::string_view names[] = {"scalar", "sse", "avx2", "avx512"};
+    for (const Isa isa : {Isa::Scalar, Isa::SSE, Isa::AVX2, Isa::AVX512}) {
+        if (names[static_cast<int>(isa)] == forced) {
+            // The best instruction set supported is used if the forced one is not.
+            if (isSupported(isa)) {
+                EXPECT_EQ(activeIsa(), isa);
+            } else {
+                EXPECT_LT(activeIsa(), isa);
+            }
+        }
+    }
+}
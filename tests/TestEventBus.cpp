@@ -0,0 +1,216 @@
+#include <fuse/EventBus.h>
+
+#include <SDL3/SDL.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Record the events received, handle them when asked.
+struct Recorder {
+    bool onEvent(const SDL_Event& e) {
+        events.push_back(e);
+        return handles;
+    }
+
+    std::vector<SDL_Event> events;
+    bool                   handles{false};
+};
+
+SDL_Event motion(float xrel, float yrel, std::uint32_t state = 0) {
+    SDL_Event e{};
+    e.motion.type  = SDL_EVENT_MOUSE_MOTION;
+    e.motion.x     = xrel * 10.0f;
+    e.motion.xrel  = xrel;
+    e.motion.yrel  = yrel;
+    e.motion.state = state;
+    return e;
+}
+
+SDL_Event keyDown() {
+    SDL_Event e{};
+    e.type = SDL_EVENT_KEY_DOWN;
+    return e;
+}
+
+} // namespace
+
+TEST(EventBus, typedDispatch) {
+    EventBus bus;
+    Recorder keys;
+    Recorder mouse;
+    auto     keySub   = bus.subscribe<&Recorder::onEvent>(SDL_EVENT_KEY_DOWN, &keys);
+    auto     mouseSub = bus.subscribe<&Recorder::onEvent>(SDL_EVENT_MOUSE_MOTION, &mouse);
+    EXPECT_EQ(1u, bus.subscriberCount(SDL_EVENT_KEY_DOWN));
+    EXPECT_EQ(0u, bus.subscriberCount(SDL_EVENT_KEY_UP));
+
+    bus.enqueue(keyDown());
+    bus.enqueue(motion(1.0f, 2.0f));
+    bus.enqueue(keyDown());
+    EXPECT_EQ(3u, bus.queuedCount());
+    bus.dispatch();
+    EXPECT_EQ(0u, bus.queuedCount());
+    EXPECT_EQ(2u, keys.events.size());
+    EXPECT_EQ(1u, mouse.events.size());
+
+    keySub.reset();
+    EXPECT_EQ(0u, bus.subscriberCount(SDL_EVENT_KEY_DOWN));
+    bus.enqueue(keyDown());
+    bus.dispatch();
+    EXPECT_EQ(2u, keys.events.size());
+}
+
+TEST(EventBus, priorityAndHandled) {
+    EventBus         bus;
+    std::vector<int> order;
+    struct Layer {
+        int               id;
+        bool              handles;
+        std::vector<int>* order;
+        bool              onEvent(const SDL_Event&) {
+            order->push_back(id);
+            return handles;
+        }
+    };
+    Layer bottom{1, false, &order};
+    Layer top{2, false, &order};
+    Layer overlay{3, true, &order};
+    Layer unreached{4, false, &order};
+    auto  s1 = bus.subscribe<&Layer::onEvent>(SDL_EVENT_KEY_DOWN, &unreached, -1);
+    auto  s2 = bus.subscribe<&Layer::onEvent>(SDL_EVENT_KEY_DOWN, &bottom);
+    auto  s3 = bus.subscribe<&Layer::onEvent>(SDL_EVENT_KEY_DOWN, &top);
+    auto  s4 = bus.subscribe<&Layer::onEvent>(SDL_EVENT_KEY_DOWN, &overlay, 1);
+
+    bus.enqueue(keyDown());
+    bus.dispatch();
+    EXPECT_EQ((std::vector<int>{3}), order);
+
+    order.clear();
+    s4.reset();
+    bus.enqueue(keyDown());
+    bus.dispatch();
+    // The latest subscription first for equal priorities, as the top of a layer stack.
+    EXPECT_EQ((std::vector<int>{2, 1, 4}), order);
+}
+
+TEST(EventBus, coalescing) {
+    EventBus bus;
+    Recorder mouse;
+    auto     sub = bus.subscribe<&Recorder::onEvent>(SDL_EVENT_MOUSE_MOTION, &mouse);
+
+    for (int i = 1; i <= 100; i++) {
+        bus.enqueue(motion(1.0f, -0.5f));
+    }
+    bus.enqueue(motion(3.0f, 0.0f, SDL_BUTTON_LMASK)); // A button pressed: not merged.
+    bus.enqueue(keyDown());
+    bus.enqueue(motion(1.0f, 1.0f)); // After another event: not merged.
+    EXPECT_EQ(4u, bus.queuedCount());
+    EXPECT_EQ(99u, bus.coalescedCount());
+    bus.dispatch();
+
+    ASSERT_EQ(3u, mouse.events.size());
+    EXPECT_FLOAT_EQ(100.0f, mouse.events[0].motion.xrel);
+    EXPECT_FLOAT_EQ(-50.0f, mouse.events[0].motion.yrel);
+    EXPECT_FLOAT_EQ(10.0f, mouse.events[0].motion.x) << "The last position.";
+    EXPECT_FLOAT_EQ(3.0f, mouse.events[1].motion.xrel);
+    EXPECT_FLOAT_EQ(1.0f, mouse.events[2].motion.xrel);
+
+    bus.setCoalescing(false);
+    bus.enqueue(motion(1.0f, 0.0f));
+    bus.enqueue(motion(1.0f, 0.0f));
+    EXPECT_EQ(2u, bus.queuedCount());
+}
+
+TEST(EventBus, wheelCoalescing) {
+    EventBus  bus;
+    SDL_Event wheel{};
+    wheel.wheel.type = SDL_EVENT_MOUSE_WHEEL;
+    wheel.wheel.y    = 1.0f;
+    bus.enqueue(wheel);
+    bus.enqueue(wheel);
+    bus.enqueue(wheel);
+    Recorder recorder;
+    auto     sub = bus.subscribe<&Recorder::onEvent>(SDL_EVENT_MOUSE_WHEEL, &recorder);
+    bus.dispatch();
+    ASSERT_EQ(1u, recorder.events.size());
+    EXPECT_FLOAT_EQ(3.0f, recorder.events[0].wheel.y);
+}
+
+TEST(EventBus, subscriptionChangesInCallback) {
+    EventBus bus;
+    struct Handler {
+        EventBus*         bus;
+        EventSubscription self;
+        EventSubscription added;
+        Recorder          recorder;
+        int               calls{0};
+        void              onEvent(const SDL_Event&) {
+            calls++;
+            // Removed in its first call, adds another subscriber for the next dispatch().
+            self.reset();
+            added = bus->subscribe<&Recorder::onEvent>(SDL_EVENT_KEY_DOWN, &recorder);
+        }
+    };
+    Handler handler{&bus, {}, {}, {}};
+    handler.self = bus.subscribe<&Handler::onEvent>(SDL_EVENT_KEY_DOWN, &handler);
+
+    bus.enqueue(keyDown());
+    bus.enqueue(keyDown());
+    bus.dispatch();
+    EXPECT_EQ(1, handler.calls);
+    EXPECT_TRUE(handler.recorder.events.empty());
+    EXPECT_EQ(1u, bus.subscriberCount(SDL_EVENT_KEY_DOWN));
+
+    bus.enqueue(keyDown());
+    bus.dispatch();
+    EXPECT_EQ(1u, handler.recorder.events.size());
+}
+
+TEST(EventBus, postFromThreads) {
+    EventBus            bus;
+    const std::uint32_t type = EventBus::registerEventType();
+    ASSERT_NE(0u, type);
+    EXPECT_NE(type, EventBus::registerEventType());
+
+    Recorder recorder;
+    auto     sub = bus.subscribe<&Recorder::onEvent>(type, &recorder);
+
+    constexpr int            kThreads = 4;
+    constexpr int            kEvents  = 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&bus, type, t] {
+            for (int i = 0; i < kEvents; i++) {
+                EXPECT_TRUE(bus.post(type, t * kEvents + i));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    bus.dispatch();
+
+    ASSERT_EQ(std::size_t{kThreads * kEvents}, recorder.events.size());
+    std::vector<bool> seen(kThreads * kEvents);
+    for (const SDL_Event& e : recorder.events) {
+        EXPECT_EQ(type, e.user.type);
+        seen[static_cast<std::size_t>(e.user.code)] = true;
+    }
+    EXPECT_EQ(std::vector<bool>(kThreads * kEvents, true), seen);
+}
+
+TEST(EventBus, postFull) {
+    EventBus            bus(4);
+    const std::uint32_t type = EventBus::registerEventType();
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(bus.post(type));
+    }
+    EXPECT_FALSE(bus.post(type));
+    bus.dispatch();
+    EXPECT_TRUE(bus.post(type));
+}
@@ -0,0 +1,107 @@
+#include <fuse/math/Angle.h>
+#include <fuse/math/FastTrig.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Reference value computed in double from the angle in degrees.
+double radiansOf(Angle angle) {
+    return static_cast<double>(angle.asDegrees()) * std::numbers::pi / 180.0;
+}
+
+/// @brief Maximum error of each precision level, see TrigPrecision.
+template <TrigPrecision kPrecision>
+constexpr double kMaxError = kPrecision == TrigPrecision::Low      ? 2e-4
+                             : kPrecision == TrigPrecision::Medium ? 1e-6
+                                                                   : 1e-7;
+
+template <TrigPrecision kPrecision>
+void checkPrecision() {
+    // Every thousandth of degree over 2 turns in both directions.
+    for (int i = -720'000; i <= 720'000; i++) {
+        const auto angle  = degrees(static_cast<float>(i) / 1000.f);
+        const auto result = sincos<kPrecision>(angle);
+        ASSERT_NEAR(std::sin(radiansOf(angle)), result.sin, kMaxError<kPrecision>) << angle.asDegrees();
+        ASSERT_NEAR(std::cos(radiansOf(angle)), result.cos, kMaxError<kPrecision>) << angle.asDegrees();
+        ASSERT_EQ(result.sin, fastSin<kPrecision>(angle));
+        ASSERT_EQ(result.cos, fastCos<kPrecision>(angle));
+    }
+}
+
+SinCos sincosOf(Angle angle, TrigPrecision precision) {
+    switch (precision) {
+        case TrigPrecision::Low: return sincos<TrigPrecision::Low>(angle);
+        case TrigPrecision::Medium: return sincos<TrigPrecision::Medium>(angle);
+        case TrigPrecision::High: return sincos<TrigPrecision::High>(angle);
+        default: return {};
+    }
+}
+
+} // namespace
+
+TEST(FastTrig, constexpr) {
+    static_assert(fastSin(degrees(0.f)) == 0.f);
+    static_assert(fastCos(degrees(0.f)) == 1.f);
+    static_assert(fastSin(degrees(90.f)) == 1.f);
+    static_assert(fastCos(degrees(180.f)) == -1.f);
+    static_assert(sincos<TrigPrecision::High>(degrees(-90.f)).sin == -1.f);
+}
+
+TEST(FastTrig, precision_low) { checkPrecision<TrigPrecision::Low>(); }
+
+TEST(FastTrig, precision_medium) { checkPrecision<TrigPrecision::Medium>(); }
+
+TEST(FastTrig, precision_high) { checkPrecision<TrigPrecision::High>(); }
+
+TEST(FastTrig, large_angles) {
+    // The reduction is exact, large angles are as accurate as small ones.
+    for (float degree : {3600.f, 36'045.f, -123'456.5f, 1e6f + 30.f, 9'999'990.f}) {
+        const auto angle = degrees(degree);
+        EXPECT_NEAR(std::sin(radiansOf(angle)), fastSin(angle), 1e-6) << angle.asDegrees();
+        EXPECT_NEAR(std::cos(radiansOf(angle)), fastCos(angle), 1e-6) << angle.asDegrees();
+    }
+}
+
+TEST(FastTrig, batch) {
+    // Every size up to 3 full AVX2 blocks, to cover all the tails.
+    for (std::size_t count = 0; count <= 25; count++) {
+        std::vector<Angle> angles(count);
+        for (std::size_t i = 0; i < count; i++) {
+            angles[i] = degrees(static_cast<float>(i) * 47.3f - 500.f);
+        }
+
+        for (auto precision : {TrigPrecision::Low, TrigPrecision::Medium, TrigPrecision::High}) {
+            std::vector<float> sin(count);
+            std::vector<float> cos(count);
+            sincos(angles, sin, cos, precision);
+            for (std::size_t i = 0; i < count; i++) {
+                const auto expected = sincosOf(angles[i], precision);
+                // Within 1 ulp, the SIMD kernels may use FMA.
+                EXPECT_NEAR(expected.sin, sin[i], 1.2e-7f);
+                EXPECT_NEAR(expected.cos, cos[i], 1.2e-7f);
+            }
+
+            std::vector<float> sinOnly(count);
+            fastSin(angles, sinOnly, precision);
+            EXPECT_EQ(sin, sinOnly);
+
+            std::vector<float> cosOnly(count);
+            fastCos(angles, cosOnly, precision);
+            EXPECT_EQ(cos, cosOnly);
+        }
+    }
+}
+
+TEST(FastTrig, batch_does_not_overflow) {
+    const std::vector<Angle> angles(9, degrees(30.f));
+    std::vector<float>       sin(10, 42.f);
+    sincos(angles, sin, {});
+    EXPECT_EQ(42.f, sin[9]);
+}
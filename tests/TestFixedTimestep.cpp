@@ -0,0 +1,93 @@
+#include <fuse/FixedTimestep.h>
+
+#include <gtest/gtest.h>
+
+using namespace fuse;
+
+namespace {
+
+// Powers of 2 so the accumulation is exact.
+constexpr double kStep = 1.0 / 64.0;
+
+} // namespace
+
+TEST(FixedTimestep, construct) {
+    const FixedTimestep fixed(kStep, 3);
+    EXPECT_EQ(kStep, fixed.step().asSeconds());
+    EXPECT_EQ(3u, fixed.maxSteps());
+    EXPECT_EQ(0.f, fixed.alpha());
+    EXPECT_EQ(0.0, fixed.droppedTime().asSeconds());
+}
+
+TEST(FixedTimestep, oneStepPerFrame) {
+    FixedTimestep fixed(kStep);
+    for (int frame = 0; frame < 100; frame++) {
+        EXPECT_EQ(1u, fixed.advance(kStep));
+        EXPECT_EQ(0.f, fixed.alpha());
+    }
+}
+
+TEST(FixedTimestep, fasterFrames) {
+    // Rendering 4 times faster than the simulation: 1 step every 4 frames.
+    FixedTimestep fixed(kStep);
+    for (int frame = 1; frame <= 16; frame++) {
+        const unsigned steps = fixed.advance(kStep / 4);
+        EXPECT_EQ(frame % 4 == 0 ? 1u : 0u, steps);
+        EXPECT_EQ(static_cast<float>(frame % 4) / 4.f, fixed.alpha());
+    }
+}
+
+TEST(FixedTimestep, slowerFrames) {
+    FixedTimestep fixed(kStep);
+    EXPECT_EQ(2u, fixed.advance(kStep * 2.5));
+    EXPECT_EQ(0.5f, fixed.alpha());
+    EXPECT_EQ(3u, fixed.advance(kStep * 2.5));
+    EXPECT_EQ(0.f, fixed.alpha());
+}
+
+TEST(FixedTimestep, maxSteps) {
+    // A long frame runs the maximum of steps and drops the rest, the fraction is kept.
+    FixedTimestep fixed(kStep, 4);
+    EXPECT_EQ(4u, fixed.advance(kStep * 10.25));
+    EXPECT_EQ(kStep * 6, fixed.droppedTime().asSeconds());
+    EXPECT_EQ(0.25f, fixed.alpha());
+
+    // Back to normal the next frame, no catch up.
+    EXPECT_EQ(1u, fixed.advance(kStep));
+    EXPECT_EQ(0.25f, fixed.alpha());
+}
+
+TEST(FixedTimestep, negativeFrameTime) {
+    FixedTimestep fixed(kStep);
+    EXPECT_EQ(0u, fixed.advance(-1.0));
+    EXPECT_EQ(0.f, fixed.alpha());
+}
+
+TEST(FixedTimestep, alphaRange) {
+    FixedTimestep fixed(1.0 / 60.0);
+    for (int frame = 0; frame < 10000; frame++) {
+        (void)fixed.advance(0.001 * (frame % 37));
+        EXPECT_GE(fixed.alpha(), 0.f);
+        EXPECT_LT(fixed.alpha(), 1.f);
+    }
+}
+
+TEST(FixedTimestep, setStep) {
+    FixedTimestep fixed(kStep);
+    EXPECT_EQ(0u, fixed.advance(kStep / 2));
+    fixed.setStep(kStep / 4);
+    EXPECT_EQ(2u, fixed.advance(0.0));
+    EXPECT_EQ(0.f, fixed.alpha());
+
+    fixed.setMaxSteps(1);
+    EXPECT_EQ(1u, fixed.advance(kStep));
+    EXPECT_EQ(1u, fixed.maxSteps());
+}
+
+TEST(FixedTimestep, reset) {
+    FixedTimestep fixed(kStep);
+    EXPECT_EQ(0u, fixed.advance(kStep * 0.75));
+    fixed.reset();
+    EXPECT_EQ(0.f, fixed.alpha());
+    EXPECT_EQ(0u, fixed.advance(kStep * 0.75));
+}
@@ -0,0 +1,152 @@
+#include <fuse/FrameArena.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+bool isAligned(const void* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+} // namespace
+
+TEST(FrameArena, allocate) {
+    FrameArena arena(1024);
+    EXPECT_EQ(0u, arena.capacity());
+
+    auto* a = static_cast<char*>(arena.allocate(3, 1));
+    auto* b = static_cast<char*>(arena.allocate(8, 8));
+    auto* c = arena.allocate<std::uint64_t>(4);
+    auto* d = arena.allocate(1, 64);
+    EXPECT_EQ(1024u, arena.capacity());
+    EXPECT_TRUE(isAligned(b, 8));
+    EXPECT_TRUE(isAligned(c, alignof(std::uint64_t)));
+    EXPECT_TRUE(isAligned(d, 64));
+    EXPECT_LT(a, b);
+    EXPECT_LE(b + 8, reinterpret_cast<char*>(c));
+    EXPECT_GE(arena.used(), 3u + 8u + 32u + 1u);
+}
+
+TEST(FrameArena, allocateZero) {
+    // Not null before the first block, as required by std::pmr::memory_resource.
+    FrameArena arena(1024);
+    void*      p = arena.allocate(0);
+    EXPECT_NE(nullptr, p);
+    EXPECT_TRUE(isAligned(p, alignof(std::max_align_t)));
+    arena.reset();
+    EXPECT_NE(nullptr, arena.allocate(0, 1));
+    EXPECT_NE(nullptr, arena.allocate(0, 256));
+
+    FrameArena         empty(1024);
+    FrameArenaResource resource(empty);
+    EXPECT_NE(nullptr, resource.allocate(0));
+}
+
+TEST(FrameArena, growAndMerge) {
+    FrameArena arena(1024);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 10; i++) {
+        blocks.push_back(arena.allocate(300));
+    }
+    // Larger than the capacity.
+    blocks.push_back(arena.allocate(10000));
+    EXPECT_GE(arena.used(), 13000u);
+    EXPECT_GE(arena.capacity(), arena.used());
+    const std::size_t capacity = arena.capacity();
+
+    // The blocks are merged: the same frame fits in the single block.
+    arena.reset();
+    EXPECT_EQ(0u, arena.used());
+    EXPECT_EQ(capacity, arena.capacity());
+    char* first = static_cast<char*>(arena.allocate(300));
+    for (int i = 1; i < 10; i++) {
+        EXPECT_NE(nullptr, arena.allocate(300));
+    }
+    char* last = static_cast<char*>(arena.allocate(10000));
+    EXPECT_EQ(capacity, arena.capacity());
+    EXPECT_LT(last - first, static_cast<std::ptrdiff_t>(capacity));
+}
+
+TEST(FrameArena, highWaterMark) {
+    FrameArena arena(1024);
+    EXPECT_EQ(0u, arena.highWaterMark());
+    EXPECT_NE(nullptr, arena.allocate(500, 1));
+    EXPECT_EQ(500u, arena.highWaterMark());
+    arena.reset();
+    EXPECT_NE(nullptr, arena.allocate(100, 1));
+    EXPECT_EQ(100u, arena.used());
+    EXPECT_EQ(500u, arena.highWaterMark());
+    EXPECT_NE(nullptr, arena.allocate(900, 1));
+    EXPECT_EQ(1000u, arena.highWaterMark());
+    EXPECT_EQ(1u, arena.generation());
+}
+
+TEST(FrameArena, reuseAfterReset) {
+    FrameArena arena(1024);
+    void* first = arena.allocate(16);
+    arena.reset();
+    EXPECT_EQ(first, arena.allocate(16));
+}
+
+TEST(FrameArena, pmrContainers) {
+    FrameArena         arena;
+    FrameArenaResource resource(arena);
+    {
+        std::pmr::vector<int> values(&resource);
+        for (int i = 0; i < 1000; i++) {
+            values.push_back(i);
+        }
+        std::pmr::string text("a string longer than the small string buffer", &resource);
+        text += text;
+        EXPECT_EQ(999, values.back());
+        EXPECT_EQ(88u, text.size());
+    }
+    EXPECT_GE(arena.used(), 1000 * sizeof(int));
+    arena.reset();
+}
+
+#if FUSE_FRAME_ARENA_DEBUG
+TEST(FrameArenaDeathTest, useAfterReset) {
+    EXPECT_DEATH(
+      {
+          FrameArena            arena;
+          FrameArenaResource    resource(arena);
+          std::pmr::vector<int> values({1, 2, 3}, &resource);
+          arena.reset();
+      },
+      "outlived the frame");
+}
+#endif
+
+TEST(FrameArena, threadArenas) {
+    FrameArena& main = frameArena();
+    EXPECT_EQ(&main, &frameArena());
+
+    FrameArena* worker = nullptr;
+    std::thread thread([&worker] {
+        worker = &frameArena();
+        EXPECT_NE(nullptr, frameArena().allocate(64));
+    });
+    thread.join();
+    EXPECT_NE(&main, worker);
+
+    // Reset on the first use of the next frame.
+    EXPECT_NE(nullptr, main.allocate(64));
+    const std::uint64_t generation = main.generation();
+    EXPECT_GT(main.used(), 0u);
+    resetFrameArenas();
+    EXPECT_EQ(generation + 1, frameArena().generation());
+    EXPECT_EQ(0u, frameArena().used());
+    EXPECT_EQ(generation + 1, frameArena().generation());
+
+    std::pmr::vector<int> values({1, 2, 3}, frameMemoryResource());
+    EXPECT_EQ(3u, values.size());
+}
@@ -0,0 +1,109 @@
+#include <fuse/FrameLimiter.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace fuse;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+TEST(FrameLimiter, defaults) {
+    const FrameLimiter limiter;
+    EXPECT_EQ(FrameLimiter::Mode::Unlimited, limiter.getMode());
+    EXPECT_EQ(60.0, limiter.getTargetFps());
+    EXPECT_EQ(10.0, limiter.getIdleFps());
+    EXPECT_FALSE(limiter.isIdle());
+    EXPECT_EQ(0.0, limiter.remaining().asSeconds());
+}
+
+TEST(FrameLimiter, unlimited) {
+    FrameLimiter limiter;
+    const auto   start = Clock::now();
+    for (int i = 0; i < 1000; i++) {
+        limiter.waitForNextFrame();
+    }
+    EXPECT_LT(secondsSince(start), 0.1);
+    EXPECT_EQ(999u, limiter.getStats().frames);
+    EXPECT_EQ(0.0, limiter.getStats().averageError.asSeconds());
+}
+
+TEST(FrameLimiter, fixed) {
+    // The timings are loose for loaded machines, the average is what the limiter controls.
+    FrameLimiter limiter;
+    limiter.setMode(FrameLimiter::Mode::Fixed);
+    limiter.setTargetFps(200.0);
+
+    limiter.waitForNextFrame(); // The first frame starts the cadence.
+    const auto start = Clock::now();
+    for (int i = 0; i < 40; i++) {
+        limiter.waitForNextFrame();
+    }
+    const double elapsed = secondsSince(start);
+    EXPECT_GE(elapsed, 40 * 0.005 * 0.95);
+    EXPECT_LT(elapsed, 40 * 0.005 * 1.5);
+
+    const FramePacingStats& stats = limiter.getStats();
+    EXPECT_EQ(40u, stats.frames);
+    EXPECT_NEAR(0.005, stats.averageFrameTime.asSeconds(), 0.001);
+    EXPECT_LE(stats.averageError.asSeconds(), stats.maxError.asSeconds());
+}
+
+TEST(FrameLimiter, cadence) {
+    // A slow frame is compensated by the next one.
+    FrameLimiter limiter;
+    limiter.setMode(FrameLimiter::Mode::Fixed);
+    limiter.setTargetFps(50.0);
+
+    limiter.waitForNextFrame();
+    const auto start = Clock::now();
+    for (int i = 0; i < 10; i++) {
+        if (i % 2 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(15));
+        }
+        limiter.waitForNextFrame();
+    }
+    EXPECT_NEAR(0.2, secondsSince(start), 0.03);
+}
+
+TEST(FrameLimiter, adaptive) {
+    FrameLimiter limiter;
+    limiter.setMode(FrameLimiter::Mode::Adaptive);
+    limiter.setTargetFps(200.0);
+    limiter.setIdleFps(20.0);
+    limiter.setIdleDelay(0.02);
+
+    limiter.markActive();
+    EXPECT_FALSE(limiter.isIdle());
+    limiter.waitForNextFrame();
+    EXPECT_LE(limiter.remaining().asSeconds(), 0.005);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(limiter.isIdle());
+    // The idle frame is longer than the time already elapsed since the last frame.
+    EXPECT_GT(limiter.remaining().asSeconds(), 0.005);
+
+    limiter.markActive();
+    EXPECT_FALSE(limiter.isIdle());
+    // The active frame is already over.
+    EXPECT_EQ(0.0, limiter.remaining().asSeconds());
+}
+
+TEST(FrameLimiter, resetStats) {
+    FrameLimiter limiter;
+    limiter.waitForNextFrame();
+    limiter.waitForNextFrame();
+    EXPECT_EQ(1u, limiter.getStats().frames);
+    limiter.resetStats();
+    EXPECT_EQ(0u, limiter.getStats().frames);
+    EXPECT_EQ(0.0, limiter.getStats().averageFrameTime.asSeconds());
+}
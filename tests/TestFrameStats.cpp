@@ -0,0 +1,173 @@
+#include <fuse/FrameStats.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <thread>
+
+using namespace fuse;
+
+TEST(FrameStats, empty) {
+    const FrameStats stats;
+    EXPECT_EQ(0u, stats.frameCount());
+    EXPECT_TRUE(stats.frames().empty());
+    const FrameTimeSummary summary = stats.summary();
+    EXPECT_EQ(0u, summary.frames);
+    EXPECT_EQ(0.0, summary.p99);
+}
+
+TEST(FrameStats, percentiles) {
+    FrameStats stats(128);
+    // 1 ms to 100 ms: percentile p is p ms with the nearest-rank method.
+    for (int i = 1; i <= 100; i++) {
+        stats.addFrame(i / 1000.0);
+    }
+    const FrameTimeSummary summary = stats.summary();
+    EXPECT_EQ(100u, summary.frames);
+    EXPECT_NEAR(50.5, summary.average, 1e-4);
+    EXPECT_NEAR(50.0, summary.p50, 1e-4);
+    EXPECT_NEAR(95.0, summary.p95, 1e-4);
+    EXPECT_NEAR(99.0, summary.p99, 1e-4);
+    EXPECT_NEAR(100.0, summary.max, 1e-4);
+    // Over 1/30 s: 34 ms to 100 ms.
+    EXPECT_EQ(67u, summary.hitches);
+    EXPECT_EQ(67u, stats.hitchCount());
+}
+
+TEST(FrameStats, stutterShowsInTheTail) {
+    FrameStats stats;
+    for (int i = 0; i < 600; i++) {
+        stats.addFrame(i % 60 == 59 ? 0.1 : 0.016);
+    }
+    const FrameTimeSummary summary = stats.summary();
+    EXPECT_NEAR(16.0, summary.p50, 1e-3);
+    EXPECT_NEAR(16.0, summary.p95, 1e-3);
+    EXPECT_NEAR(100.0, summary.p99, 1e-3);
+    EXPECT_EQ(10u, summary.hitches);
+}
+
+TEST(FrameStats, windowKeepsTheLastFrames) {
+    FrameStats stats(4);
+    EXPECT_EQ(4u, stats.capacity());
+    for (int i = 1; i <= 10; i++) {
+        stats.addFrame(i / 1000.0);
+    }
+    EXPECT_EQ(10u, stats.frameCount());
+    const auto frames = stats.frames();
+    ASSERT_EQ(4u, frames.size());
+    EXPECT_FLOAT_EQ(7.0f, frames[0].frameTime);
+    EXPECT_FLOAT_EQ(10.0f, frames[3].frameTime);
+
+    // The histogram counts every frame since the reset.
+    const auto histogram = stats.histogram();
+    EXPECT_EQ(10u, std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{0}));
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.frameCount());
+    EXPECT_TRUE(stats.frames().empty());
+    EXPECT_EQ(0u, stats.histogram()[FrameStats::bucketOf(10.0)]);
+}
+
+TEST(FrameStats, phases) {
+    FrameStats      stats;
+    FramePhaseTimes phases{};
+    for (int i = 1; i <= 10; i++) {
+        phases[static_cast<std::size_t>(FramePhase::Render)] = static_cast<float>(i);
+        phases[static_cast<std::size_t>(FramePhase::Wait)]   = 2.0f;
+        stats.addFrame(0.016, phases);
+    }
+    const FrameTimeSummary render = stats.summary(FramePhase::Render);
+    EXPECT_EQ(10u, render.frames);
+    EXPECT_NEAR(5.0, render.p50, 1e-4);
+    EXPECT_NEAR(10.0, render.max, 1e-4);
+    EXPECT_NEAR(2.0, stats.summary(FramePhase::Wait).p99, 1e-4);
+    EXPECT_EQ(0.0, stats.summary(FramePhase::Events).max);
+    EXPECT_EQ("FixedUpdate", toString(FramePhase::FixedUpdate));
+}
+
+TEST(FrameStats, hitchThreshold) {
+    FrameStats stats;
+    stats.setHitchThreshold(0.010);
+    EXPECT_NEAR(10.0, stats.hitchThreshold().asMilliSeconds(), 1e-4);
+    stats.addFrame(0.009);
+    stats.addFrame(0.011);
+    EXPECT_EQ(1u, stats.hitchCount());
+    EXPECT_EQ(1u, stats.summary().hitches);
+}
+
+TEST(FrameStats, histogramBuckets) {
+    EXPECT_EQ(0u, FrameStats::bucketOf(0.0));
+    EXPECT_EQ(0u, FrameStats::bucketOf(0.2));
+    EXPECT_EQ(1u, FrameStats::bucketOf(0.25));
+    EXPECT_EQ(2u, FrameStats::bucketOf(0.36));
+    EXPECT_EQ(3u, FrameStats::bucketOf(0.5));
+    EXPECT_EQ(FrameStats::kHistogramBuckets - 1, FrameStats::bucketOf(1e6));
+    for (std::size_t i = 1; i < FrameStats::kHistogramBuckets; i++) {
+        const double lower = FrameStats::bucketLowerBound(i);
+        EXPECT_EQ(i, FrameStats::bucketOf(lower * 1.0001)) << lower;
+        EXPECT_EQ(i - 1, FrameStats::bucketOf(lower * 0.9999)) << lower;
+    }
+    // 60 FPS and 30 FPS frames are 2 buckets apart.
+    EXPECT_EQ(FrameStats::bucketOf(16.7) + 2, FrameStats::bucketOf(33.4));
+}
+
+TEST(FrameStats, concurrentReader) {
+    FrameStats        stats(64);
+    std::atomic<bool> done{false};
+    std::thread       writer([&] {
+        // Every frame of the ring has the same time as its phases: a mix of 2 frames shows.
+        for (int i = 0; i < 200'000; i++) {
+            const float     ms = static_cast<float>(i % 1000);
+            FramePhaseTimes phases;
+            phases.fill(ms);
+            stats.addFrame(ms / 1000.0, phases);
+        }
+        done = true;
+    });
+    while (!done) {
+        for (const FrameSample& frame : stats.frames()) {
+            for (const float phase : frame.phases) {
+                ASSERT_NEAR(frame.frameTime, phase, 1e-3f);
+            }
+        }
+    }
+    writer.join();
+    EXPECT_EQ(64u, stats.frames().size());
+}
+
+TEST(FrameStats, exportCsv) {
+    FrameStats stats;
+    stats.addFrame(0.010);
+    stats.addFrame(0.050);
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestFrameStats.csv";
+    ASSERT_TRUE(stats.exportCsv(path));
+
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    EXPECT_EQ("series,frames,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches", line);
+    std::getline(file, line);
+    EXPECT_EQ("Frame,2,30.0000,10.0000,50.0000,50.0000,50.0000,1", line);
+    int         lines = 2;
+    std::string last;
+    while (std::getline(file, line)) {
+        last = line;
+        lines++;
+    }
+    EXPECT_EQ("Total,2,,,,,,1", last);
+    EXPECT_EQ(2 + static_cast<int>(kFramePhaseCount) + 1, lines);
+    file.close();
+
+    ASSERT_TRUE(stats.exportHistogramCsv(path));
+    std::ifstream histogram(path);
+    std::getline(histogram, line);
+    EXPECT_EQ("min_ms,frames", line);
+    histogram.close();
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(stats.exportCsv(std::filesystem::path("missing-dir") / "stats.csv"));
+}
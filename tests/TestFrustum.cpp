@@ -0,0 +1,171 @@
+#include "GTestUtils.h"
+
+#include <fuse/math/AABB.h>
+#include <fuse/math/Angle.h>
+#include <fuse/math/BoundingSphere.h>
+#include <fuse/math/Frustum.h>
+#include <fuse/math/Mat4.h>
+#include <fuse/math/Vec3.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Camera at the origin looking toward -z, 90 degrees field of view, near 1, far 100.
+Frustum makeFrustum() {
+    return Frustum::FromMatrix(
+      Mat4::CreateProjectionPerspectiveFOVY(degrees(90), 1.f, 1.f, 100.f));
+}
+
+/// @brief Frustum of a camera looking at the origin from an arbitrary position.
+Frustum makeCameraFrustum() {
+    const Mat4 projection = Mat4::CreateProjectionPerspectiveFOVY(degrees(60), 16.f / 9.f, 0.1f, 50.f);
+    const Mat4 view       = Mat4::CreateViewLookAt({10.f, 5.f, 20.f}, Vec3::kZero);
+    return Frustum::FromMatrix(projection * view);
+}
+
+std::vector<BoundingSphere> makeSpheres(std::size_t count, unsigned seed) {
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-60.f, 60.f);
+    std::uniform_real_distribution<float> radius(0.f, 5.f);
+    std::vector<BoundingSphere>           spheres(count);
+    for (auto& sphere : spheres) {
+        sphere = {{position(rng), position(rng), position(rng)}, radius(rng)};
+    }
+    return spheres;
+}
+
+std::vector<AABB> makeBoxes(std::size_t count, unsigned seed) {
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> position(-60.f, 60.f);
+    std::uniform_real_distribution<float> extent(0.f, 5.f);
+    std::vector<AABB>                     boxes(count);
+    for (auto& box : boxes) {
+        box = AABB::FromCenterExtents({position(rng), position(rng), position(rng)},
+                                      {extent(rng), extent(rng), extent(rng)});
+    }
+    return boxes;
+}
+
+} // namespace
+
+TEST(Frustum, FromMatrix) {
+    const Frustum     frustum = makeFrustum();
+    const float       s       = 1.f / std::sqrt(2.f);
+    const std::array  normals = {Vec3(s, 0.f, -s), Vec3(-s, 0.f, -s), Vec3(0.f, s, -s),
+                                 Vec3(0.f, -s, -s), Vec3(0.f, 0.f, -1.f), Vec3(0.f, 0.f, 1.f)};
+    const std::array  ds      = {0.f, 0.f, 0.f, 0.f, -1.f, 100.f};
+    for (unsigned side = 0; side < Frustum::Count; side++) {
+        const Plane& plane = frustum.plane(static_cast<Frustum::Side>(side));
+        EXPECT_VEC3_NEAR(normals[side], plane.normal) << "side " << side;
+        EXPECT_NEAR(ds[side], plane.d, 1e-5f * (1.f + std::abs(ds[side]))) << "side " << side;
+    }
+}
+
+TEST(Frustum, contains) {
+    const Frustum frustum = makeFrustum();
+    EXPECT_TRUE(frustum.contains({0.f, 0.f, -10.f}));
+    EXPECT_TRUE(frustum.contains({9.f, -9.f, -10.f}));
+    EXPECT_FALSE(frustum.contains({11.f, 0.f, -10.f}));
+    EXPECT_FALSE(frustum.contains({0.f, 11.f, -10.f}));
+    EXPECT_FALSE(frustum.contains({0.f, 0.f, -0.5f}));
+    EXPECT_FALSE(frustum.contains({0.f, 0.f, -101.f}));
+    EXPECT_FALSE(frustum.contains({0.f, 0.f, 10.f}));
+}
+
+TEST(Frustum, intersectsSphere) {
+    const Frustum frustum = makeFrustum();
+    EXPECT_TRUE(frustum.intersects(BoundingSphere({0.f, 0.f, -10.f}, 1.f)));
+    EXPECT_TRUE(frustum.intersects(BoundingSphere({0.f, 0.f, 0.f}, 1.5f)));
+    EXPECT_TRUE(frustum.intersects(BoundingSphere({0.f, 0.f, -10.f}, 1000.f)));
+    EXPECT_TRUE(frustum.intersects(BoundingSphere({11.f, 0.f, -10.f}, 1.f)));
+    EXPECT_FALSE(frustum.intersects(BoundingSphere({12.f, 0.f, -10.f}, 1.f)));
+    EXPECT_FALSE(frustum.intersects(BoundingSphere({0.f, 0.f, 5.f}, 1.f)));
+    EXPECT_FALSE(frustum.intersects(BoundingSphere({0.f, 0.f, -110.f}, 5.f)));
+}
+
+TEST(Frustum, intersectsBox) {
+    const Frustum frustum = makeFrustum();
+    EXPECT_TRUE(frustum.intersects(AABB({-1.f, -1.f, -11.f}, {1.f, 1.f, -9.f})));
+    EXPECT_TRUE(frustum.intersects(AABB({-500.f, -500.f, -50.f}, {500.f, 500.f, -40.f})));
+    EXPECT_TRUE(frustum.intersects(AABB({9.5f, -1.f, -11.f}, {12.f, 1.f, -9.f})));
+    EXPECT_FALSE(frustum.intersects(AABB({11.5f, -1.f, -11.f}, {12.f, 1.f, -9.f})));
+    EXPECT_FALSE(frustum.intersects(AABB({-1.f, -1.f, 1.f}, {1.f, 1.f, 2.f})));
+    EXPECT_FALSE(frustum.intersects(AABB({-1.f, -1.f, -200.f}, {1.f, 1.f, -101.f})));
+}
+
+TEST(Frustum, visibilityMaskSize) {
+    static_assert(visibilityMaskSize(0) == 0);
+    static_assert(visibilityMaskSize(1) == 1);
+    static_assert(visibilityMaskSize(32) == 1);
+    static_assert(visibilityMaskSize(33) == 2);
+    static_assert(visibilityMaskSize(1000) == 32);
+}
+
+TEST(Frustum, cullSpheres) {
+    const Frustum frustum = makeCameraFrustum();
+    // Every size up to 2 words and a half, to cover the tails of all the blocks.
+    for (std::size_t count = 0; count <= 80; count++) {
+        const auto spheres = makeSpheres(count, static_cast<unsigned>(count));
+        // Garbage in the mask must be overwritten.
+        std::vector<std::uint32_t> visibility(visibilityMaskSize(count), 0xdeadbeef);
+        cull(frustum, spheres, visibility);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(frustum.intersects(spheres[i]), isVisible(visibility, i))
+              << "count " << count << ", sphere " << i;
+        }
+        if (count % 32 != 0) {
+            EXPECT_EQ(0u, visibility.back() >> (count % 32)) << "count " << count;
+        }
+    }
+}
+
+TEST(Frustum, cullBoxes) {
+    const Frustum frustum = makeCameraFrustum();
+    for (std::size_t count = 0; count <= 80; count++) {
+        const auto                 boxes = makeBoxes(count, static_cast<unsigned>(count));
+        std::vector<std::uint32_t> visibility(visibilityMaskSize(count), 0xdeadbeef);
+        cull(frustum, boxes, visibility);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(frustum.intersects(boxes[i]), isVisible(visibility, i))
+              << "count " << count << ", box " << i;
+        }
+        if (count % 32 != 0) {
+            EXPECT_EQ(0u, visibility.back() >> (count % 32)) << "count " << count;
+        }
+    }
+}
+
+TEST(Frustum, cullMixed) {
+    // Both visible and hidden objects in every block.
+    const Frustum               frustum = makeFrustum();
+    std::vector<BoundingSphere> spheres;
+    std::vector<AABB>           boxes;
+    for (int i = 0; i < 64; i++) {
+        const float x = (i % 3 == 0) ? 50.f : 0.f;
+        spheres.emplace_back(Vec3(x, 0.f, -10.f), 1.f);
+        boxes.push_back(AABB::FromCenterExtents({x, 0.f, -10.f}, {1.f, 1.f, 1.f}));
+    }
+    std::vector<std::uint32_t> visibility(visibilityMaskSize(64));
+    cull(frustum, spheres, visibility);
+    for (std::size_t i = 0; i < 64; i++) {
+        EXPECT_EQ(i % 3 != 0, isVisible(visibility, i)) << "sphere " << i;
+    }
+    cull(frustum, boxes, visibility);
+    for (std::size_t i = 0; i < 64; i++) {
+        EXPECT_EQ(i % 3 != 0, isVisible(visibility, i)) << "box " << i;
+    }
+}
+
+TEST(Frustum, cullEmpty) {
+    // Default spans, data() is nullptr.
+    const Frustum frustum = makeFrustum();
+    cull(frustum, std::span<const BoundingSphere>(), std::span<std::uint32_t>());
+    cull(frustum, std::span<const AABB>(), std::span<std::uint32_t>());
+}
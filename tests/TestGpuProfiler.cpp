@@ -0,0 +1,165 @@
+#include <fuse/GpuProfiler.h>
+
+#include <glad/gl.h>
+#include <SDL3/SDL.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace fuse;
+
+TEST(SlidingStats, empty) {
+    const SlidingStats stats(4);
+    EXPECT_EQ(0u, stats.count());
+    EXPECT_EQ(0.0, stats.average());
+    EXPECT_EQ(0.0, stats.min());
+    EXPECT_EQ(0.0, stats.max());
+}
+
+TEST(SlidingStats, window) {
+    SlidingStats stats(3);
+    stats.add(4.0);
+    stats.add(1.0);
+    EXPECT_EQ(2u, stats.count());
+    EXPECT_EQ(1.0, stats.last());
+    EXPECT_EQ(1.0, stats.min());
+    EXPECT_EQ(4.0, stats.max());
+    EXPECT_DOUBLE_EQ(2.5, stats.average());
+
+    // The extremes leave the window with their sample.
+    stats.add(2.0);
+    stats.add(3.0);
+    stats.add(2.0);
+    EXPECT_EQ(3u, stats.count());
+    EXPECT_EQ(2.0, stats.min());
+    EXPECT_EQ(3.0, stats.max());
+    EXPECT_DOUBLE_EQ(7.0 / 3.0, stats.average());
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.count());
+    stats.add(5.0);
+    EXPECT_EQ(5.0, stats.min());
+    EXPECT_EQ(5.0, stats.average());
+}
+
+namespace {
+
+/// @brief An OpenGL context on a hidden window of the offscreen video driver, run with
+///        LIBGL_ALWAYS_SOFTWARE=1 to use Mesa llvmpipe. Skipped without OpenGL.
+class GpuProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        if (!SDL_Init(SDL_INIT_VIDEO)) {
+            GTEST_SKIP() << "No video driver: " << SDL_GetError();
+        }
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+        mWindow = SDL_CreateWindow("TestGpuProfiler", 64, 64,
+                                   SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+        if (mWindow == nullptr) {
+            GTEST_SKIP() << "No OpenGL window: " << SDL_GetError();
+        }
+        mContext = SDL_GL_CreateContext(mWindow);
+        if (mContext == nullptr || gladLoadGL((GLADloadfunc)SDL_GL_GetProcAddress) == 0) {
+            GTEST_SKIP() << "No OpenGL 3.3 context: " << SDL_GetError();
+        }
+    }
+
+    void TearDown() override {
+        if (mContext != nullptr) {
+            SDL_GL_DestroyContext(mContext);
+        }
+        if (mWindow != nullptr) {
+            SDL_DestroyWindow(mWindow);
+        }
+        SDL_Quit();
+    }
+
+    /// @brief Render frames with nested scopes until every frame is read back.
+    static void renderFrames(GpuProfiler& profiler, int count) {
+        for (int frame = 0; frame < count; frame++) {
+            profiler.beginFrame();
+            {
+                const GpuProfileScope render(profiler, "Render");
+                for (int i = 0; i < 4; i++) {
+                    const GpuProfileScope clear(profiler, "Clear");
+                    glClear(GL_COLOR_BUFFER_BIT);
+                }
+            }
+            profiler.endFrame();
+        }
+        glFinish();
+        profiler.beginFrame();
+        profiler.endFrame();
+    }
+
+    SDL_Window*   mWindow{};
+    SDL_GLContext mContext{};
+};
+
+} // namespace
+
+TEST_F(GpuProfilerTest, nestedScopes) {
+    GpuProfiler profiler(8);
+    if (!profiler.isSupported()) {
+        GTEST_SKIP() << "No timestamp queries.";
+    }
+    renderFrames(profiler, 10);
+
+    const auto& stats = profiler.stats();
+    ASSERT_EQ(3u, stats.size());
+    EXPECT_STREQ("Frame", stats[0].name);
+    EXPECT_EQ(0u, stats[0].depth);
+    EXPECT_STREQ("Render", stats[1].name);
+    EXPECT_EQ(1u, stats[1].depth);
+    EXPECT_STREQ("Clear", stats[2].name);
+    EXPECT_EQ(2u, stats[2].depth);
+    // A frame is not measured when the GPU is too far behind.
+    EXPECT_EQ(std::min<std::uint64_t>(8, 10 - profiler.droppedFrames()), stats[0].time.count());
+    EXPECT_EQ(8u, stats[2].time.count());
+    EXPECT_LE(stats[1].time.min(), stats[0].time.max());
+
+    // 1 frame, 1 render and 4 clears, each inside its parent.
+    const auto& last = profiler.lastFrame();
+    ASSERT_EQ(6u, last.size());
+    EXPECT_EQ(0u, last[0].begin);
+    for (std::size_t i = 2; i < last.size(); i++) {
+        EXPECT_LE(last[1].begin, last[i].begin);
+        EXPECT_LE(last[i].end, last[1].end);
+        EXPECT_LE(last[i].end, last[0].end);
+    }
+}
+
+TEST_F(GpuProfilerTest, disabled) {
+    GpuProfiler profiler;
+    profiler.setEnabled(false);
+    renderFrames(profiler, 3);
+    EXPECT_TRUE(profiler.stats().empty());
+    EXPECT_TRUE(profiler.lastFrame().empty());
+}
+
+TEST_F(GpuProfilerTest, exportCsv) {
+    GpuProfiler profiler;
+    if (!profiler.isSupported()) {
+        GTEST_SKIP() << "No timestamp queries.";
+    }
+    renderFrames(profiler, 2);
+
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestGpuProfiler.csv";
+    ASSERT_TRUE(profiler.exportCsv(path));
+    std::stringstream content;
+    content << std::ifstream(path).rdbuf();
+    std::filesystem::remove(path);
+    const std::string csv = content.str();
+    EXPECT_TRUE(csv.starts_with("scope,depth,samples,last_ms,min_ms,avg_ms,max_ms\n"));
+    EXPECT_NE(std::string::npos, csv.find("\"Render\",1,"));
+    EXPECT_NE(std::string::npos, csv.find("\"Clear\",2,"));
+}
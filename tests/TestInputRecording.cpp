@@ -0,0 +1,169 @@
+#include <fuse/InputRecording.h>
+
+#include <SDL3/SDL.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace fuse;
+
+namespace {
+
+class InputRecording : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mPath = std::filesystem::temp_directory_path() / "FuseTestInputRecording.input";
+    }
+
+    void TearDown() override { std::filesystem::remove(mPath); }
+
+    static SDL_Event keyDown(SDL_Keycode key) {
+        SDL_Event e{};
+        e.key.type     = SDL_EVENT_KEY_DOWN;
+        e.key.windowID = 7;
+        e.key.key      = key;
+        e.key.down     = true;
+        return e;
+    }
+
+    static SDL_Event mouseMotion(float xrel, float yrel) {
+        SDL_Event e{};
+        e.motion.type     = SDL_EVENT_MOUSE_MOTION;
+        e.motion.windowID = 7;
+        e.motion.xrel     = xrel;
+        e.motion.yrel     = yrel;
+        return e;
+    }
+
+    std::filesystem::path mPath;
+};
+
+} // namespace
+
+TEST_F(InputRecording, roundTrip) {
+    {
+        InputRecorder recorder;
+        ASSERT_TRUE(recorder.open(mPath));
+        EXPECT_TRUE(recorder.record(keyDown('w')));
+        EXPECT_TRUE(recorder.record(mouseMotion(3.0f, -2.0f)));
+        recorder.endFrame(0.016);
+        recorder.endFrame(0.017);
+        EXPECT_TRUE(recorder.record(mouseMotion(-1.0f, 0.5f)));
+        recorder.endFrame(0.015);
+        EXPECT_EQ(3u, recorder.frameCount());
+    }
+
+    auto replay = InputReplay::load(mPath);
+    ASSERT_TRUE(replay.has_value()) << replay.error();
+    ASSERT_EQ(3u, replay->frameCount());
+
+    SDL_Event e{};
+    EXPECT_DOUBLE_EQ(0.016, replay->nextFrame().asSeconds());
+    ASSERT_TRUE(replay->pollEvent(e, 42));
+    EXPECT_EQ(SDL_EVENT_KEY_DOWN, e.type);
+    EXPECT_EQ(SDL_Keycode('w'), e.key.key);
+    EXPECT_TRUE(e.key.down);
+    EXPECT_EQ(42u, e.key.windowID);
+    ASSERT_TRUE(replay->pollEvent(e, 42));
+    EXPECT_EQ(SDL_EVENT_MOUSE_MOTION, e.type);
+    EXPECT_FLOAT_EQ(3.0f, e.motion.xrel);
+    EXPECT_FLOAT_EQ(-2.0f, e.motion.yrel);
+    EXPECT_EQ(42u, e.motion.windowID);
+    EXPECT_FALSE(replay->pollEvent(e, 42));
+
+    EXPECT_DOUBLE_EQ(0.017, replay->nextFrame().asSeconds());
+    EXPECT_FALSE(replay->pollEvent(e, 42));
+
+    EXPECT_FALSE(replay->finished());
+    EXPECT_DOUBLE_EQ(0.015, replay->nextFrame().asSeconds());
+    ASSERT_TRUE(replay->pollEvent(e, 42));
+    EXPECT_FLOAT_EQ(-1.0f, e.motion.xrel);
+    EXPECT_FALSE(replay->pollEvent(e, 42));
+    EXPECT_TRUE(replay->finished());
+}
+
+TEST_F(InputRecording, skipsOtherEvents) {
+    SDL_Event quit{};
+    quit.type = SDL_EVENT_QUIT;
+    SDL_Event resized{};
+    resized.type = SDL_EVENT_WINDOW_RESIZED;
+    EXPECT_FALSE(isRecordedEvent(quit));
+    EXPECT_FALSE(isRecordedEvent(resized));
+    EXPECT_TRUE(isRecordedEvent(keyDown('a')));
+
+    InputRecorder recorder;
+    EXPECT_FALSE(recorder.record(keyDown('a'))) << "Not open.";
+    ASSERT_TRUE(recorder.open(mPath));
+    EXPECT_FALSE(recorder.record(quit));
+    EXPECT_FALSE(recorder.record(resized));
+    recorder.endFrame(0.01);
+    recorder.close();
+
+    auto replay = InputReplay::load(mPath);
+    ASSERT_TRUE(replay.has_value()) << replay.error();
+    ASSERT_EQ(1u, replay->frameCount());
+    replay->nextFrame();
+    SDL_Event e{};
+    EXPECT_FALSE(replay->pollEvent(e, 1));
+}
+
+TEST_F(InputRecording, truncatedFrameDropped) {
+    {
+        InputRecorder recorder;
+        ASSERT_TRUE(recorder.open(mPath));
+        recorder.endFrame(0.01);
+        recorder.record(keyDown('s'));
+        recorder.endFrame(0.02);
+    }
+    // Cut the last event as a crash during the write would.
+    std::filesystem::resize_file(mPath, std::filesystem::file_size(mPath) - 4);
+
+    auto replay = InputReplay::load(mPath);
+    ASSERT_TRUE(replay.has_value()) << replay.error();
+    EXPECT_EQ(1u, replay->frameCount());
+}
+
+TEST_F(InputRecording, errors) {
+    EXPECT_FALSE(InputReplay::load(mPath).has_value()) << "Missing file.";
+
+    std::ofstream(mPath, std::ios::binary) << "not a recording";
+    const auto replay = InputReplay::load(mPath);
+    ASSERT_FALSE(replay.has_value());
+    EXPECT_NE(std::string::npos, replay.error().find("not an input recording"));
+}
+
+TEST_F(InputRecording, invalidEvents) {
+    const auto loadPatched = [&](std::size_t offset, std::uint32_t value) {
+        {
+            InputRecorder recorder;
+            EXPECT_TRUE(recorder.open(mPath));
+            recorder.record(keyDown('w'));
+            recorder.endFrame(0.01);
+        }
+        {
+            std::fstream file(mPath, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        return InputReplay::load(mPath);
+    };
+    // After the magic and the version, the frame (number, event count, delta) and the type
+    // and size of its event.
+    const std::size_t eventOffset = 8 + 4 + (4 + 4 + 8) + (4 + 4);
+
+    auto replay = loadPatched(eventOffset - 8, SDL_EVENT_QUIT);
+    ASSERT_FALSE(replay.has_value()) << "Type not recorded.";
+    EXPECT_NE(std::string::npos, replay.error().find("Unsupported event"));
+
+    replay = loadPatched(eventOffset - 4, sizeof(SDL_KeyboardEvent) - 4);
+    ASSERT_FALSE(replay.has_value()) << "Size of another type.";
+    EXPECT_NE(std::string::npos, replay.error().find("expected"));
+
+    replay = loadPatched(eventOffset, SDL_EVENT_MOUSE_WHEEL);
+    ASSERT_FALSE(replay.has_value()) << "Bytes of another type.";
+    EXPECT_NE(std::string::npos, replay.error().find("recorded as"));
+}
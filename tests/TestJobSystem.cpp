@@ -0,0 +1,226 @@
+#include <fuse/JobSystem.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Run the tests without worker, with one worker and with many workers.
+class JobSystemTest : public ::testing::TestWithParam<unsigned> {};
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(Workers, JobSystemTest, ::testing::Values(0u, 1u, 4u));
+
+TEST_P(JobSystemTest, workerCount) {
+    JobSystem jobs(GetParam());
+    EXPECT_EQ(GetParam(), jobs.workerCount());
+}
+
+TEST_P(JobSystemTest, schedule) {
+    JobSystem        jobs(GetParam());
+    JobCounter       counter;
+    std::atomic<int> sum{0};
+    for (int i = 1; i <= 1000; i++) {
+        jobs.schedule([&sum, i] { sum += i; }, &counter);
+    }
+    jobs.wait(counter);
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(500500, sum.load());
+}
+
+TEST_P(JobSystemTest, scheduleWithoutCounter) {
+    std::atomic<int> count{0};
+    {
+        JobSystem jobs(GetParam());
+        for (int i = 0; i < 100; i++) {
+            jobs.schedule([&count] { count++; });
+        }
+    }
+    // The destructor runs the jobs left.
+    EXPECT_EQ(100, count.load());
+}
+
+TEST_P(JobSystemTest, destroyOnOtherThread) {
+    std::atomic<int> count{0};
+    auto             jobs = std::make_unique<JobSystem>(GetParam());
+    for (int i = 0; i < 100; i++) {
+        jobs->schedule([&count] { count++; });
+    }
+    // The jobs left in the deque of the creating thread are stolen by the destructor.
+    std::thread([&jobs] { jobs.reset(); }).join();
+    EXPECT_EQ(100, count.load());
+}
+
+TEST_P(JobSystemTest, counterReuse) {
+    JobSystem        jobs(GetParam());
+    JobCounter       counter;
+    std::atomic<int> count{0};
+    EXPECT_TRUE(counter.isDone());
+    for (int round = 1; round <= 10; round++) {
+        for (int i = 0; i < 10; i++) {
+            jobs.schedule([&count] { count++; }, &counter);
+        }
+        jobs.wait(counter);
+        EXPECT_EQ(round * 10, count.load());
+    }
+}
+
+TEST_P(JobSystemTest, dependencies) {
+    JobSystem  jobs(GetParam());
+    JobCounter first;
+    JobCounter second;
+    JobCounter third;
+
+    std::atomic<int> stage1{0};
+    std::atomic<int> stage2{0};
+    std::atomic<int> errors{0};
+    for (int i = 0; i < 50; i++) {
+        jobs.schedule([&] { stage1++; }, &first);
+    }
+    for (int i = 0; i < 50; i++) {
+        jobs.schedule(
+          [&] {
+              if (stage1.load() != 50) {
+                  errors++;
+              }
+              stage2++;
+          },
+          first,
+          &second);
+    }
+    jobs.schedule(
+      [&] {
+          if (stage2.load() != 50) {
+              errors++;
+          }
+      },
+      second,
+      &third);
+
+    jobs.wait(third);
+    EXPECT_EQ(50, stage1.load());
+    EXPECT_EQ(50, stage2.load());
+    EXPECT_EQ(0, errors.load());
+    EXPECT_TRUE(first.isDone());
+    EXPECT_TRUE(second.isDone());
+}
+
+TEST_P(JobSystemTest, dependencyDone) {
+    JobSystem  jobs(GetParam());
+    JobCounter done;
+    JobCounter counter;
+    bool       run = false;
+    jobs.schedule([&run] { run = true; }, done, &counter);
+    jobs.wait(counter);
+    EXPECT_TRUE(run);
+}
+
+TEST_P(JobSystemTest, nestedWait) {
+    JobSystem        jobs(GetParam());
+    JobCounter       outer;
+    std::atomic<int> count{0};
+    for (int i = 0; i < 8; i++) {
+        jobs.schedule(
+          [&] {
+              JobCounter inner;
+              for (int j = 0; j < 8; j++) {
+                  jobs.schedule([&count] { count++; }, &inner);
+              }
+              jobs.wait(inner);
+          },
+          &outer);
+    }
+    jobs.wait(outer);
+    EXPECT_EQ(64, count.load());
+}
+
+TEST_P(JobSystemTest, scheduleFromOtherThread) {
+    JobSystem        jobs(GetParam());
+    JobCounter       counter;
+    std::atomic<int> count{0};
+    std::thread      thread([&] {
+        for (int i = 0; i < 100; i++) {
+            jobs.schedule([&count] { count++; }, &counter);
+        }
+        jobs.wait(counter);
+    });
+    thread.join();
+    jobs.wait(counter);
+    EXPECT_EQ(100, count.load());
+}
+
+TEST_P(JobSystemTest, manyJobs) {
+    // More jobs than the capacity of a deque.
+    JobSystem        jobs(GetParam());
+    JobCounter       counter;
+    std::atomic<int> count{0};
+    for (int i = 0; i < 20000; i++) {
+        jobs.schedule([&count] { count++; }, &counter);
+    }
+    jobs.wait(counter);
+    EXPECT_EQ(20000, count.load());
+}
+
+TEST_P(JobSystemTest, parallelFor) {
+    JobSystem jobs(GetParam());
+    for (std::size_t count : {0u, 1u, 7u, 100u, 10007u}) {
+        for (std::size_t grainSize : {0u, 1u, 3u, 64u, 100000u}) {
+            std::vector<std::atomic<int>> visits(count);
+            jobs.parallelFor(
+              0,
+              count,
+              [&](std::size_t first, std::size_t last) {
+                  EXPECT_LT(first, last);
+                  for (std::size_t i = first; i < last; i++) {
+                      visits[i]++;
+                  }
+              },
+              grainSize);
+            for (std::size_t i = 0; i < count; i++) {
+                ASSERT_EQ(1, visits[i].load()) << "count " << count << ", grain " << grainSize;
+            }
+        }
+    }
+}
+
+TEST_P(JobSystemTest, parallelForOffset) {
+    JobSystem                jobs(GetParam());
+    std::vector<std::size_t> values(1000, 0);
+    jobs.parallelFor(100, 900, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            values[i] = i;
+        }
+    });
+    for (std::size_t i = 0; i < values.size(); i++) {
+        EXPECT_EQ(i >= 100 && i < 900 ? i : 0u, values[i]);
+    }
+}
+
+TEST_P(JobSystemTest, parallelForNested) {
+    JobSystem                     jobs(GetParam());
+    std::vector<std::atomic<int>> visits(64 * 64);
+    jobs.parallelFor(
+      0,
+      64,
+      [&](std::size_t first, std::size_t last) {
+          for (std::size_t row = first; row < last; row++) {
+              jobs.parallelFor(0, 64, [&](std::size_t begin, std::size_t end) {
+                  for (std::size_t column = begin; column < end; column++) {
+                      visits[row * 64 + column]++;
+                  }
+              });
+          }
+      },
+      1);
+    const int total = std::accumulate(
+      visits.begin(), visits.end(), 0, [](int sum, const std::atomic<int>& v) { return sum + v.load(); });
+    EXPECT_EQ(64 * 64, total);
+}
@@ -0,0 +1,202 @@
+#include <fuse/LayerStack.h>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+class ImGuiLayer : public Layer {
+public:
+    explicit ImGuiLayer(std::vector<int>* order = nullptr, int id = 0)
+        : mOrder(order)
+        , mId(id) {}
+
+    void onImGui() override {
+        if (mOrder != nullptr) {
+            mOrder->push_back(mId);
+        }
+        if (onCall) {
+            onCall();
+        }
+    }
+
+    std::function<void()> onCall;
+
+private:
+    std::vector<int>* mOrder;
+    int               mId;
+};
+
+class UpdateLayer final : public Layer {
+public:
+    void onFixedUpdate(Time /*step*/) override {}
+    void onUpdate(Time /*deltaTime*/) override {}
+};
+
+// Overrides onRender, inherits onImGui from ImGuiLayer.
+class DerivedLayer final : public ImGuiLayer {
+public:
+    void onRender(float /*alpha*/) override {}
+};
+
+void callImGui(LayerStack& stack) {
+    stack.forEach(LayerPhase::ImGui, [](Layer* layer) { layer->onImGui(); });
+}
+
+} // namespace
+
+TEST(LayerStack, hooks) {
+    static_assert(layerHooksOf<Layer>() == 0);
+    static_assert(layerHooksOf<ImGuiLayer>() == layerHook(LayerPhase::ImGui));
+    static_assert(layerHooksOf<UpdateLayer>() ==
+                  (layerHook(LayerPhase::FixedUpdate) | layerHook(LayerPhase::Update)));
+    static_assert(layerHooksOf<DerivedLayer>() ==
+                  (layerHook(LayerPhase::Render) | layerHook(LayerPhase::ImGui)));
+    static_assert(kAllLayerHooks == 0b1111);
+
+    // A layer of a class derived from ImGuiLayer may override the other callbacks.
+    static_assert(knownLayerHooks<ImGuiLayer>() == kAllLayerHooks);
+    static_assert(knownLayerHooks<DerivedLayer>() == layerHooksOf<DerivedLayer>());
+}
+
+TEST(LayerStack, dispatchLists) {
+    LayerStack stack;
+    auto*      update  = new UpdateLayer();
+    auto*      imgui   = new ImGuiLayer();
+    auto*      derived = new DerivedLayer();
+    auto*      unknown = new ImGuiLayer();
+    stack.pushLayer(update);
+    stack.pushOverlay(imgui); // Not final: every callback.
+    stack.pushLayer(derived);
+    stack.pushLayer(static_cast<Layer*>(unknown)); // The type is lost: every callback.
+    EXPECT_EQ(4u, stack.size());
+
+    const auto list = [&stack](LayerPhase phase) {
+        const auto layers = stack.dispatchList(phase);
+        return std::vector<Layer*>(layers.begin(), layers.end());
+    };
+    EXPECT_EQ((std::vector<Layer*>{update, unknown, imgui}), list(LayerPhase::FixedUpdate));
+    EXPECT_EQ((std::vector<Layer*>{update, unknown, imgui}), list(LayerPhase::Update));
+    EXPECT_EQ((std::vector<Layer*>{derived, unknown, imgui}), list(LayerPhase::Render));
+    EXPECT_EQ((std::vector<Layer*>{derived, unknown, imgui}), list(LayerPhase::ImGui));
+    EXPECT_EQ((std::vector<Layer*>{update, derived, unknown, imgui}),
+              std::vector<Layer*>(stack.begin(), stack.end()));
+}
+
+TEST(LayerStack, enable) {
+    std::vector<int> order;
+    LayerStack       stack;
+    auto*            first  = new ImGuiLayer(&order, 1);
+    auto*            second = new ImGuiLayer(&order, 2);
+    auto*            third  = new ImGuiLayer(&order, 3);
+    stack.pushLayer(first);
+    stack.pushLayer(second);
+    stack.pushOverlay(third);
+    EXPECT_TRUE(stack.isEnabled(second));
+
+    stack.setEnabled(second, false);
+    EXPECT_FALSE(stack.isEnabled(second));
+    callImGui(stack);
+    EXPECT_EQ((std::vector<int>{1, 3}), order);
+
+    // Enabled again at its place.
+    order.clear();
+    stack.setEnabled(second, true);
+    callImGui(stack);
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), order);
+    EXPECT_EQ(3u, stack.size());
+
+    ImGuiLayer outside;
+    EXPECT_FALSE(stack.isEnabled(&outside));
+}
+
+TEST(LayerStack, changesInForEach) {
+    std::vector<int> order;
+    LayerStack       stack;
+    auto*            first  = new ImGuiLayer(&order, 1);
+    auto*            second = new ImGuiLayer(&order, 2);
+    auto*            third  = new ImGuiLayer(&order, 3);
+    auto*            pushed = new ImGuiLayer(&order, 4);
+    stack.pushLayer(first);
+    stack.pushLayer(second);
+    stack.pushLayer(third);
+
+    // The first layer pops the second, disables the third and pushes another one.
+    std::unique_ptr<Layer> popped;
+    first->onCall = [&] {
+        if (!popped) {
+            stack.popLayer(second);
+            popped.reset(second);
+            stack.setEnabled(third, false);
+            stack.pushOverlay(pushed);
+            EXPECT_EQ(3u, stack.size());
+        }
+    };
+    callImGui(stack);
+    EXPECT_EQ((std::vector<int>{1}), order);
+    EXPECT_EQ(3u, stack.size());
+    EXPECT_EQ((std::vector<Layer*>{first, third, pushed}),
+              std::vector<Layer*>(stack.begin(), stack.end()));
+
+    order.clear();
+    stack.setEnabled(third, true);
+    callImGui(stack);
+    EXPECT_EQ((std::vector<int>{1, 3, 4}), order);
+}
+
+TEST(LayerStack, pushThenPopInForEach) {
+    LayerStack stack;
+    auto*      layer = new ImGuiLayer();
+    ImGuiLayer transient;
+    layer->onCall = [&] {
+        stack.pushLayer(&transient);
+        stack.popLayer(&transient);
+    };
+    stack.pushLayer(layer);
+    callImGui(stack);
+    EXPECT_EQ(1u, stack.size());
+}
+
+TEST(LayerStack, nestedForEach) {
+    std::vector<int> order;
+    LayerStack       stack;
+    auto*            outer  = new ImGuiLayer(&order, 1);
+    auto*            pushed = new ImGuiLayer(&order, 2);
+    stack.pushLayer(outer);
+    bool done     = false;
+    outer->onCall = [&] {
+        if (!done) {
+            stack.forEach(LayerPhase::Update, [](Layer*) {});
+            stack.pushLayer(pushed);
+            done = true;
+        }
+    };
+    callImGui(stack);
+    // Applied when the outer forEach() returns.
+    EXPECT_EQ(2u, stack.size());
+    order.clear();
+    callImGui(stack);
+    EXPECT_EQ((std::vector<int>{1, 2}), order);
+}
+
+TEST(LayerStack, popOutsideForEach) {
+    LayerStack stack;
+    auto*      layer   = new UpdateLayer();
+    auto*      overlay = new ImGuiLayer();
+    auto*      top     = new ImGuiLayer();
+    stack.pushLayer(layer);
+    stack.pushOverlay(overlay, layerHooksOf<ImGuiLayer>());
+    stack.popLayer(layer);
+    std::unique_ptr<Layer> owned(layer);
+    EXPECT_TRUE(stack.dispatchList(LayerPhase::Update).empty());
+
+    // The layers are inserted below the overlays.
+    stack.pushLayer(top);
+    EXPECT_EQ((std::vector<Layer*>{top, overlay}),
+              std::vector<Layer*>(stack.begin(), stack.end()));
+}
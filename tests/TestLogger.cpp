@@ -0,0 +1,302 @@
+#include <fuse/LogSink.h>
+#include <fuse/Logger.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief Count the number of times it is formatted.
+struct FormatCounter {
+    int* count;
+};
+
+template <>
+struct std::formatter<FormatCounter> : std::formatter<int> {
+    auto format(const FormatCounter& counter, std::format_context& ctx) const {
+        return std::formatter<int>::format(++*counter.count, ctx);
+    }
+};
+
+using namespace fuse;
+
+namespace {
+
+struct CapturedRecord {
+    LogCategory category;
+    LogLevel    level;
+    std::string message;
+};
+
+
+/// @brief Keep the messages in a vector owned by the test.
+class CaptureSink final : public LogSink {
+public:
+    explicit CaptureSink(std::vector<CapturedRecord>& records, unsigned& flushes)
+        : mRecords(records)
+        , mFlushes(flushes) {}
+
+    void write(const LogRecord& record) override {
+        mRecords.push_back({record.category, record.level, std::string(record.message)});
+    }
+
+    void flush() override { mFlushes++; }
+
+private:
+    std::vector<CapturedRecord>& mRecords;
+    unsigned&                    mFlushes;
+};
+
+class Logger : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!isLogLevelCompiled(LogLevel::Verbose)) {
+            GTEST_SKIP() << "The tests log every level, FUSE_LOG_LEVEL removes some.";
+        }
+    }
+
+    void initialize(LogConfig config) {
+        config.console = false;
+        log_initialize(config);
+        log_add_sink(std::make_unique<CaptureSink>(mRecords, mFlushes));
+    }
+
+    void TearDown() override {
+        log_shutdown();
+        log_set_level(kCompiledLogLevel);
+    }
+
+    std::vector<CapturedRecord> mRecords;
+    unsigned                    mFlushes{};
+};
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+} // namespace
+
+TEST(LogLevel, toString) {
+    EXPECT_EQ("Fatal", toString(LogLevel::Fatal));
+    EXPECT_EQ("Error", toString(LogLevel::Error));
+    EXPECT_EQ("Warn", toString(LogLevel::Warn));
+    EXPECT_EQ("Info", toString(LogLevel::Info));
+    EXPECT_EQ("Debug", toString(LogLevel::Debug));
+    EXPECT_EQ("Verbose", toString(LogLevel::Verbose));
+}
+
+TEST(LogCategory, toString) {
+    EXPECT_EQ("General", toString(LogCategory::General));
+    EXPECT_EQ("Render", toString(LogCategory::Render));
+    EXPECT_EQ("Math", toString(LogCategory::Math));
+}
+
+TEST(LogLevel, compiled) {
+    EXPECT_TRUE(isLogLevelCompiled(LogLevel::Fatal));
+    EXPECT_EQ(FUSE_LOG_LEVEL >= 3, isLogLevelCompiled(LogLevel::Info));
+    EXPECT_EQ(FUSE_LOG_LEVEL >= 5, isLogLevelCompiled(LogLevel::Verbose));
+    for (std::size_t i = 0; i < kLogCategoryCount; i++) {
+        EXPECT_EQ(kCompiledLogLevel, log_get_level(static_cast<LogCategory>(i)));
+    }
+}
+
+TEST_F(Logger, categoryLevel) {
+    initialize({});
+    log_set_level(LogCategory::Render, LogLevel::Warn);
+    EXPECT_EQ(LogLevel::Warn, log_get_level(LogCategory::Render));
+    EXPECT_FALSE(log_enabled(LogLevel::Info, LogCategory::Render));
+    EXPECT_TRUE(log_enabled(LogLevel::Error, LogCategory::Render));
+    EXPECT_TRUE(log_enabled(LogLevel::Fatal, LogCategory::Render));
+
+    log_message(LogCategory::Render, LogLevel::Info, "Filtered");
+    log_message(LogCategory::Render, LogLevel::Error, "Render {}", 1);
+    log_message(LogCategory::Math, LogLevel::Info, "Math {}", 2);
+    log_flush();
+
+    ASSERT_EQ(2u, mRecords.size());
+    EXPECT_EQ(LogCategory::Render, mRecords[0].category);
+    EXPECT_EQ("Render 1", mRecords[0].message);
+    EXPECT_EQ(LogCategory::Math, mRecords[1].category);
+    EXPECT_EQ("Math 2", mRecords[1].message);
+}
+
+TEST_F(Logger, noFormattingWhenFiltered) {
+    initialize({});
+    int count = 0;
+    log_set_level(LogLevel::Error);
+    log_message(LogCategory::Math, LogLevel::Info, "{}", FormatCounter{&count});
+    FUSE_INFO("{}", FormatCounter{&count});
+    EXPECT_EQ(0, count);
+
+    log_set_level(LogLevel::Verbose);
+    FUSE_LOG(LogCategory::Math, LogLevel::Error, "{}", FormatCounter{&count});
+    EXPECT_EQ(1, count);
+    log_flush();
+    ASSERT_EQ(1u, mRecords.size());
+    EXPECT_EQ("1", mRecords[0].message);
+}
+
+TEST_F(Logger, writeAfterFlush) {
+    initialize({});
+    log_message(LogLevel::Info, "Frame {} rendered in {:.1f} ms", 42, 16.25);
+    log_message(LogLevel::Warn, "Slow frame");
+    log_flush();
+
+    ASSERT_EQ(2u, mRecords.size());
+    EXPECT_EQ(LogLevel::Info, mRecords[0].level);
+    EXPECT_EQ("Frame 42 rendered in 16.2 ms", mRecords[0].message);
+    EXPECT_EQ(LogLevel::Warn, mRecords[1].level);
+    EXPECT_EQ("Slow frame", mRecords[1].message);
+    EXPECT_GE(mFlushes, 1u);
+    EXPECT_EQ(2u, log_stats().written);
+    EXPECT_EQ(0u, log_stats().dropped);
+}
+
+TEST_F(Logger, shutdownWritesPendingMessages) {
+    initialize({});
+    for (int i = 0; i < 1000; i++) {
+        log_message(LogLevel::Debug, "Message {}", i);
+    }
+    log_shutdown();
+
+    ASSERT_EQ(1000u, mRecords.size());
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(std::format("Message {}", i), mRecords[i].message);
+    }
+}
+
+TEST_F(Logger, multipleProducers) {
+    constexpr int kThreads  = 4;
+    constexpr int kMessages = 2000;
+    initialize({.capacity = 256, .overflow = LogOverflow::Block});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kMessages; i++) {
+                log_message(LogLevel::Info, "{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    log_flush();
+
+    // Nothing is lost when blocking, and the messages of a thread keep their order.
+    ASSERT_EQ(static_cast<std::size_t>(kThreads * kMessages), mRecords.size());
+    EXPECT_EQ(0u, log_stats().dropped);
+    std::vector<int> next(kThreads, 0);
+    for (const auto& record : mRecords) {
+        int thread = 0;
+        int index  = 0;
+        ASSERT_EQ(2, std::sscanf(record.message.c_str(), "%d %d", &thread, &index));
+        EXPECT_EQ(next[thread], index);
+        next[thread] = index + 1;
+    }
+}
+
+TEST_F(Logger, dropWhenFull) {
+    constexpr int kMessages = 100000;
+    initialize({.capacity = 4, .overflow = LogOverflow::Drop});
+    for (int i = 0; i < kMessages; i++) {
+        log_message(LogLevel::Info, "Message {}", i);
+    }
+    // The dropped messages are reported by a warning once the queue has room again, the last
+    // report may be written after the flush.
+    log_shutdown();
+    const LogStats stats = log_stats();
+    EXPECT_EQ(static_cast<std::uint64_t>(kMessages), stats.written + stats.dropped);
+    EXPECT_GT(stats.dropped, 0u);
+    std::uint64_t reported = 0;
+    for (const auto& record : mRecords) {
+        unsigned long long count = 0;
+        if (record.level == LogLevel::Warn &&
+            std::sscanf(record.message.c_str(), "%llu messages dropped", &count) == 1) {
+            reported += count;
+        }
+    }
+    EXPECT_EQ(stats.dropped, reported);
+}
+
+TEST_F(Logger, synchronousWithoutInitialize) {
+    log_add_sink(std::make_unique<CaptureSink>(mRecords, mFlushes));
+    log_message(LogLevel::Error, "Not initialized");
+
+    // Written by the calling thread, nothing to wait for.
+    ASSERT_EQ(1u, mRecords.size());
+    EXPECT_EQ("Not initialized", mRecords[0].message);
+    EXPECT_EQ(1u, mFlushes);
+}
+
+TEST(LoggerDeathTest, fatalWritesBeforeAbort) {
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestLoggerFatal.log";
+    std::filesystem::remove(path);
+    EXPECT_DEATH(
+      {
+          log_initialize({.console = false});
+          log_add_sink(std::make_unique<RotatingFileSink>(path));
+          log_message(LogLevel::Info, "Before");
+          log_message(LogLevel::Fatal, "Fatal {}", 1);
+      },
+      "");
+    const std::string content = readFile(path);
+    if (isLogLevelCompiled(LogLevel::Info)) {
+        EXPECT_NE(std::string::npos, content.find("[Info] Before"));
+    }
+    EXPECT_NE(std::string::npos, content.find("[Fatal] Fatal 1"));
+    std::filesystem::remove(path);
+}
+
+TEST(RotatingFileSink, rotate) {
+    const auto directory = std::filesystem::temp_directory_path() / "FuseTestRotatingFileSink";
+    std::filesystem::remove_all(directory);
+    const auto path = directory / "fuse.log";
+    {
+        RotatingFileSink sink(path, 100, 2);
+        for (int i = 0; i < 20; i++) {
+            const std::string message = std::format("Message {:02}", i);
+            sink.write({LogCategory::General, LogLevel::Info, 0.0, message});
+            sink.flush();
+        }
+    }
+
+    // A line is 29 bytes, 3 lines per file: the current file and 2 old ones are kept.
+    const auto numbered = [&](int index) {
+        return std::filesystem::path(path.string() + std::format(".{}", index));
+    };
+    EXPECT_TRUE(std::filesystem::exists(path));
+    EXPECT_TRUE(std::filesystem::exists(numbered(1)));
+    EXPECT_TRUE(std::filesystem::exists(numbered(2)));
+    EXPECT_FALSE(std::filesystem::exists(numbered(3)));
+    for (const auto& file : {path, numbered(1), numbered(2)}) {
+        EXPECT_LE(std::filesystem::file_size(file), 100u);
+    }
+
+    EXPECT_EQ("[0.000000] [Info] Message 18\n[0.000000] [Info] Message 19\n", readFile(path));
+    EXPECT_EQ("[0.000000] [Info] Message 15\n[0.000000] [Info] Message 16\n"
+              "[0.000000] [Info] Message 17\n",
+              readFile(numbered(1)));
+    EXPECT_EQ("[0.000000] [Info] Message 12\n[0.000000] [Info] Message 13\n"
+              "[0.000000] [Info] Message 14\n",
+              readFile(numbered(2)));
+    std::filesystem::remove_all(directory);
+}
+
+TEST(RotatingFileSink, appendToExistingFile) {
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestRotatingAppend.log";
+    std::filesystem::remove(path);
+    for (int run = 0; run < 2; run++) {
+        RotatingFileSink sink(path);
+        sink.write({LogCategory::General, LogLevel::Warn, 1.5, "Run"});
+    }
+    EXPECT_EQ("[1.500000] [Warn] Run\n[1.500000] [Warn] Run\n", readFile(path));
+    std::filesystem::remove(path);
+}
@@ -291,6 +291,17 @@ TEST(Mat4, mul_by_mat4) {
 
         EXPECT_EQ(&result, &m);
     }
+    // operator*=(Mat4,Mat4) with itself
+    {
+        Mat4 m(matrix1);
+        m *= m;
+        // clang-format off
+        EXPECT_EQ(m(0, 0),  90); EXPECT_EQ(m(0, 1), 100); EXPECT_EQ(m(0, 2), 110); EXPECT_EQ(m(0, 3), 120);
+        EXPECT_EQ(m(1, 0), 202); EXPECT_EQ(m(1, 1), 228); EXPECT_EQ(m(1, 2), 254); EXPECT_EQ(m(1, 3), 280);
+        EXPECT_EQ(m(2, 0), 314); EXPECT_EQ(m(2, 1), 356); EXPECT_EQ(m(2, 2), 398); EXPECT_EQ(m(2, 3), 440);
+        EXPECT_EQ(m(3, 0), 426); EXPECT_EQ(m(3, 1), 484); EXPECT_EQ(m(3, 2), 542); EXPECT_EQ(m(3, 3), 600);
+        // clang-format on
+    }
 }
 
 TEST(Mat4, determinant) {
@@ -351,6 +362,25 @@ TEST(Mat4, inverse) {
         EXPECT_EQ(matrix.determinant(), -96.f);
         EXPECT_EQ(matrix.inverse(), inverse);
     }
+    {
+        // Non integer matrix, M * inverse(M) must be the identity.
+        const Mat4 matrix(
+          // clang-format off
+             0.5f, -1.25f,  3.0f,  0.75f,
+             2.5f,  0.1f,  -0.3f,  4.0f,
+            -1.0f,  0.2f,   1.5f, -2.25f,
+             0.0f,  0.0f,   0.0f,  1.0f
+          // clang-format on
+        );
+        const Mat4 identity1 = matrix * matrix.inverse();
+        const Mat4 identity2 = matrix.inverse() * matrix;
+        for (unsigned row = 0; row < 4; row++) {
+            for (unsigned col = 0; col < 4; col++) {
+                EXPECT_NEAR(identity1(row, col), Mat4::kIdentity(row, col), 1e-5f);
+                EXPECT_NEAR(identity2(row, col), Mat4::kIdentity(row, col), 1e-5f);
+            }
+        }
+    }
 }
 
 TEST(Mat4, transpose) {
@@ -687,3 +717,61 @@ TEST(Mat4, CreateProjectionPerspectiveFOVY) {
     /// @todo Test CreateProjectionPerspectiveFOVY
     ///
 }
+
+TEST(Mat4d, traits) {
+    static_assert(sizeof(Mat4d) == 16 * sizeof(double));
+    static_assert(std::is_trivially_copyable_v<Mat4d>);
+    static_assert(Mat4d::kIdentity(0, 0) == 1.0);
+    static_assert(Mat4d::kIdentity(3, 2) == 0.0);
+}
+
+TEST(Mat4d, mul_by_vec4) {
+    const Mat4d matrix(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    EXPECT_EQ(matrix * Vec4d(10, 20, 30, 40), Vec4d(300, 700, 1100, 1500));
+    EXPECT_EQ(Vec4d(10, 20, 30, 40) * matrix, Vec4d(900, 1000, 1100, 1200));
+}
+
+TEST(Mat4d, mul_by_mat4) {
+    const Mat4d matrix1(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    const Mat4d matrix2(3, 4, 7, 1, 9, 12, 2, 7, 8, 5, 6, 13, 15, 22, 26, 4);
+    const Mat4d expected(
+      // clang-format off
+        105, 131, 133,  70,
+        245, 303, 297, 170,
+        385, 475, 461, 270,
+        525, 647, 625, 370
+      // clang-format on
+    );
+    EXPECT_EQ(matrix1 * matrix2, expected);
+
+    Mat4d m(matrix1);
+    m *= m;
+    EXPECT_EQ(m, Mat4d(90, 100, 110, 120, 202, 228, 254, 280, 314, 356, 398, 440, 426, 484, 542, 600));
+}
+
+TEST(Mat4d, inverse) {
+    const Mat4d matrix(2, 2, 3, 4, 5, 6, 7, 8, 9, 3, 11, 12, 13, 14, 15, 16);
+    const Mat4d inverse =
+      Mat4d(56, -84, 0, 28, 0, 4, -8, 4, -168, 132, 16, -36, 112, -59, -8, 11) * (1 / 56.0);
+    EXPECT_EQ(matrix.determinant(), -56.0);
+    for (unsigned row = 0; row < 4; row++) {
+        for (unsigned col = 0; col < 4; col++) {
+            EXPECT_DOUBLE_EQ(matrix.inverse()(row, col), inverse(row, col));
+        }
+    }
+}
+
+TEST(Mat4d, precision) {
+    // A transform far from the origin, float can not represent the translation exactly.
+    const Vec3d translation(1.0e8 + 0.125, -2.0e8 + 0.25, 3.0e7 + 0.5);
+    const Mat4d model =
+      Mat4d::CreateTranslation(translation) * Mat4d::CreateRotationY(degrees(30));
+    const Mat4d identity = model * model.inverse();
+    for (unsigned row = 0; row < 4; row++) {
+        for (unsigned col = 0; col < 4; col++) {
+            EXPECT_NEAR(identity(row, col), Mat4d::kIdentity(row, col), 1e-6);
+        }
+    }
+    const Vec4d origin = model * Vec4d(0, 0, 0, 1);
+    EXPECT_EQ(origin, Vec4d(translation.x, translation.y, translation.z, 1));
+}
@@ -0,0 +1,111 @@
+#include <fuse/MemoryTracker.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace fuse;
+
+// The counters are global: the tests compare them before and after, with tags the library
+// does not use itself.
+
+TEST(MemoryTracker, toString) {
+    EXPECT_EQ("General", toString(MemTag::General));
+    EXPECT_EQ("Geometry", toString(MemTag::Geometry));
+    EXPECT_EQ("Profiler", toString(MemTag::Profiler));
+}
+
+TEST(MemoryTracker, liveAndPeak) {
+    const MemTagStats before = memoryStats(MemTag::Texture);
+    trackAllocation(MemTag::Texture, 1000);
+    trackAllocation(MemTag::Texture, 500);
+    trackDeallocation(MemTag::Texture, 1000);
+
+    const MemTagStats after = memoryStats(MemTag::Texture);
+    EXPECT_EQ(MemTag::Texture, after.tag);
+    EXPECT_EQ(before.liveBytes + 500, after.liveBytes);
+    EXPECT_GE(after.peakBytes, before.liveBytes + 1500);
+    EXPECT_EQ(before.allocations + 2, after.allocations);
+    trackDeallocation(MemTag::Texture, 500);
+    EXPECT_EQ(before.liveBytes, memoryStats(MemTag::Texture).liveBytes);
+}
+
+TEST(MemoryTracker, frameAllocations) {
+    markMemoryFrame();
+    for (int i = 0; i < 3; i++) {
+        trackAllocation(MemTag::General, 8);
+    }
+    markMemoryFrame();
+    EXPECT_EQ(3u, memoryStats(MemTag::General).lastFrameAllocations);
+    markMemoryFrame();
+    EXPECT_EQ(0u, memoryStats(MemTag::General).lastFrameAllocations);
+    trackDeallocation(MemTag::General, 3 * 8);
+}
+
+TEST(MemoryTracker, trackedVector) {
+    const std::size_t before = memoryStats(MemTag::Geometry).liveBytes;
+    {
+        TrackedVector<int, MemTag::Geometry> values(100);
+        EXPECT_EQ(before + 100 * sizeof(int), memoryStats(MemTag::Geometry).liveBytes);
+        values.reserve(1000);
+        EXPECT_EQ(before + 1000 * sizeof(int), memoryStats(MemTag::Geometry).liveBytes);
+
+        // Rebound by the node containers.
+        std::vector<std::string, TrackedAllocator<std::string, MemTag::Geometry>> strings;
+        strings.emplace_back("tracked");
+        EXPECT_GT(memoryStats(MemTag::Geometry).liveBytes, before + 1000 * sizeof(int));
+    }
+    EXPECT_EQ(before, memoryStats(MemTag::Geometry).liveBytes);
+}
+
+TEST(MemoryTracker, trackedMemory) {
+    const std::size_t before = memoryStats(MemTag::Texture).liveBytes;
+    {
+        TrackedMemory memory(MemTag::Texture, 4096);
+        EXPECT_EQ(before + 4096, memoryStats(MemTag::Texture).liveBytes);
+
+        TrackedMemory moved = std::move(memory);
+        EXPECT_EQ(0u, memory.bytes());
+        EXPECT_EQ(4096u, moved.bytes());
+        EXPECT_EQ(before + 4096, memoryStats(MemTag::Texture).liveBytes);
+
+        moved = TrackedMemory(MemTag::Texture, 100);
+        EXPECT_EQ(before + 100, memoryStats(MemTag::Texture).liveBytes);
+    }
+    EXPECT_EQ(before, memoryStats(MemTag::Texture).liveBytes);
+}
+
+TEST(MemoryTracker, threads) {
+    const MemTagStats before = memoryStats(MemTag::Texture);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 10000; i++) {
+                trackAllocation(MemTag::Texture, 16);
+                trackDeallocation(MemTag::Texture, 16);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const MemTagStats after = memoryStats(MemTag::Texture);
+    EXPECT_EQ(before.liveBytes, after.liveBytes);
+    EXPECT_EQ(before.allocations + 40000, after.allocations);
+    // At most 1 allocation of each thread alive at a time.
+    EXPECT_LE(after.peakBytes, std::max(before.peakBytes, before.liveBytes + 4 * 16));
+}
+
+TEST(MemoryTracker, report) {
+    TrackedMemory     memory(MemTag::Texture, 3 * 1024 * 1024 / 2);
+    const std::string report = memoryReport();
+    EXPECT_TRUE(report.starts_with("Tag"));
+    for (std::size_t i = 0; i < kMemTagCount; i++) {
+        EXPECT_NE(std::string::npos, report.find(toString(static_cast<MemTag>(i))));
+    }
+    EXPECT_NE(std::string::npos, report.find("MiB"));
+}
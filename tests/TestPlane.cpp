@@ -0,0 +1,40 @@
+#include "GTestUtils.h"
+
+#include <fuse/math/Plane.h>
+#include <fuse/math/Vec3.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace fuse;
+
+TEST(Plane, traits) {
+    static_assert(std::is_trivially_copyable_v<Plane>);
+    static_assert(sizeof(Plane) == 4 * sizeof(float));
+}
+
+TEST(Plane, constructors) {
+    constexpr Plane a({0.f, 1.f, 0.f}, -2.f);
+    static_assert(a.normal == Vec3(0.f, 1.f, 0.f));
+    static_assert(a.d == -2.f);
+
+    constexpr Plane b({0.f, 1.f, 0.f}, Vec3(5.f, 2.f, -3.f));
+    static_assert(a == b);
+}
+
+TEST(Plane, distance) {
+    constexpr Plane plane({0.f, 0.f, 1.f}, Vec3(0.f, 0.f, 3.f));
+    static_assert(plane.distance({0.f, 0.f, 3.f}) == 0.f);
+    static_assert(plane.distance({1.f, 2.f, 5.f}) == 2.f);
+    static_assert(plane.distance({1.f, 2.f, -1.f}) == -4.f);
+}
+
+TEST(Plane, normalize) {
+    const Plane plane = Plane({0.f, 3.f, 4.f}, 10.f).normalize();
+    EXPECT_VEC3_NEAR(Vec3(0.f, 0.6f, 0.8f), plane.normal);
+    EXPECT_FLOAT_EQ(2.f, plane.d);
+
+    // The normalized plane gives the Euclidean distance.
+    EXPECT_FLOAT_EQ(-2.f, plane.distance(-plane.normal * 4.f));
+}
@@ -0,0 +1,206 @@
+#include <fuse/Profiler.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <latch>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+class Profiler : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!FUSE_PROFILER_ENABLE) {
+            GTEST_SKIP() << "The profiler scopes are compiled out, FUSE_PROFILER is OFF.";
+        }
+        setProfilerEnabled(true);
+    }
+
+    void TearDown() override { setProfilerEnabled(true); }
+
+    /// @brief Return the scopes of the calling thread recorded since the start of the test.
+    std::vector<ProfileEvent> ownEvents() const {
+        const std::uint32_t thread = detail::profileThreadBuffer().thread();
+        auto                events = collectProfileEvents(mStart, profilerTicks());
+        std::erase_if(events, [&](const ProfileEvent& event) {
+            return event.thread != thread || event.begin < mStart;
+        });
+        return events;
+    }
+
+    std::uint64_t mStart = profilerTicks();
+};
+
+void nested() {
+    FUSE_PROFILE_SCOPE("Outer");
+    {
+        FUSE_PROFILE_SCOPE("Inner");
+        FUSE_PROFILE_SCOPE("Innermost");
+    }
+    FUSE_PROFILE_SCOPE("Second");
+}
+
+} // namespace
+
+TEST_F(Profiler, nestedScopes) {
+    nested();
+    const auto events = ownEvents();
+
+    // Sorted by start, a scope contains the scopes with a greater depth after it.
+    ASSERT_EQ(4u, events.size());
+    EXPECT_STREQ("Outer", events[0].name);
+    EXPECT_EQ(0u, events[0].depth);
+    EXPECT_STREQ("Inner", events[1].name);
+    EXPECT_EQ(1u, events[1].depth);
+    EXPECT_STREQ("Innermost", events[2].name);
+    EXPECT_EQ(2u, events[2].depth);
+    EXPECT_STREQ("Second", events[3].name);
+    EXPECT_EQ(1u, events[3].depth);
+    for (const auto& event : events) {
+        EXPECT_LE(event.begin, event.end);
+    }
+    EXPECT_LE(events[0].begin, events[1].begin);
+    EXPECT_LE(events[2].end, events[1].end);
+    EXPECT_LE(events[1].end, events[3].begin);
+    EXPECT_LE(events[3].end, events[0].end);
+}
+
+TEST_F(Profiler, disabledAtRuntime) {
+    setProfilerEnabled(false);
+    EXPECT_FALSE(isProfilerEnabled());
+    nested();
+    setProfilerEnabled(true);
+    EXPECT_TRUE(ownEvents().empty());
+}
+
+TEST_F(Profiler, overwritesOldestScopes) {
+    const std::size_t count = detail::ProfileThreadBuffer::kCapacity + 100;
+    for (std::size_t i = 0; i < count; i++) {
+        FUSE_PROFILE_SCOPE("Loop");
+    }
+    const auto events = ownEvents();
+    EXPECT_EQ(detail::ProfileThreadBuffer::kCapacity, events.size());
+}
+
+TEST_F(Profiler, threads) {
+    constexpr int kThreads = 4;
+    constexpr int kScopes  = 1000;
+
+    // The threads exit together, the buffer of an exited thread would be given to the next.
+    std::latch               done(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&done] {
+            FUSE_PROFILE_THREAD("ProfilerTestThread");
+            for (int i = 0; i < kScopes; i++) {
+                FUSE_PROFILE_SCOPE("ThreadScope");
+            }
+            done.arrive_and_wait();
+        });
+    }
+    // Read while the threads record.
+    while (collectProfileEvents(mStart, profilerTicks()).empty()) {
+        std::this_thread::yield();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // The buffers are kept after the threads exit.
+    auto events = collectProfileEvents(mStart, profilerTicks());
+    std::erase_if(events, [](const ProfileEvent& event) {
+        return std::string_view(event.name) != "ThreadScope";
+    });
+    ASSERT_EQ(static_cast<std::size_t>(kThreads * kScopes), events.size());
+    EXPECT_TRUE(std::ranges::is_sorted(events, {}, &ProfileEvent::thread));
+    std::vector<std::uint32_t> ids;
+    for (const auto& event : events) {
+        ids.push_back(event.thread);
+    }
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    EXPECT_EQ(static_cast<std::size_t>(kThreads), ids.size());
+    for (const auto id : ids) {
+        EXPECT_EQ("ProfilerTestThread", profileThreadName(id));
+    }
+}
+
+TEST_F(Profiler, threadName) {
+    const std::uint32_t thread = detail::profileThreadBuffer().thread();
+    setProfileThreadName("ProfilerTestMain");
+    EXPECT_EQ("ProfilerTestMain", profileThreadName(thread));
+    EXPECT_EQ("Thread 100000", profileThreadName(100000));
+}
+
+TEST_F(Profiler, frames) {
+    markProfileFrame();
+    nested();
+    markProfileFrame();
+    nested();
+    markProfileFrame();
+
+    const auto frames = profileFrames();
+    ASSERT_GE(frames.size(), 2u);
+    const auto& first = frames[frames.size() - 2];
+    const auto& last  = frames.back();
+    EXPECT_EQ(first.index + 1, last.index);
+    EXPECT_EQ(first.end, last.begin);
+    EXPECT_LE(first.begin, first.end);
+    EXPECT_LE(last.begin, last.end);
+
+    // Each frame contains its scopes.
+    const auto inFirst = collectProfileEvents(first.begin, first.end);
+    EXPECT_TRUE(std::ranges::any_of(inFirst, [&](const ProfileEvent& event) {
+        return std::string_view(event.name) == "Outer" && event.begin >= first.begin &&
+               event.end <= first.end;
+    }));
+}
+
+TEST_F(Profiler, secondsPerTick) {
+    const double secondsPerTick = profilerSecondsPerTick();
+    EXPECT_GT(secondsPerTick, 0.0);
+    // Between 10 MHz and 100 GHz.
+    EXPECT_LT(secondsPerTick, 1e-7);
+    EXPECT_GT(secondsPerTick, 1e-11);
+
+    const std::uint64_t begin = profilerTicks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const double elapsed = static_cast<double>(profilerTicks() - begin) * secondsPerTick;
+    EXPECT_GT(elapsed, 0.015);
+    EXPECT_LT(elapsed, 1.0);
+}
+
+TEST_F(Profiler, chromeTrace) {
+    setProfileThreadName("Test \"main\"");
+    markProfileFrame();
+    nested();
+    markProfileFrame();
+    const auto frame = profileFrames().back();
+
+    const auto path = std::filesystem::temp_directory_path() / "FuseTestProfiler.json";
+    ASSERT_TRUE(exportChromeTrace(path, frame, frame));
+    std::stringstream content;
+    content << std::ifstream(path).rdbuf();
+    std::filesystem::remove(path);
+    const std::string json = content.str();
+
+    EXPECT_TRUE(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_TRUE(json.ends_with("]}\n"));
+    EXPECT_EQ(std::string::npos, json.find(",\n]"));
+    EXPECT_NE(std::string::npos, json.find(std::format("\"name\":\"Frame {}\"", frame.index)));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Outer\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Innermost\""));
+    EXPECT_NE(std::string::npos, json.find("\"args\":{\"name\":\"Test \\\"main\\\"\"}"));
+
+    EXPECT_FALSE(exportChromeTrace(path / "missing" / "trace.json", frame, frame));
+}
@@ -436,6 +436,65 @@ TEST(Quaternion, MakeRotationZ) {
     EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(360)), Quaternion(0, 0, 0, -1));
 }
 
+TEST(Quaternion, nlerp) {
+    const auto a = Quaternion::MakeRotationY(degrees(10));
+    const auto b = Quaternion::MakeRotationY(degrees(70));
+    EXPECT_QUAT_NEAR(a, nlerp(a, b, 0.f));
+    EXPECT_QUAT_NEAR(b, nlerp(a, b, 1.f));
+    // Symmetric around the middle, the middle is exact.
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationY(degrees(40)), nlerp(a, b, 0.5f));
+    EXPECT_NEAR(1.f, nlerp(a, b, 0.3f).length(), 1e-6f);
+
+    // -b is the same rotation as b, the shortest path is taken.
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationY(degrees(40)), nlerp(a, -1.f * b, 0.5f));
+}
+
+TEST(Quaternion, slerp) {
+    const auto a = Quaternion::MakeRotationZ(degrees(0));
+    const auto b = Quaternion::MakeRotationZ(degrees(120));
+    EXPECT_QUAT_NEAR(a, slerp(a, b, 0.f));
+    EXPECT_QUAT_NEAR(b, slerp(a, b, 1.f));
+    // Constant angular velocity.
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(30)), slerp(a, b, 0.25f));
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(60)), slerp(a, b, 0.5f));
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(90)), slerp(a, b, 0.75f));
+
+    // Almost the same rotation.
+    const auto c = Quaternion::MakeRotationZ(degrees(0.01f));
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(0.005f)), slerp(a, c, 0.5f));
+
+    // The arc is taken as is: -b is 120 degrees reached the long way, -240 degrees.
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationZ(degrees(-120)), slerp(a, -1.f * b, 0.5f));
+}
+
+TEST(Quaternion, slerpShortestPath) {
+    const auto a = Quaternion::MakeRotationX(degrees(20));
+    const auto b = Quaternion::MakeRotationX(degrees(100));
+    EXPECT_QUAT_NEAR(slerp(a, b, 0.3f), slerpShortestPath(a, b, 0.3f));
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationX(degrees(60)), slerpShortestPath(a, -1.f * b, 0.5f));
+
+    // 340 degrees is -20 degrees, the shortest path from 20 goes through 0.
+    const auto c = Quaternion::MakeRotationX(degrees(340));
+    EXPECT_QUAT_NEAR(Quaternion::MakeRotationX(degrees(0)), slerpShortestPath(a, c, 0.5f));
+}
+
 TEST(Quaternion, std_format) {
     ASSERT_EQ(std::format("{}", Quaternion(1, 2, 3, 4)), "[1, 2, 3, 4]");
 }
+
+TEST(Quaterniond, rotation) {
+    const auto a        = Quaterniond::MakeRotationZ(degrees(0));
+    const auto b        = Quaterniond::MakeRotationZ(degrees(120));
+    const auto q        = slerp(a, b, 0.5);
+    const auto expected = Quaterniond::MakeRotationZ(degrees(60));
+    EXPECT_NEAR(q.x, expected.x, 1e-7);
+    EXPECT_NEAR(q.y, expected.y, 1e-7);
+    EXPECT_NEAR(q.z, expected.z, 1e-7);
+    EXPECT_NEAR(q.w, expected.w, 1e-7);
+
+    const Vec3d v = q * Vec3d::kUnitX;
+    EXPECT_NEAR(v.x, 0.5, 1e-7);
+    EXPECT_NEAR(v.y, std::sqrt(3.0) / 2, 1e-7);
+    EXPECT_NEAR(v.z, 0.0, 1e-7);
+    EXPECT_EQ(std::format("{}", Quaterniond(1, 2, 3, 4)), "[1, 2, 3, 4]");
+}
@@ -0,0 +1,141 @@
+#include "GTestUtils.h"
+
+#include <fuse/math/Angle.h>
+#include <fuse/math/Quaternion.h>
+#include <fuse/math/QuaternionBatch.h>
+#include <fuse/math/Vec3.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace fuse;
+
+namespace {
+
+/// @brief Maximum difference with the single value functions.
+constexpr float kTolerance = 1e-6f;
+
+::testing::AssertionResult AssertBatchNear(const char* expr1, const char* expr2,
+                                           const Quaternion& expected, const Quaternion& actual) {
+    return AssertQuaternionNear(expr1, expr2, expected, actual, kTolerance);
+}
+
+std::vector<Quaternion> makeRotations(std::size_t count, unsigned seed) {
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<Quaternion>               rotations(count);
+    for (auto& q : rotations) {
+        q = Quaternion(dist(rng), dist(rng), dist(rng), dist(rng)).normalize();
+    }
+    return rotations;
+}
+
+std::vector<float> makeFactors(std::size_t count) {
+    std::vector<float> factors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        factors[i] = static_cast<float>(i % 11) / 10.f;
+    }
+    return factors;
+}
+
+} // namespace
+
+TEST(QuaternionBatch, interpolate) {
+    // Every size up to 3 full AVX2 blocks, to cover all the tails.
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto a = makeRotations(count, 1);
+        const auto b = makeRotations(count, 2);
+        const auto t = makeFactors(count);
+
+        std::vector<Quaternion> result(count);
+        nlerp(a, b, t, result);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_PRED_FORMAT2(AssertBatchNear, nlerp(a[i], b[i], t[i]), result[i]);
+        }
+
+        slerp(a, b, t, result);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_PRED_FORMAT2(AssertBatchNear, slerp(a[i], b[i], t[i]), result[i]);
+        }
+
+        slerpShortestPath(a, b, t, result);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_PRED_FORMAT2(AssertBatchNear, slerpShortestPath(a[i], b[i], t[i]),
+                                result[i]);
+        }
+    }
+}
+
+TEST(QuaternionBatch, slerp_accuracy) {
+    // Every angle between the rotations, in both hemispheres, and many factors.
+    // Near 360 degrees b is almost -a, slerp() is ill-conditioned and the reference is not
+    // accurate enough.
+    const auto a = Quaternion::MakeRotationY(degrees(15));
+    for (int angle = -300; angle <= 300; angle++) {
+        const auto b = Quaternion::MakeRotationY(degrees(15.f + static_cast<float>(angle)));
+        std::vector<Quaternion> as(21, a);
+        std::vector<Quaternion> bs(21, b);
+        std::vector<float>      t(21);
+        for (std::size_t i = 0; i < t.size(); i++) {
+            t[i] = static_cast<float>(i) / 20.f;
+        }
+
+        std::vector<Quaternion> result(t.size());
+        slerp(as, bs, t, result);
+        for (std::size_t i = 0; i < t.size(); i++) {
+            ASSERT_PRED_FORMAT2(AssertBatchNear, slerp(a, b, t[i]), result[i])
+              << "angle " << angle << " t " << t[i];
+        }
+        slerpShortestPath(as, bs, t, result);
+        for (std::size_t i = 0; i < t.size(); i++) {
+            ASSERT_PRED_FORMAT2(AssertBatchNear, slerpShortestPath(a, b, t[i]), result[i])
+              << "angle " << angle << " t " << t[i];
+        }
+    }
+}
+
+TEST(QuaternionBatch, in_place) {
+    const auto a = makeRotations(13, 3);
+    const auto b = makeRotations(13, 4);
+    const auto t = makeFactors(13);
+
+    auto result = a;
+    slerpShortestPath(result, b, t, result);
+    for (std::size_t i = 0; i < a.size(); i++) {
+        EXPECT_PRED_FORMAT2(AssertBatchNear, slerpShortestPath(a[i], b[i], t[i]),
+                            result[i]);
+    }
+}
+
+TEST(QuaternionBatch, toMatrices) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto q = makeRotations(count, 5);
+
+        std::vector<Mat3> mat3(count);
+        toMatrices(q, mat3);
+        std::vector<Mat4> mat4(count);
+        toMatrices(q, mat4);
+        for (std::size_t i = 0; i < count; i++) {
+            const auto expected = q[i].asMatrix();
+            for (unsigned row = 0; row < 3; row++) {
+                for (unsigned col = 0; col < 3; col++) {
+                    EXPECT_NEAR(expected(row, col), mat3[i](row, col), kTolerance);
+                    EXPECT_NEAR(expected(row, col), mat4[i](row, col), kTolerance);
+                }
+                EXPECT_EQ(0.f, mat4[i](row, 3));
+                EXPECT_EQ(0.f, mat4[i](3, row));
+            }
+            EXPECT_EQ(1.f, mat4[i](3, 3));
+        }
+    }
+}
+
+TEST(QuaternionBatch, toMatrices_does_not_overflow) {
+    // The last matrix must not write past the end of the output.
+    const auto        q = makeRotations(9, 6);
+    std::vector<Mat3> mat3(10, Mat3::kZero);
+    toMatrices(q, std::span(mat3).first(9));
+    EXPECT_EQ(Mat3::kZero, mat3[9]);
+}
@@ -522,3 +522,14 @@ TEST(Vec3, ptr) {
 }
 
 TEST(Vec3, std_format) { ASSERT_EQ(std::format("{}", Vec3(1, 2, 3)), "[1, 2, 3]"); }
+
+TEST(Vec3d, operations) {
+    static_assert(sizeof(Vec3d) == 3 * sizeof(double));
+    static_assert(Vec3d::kUnitX.cross(Vec3d::kUnitY) == Vec3d::kUnitZ);
+
+    const Vec3d v(1.0e8, 0.5, -0.25);
+    EXPECT_EQ(v + Vec3d(1, 1, 1), Vec3d(1.0e8 + 1, 1.5, 0.75));
+    EXPECT_EQ(2.0 * v, Vec3d(2.0e8, 1.0, -0.5));
+    EXPECT_DOUBLE_EQ(Vec3d(3, 4, 0).length(), 5.0);
+    EXPECT_EQ(std::format("{}", Vec3d(1, 2, 3)), "[1, 2, 3]");
+}
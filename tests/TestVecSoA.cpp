@@ -0,0 +1,201 @@
+#include "GTestUtils.h"
+
+#include <fuse/math/Vec3.h>
+#include <fuse/math/Vec4.h>
+#include <fuse/math/VecSoA.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace fuse;
+using namespace testing;
+
+namespace {
+
+std::vector<Vec3> makeVec3(std::size_t count, float offset = 0.f) {
+    std::vector<Vec3> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i) + offset;
+        vectors[i]   = Vec3(f + 1.f, -2.f * f, 3.f - f);
+    }
+    return vectors;
+}
+
+std::vector<Vec4> makeVec4(std::size_t count, float offset = 0.f) {
+    std::vector<Vec4> vectors(count);
+    for (std::size_t i = 0; i < count; i++) {
+        const auto f = static_cast<float>(i) + offset;
+        vectors[i]   = Vec4(f + 1.f, -2.f * f, 3.f - f, 0.5f * f);
+    }
+    return vectors;
+}
+
+bool isAligned(const float* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % VecSoA<3>::kAlignment == 0;
+}
+
+} // namespace
+
+TEST(VecSoA, default_constructor) {
+    const Vec3SoA v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(0u, v.size());
+    EXPECT_EQ(0u, v.capacity());
+}
+
+TEST(VecSoA, resize) {
+    Vec3SoA v(3);
+    EXPECT_EQ(3u, v.size());
+    EXPECT_EQ(Vec3::kZero, v.get(0));
+    EXPECT_EQ(Vec3::kZero, v.get(2));
+
+    v.set(1, Vec3(1.f, 2.f, 3.f));
+    v.resize(100);
+    EXPECT_EQ(100u, v.size());
+    EXPECT_EQ(Vec3(1.f, 2.f, 3.f), v.get(1));
+    EXPECT_EQ(Vec3::kZero, v.get(99));
+    EXPECT_TRUE(isAligned(v.x().data()));
+    EXPECT_TRUE(isAligned(v.y().data()));
+    EXPECT_TRUE(isAligned(v.z().data()));
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_GE(v.capacity(), 100u);
+}
+
+TEST(VecSoA, copy_and_move) {
+    const Vec3SoA a(makeVec3(13));
+    Vec3SoA       b(a);
+    EXPECT_EQ(a.toVector(), b.toVector());
+
+    Vec3SoA c;
+    c = b;
+    EXPECT_EQ(a.toVector(), c.toVector());
+
+    Vec3SoA d(std::move(b));
+    EXPECT_EQ(a.toVector(), d.toVector());
+    EXPECT_TRUE(b.empty());
+
+    c = std::move(d);
+    EXPECT_EQ(a.toVector(), c.toVector());
+}
+
+TEST(VecSoA, gather_scatter) {
+    // Every size up to 3 full AVX2 blocks, to cover all the tails.
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto    vectors = makeVec3(count);
+        const Vec3SoA soa(vectors);
+        ASSERT_EQ(count, soa.size());
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(vectors[i].x, soa.x()[i]);
+            EXPECT_EQ(vectors[i].y, soa.y()[i]);
+            EXPECT_EQ(vectors[i].z, soa.z()[i]);
+        }
+        EXPECT_EQ(vectors, soa.toVector());
+
+        const auto    vectors4 = makeVec4(count);
+        const Vec4SoA soa4(vectors4);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(vectors4[i], soa4.get(i));
+        }
+        EXPECT_EQ(vectors4, soa4.toVector());
+    }
+}
+
+TEST(VecSoA, add_mulAdd) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto a = makeVec3(count);
+        const auto b = makeVec3(count, 10.f);
+
+        Vec3SoA out;
+        add(Vec3SoA(a), Vec3SoA(b), out);
+        ASSERT_EQ(count, out.size());
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(a[i] + b[i], out.get(i));
+        }
+
+        // In place, like a particle integration.
+        Vec3SoA positions(b);
+        mulAdd(Vec3SoA(a), 0.5f, positions, positions);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(a[i] * 0.5f + b[i], positions.get(i));
+        }
+    }
+
+    const auto a4 = makeVec4(11);
+    const auto b4 = makeVec4(11, 3.f);
+    Vec4SoA    out4;
+    add(Vec4SoA(a4), Vec4SoA(b4), out4);
+    mulAdd(Vec4SoA(a4), 2.f, out4, out4);
+    for (std::size_t i = 0; i < a4.size(); i++) {
+        EXPECT_EQ(a4[i] * 2.f + (a4[i] + b4[i]), out4.get(i));
+    }
+}
+
+TEST(VecSoA, dot_length) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto    a = makeVec3(count);
+        const auto    b = makeVec3(count, 5.f);
+        const Vec3SoA sa(a);
+
+        std::vector<float> dots(count);
+        dot(sa, Vec3SoA(b), dots);
+        std::vector<float> lengths(count);
+        length(sa, lengths);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_FLOAT_EQ(a[i].dot(b[i]), dots[i]);
+            EXPECT_FLOAT_EQ(a[i].length(), lengths[i]);
+        }
+    }
+
+    const auto         a4 = makeVec4(9);
+    const Vec4SoA      sa4(a4);
+    std::vector<float> dots(a4.size());
+    dot(sa4, sa4, dots);
+    std::vector<float> lengths(a4.size());
+    length(sa4, lengths);
+    for (std::size_t i = 0; i < a4.size(); i++) {
+        EXPECT_FLOAT_EQ(a4[i].dot(a4[i]), dots[i]);
+        EXPECT_FLOAT_EQ(a4[i].length(), lengths[i]);
+    }
+}
+
+TEST(VecSoA, cross) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto a = makeVec3(count);
+        const auto b = makeVec3(count, 7.f);
+
+        Vec3SoA out;
+        cross(Vec3SoA(a), Vec3SoA(b), out);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(a[i].cross(b[i]), out.get(i));
+        }
+    }
+}
+
+TEST(VecSoA, normalize) {
+    for (std::size_t count = 0; count <= 25; count++) {
+        const auto a = makeVec3(count);
+
+        Vec3SoA out(a);
+        normalize(out, out);
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_VEC3_NEAR(a[i].normalize(), out.get(i));
+        }
+    }
+
+    const auto a4 = makeVec4(9);
+    Vec4SoA    out4;
+    normalize(Vec4SoA(a4), out4);
+    for (std::size_t i = 0; i < a4.size(); i++) {
+        const auto expected = a4[i].normalize();
+        const auto actual   = out4.get(i);
+        EXPECT_NEAR(expected.x, actual.x, 1e-6f);
+        EXPECT_NEAR(expected.y, actual.y, 1e-6f);
+        EXPECT_NEAR(expected.z, actual.z, 1e-6f);
+        EXPECT_NEAR(expected.w, actual.w, 1e-6f);
+    }
+}